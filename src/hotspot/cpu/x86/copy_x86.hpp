@@ -31,6 +31,19 @@ static void pd_fill_to_words(HeapWord* tohw, size_t count, juint value) {
 #ifdef AMD64
   julong* to = (julong*) tohw;
   julong  v  = ((julong) value << 32) | value;
+#ifndef _WINDOWS
+  // Very large fills bypass the caches, so that clearing a huge array does
+  // not evict the working set of the other threads sharing the cache.
+  if (NonTemporalFillThreshold != 0 && count * HeapWordSize >= NonTemporalFillThreshold) {
+    while (count-- > 0) {
+      __asm__ volatile("movnti %1, %0" : "=m" (*to) : "r" (v));
+      to++;
+    }
+    // order the weakly ordered stores before the object is published
+    __asm__ volatile("sfence" : : : "memory");
+    return;
+  }
+#endif // !_WINDOWS
   while (count-- > 0) {
     *to++ = v;
   }
@@ -144,6 +144,10 @@ define_pd_global(intx, InitArrayShortSize, 8*BytesPerLong);
   product(bool, UseFastStosb, false,                                        \
           "Use fast-string operation for zeroing: rep stosb")               \
                                                                             \
+  product(size_t, NonTemporalFillThreshold, 64*M, DIAGNOSTIC,               \
+          "Minimum size in bytes of a runtime fill, such as clearing a "    \
+          "large array, to use non-temporal stores. 0 disables them.")      \
+                                                                            \
   /* assembler */                                                           \
   product(bool, UseCountLeadingZerosInstruction, false,                     \
           "Use count leading zeros instruction")                            \
@@ -872,6 +872,10 @@ jlong CgroupSubsystem::cache_usage_in_bytes() {
   return memory_controller()->controller()->cache_usage_in_bytes();
 }
 
+jlong CgroupSubsystem::memory_pressure() {
+  return memory_controller()->controller()->memory_pressure();
+}
+
 int CgroupSubsystem::cpu_quota() {
   return cpu_controller()->controller()->cpu_quota();
 }
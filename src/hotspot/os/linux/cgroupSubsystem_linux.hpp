@@ -227,6 +227,7 @@ class CgroupMemoryController: public CHeapObj<mtInternal> {
     virtual jlong memory_max_usage_in_bytes() = 0;
     virtual jlong rss_usage_in_bytes() = 0;
     virtual jlong cache_usage_in_bytes() = 0;
+    virtual jlong memory_pressure() = 0;
     virtual void print_version_specific_info(outputStream* st, julong host_mem) = 0;
     virtual bool needs_hierarchy_adjustment() = 0;
     virtual bool is_read_only() = 0;
@@ -262,6 +263,7 @@ class CgroupSubsystem: public CHeapObj<mtInternal> {
     jlong memory_max_usage_in_bytes();
     jlong rss_usage_in_bytes();
     jlong cache_usage_in_bytes();
+    jlong memory_pressure();
     void print_version_specific_info(outputStream* st);
 };
 
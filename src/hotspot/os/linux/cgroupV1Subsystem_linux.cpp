@@ -323,6 +323,11 @@ jlong CgroupV1MemoryController::cache_usage_in_bytes() {
   return cache;
 }
 
+// Pressure stall information is only available for cgroups v2
+jlong CgroupV1MemoryController::memory_pressure() {
+  return OSCONTAINER_ERROR;
+}
+
 jlong CgroupV1MemoryController::kernel_memory_usage_in_bytes() {
   julong kmem_usage;
   CONTAINER_READ_NUMBER_CHECKED(reader(), "/memory.kmem.usage_in_bytes", "Kernel Memory Usage", kmem_usage);
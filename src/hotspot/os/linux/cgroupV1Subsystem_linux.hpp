@@ -85,6 +85,7 @@ class CgroupV1MemoryController final : public CgroupMemoryController {
     jlong memory_max_usage_in_bytes() override;
     jlong rss_usage_in_bytes() override;
     jlong cache_usage_in_bytes() override;
+    jlong memory_pressure() override;
     jlong kernel_memory_usage_in_bytes();
     jlong kernel_memory_limit_in_bytes(julong host_mem);
     jlong kernel_memory_max_usage_in_bytes();
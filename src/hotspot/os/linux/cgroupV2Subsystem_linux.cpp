@@ -199,6 +199,32 @@ jlong CgroupV2MemoryController::cache_usage_in_bytes() {
   return (jlong)cache;
 }
 
+/* memory_pressure
+ *
+ * Return the share of the last 10 seconds in which at least one task of
+ * this cgroup was stalled on memory, as reported by the "some avg10" field
+ * of memory.pressure.
+ *
+ * return:
+ *    pressure in hundredths of a percent (0 - 10000) or
+ *    OSCONTAINER_ERROR for not supported
+ */
+jlong CgroupV2MemoryController::memory_pressure() {
+  char line[1024];
+  bool is_ok = reader()->read_string("/memory.pressure", line, sizeof(line));
+  if (!is_ok) {
+    return OSCONTAINER_ERROR;
+  }
+  double avg10;
+  if (sscanf(line, "some avg10=%lf", &avg10) != 1 || avg10 < 0.0) {
+    log_trace(os, container)("Memory Pressure failed to parse: %s", line);
+    return OSCONTAINER_ERROR;
+  }
+  const jlong pressure = (jlong)(avg10 * 100.0 + 0.5);
+  log_trace(os, container)("Memory Pressure is: " JLONG_FORMAT, pressure);
+  return pressure;
+}
+
 // Note that for cgroups v2 the actual limits set for swap and
 // memory live in two different files, memory.swap.max and memory.max
 // respectively. In order to properly report a cgroup v1 like
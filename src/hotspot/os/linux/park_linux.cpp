@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "runtime/atomic.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/javaThread.hpp"
+#include "runtime/os.hpp"
+#include "runtime/osThread.hpp"
+#include "runtime/park.hpp"
+#include "utilities/debug.hpp"
+
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <time.h>
+
+// 32-bit RISC-V has no SYS_futex syscall.
+#ifdef RISCV32
+  #if !defined(SYS_futex) && defined(SYS_futex_time64)
+    #define SYS_futex SYS_futex_time64
+  #endif
+#endif
+
+// Spinning before blocking is only worthwhile if the unpark usually comes
+// within a few microseconds. The spin limit grows while blocked parks are
+// woken within SpinWindowNanos, and is halved otherwise.
+static const int   SpinLimitMax     = 256;
+static const int   SpinLimitStep    = 32;
+static const jlong SpinWindowNanos  = 20 * (NANOUNITS / MICROUNITS);
+
+// Upper bound on relative timeouts, as for the pthread based implementation.
+static const time_t MaxParkSecs     = 100000000;
+
+static void to_futex_abstime(timespec* abstime, jlong time, bool isAbsolute) {
+  assert(time > 0, "must be");
+  if (isAbsolute) {
+    // milliseconds since the epoch, used with FUTEX_CLOCK_REALTIME
+    abstime->tv_sec = time / MILLIUNITS;
+    abstime->tv_nsec = (time % MILLIUNITS) * NANOUNITS_PER_MILLIUNIT;
+  } else {
+    // nanoseconds from now, on the monotonic clock
+    struct timespec now;
+    int status = clock_gettime(CLOCK_MONOTONIC, &now);
+    assert(status == 0, "clock_gettime error: %s", os::strerror(errno));
+    jlong secs = MIN2(time / NANOUNITS, (jlong)MaxParkSecs);
+    jlong nanos = now.tv_nsec + time % NANOUNITS;
+    abstime->tv_sec = now.tv_sec + secs + nanos / NANOUNITS;
+    abstime->tv_nsec = nanos % NANOUNITS;
+  }
+}
+
+// Parker::park consumes the permit if one is available. Otherwise it spins
+// briefly, then marks the parker PARKED and waits on the futex until
+// unpark() stores NOTIFIED and wakes it. Spurious returns are fine, so a
+// single futex wait is done and whatever state is found afterwards is reset.
+
+void Parker::park(bool isAbsolute, jlong time) {
+
+  // Optional fast-path check:
+  // Return immediately if a permit is available.
+  // We depend on Atomic::xchg() having full barrier semantics
+  // since we are doing a lock-free update to _state.
+  if (Atomic::xchg(&_state, (int)EMPTY) == NOTIFIED) return;
+
+  JavaThread *jt = JavaThread::current();
+
+  // Optional optimization -- avoid state transitions if there's
+  // an interrupt pending.
+  if (jt->is_interrupted(false)) {
+    return;
+  }
+
+  // Next, demultiplex/decode time arguments
+  struct timespec absTime;
+  if (time < 0 || (isAbsolute && time == 0)) { // don't wait at all
+    return;
+  }
+  if (time > 0) {
+    to_futex_abstime(&absTime, time, isAbsolute);
+  }
+
+  if (os::processor_count() > 1) {
+    for (int i = 0; i < _spin_limit; i++) {
+      if (Atomic::load(&_state) == NOTIFIED &&
+          Atomic::xchg(&_state, (int)EMPTY) == NOTIFIED) {
+        return;
+      }
+      SpinPause();
+    }
+  }
+
+  ThreadBlockInVM tbivm(jt);
+
+  // Can't access interrupt state now that we are _thread_blocked. If we've
+  // been interrupted since we checked above then _state will be NOTIFIED.
+  if (Atomic::cmpxchg(&_state, (int)EMPTY, (int)PARKED) != EMPTY) {
+    Atomic::xchg(&_state, (int)EMPTY);
+    return;
+  }
+
+  OSThreadWaitState osts(jt->osthread(), false /* not Object.wait() */);
+
+  jlong start = os::javaTimeNanos();
+  int op = FUTEX_WAIT_BITSET_PRIVATE | (isAbsolute ? FUTEX_CLOCK_REALTIME : 0);
+  long s = syscall(SYS_futex, &_state, op, (int)PARKED,
+                   time == 0 ? nullptr : &absTime, nullptr, FUTEX_BITSET_MATCH_ANY);
+  guarantee_with_errno((s == 0) ||
+                       (s == -1 && errno == EAGAIN) ||
+                       (s == -1 && errno == EINTR) ||
+                       (s == -1 && errno == ETIMEDOUT),
+                       "futex FUTEX_WAIT_BITSET failed");
+
+  if (Atomic::xchg(&_state, (int)EMPTY) == NOTIFIED &&
+      os::javaTimeNanos() - start < SpinWindowNanos) {
+    _spin_limit = MIN2(_spin_limit + SpinLimitStep, SpinLimitMax);
+  } else {
+    _spin_limit >>= 1;
+  }
+}
+
+void Parker::unpark() {
+  if (Atomic::xchg(&_state, (int)NOTIFIED) == PARKED) {
+    // thread is blocked, or about to block, on the futex
+    long s = syscall(SYS_futex, &_state, FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+    guarantee_with_errno(s > -1, "futex FUTEX_WAKE failed");
+  }
+}
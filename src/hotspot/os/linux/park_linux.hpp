@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef OS_LINUX_PARK_LINUX_HPP
+#define OS_LINUX_PARK_LINUX_HPP
+
+#include "utilities/globalDefinitions.hpp"
+
+// JSR166 support
+// PlatformParker provides the platform dependent base class for the
+// Parker class. On Linux the permit is a single futex word, so that
+// unpark() of a thread that is not blocked is a plain atomic exchange,
+// and waking a blocked thread takes a single FUTEX_WAKE.
+// Before blocking, park() spins briefly for a permit. The spin limit adapts
+// to how quickly the thread was recently unparked after blocking.
+
+class PlatformParker {
+  NONCOPYABLE(PlatformParker);
+ protected:
+  enum {
+    EMPTY    =  0,  // no permit
+    NOTIFIED =  1,  // permit available
+    PARKED   = -1   // owner is blocked, or about to block, in the kernel
+  };
+  volatile int _state;
+  int _spin_limit;  // only used by the owning thread
+
+ public:
+  PlatformParker() : _state(EMPTY), _spin_limit(0) {}
+};
+
+#endif // OS_LINUX_PARK_LINUX_HPP
@@ -31,6 +31,7 @@
 #include "utilities/checkedCast.hpp"
 #include "utilities/macros.hpp"
 
+#include <poll.h>
 #include <unistd.h>
 #include <signal.h>
 #include <sys/types.h>
@@ -60,6 +61,11 @@
 // 2. When a client connect, the SO_PEERCRED socket option is used to
 //    obtain the credentials of client. We check that the effective uid
 //    of the client matches this process.
+//
+// A client can ask to keep its connection open with the "keepalive" option.
+// The connection is then polled along with the listening socket and further
+// requests are read from it without a new connect and credentials check.
+// Only the most recent keepalive connection is kept.
 
 // forward reference
 class PosixAttachOperation;
@@ -75,6 +81,9 @@ class PosixAttachListener: AllStatic {
 
   static bool _atexit_registered;
 
+  // connection of a keepalive client waiting for its next request, or -1
+  static int _keepalive_socket;
+
  public:
   static void set_path(char* path) {
     if (path == nullptr) {
@@ -96,6 +105,14 @@ class PosixAttachListener: AllStatic {
   static bool has_path()                { return _has_path; }
   static int listener()                 { return _listener; }
 
+  static void set_keepalive_socket(int s) {
+    if (_keepalive_socket != -1) {
+      ::shutdown(_keepalive_socket, SHUT_RDWR);
+      ::close(_keepalive_socket);
+    }
+    _keepalive_socket = s;
+  }
+
   static PosixAttachOperation* dequeue();
 };
 
@@ -112,6 +129,13 @@ class SocketChannel : public AttachOperation::RequestReader, public AttachOperat
     return _socket != -1;
   }
 
+  // gives up ownership of the socket without closing it
+  int release() {
+    int s = _socket;
+    _socket = -1;
+    return s;
+  }
+
   void close() {
     if (opened()) {
       ::shutdown(_socket, SHUT_RDWR);
@@ -155,6 +179,10 @@ class PosixAttachOperation: public AttachOperation {
   bool read_request() {
     return _socket_channel.read_request(this, &_socket_channel);
   }
+
+  int release_socket() {
+    return _socket_channel.release();
+  }
 };
 
 // statics
@@ -162,6 +190,7 @@ char PosixAttachListener::_path[UNIX_PATH_MAX];
 bool PosixAttachListener::_has_path;
 volatile int PosixAttachListener::_listener = -1;
 bool PosixAttachListener::_atexit_registered = false;
+int PosixAttachListener::_keepalive_socket = -1;
 
 // atexit hook to stop listener and unlink the file that it is
 // bound too.
@@ -173,6 +202,7 @@ extern "C" {
       ::shutdown(s, SHUT_RDWR);
       ::close(s);
     }
+    PosixAttachListener::set_keepalive_socket(-1);
     if (PosixAttachListener::has_path()) {
       ::unlink(PosixAttachListener::path());
       PosixAttachListener::set_path(nullptr);
@@ -257,6 +287,31 @@ PosixAttachOperation* PosixAttachListener::dequeue() {
   for (;;) {
     int s;
 
+    if (_keepalive_socket != -1) {
+      // wait for the next request of the keepalive client or a new client
+      struct pollfd fds[2];
+      fds[0].fd = listener();
+      fds[0].events = POLLIN;
+      fds[1].fd = _keepalive_socket;
+      fds[1].events = POLLIN;
+      int res;
+      RESTARTABLE(::poll(fds, 2, -1), res);
+      if (res == -1) {
+        return nullptr;
+      }
+      if (fds[1].revents != 0) {
+        s = _keepalive_socket;
+        _keepalive_socket = -1;
+        PosixAttachOperation* op = new PosixAttachOperation(s);
+        if (op->read_request()) {
+          return op;
+        }
+        // the client closed the connection, or sent a bad request
+        delete op;
+        continue;
+      }
+    }
+
     // wait for client to connect
     struct sockaddr addr;
     socklen_t len = sizeof(addr);
@@ -321,6 +376,9 @@ PosixAttachOperation* PosixAttachListener::dequeue() {
 // socket could be made non-blocking and a timeout could be used.
 
 void PosixAttachOperation::complete(jint result, bufferedStream* st) {
+  if (keepalive()) {
+    PosixAttachListener::set_keepalive_socket(release_socket());
+  }
   delete this;
 }
 
@@ -361,6 +419,7 @@ void AttachListener::vm_start() {
 
 int AttachListener::pd_init() {
   AttachListener::set_supported_version(ATTACH_API_V2);
+  AttachListener::set_keepalive_supported(true);
 
   JavaThread* thread = JavaThread::current();
   ThreadBlockInVM tbivm(thread);
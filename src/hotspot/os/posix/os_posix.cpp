@@ -1703,6 +1703,8 @@ void PlatformEvent::unpark() {
 
 // JSR166 support
 
+#ifndef LINUX
+
  PlatformParker::PlatformParker() : _counter(0), _cur_index(-1) {
   int status = pthread_cond_init(&_cond[REL_INDEX], _condAttr);
   assert_status(status == 0, status, "cond_init rel");
@@ -1830,6 +1832,8 @@ void Parker::unpark() {
   }
 }
 
+#endif // !LINUX
+
 // Platform Mutex/Monitor implementation
 
 #if PLATFORM_MONITOR_IMPL_INDIRECT
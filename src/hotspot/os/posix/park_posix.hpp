@@ -73,7 +73,10 @@ class PlatformEvent : public CHeapObj<mtSynchronizer> {
 // were more like ObjectMonitor we could use PlatformEvent in both (with some
 // API updates of course). But Parker methods use fastpaths that break that
 // level of encapsulation - so combining the two remains a future project.
+//
+// Linux uses a futex based PlatformParker instead, see park_linux.hpp.
 
+#ifndef LINUX
 class PlatformParker {
   NONCOPYABLE(PlatformParker);
  protected:
@@ -90,5 +93,6 @@ class PlatformParker {
   PlatformParker();
   ~PlatformParker();
 };
+#endif // !LINUX
 
 #endif // OS_POSIX_PARK_POSIX_HPP
@@ -35,6 +35,7 @@
 #include "compiler/compilationFailureInfo.hpp"
 #include "compiler/compilationLog.hpp"
 #include "compiler/compilationMemoryStatistic.hpp"
+#include "compiler/compilationPolicy.hpp"
 #include "compiler/compileLog.hpp"
 #include "compiler/compiler_globals.hpp"
 #include "compiler/compilerDirectives.hpp"
@@ -587,6 +588,7 @@ Compilation::Compilation(AbstractCompiler* compiler, ciEnv* env, ciMethod* metho
 , _has_access_indexed(false)
 , _interpreter_frame_size(0)
 , _immediate_oops_patched(0)
+, _type_profile_sample_stride(CompilationPolicy::type_profile_sample_stride(env, method))
 , _current_instruction(nullptr)
 #ifndef PRODUCT
 , _last_instruction_printed(nullptr)
@@ -96,6 +96,7 @@ class Compilation: public StackObj {
   bool               _has_access_indexed;
   int                _interpreter_frame_size; // Stack space needed in case of a deoptimization
   int                _immediate_oops_patched;
+  int                _type_profile_sample_stride; // Executions of type profiling code per profile update
 
   // compilation helpers
   void initialize();
@@ -261,6 +262,7 @@ class Compilation: public StackObj {
     return env()->comp_level() == CompLevel_full_profile &&
       C1UpdateMethodData && MethodData::profile_return();
   }
+  int type_profile_sample_stride() const         { return _type_profile_sample_stride; }
 
   // will compilation make optimistic assumptions that might lead to
   // deoptimization and that the runtime will account for?
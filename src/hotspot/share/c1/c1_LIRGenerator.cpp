@@ -2482,11 +2482,85 @@ ciKlass* LIRGenerator::profile_type(ciMethodData* md, int md_base_offset, int md
   }
   LIRItem value(obj, this);
   value.load_item();
-  __ profile_type(new LIR_Address(mdp, md_offset, T_METADATA),
-                  value.result(), exact_klass, profiled_k, new_pointer_register(), not_null, exact_signature_k != nullptr);
+  LIR_Opr value_opr = value.result();
+  if (_sampled_type_profiles != nullptr) {
+    // The update may be skipped: give it a copy of the value that is not
+    // used past the update.
+    value_opr = new_register(T_OBJECT);
+    __ move(value.result(), value_opr);
+  }
+  LIR_Op* op = new LIR_OpProfileType(LIR_OprFact::address(new LIR_Address(mdp, md_offset, T_METADATA)),
+                                     value_opr, exact_klass, profiled_k, new_pointer_register(), not_null, exact_signature_k != nullptr);
+  if (_sampled_type_profiles != nullptr) {
+    _sampled_type_profiles->append(op);
+  } else {
+    __ append(op);
+  }
   return result;
 }
 
+// Type profiles may be sampled: the code updating the type profiles of a
+// site is then skipped unless the countdown of the current thread to its
+// next sample expired. The countdown is shared by all sampled sites, so it
+// is reset to a random value around the stride: with a fixed reset, sites
+// executed in a fixed order would always, or never, hit the expiry.
+//
+// Between begin_sampled_type_profile() and end_sampled_type_profile(),
+// profile_type() emits the loads of the operands in line and collects the
+// profile updates. The branch around the updates is emitted last, so that
+// the skipped code only consists of the updates, and nothing that is used
+// after them (operands, cached constants) is defined on only one path.
+void LIRGenerator::begin_sampled_type_profile() {
+  assert(_sampled_type_profiles == nullptr, "sampled type profiles do not nest");
+  if (compilation()->type_profile_sample_stride() > 1) {
+    _sampled_type_profiles = new LIR_OpList();
+  }
+}
+
+void LIRGenerator::end_sampled_type_profile() {
+  LIR_OpList* updates = _sampled_type_profiles;
+  if (updates == nullptr) {
+    return;
+  }
+  _sampled_type_profiles = nullptr;
+  if (updates->is_empty()) {
+    return;
+  }
+  LabelObj* skip = new LabelObj();
+  LIR_Address* countdown_addr = new LIR_Address(getThreadPointer(), in_bytes(JavaThread::profile_sample_countdown_offset()), T_INT);
+  LIR_Opr countdown = new_register(T_INT);
+  __ move(countdown_addr, countdown);
+  __ sub(countdown, LIR_OprFact::intConst(1), countdown);
+  __ move(countdown, countdown_addr);
+  __ cmp(lir_cond_greater, countdown, LIR_OprFact::intConst(0));
+  __ branch(lir_cond_greater, skip->label());
+  // Reset the countdown to a value in [stride - h, stride + h), with h half
+  // the largest power of two not above the stride, from a xorshift step.
+  const int stride = compilation()->type_profile_sample_stride();
+  const int h = round_down_power_of_2(stride) / 2;
+  LIR_Address* seed_addr = new LIR_Address(getThreadPointer(), in_bytes(JavaThread::profile_sample_seed_offset()), T_INT);
+  LIR_Opr seed = new_register(T_INT);
+  LIR_Opr tmp = new_register(T_INT);
+  __ move(seed_addr, seed);
+  __ move(seed, tmp);
+  __ shift_left(tmp, 13, tmp);
+  __ logical_xor(seed, tmp, seed);
+  __ move(seed, tmp);
+  __ unsigned_shift_right(tmp, 17, tmp);
+  __ logical_xor(seed, tmp, seed);
+  __ move(seed, tmp);
+  __ shift_left(tmp, 5, tmp);
+  __ logical_xor(seed, tmp, seed);
+  __ move(seed, seed_addr);
+  __ logical_and(seed, LIR_OprFact::intConst(2 * h - 1), seed);
+  __ add(seed, LIR_OprFact::intConst(stride - h), seed);
+  __ move(seed, countdown_addr);
+  for (int i = 0; i < updates->length(); i++) {
+    __ append(updates->at(i));
+  }
+  __ branch_destination(skip->label());
+}
+
 // profile parameters on entry to the root of the compilation
 void LIRGenerator::profile_parameters(Base* x) {
   if (compilation()->profile_parameters()) {
@@ -2498,6 +2572,7 @@ void LIRGenerator::profile_parameters(Base* x) {
       ciParametersTypeData* parameters_type_data = md->parameters_type_data();
       ciTypeStackSlotEntries* parameters =  parameters_type_data->parameters();
       LIR_Opr mdp = LIR_OprFact::illegalOpr;
+      begin_sampled_type_profile();
       for (int java_index = 0, i = 0, j = 0; j < parameters_type_data->number_of_parameters(); i++) {
         LIR_Opr src = args->at(i);
         assert(!src->is_illegal(), "check");
@@ -2516,6 +2591,7 @@ void LIRGenerator::profile_parameters(Base* x) {
         }
         java_index += type2size[t];
       }
+      end_sampled_type_profile();
     }
   }
 }
@@ -3060,6 +3136,8 @@ void LIRGenerator::do_ProfileCall(ProfileCall* x) {
   // tmp is used to hold the counters on SPARC
   LIR_Opr tmp = new_pointer_register();
 
+  begin_sampled_type_profile();
+
   if (x->nb_profiled_args() > 0) {
     profile_arguments(x);
   }
@@ -3069,6 +3147,8 @@ void LIRGenerator::do_ProfileCall(ProfileCall* x) {
     profile_parameters_at_call(x);
   }
 
+  end_sampled_type_profile();
+
   if (x->recv() != nullptr) {
     LIRItem value(x->recv(), this);
     value.load_item();
@@ -3095,11 +3175,13 @@ void LIRGenerator::do_ProfileReturnType(ProfileReturnType* x) {
     // The offset within the MDO of the entry to update may be too large
     // to be used in load/store instructions on some platforms. So have
     // profile_type() compute the address of the profile in a register.
+    begin_sampled_type_profile();
     ciKlass* exact = profile_type(md, md->byte_offset_of_slot(data, ret->type_offset()), 0,
         ret->type(), x->ret(), mdp,
         !x->needs_null_check(),
         signature_at_call->return_type()->as_klass(),
         x->callee()->signature()->return_type()->as_klass());
+    end_sampled_type_profile();
     if (exact != nullptr) {
       md->set_return_type(bci, exact);
     }
@@ -169,6 +169,7 @@ class LIRGenerator: public InstructionVisitor, public BlockClosure {
 #endif
   BitMap2D      _vreg_flags; // flags which can be set on a per-vreg basis
   LIR_List*     _lir;
+  LIR_OpList*   _sampled_type_profiles; // type profile updates of the current site, if sampled
 
   LIRGenerator* gen() {
     return this;
@@ -476,6 +477,8 @@ class LIRGenerator: public InstructionVisitor, public BlockClosure {
   void profile_arguments(ProfileCall* x);
   void profile_parameters(Base* x);
   void profile_parameters_at_call(ProfileCall* x);
+  void begin_sampled_type_profile();
+  void end_sampled_type_profile();
   LIR_Opr mask_boolean(LIR_Opr array, LIR_Opr value, CodeEmitInfo*& null_check_info);
 
  public:
@@ -503,6 +506,7 @@ class LIRGenerator: public InstructionVisitor, public BlockClosure {
     , _method(method)
     , _virtual_register_number(LIR_Opr::vreg_base)
     , _vreg_flags(num_vreg_flags)
+    , _sampled_type_profiles(nullptr)
     , _barrier_set(BarrierSet::barrier_set()->barrier_set_c1()) {
   }
 
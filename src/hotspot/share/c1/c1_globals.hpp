@@ -308,6 +308,12 @@
   product(bool, C1UpdateMethodData, true,                                   \
           "Update MethodData*s in Tier 3 C1 generated code")                \
                                                                             \
+  product(intx, C1TypeProfileSampleStride, 1,                               \
+          "Update argument, return and parameter type profiles only once "  \
+          "every this many executions in Tier 3 C1 generated code while "   \
+          "the C2 compile queue is long. 1 profiles every execution")       \
+          range(1, 1024)                                                    \
+                                                                            \
   develop(bool, PrintCFGToFile, false,                                      \
           "print control flow graph to a separate file during compilation")
 
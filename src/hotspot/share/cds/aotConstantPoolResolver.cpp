@@ -422,6 +422,46 @@ bool AOTConstantPoolResolver::check_lambda_metafactory_methodhandle_arg(Constant
   return check_methodtype_signature(cp, sig);
 }
 
+// The getters passed to ObjectMethods::bootstrap() must read the fields of the record class itself,
+// and the types of these fields must not be excluded from the AOT cache.
+bool AOTConstantPoolResolver::check_object_methods_getter_arg(ConstantPool* cp, int bsms_attribute_index, int arg_i) {
+  int mh_index = cp->operand_argument_index_at(bsms_attribute_index, arg_i);
+  if (!cp->tag_at(mh_index).is_method_handle() ||
+      cp->method_handle_ref_kind_at(mh_index) != JVM_REF_getField) {
+    // malformed class?
+    return false;
+  }
+
+  int field_ref = cp->method_handle_index_at(mh_index);
+  if (cp->klass_name_at(cp->uncached_klass_ref_index_at(field_ref)) != cp->pool_holder()->name()) {
+    return false;
+  }
+
+  Symbol* sig = cp->uncached_signature_ref_at(field_ref);
+  if (log_is_enabled(Debug, aot, resolve)) {
+    ResourceMark rm;
+    log_debug(aot, resolve)("Checking field type of MethodHandle for ObjectMethods BSM arg %d: %s", arg_i, sig->as_C_string());
+  }
+
+  ResourceMark rm;
+  SignatureStream ss(sig, false);
+  if (!ss.is_reference()) {
+    return true;
+  }
+  Klass* k = find_loaded_class(Thread::current(), cp->pool_holder()->class_loader(), ss.as_symbol());
+  if (k == nullptr) {
+    return false;
+  }
+  if (SystemDictionaryShared::should_be_excluded(k)) {
+    if (log_is_enabled(Warning, aot, resolve)) {
+      ResourceMark rm;
+      log_warning(aot, resolve)("Cannot aot-resolve ObjectMethods callsite because %s is excluded", k->external_name());
+    }
+    return false;
+  }
+  return true;
+}
+
 bool AOTConstantPoolResolver::is_indy_resolution_deterministic(ConstantPool* cp, int cp_index) {
   assert(cp->tag_at(cp_index).is_invoke_dynamic(), "sanity");
   if (!CDSConfig::is_dumping_invokedynamic()) {
@@ -439,18 +479,24 @@ bool AOTConstantPoolResolver::is_indy_resolution_deterministic(ConstantPool* cp,
   Symbol* bsm_signature = cp->uncached_signature_ref_at(bsm_ref);
   Symbol* bsm_klass = cp->klass_name_at(cp->uncached_klass_ref_index_at(bsm_ref));
 
-  // We currently support only StringConcatFactory::makeConcatWithConstants() and LambdaMetafactory::metafactory()
+  // We currently support only StringConcatFactory::makeConcatWithConstants(), StringConcatFactory::makeConcat(),
+  // LambdaMetafactory::metafactory() and ObjectMethods::bootstrap().
   // We should mark the allowed BSMs in the JDK code using a private annotation.
   // See notes on RFE JDK-8342481.
 
   if (bsm_klass->equals("java/lang/invoke/StringConcatFactory") &&
-      bsm_name->equals("makeConcatWithConstants") &&
-      bsm_signature->equals("(Ljava/lang/invoke/MethodHandles$Lookup;"
-                             "Ljava/lang/String;"
-                             "Ljava/lang/invoke/MethodType;"
-                             "Ljava/lang/String;"
-                             "[Ljava/lang/Object;"
-                            ")Ljava/lang/invoke/CallSite;")) {
+      ((bsm_name->equals("makeConcatWithConstants") &&
+        bsm_signature->equals("(Ljava/lang/invoke/MethodHandles$Lookup;"
+                               "Ljava/lang/String;"
+                               "Ljava/lang/invoke/MethodType;"
+                               "Ljava/lang/String;"
+                               "[Ljava/lang/Object;"
+                              ")Ljava/lang/invoke/CallSite;")) ||
+       (bsm_name->equals("makeConcat") &&
+        bsm_signature->equals("(Ljava/lang/invoke/MethodHandles$Lookup;"
+                               "Ljava/lang/String;"
+                               "Ljava/lang/invoke/MethodType;"
+                              ")Ljava/lang/invoke/CallSite;")))) {
     Symbol* factory_type_sig = cp->uncached_signature_ref_at(cp_index);
     if (log_is_enabled(Debug, aot, resolve)) {
       ResourceMark rm;
@@ -538,6 +584,63 @@ bool AOTConstantPoolResolver::is_indy_resolution_deterministic(ConstantPool* cp,
     return true;
   }
 
+  if (bsm_klass->equals("java/lang/runtime/ObjectMethods") &&
+      bsm_name->equals("bootstrap") &&
+      bsm_signature->equals("(Ljava/lang/invoke/MethodHandles$Lookup;"
+                             "Ljava/lang/String;"
+                             "Ljava/lang/invoke/TypeDescriptor;"
+                             "Ljava/lang/Class;"
+                             "Ljava/lang/String;"
+                             "[Ljava/lang/invoke/MethodHandle;"
+                            ")Ljava/lang/Object;")) {
+    /*
+     * These are the toString(), hashCode() and equals() callsites that javac generates for
+     * records. The static arguments are:
+     *
+     * Class recordClass        The record class; must be the class that contains the callsite.
+     * String names             The component names, separated by ';'.
+     * MethodHandle... getters  One getField handle per record component.
+     */
+    Symbol* factory_type_sig = cp->uncached_signature_ref_at(cp_index);
+    if (log_is_enabled(Debug, aot, resolve)) {
+      ResourceMark rm;
+      log_debug(aot, resolve)("Checking ObjectMethods callsite signature [%d]: %s", cp_index, factory_type_sig->as_C_string());
+    }
+
+    if (!check_methodtype_signature(cp, factory_type_sig)) {
+      return false;
+    }
+
+    int bsms_attribute_index = cp->bootstrap_methods_attribute_index(cp_index);
+    int arg_count = cp->operand_argument_count_at(bsms_attribute_index);
+    if (arg_count < 2) {
+      // Malformed class?
+      return false;
+    }
+
+    // recordClass
+    int class_index = cp->operand_argument_index_at(bsms_attribute_index, 0);
+    if (!cp->tag_at(class_index).is_klass_or_reference() ||
+        cp->klass_name_at(class_index) != pool_holder->name()) {
+      return false;
+    }
+
+    // names
+    int names_index = cp->operand_argument_index_at(bsms_attribute_index, 1);
+    if (!cp->tag_at(names_index).is_string()) {
+      return false;
+    }
+
+    // getters
+    for (int arg_i = 2; arg_i < arg_count; arg_i++) {
+      if (!check_object_methods_getter_arg(cp, bsms_attribute_index, arg_i)) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
   return false;
 }
 #ifdef ASSERT
@@ -78,6 +78,7 @@ class AOTConstantPoolResolver :  AllStatic {
   static bool check_lambda_metafactory_signature(ConstantPool* cp, Symbol* sig);
   static bool check_lambda_metafactory_methodtype_arg(ConstantPool* cp, int bsms_attribute_index, int arg_i);
   static bool check_lambda_metafactory_methodhandle_arg(ConstantPool* cp, int bsms_attribute_index, int arg_i);
+  static bool check_object_methods_getter_arg(ConstantPool* cp, int bsms_attribute_index, int arg_i);
 
 public:
   static void preresolve_class_cp_entries(JavaThread* current, InstanceKlass* ik, GrowableArray<bool>* preresolve_list);
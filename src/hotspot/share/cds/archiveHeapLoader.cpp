@@ -23,7 +23,9 @@
  */
 
 #include "cds/archiveHeapLoader.inline.hpp"
+#include "cds/archiveUtils.hpp"
 #include "cds/cdsConfig.hpp"
+#include "cds/cds_globals.hpp"
 #include "cds/heapShared.hpp"
 #include "cds/metaspaceShared.hpp"
 #include "classfile/classLoaderDataShared.hpp"
@@ -96,6 +98,38 @@ void ArchiveHeapLoader::fixup_region() {
   }
 }
 
+// Every bit in the oopmap marks a separate narrowOop/oop slot, so the patchers below
+// can be applied to disjoint slices of the bitmap concurrently.
+template <typename PATCHER>
+class HeapDataRelocationTask : public ArchiveWorkerTask {
+private:
+  BitMapView* const _bm;
+  PATCHER* const _patcher;
+
+public:
+  HeapDataRelocationTask(BitMapView* bm, PATCHER* patcher) :
+                         ArchiveWorkerTask("Heap Data Relocation"),
+                         _bm(bm), _patcher(patcher) {}
+
+  void work(int chunk, int max_chunks) override {
+    BitMap::idx_t size  = _bm->size();
+    BitMap::idx_t start = MIN2(size, size * chunk / max_chunks);
+    BitMap::idx_t end   = MIN2(size, size * (chunk + 1) / max_chunks);
+    _bm->iterate(_patcher, start, end);
+  }
+};
+
+template <typename PATCHER>
+static void iterate_heap_oopmap(BitMapView* bm, PATCHER* patcher) {
+  if (AOTCacheParallelRelocation) {
+    ArchiveWorkers workers;
+    HeapDataRelocationTask<PATCHER> task(bm, patcher);
+    workers.run_task(&task);
+  } else {
+    bm->iterate(patcher);
+  }
+}
+
 // ------------------ Support for Region MAPPING -----------------------------------------
 
 // Patch all the embedded oop pointers inside an archived heap region,
@@ -180,12 +214,12 @@ void ArchiveHeapLoader::patch_compressed_embedded_pointers(BitMapView bm,
       log_info(aot)("heap data relocation unnecessary, quick_delta = 0");
     } else {
       PatchCompressedEmbeddedPointersQuick patcher(patching_start, quick_delta);
-      bm.iterate(&patcher);
+      iterate_heap_oopmap(&bm, &patcher);
     }
   } else {
     log_info(aot)("heap data quick relocation not possible");
     PatchCompressedEmbeddedPointers patcher(patching_start);
-    bm.iterate(&patcher);
+    iterate_heap_oopmap(&bm, &patcher);
   }
 }
 
@@ -199,7 +233,7 @@ void ArchiveHeapLoader::patch_embedded_pointers(FileMapInfo* info,
     patch_compressed_embedded_pointers(bm, info, region);
   } else {
     PatchUncompressedEmbeddedPointers patcher((oop*)region.start() + FileMapInfo::current_info()->heap_oopmap_start_pos());
-    bm.iterate(&patcher);
+    iterate_heap_oopmap(&bm, &patcher);
   }
 }
 
@@ -316,10 +350,10 @@ bool ArchiveHeapLoader::load_heap_region_impl(FileMapInfo* mapinfo, LoadedArchiv
 
   if (UseCompressedOops) {
     PatchLoadedRegionPointers patcher((narrowOop*)load_address + FileMapInfo::current_info()->heap_oopmap_start_pos(), loaded_region);
-    bm.iterate(&patcher);
+    iterate_heap_oopmap(&bm, &patcher);
   } else {
     PatchUncompressedEmbeddedPointers patcher((oop*)load_address + FileMapInfo::current_info()->heap_oopmap_start_pos(), loaded_region->_runtime_offset);
-    bm.iterate(&patcher);
+    iterate_heap_oopmap(&bm, &patcher);
   }
   return true;
 }
@@ -196,6 +196,8 @@ class MetaspaceShared : AllStatic {
                                      ReservedSpace& class_space_rs);
   static MapArchiveResult map_archive(FileMapInfo* mapinfo, char* mapped_base_address, ReservedSpace rs);
   static void unmap_archive(FileMapInfo* mapinfo);
+
+public:
   static void get_default_classlist(char* default_classlist, const size_t buf_size);
 };
 #endif // SHARE_CDS_METASPACESHARED_HPP
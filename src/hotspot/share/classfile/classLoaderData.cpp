@@ -811,9 +811,12 @@ ClassLoaderMetaspace* ClassLoaderData::metaspace_non_null() {
         assert (class_loader() == nullptr, "Must be");
         metaspace = new ClassLoaderMetaspace(_metaspace_lock, Metaspace::BootMetaspaceType);
       } else if (has_class_mirror_holder()) {
-        metaspace = new ClassLoaderMetaspace(_metaspace_lock, Metaspace::ClassMirrorHolderMetaspaceType);
+        metaspace = new ClassLoaderMetaspace(_metaspace_lock, Metaspace::ClassMirrorHolderMetaspaceType,
+                                             MetaspaceSeparateTransientLoaders);
       } else {
-        metaspace = new ClassLoaderMetaspace(_metaspace_lock, Metaspace::StandardMetaspaceType);
+        // Builtin loaders live as long as the VM, everything else may get unloaded.
+        metaspace = new ClassLoaderMetaspace(_metaspace_lock, Metaspace::StandardMetaspaceType,
+                                             MetaspaceSeparateTransientLoaders && !is_builtin_class_loader_data());
       }
       // Ensure _metaspace is stable, since it is examined without a lock
       Atomic::release_store(&_metaspace, metaspace);
@@ -466,6 +466,16 @@ void ClassLoaderDataGraph::purge(bool at_safepoint) {
 
   bool classes_unloaded = ClassUnloadingContext::context()->has_unloaded_classes();
 
+  purge_metaspaces(classes_unloaded, at_safepoint);
+}
+
+void ClassLoaderDataGraph::purge_unloaded(ClassLoaderData* unloading_head, bool at_safepoint) {
+  ClassUnloadingContext::purge_class_loader_data(unloading_head);
+
+  purge_metaspaces(unloading_head != nullptr, at_safepoint);
+}
+
+void ClassLoaderDataGraph::purge_metaspaces(bool classes_unloaded, bool at_safepoint) {
   Metaspace::purge(classes_unloaded);
   if (classes_unloaded) {
     set_metaspace_oom(false);
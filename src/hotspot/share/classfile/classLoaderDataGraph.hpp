@@ -58,11 +58,15 @@ class ClassLoaderDataGraph : public AllStatic {
 
   static ClassLoaderData* add_to_graph(Handle class_loader, bool has_class_mirror_holder);
 
+  static void purge_metaspaces(bool classes_unloaded, bool at_safepoint);
+
  public:
   static ClassLoaderData* find_or_create(Handle class_loader);
   static ClassLoaderData* add(Handle class_loader, bool has_class_mirror_holder);
   static void clean_module_and_package_info();
   static void purge(bool at_safepoint);
+  // Purge class loader data detached from an earlier ClassUnloadingContext.
+  static void purge_unloaded(ClassLoaderData* unloading_head, bool at_safepoint);
   static void clear_claimed_marks();
   static void clear_claimed_marks(int claim);
   static void verify_claimed_marks_cleared(int claim);
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "cds/cdsConfig.hpp"
+#include "cds/cds_globals.hpp"
+#include "cds/metaspaceShared.hpp"
+#include "classfile/classPreloader.hpp"
+#include "classfile/symbolTable.hpp"
+#include "classfile/systemDictionary.hpp"
+#include "jvm_io.h"
+#include "logging/log.hpp"
+#include "memory/allocation.hpp"
+#include "memory/resourceArea.hpp"
+#include "prims/jvmtiExport.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/handles.inline.hpp"
+#include "runtime/java.hpp"
+#include "runtime/javaThread.hpp"
+#include "runtime/os.hpp"
+#include "utilities/growableArray.hpp"
+
+class ClassPreloadThread : public JavaThread {
+ public:
+  ClassPreloadThread(ThreadFunction entry_point) : JavaThread(entry_point) {};
+
+  // Hide this thread from external view.
+  bool is_hidden_from_external_view() const { return true; }
+};
+
+char**       ClassPreloader::_class_names = nullptr;
+int          ClassPreloader::_num_classes = 0;
+volatile int ClassPreloader::_next = 0;
+volatile int ClassPreloader::_loaded = 0;
+volatile int ClassPreloader::_active_threads = 0;
+
+// Read the class names from a class list. Only the first token of a line is
+// used; comments and '@' directives (lambda forms, etc.) are skipped.
+bool ClassPreloader::read_class_list(const char* path) {
+  FILE* file = os::fopen(path, "r");
+  if (file == nullptr) {
+    log_info(class, load, startup)("Cannot open class list %s for preloading", path);
+    return false;
+  }
+
+  GrowableArrayCHeap<char*, mtClass> names;
+  char line[1024];
+  while (fgets(line, sizeof(line), file) != nullptr) {
+    size_t len = strcspn(line, " \t\r\n");
+    if (len == 0 || line[0] == '#' || line[0] == '@') {
+      continue;
+    }
+    line[len] = '\0';
+    names.append(os::strdup_check_oom(line, mtClass));
+  }
+  fclose(file);
+
+  _num_classes = names.length();
+  if (_num_classes == 0) {
+    return false;
+  }
+  _class_names = NEW_C_HEAP_ARRAY(char*, _num_classes, mtClass);
+  for (int i = 0; i < _num_classes; i++) {
+    _class_names[i] = names.at(i);
+  }
+  return true;
+}
+
+void ClassPreloader::free_class_list() {
+  for (int i = 0; i < _num_classes; i++) {
+    os::free(_class_names[i]);
+  }
+  FREE_C_HEAP_ARRAY(char*, _class_names);
+  _class_names = nullptr;
+  _num_classes = 0;
+}
+
+void ClassPreloader::start() {
+#if INCLUDE_CDS
+  if (BootClassPreloadThreads == 0) {
+    return;
+  }
+  if (CDSConfig::is_dumping_archive()) {
+    // Do not change the set of classes that gets archived.
+    return;
+  }
+  if (JvmtiExport::should_post_class_file_load_hook() ||
+      JvmtiExport::should_post_class_load() ||
+      JvmtiExport::should_post_class_prepare()) {
+    // Agents observe which thread loads a class and in which order.
+    return;
+  }
+
+  char default_classlist[JVM_MAXPATHLEN];
+  const char* path = SharedClassListFile;
+  if (path == nullptr) {
+    MetaspaceShared::get_default_classlist(default_classlist, sizeof(default_classlist));
+    path = default_classlist;
+  }
+  if (!read_class_list(path)) {
+    return;
+  }
+  log_info(class, load, startup)("Preloading %d classes from %s on %u threads",
+                                 _num_classes, path, BootClassPreloadThreads);
+
+  EXCEPTION_MARK;
+  _active_threads = (int)BootClassPreloadThreads;
+  for (uint i = 0; i < BootClassPreloadThreads; i++) {
+    Handle thread_oop = JavaThread::create_system_thread_object("Class Preload Thread", CHECK);
+    ClassPreloadThread* thread = new ClassPreloadThread(&preload_thread_entry);
+    JavaThread::vm_exit_on_osthread_failure(thread);
+    JavaThread::start_internal_daemon(THREAD, thread, thread_oop, NormPriority);
+  }
+#endif // INCLUDE_CDS
+}
+
+void ClassPreloader::preload_thread_entry(JavaThread* jt, TRAPS) {
+  int loaded = 0;
+  while (true) {
+    const int index = Atomic::fetch_then_add(&_next, 1);
+    if (index >= _num_classes) {
+      break;
+    }
+    HandleMark hm(THREAD);
+    ResourceMark rm(THREAD);
+    TempNewSymbol name = SymbolTable::new_symbol(_class_names[index]);
+    // Classes that are not defined by the boot loader are not found. That
+    // and any other failure is ignored; the class will be loaded (and the
+    // error reported) if and when the application needs it.
+    Klass* k = SystemDictionary::resolve_or_null(name, THREAD);
+    if (HAS_PENDING_EXCEPTION) {
+      CLEAR_PENDING_EXCEPTION;
+    } else if (k != nullptr) {
+      loaded++;
+    }
+  }
+
+  Atomic::add(&_loaded, loaded);
+  if (Atomic::sub(&_active_threads, 1) == 0) {
+    log_info(class, load, startup)("Preloaded %d of %d classes", Atomic::load(&_loaded), _num_classes);
+    free_class_list();
+  }
+}
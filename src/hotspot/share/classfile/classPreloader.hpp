@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_CLASSFILE_CLASSPRELOADER_HPP
+#define SHARE_CLASSFILE_CLASSPRELOADER_HPP
+
+#include "memory/allStatic.hpp"
+#include "utilities/exceptions.hpp"
+
+class JavaThread;
+
+// Speculatively loads (but does not link or initialize) the boot classes
+// named in the CDS class list on BootClassPreloadThreads hidden helper
+// threads, so that parsing them overlaps the start of main(). The boot
+// loader supports parallel loading, so a class that main() needs while it
+// is being preloaded is simply waited for.
+class ClassPreloader : AllStatic {
+  static char**       _class_names;
+  static int          _num_classes;
+  static volatile int _next;
+  static volatile int _loaded;
+  static volatile int _active_threads;
+
+  static bool read_class_list(const char* path);
+  static void free_class_list();
+  static void preload_thread_entry(JavaThread* thread, TRAPS);
+
+ public:
+  // Called at the end of VM initialization.
+  static void start();
+};
+
+#endif // SHARE_CLASSFILE_CLASSPRELOADER_HPP
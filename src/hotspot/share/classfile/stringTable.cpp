@@ -376,6 +376,30 @@ oop StringTable::lookup(const jchar* name, int len) {
   return do_lookup(wrapped_name, hash);
 }
 
+// Looks up a String with the same contents as java_string, whatever the
+// coder of either String.
+oop StringTable::lookup(oop java_string) {
+  Thread* thread = Thread::current();
+  HandleMark hm(thread);
+  Handle h_string(thread, java_string);
+  StringWrapper wrapped_name(h_string, java_lang_String::length(java_string));
+  unsigned int hash = hash_wrapped_string(wrapped_name);
+  oop string = lookup_shared(wrapped_name, hash);
+  if (string != nullptr) {
+    return string;
+  }
+  if (_alt_hash) {
+    ResourceMark rm(thread);
+    int length;
+    const jchar* chars = java_lang_String::as_unicode_string_or_null(java_string, length);
+    if (chars == nullptr) {
+      return nullptr;
+    }
+    hash = hash_string(chars, length, true);
+  }
+  return do_lookup(wrapped_name, hash);
+}
+
 class StringTableGet : public StackObj {
   Thread* _thread;
   Handle  _return;
@@ -93,6 +93,7 @@ class StringTable : AllStatic {
   // Probing
   static oop lookup(Symbol* symbol);
   static oop lookup(const jchar* chars, int length);
+  static oop lookup(oop java_string);
 
   // Interning
   static oop intern(Symbol* symbol, TRAPS);
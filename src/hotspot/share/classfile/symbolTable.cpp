@@ -92,6 +92,12 @@ static volatile bool _alt_hash = false;
 // are updating "lookup success history" in a global shared variable, so use built-in TLS
 static THREAD_LOCAL bool _lookup_shared_first = false;
 
+// Per-thread cache of recently looked up permanent symbols, indexed by hash.
+// Permanent symbols (archived ones and those in the symbol arena) are never
+// freed, so a hit needs neither a table probe nor a refcount update.
+static const uint RecentSymbolsSize = 32; // must be a power of 2
+static THREAD_LOCAL Symbol* _recent_symbols[RecentSymbolsSize];
+
 // Static arena for symbols that are not deallocated
 Arena* SymbolTable::_arena = nullptr;
 
@@ -316,7 +322,12 @@ Symbol* SymbolTable::lookup_shared(const char* name,
 
 Symbol* SymbolTable::lookup_common(const char* name,
                             int len, unsigned int hash) {
-  Symbol* sym;
+  Symbol** const recent = &_recent_symbols[hash & (RecentSymbolsSize - 1)];
+  Symbol* sym = *recent;
+  if (sym != nullptr && sym->equals(name, len)) {
+    return sym;
+  }
+
   if (_lookup_shared_first) {
     sym = lookup_shared(name, len, hash);
     if (sym == nullptr) {
@@ -332,6 +343,9 @@ Symbol* SymbolTable::lookup_common(const char* name,
       }
     }
   }
+  if (sym != nullptr && sym->is_permanent()) {
+    *recent = sym;
+  }
   return sym;
 }
 
@@ -612,8 +612,11 @@ InstanceKlass* SystemDictionary::resolve_instance_class_or_null(Symbol* name,
          name->as_C_string(),
          class_loader.is_null() ? "null" : class_loader->klass()->name()->as_C_string());
 
-  // Check again (after locking) if the class already exists in SystemDictionary
-  {
+  // Check again (after locking) if the class already exists in SystemDictionary.
+  // Dictionary lookups are lock-free, so only take the SystemDictionary_lock
+  // if the placeholders need to be consulted.
+  loaded_class = dictionary->find_class(THREAD, name);
+  if (loaded_class == nullptr) {
     MutexLocker mu(THREAD, SystemDictionary_lock);
     InstanceKlass* check = dictionary->find_class(THREAD, name);
     if (check != nullptr) {
@@ -1416,6 +1419,15 @@ InstanceKlass* SystemDictionary::find_or_define_helper(Symbol* class_name, Handl
   ClassLoaderData* loader_data = class_loader_data(class_loader);
   Dictionary* dictionary = loader_data->dictionary();
 
+  // Another thread may have won the race to define the class already, in which
+  // case there is no need to serialize on the SD lock for the placeholder.
+  if (is_parallelDefine(class_loader)) {
+    InstanceKlass* check = dictionary->find_class(THREAD, name_h);
+    if (check != nullptr) {
+      return check;
+    }
+  }
+
   // Hold SD lock around find_class and placeholder creation for DEFINE_CLASS
   {
     MutexLocker mu(THREAD, SystemDictionary_lock);
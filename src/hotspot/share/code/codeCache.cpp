@@ -344,6 +344,10 @@ void CodeCache::initialize_heaps() {
 }
 
 size_t CodeCache::page_size(bool aligned, size_t min_pages) {
+  if (CodeCacheHotSegmentSize > 0) {
+    // Only the hot segment of each code heap asks for large pages.
+    return os::vm_page_size();
+  }
   return aligned ? os::page_size_for_region_aligned(ReservedCodeCacheSize, min_pages) :
                    os::page_size_for_region_unaligned(ReservedCodeCacheSize, min_pages);
 }
@@ -500,7 +504,7 @@ CodeBlob* CodeCache::next_blob(CodeHeap* heap, CodeBlob* cb) {
  * run the constructor for the CodeBlob subclass he is busy
  * instantiating.
  */
-CodeBlob* CodeCache::allocate(uint size, CodeBlobType code_blob_type, bool handle_alloc_failure, CodeBlobType orig_code_blob_type) {
+CodeBlob* CodeCache::allocate(uint size, CodeBlobType code_blob_type, bool handle_alloc_failure, CodeBlobType orig_code_blob_type, bool hot) {
   assert_locked_or_safepoint(CodeCache_lock);
   assert(size > 0, "Code cache allocation request must be > 0");
   if (size == 0) {
@@ -513,7 +517,8 @@ CodeBlob* CodeCache::allocate(uint size, CodeBlobType code_blob_type, bool handl
   assert(heap != nullptr, "heap is null");
 
   while (true) {
-    cb = (CodeBlob*)heap->allocate(size);
+    // Hot code is packed towards the low end of the heap.
+    cb = (CodeBlob*)heap->allocate(size, hot /* first_fit */);
     if (cb != nullptr) break;
     if (!heap->expand_by(CodeCacheExpansionSize)) {
       // Save original type for error reporting
@@ -546,7 +551,7 @@ CodeBlob* CodeCache::allocate(uint size, CodeBlobType code_blob_type, bool handl
             tty->print_cr("Extension of %s failed. Trying to allocate in %s.",
                           heap->name(), get_code_heap(type)->name());
           }
-          return allocate(size, type, handle_alloc_failure, orig_code_blob_type);
+          return allocate(size, type, handle_alloc_failure, orig_code_blob_type, hot);
         }
       }
       if (handle_alloc_failure) {
@@ -1233,9 +1238,11 @@ void CodeCache::mark_for_deoptimization(DeoptimizationScope* deopt_scope, KlassD
   // nmethod::check_all_dependencies works only correctly, if no safepoint
   // can happen
   NoSafepointVerifier nsv;
+  ResourceMark rm;
+  CheckedNMethodSet checked;
   for (DepChange::ContextStream str(changes, nsv); str.next(); ) {
     InstanceKlass* d = str.klass();
-    d->mark_dependent_nmethods(deopt_scope, changes);
+    d->mark_dependent_nmethods(deopt_scope, changes, &checked);
   }
 
 #ifndef PRODUCT
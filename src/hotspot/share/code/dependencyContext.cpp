@@ -61,16 +61,32 @@ void DependencyContext::init() {
   }
 }
 
+static bool is_already_checked(CheckedNMethodSet* checked, nmethod* nm) {
+  if (checked == nullptr) {
+    return false;
+  }
+  bool created;
+  checked->put_if_absent(nm, true, &created);
+  if (created) {
+    checked->maybe_grow();
+  }
+  return !created;
+}
+
 //
 // Walk the list of dependent nmethods searching for nmethods which
 // are dependent on the changes that were passed in and mark them for
-// deoptimization.
+// deoptimization. Nmethods found in checked have already been found
+// not to depend on the changes, through another dependency context.
 //
-void DependencyContext::mark_dependent_nmethods(DeoptimizationScope* deopt_scope, DepChange& changes) {
+void DependencyContext::mark_dependent_nmethods(DeoptimizationScope* deopt_scope, DepChange& changes,
+                                                CheckedNMethodSet* checked) {
   for (nmethodBucket* b = dependencies_not_unloading(); b != nullptr; b = b->next_not_unloading()) {
     nmethod* nm = b->get_nmethod();
     if (nm->is_marked_for_deoptimization()) {
       deopt_scope->dependent(nm);
+    } else if (is_already_checked(checked, nm)) {
+      continue;
     } else if (nm->check_dependency_on(changes)) {
       LogTarget(Info, dependencies) lt;
       if (lt.is_enabled()) {
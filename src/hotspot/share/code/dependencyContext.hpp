@@ -30,11 +30,21 @@
 #include "runtime/handles.hpp"
 #include "runtime/perfData.hpp"
 #include "runtime/safepoint.hpp"
+#include "utilities/resizeableResourceHash.hpp"
 
 class nmethod;
 class DeoptimizationScope;
 class DepChange;
 
+// The nmethods already checked against a change that involves several
+// dependency contexts. An nmethod is registered with every context it
+// depends on, so it is found once per context, but it only needs to be
+// checked once.
+class CheckedNMethodSet : public ResizeableResourceHashtable<nmethod*, bool, AnyObj::RESOURCE_AREA, mtCode> {
+ public:
+  CheckedNMethodSet() : ResizeableResourceHashtable(256, 64 * K) {}
+};
+
 //
 // nmethodBucket is used to record dependent nmethods for
 // deoptimization.  nmethod dependencies are actually <klass, method>
@@ -110,7 +120,8 @@ class DependencyContext : public StackObj {
 
   static void init();
 
-  void mark_dependent_nmethods(DeoptimizationScope* deopt_scope, DepChange& changes);
+  void mark_dependent_nmethods(DeoptimizationScope* deopt_scope, DepChange& changes,
+                               CheckedNMethodSet* checked = nullptr);
   void add_dependent_nmethod(nmethod* nm);
   void remove_all_dependents();
   void clean_unloading_dependents();
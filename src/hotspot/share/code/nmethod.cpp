@@ -1179,10 +1179,15 @@ nmethod* nmethod::new_nmethod(const methodHandle& method,
   int mutable_data_size = required_mutable_data_size(code_buffer
     JVMCI_ONLY(COMMA (compiler->is_jvmci() ? jvmci_data->size() : 0)));
 
+  // Group the code of the hottest methods (see CodeCacheHotInvocationThreshold).
+  bool hot = CodeCacheHotInvocationThreshold > 0 &&
+             comp_level == CompLevel_full_optimization &&
+             (uintx)method->invocation_count() >= CodeCacheHotInvocationThreshold;
+
   {
     MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
 
-    nm = new (nmethod_size, comp_level)
+    nm = new (nmethod_size, comp_level, hot)
     nmethod(method(), compiler->type(), nmethod_size, immutable_data_size, mutable_data_size,
             compile_id, entry_bci, immutable_data, offsets, orig_pc_offset,
             debug_info, dependencies, code_buffer, frame_size, oop_maps,
@@ -1391,8 +1396,9 @@ nmethod::nmethod(
   }
 }
 
-void* nmethod::operator new(size_t size, int nmethod_size, int comp_level) throw () {
-  return CodeCache::allocate(nmethod_size, CodeCache::get_code_blob_type(comp_level));
+void* nmethod::operator new(size_t size, int nmethod_size, int comp_level, bool hot) throw () {
+  return CodeCache::allocate(nmethod_size, CodeCache::get_code_blob_type(comp_level),
+                             true /* handle_alloc_failure */, CodeBlobType::All, hot);
 }
 
 void* nmethod::operator new(size_t size, int nmethod_size, bool allow_NonNMethod_space) throw () {
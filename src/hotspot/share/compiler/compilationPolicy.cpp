@@ -22,6 +22,7 @@
  *
  */
 
+#include "ci/ciMethodData.hpp"
 #include "code/scopeDesc.hpp"
 #include "compiler/compilationPolicy.hpp"
 #include "compiler/compileBroker.hpp"
@@ -40,6 +41,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/safepointVerifiers.hpp"
+#include "runtime/timer.hpp"
 #ifdef COMPILER1
 #include "c1/c1_Compiler.hpp"
 #endif
@@ -623,6 +625,7 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
   Method* max_method = nullptr;
 
   jlong t = nanos_to_millis(os::javaTimeNanos());
+  jlong now = os::elapsed_counter();
   // Iterate through the queue and find a method with a maximum rate.
   for (CompileTask* task = compile_queue->first(); task != nullptr;) {
     CompileTask* next_task = task->next();
@@ -650,14 +653,14 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
       continue;
     }
     update_rate(t, mh);
-    if (max_task == nullptr || compare_methods(method, max_method)) {
+    if (max_task == nullptr || compare_tasks(task, max_task, now)) {
       // Select a method with the highest rate
       max_task = task;
       max_method = method;
     }
 
     if (task->is_blocking()) {
-      if (max_blocking_task == nullptr || compare_methods(method, max_blocking_task->method())) {
+      if (max_blocking_task == nullptr || compare_tasks(task, max_blocking_task, now)) {
         max_blocking_task = task;
       }
     }
@@ -881,18 +884,45 @@ double CompilationPolicy::weight(Method* method) {
   return (double)(method->rate() + 1) * (method->invocation_count() + 1) * (method->backedge_count() + 1);
 }
 
-// Apply heuristics and return true if x should be compiled before y
-bool CompilationPolicy::compare_methods(Method* x, Method* y) {
-  if (x->highest_comp_level() > y->highest_comp_level()) {
+int CompilationPolicy::estimated_compile_bytes(CompileTask* task) {
+  Method* method = task->method();
+  int bytes = method->code_size();
+  MethodCounters* mcs = method->method_counters();
+  if (mcs != nullptr) {
+    // The last compilation of the method tells how much of its callees get inlined
+    bytes = MAX2(bytes, mcs->compiled_bytes());
+  }
+  return bytes;
+}
+
+bool CompilationPolicy::is_overdue(CompileTask* task, jlong now) {
+  return CompileTaskDeadline > 0 &&
+         TimeHelper::counter_to_millis(now - task->time_queued()) > (double)CompileTaskDeadline;
+}
+
+// Apply heuristics and return true if task x should be compiled before task y.
+// Recompilations after deopt go first, then the tasks that waited for longer
+// than their deadline. Otherwise the weights of the methods are scaled down by
+// the expected cost of their compilation, so that a few huge methods don't hold
+// up the small hot methods behind them.
+bool CompilationPolicy::compare_tasks(CompileTask* x, CompileTask* y, jlong now) {
+  Method* xm = x->method();
+  Method* ym = y->method();
+  if (xm->highest_comp_level() != ym->highest_comp_level()) {
     // recompilation after deopt
-    return true;
-  } else
-    if (x->highest_comp_level() == y->highest_comp_level()) {
-      if (weight(x) > weight(y)) {
-        return true;
-      }
-    }
-  return false;
+    return xm->highest_comp_level() > ym->highest_comp_level();
+  }
+  bool x_overdue = is_overdue(x, now);
+  if (x_overdue != is_overdue(y, now)) {
+    return x_overdue;
+  }
+  double x_weight = weight(xm);
+  double y_weight = weight(ym);
+  if (CompileTaskCostScale > 0) {
+    x_weight /= 1.0 + (double)estimated_compile_bytes(x) / CompileTaskCostScale;
+    y_weight /= 1.0 + (double)estimated_compile_bytes(y) / CompileTaskCostScale;
+  }
+  return x_weight > y_weight;
 }
 
 // Is method profiled enough?
@@ -956,6 +986,25 @@ bool CompilationPolicy::should_not_inline(ciEnv* env, ciMethod* callee) {
   return false;
 }
 
+// Type profiles collected by C1 are sampled while C2 is busy: a method then
+// stays longer in tier 3 waiting for C2, and argument, return and parameter
+// profiles only need to see the types, not to count them. Branch and call
+// counters stay exact. Methods that were already deoptimized by C2 update
+// their profiles at every execution so that the types C2 missed are seen.
+int CompilationPolicy::type_profile_sample_stride(ciEnv* env, ciMethod* method) {
+#ifdef COMPILER1
+  if (C1TypeProfileSampleStride > 1 && env->comp_level() == CompLevel_full_profile) {
+    ciMethodData* md = method->method_data_or_null();
+    if (md != nullptr && md->decompile_count() == 0 &&
+        CompileBroker::queue_size(CompLevel_full_optimization) >=
+        Tier3DelayOff * compiler_count(CompLevel_full_optimization)) {
+      return checked_cast<int>(C1TypeProfileSampleStride);
+    }
+  }
+#endif
+  return 1;
+}
+
 // Create MDO if necessary.
 void CompilationPolicy::create_mdo(const methodHandle& mh, JavaThread* THREAD) {
   if (mh->is_native() ||
@@ -205,8 +205,12 @@ class CompilationPolicy : AllStatic {
   inline static bool is_stale(jlong t, jlong timeout, const methodHandle& method);
   // Compute the weight of the method for the compilation scheduling
   inline static double weight(Method* method);
-  // Apply heuristics and return true if x should be compiled before y
-  inline static bool compare_methods(Method* x, Method* y);
+  // Estimate the number of bytecodes, including inlined ones, the task will compile
+  inline static int estimated_compile_bytes(CompileTask* task);
+  // Did a given task wait in the queue for longer than CompileTaskDeadline
+  inline static bool is_overdue(CompileTask* task, jlong now);
+  // Apply heuristics and return true if task x should be compiled before task y
+  inline static bool compare_tasks(CompileTask* x, CompileTask* y, jlong now);
   // Compute event rate for a given method. The rate is the number of event (invocations + backedges)
   // per millisecond.
   inline static void update_rate(jlong t, const methodHandle& method);
@@ -275,6 +279,8 @@ class CompilationPolicy : AllStatic {
   // Initialize: set compiler thread count
   static void initialize();
   static bool should_not_inline(ciEnv* env, ciMethod* callee);
+  // Number of executions of C1 type profiling code per profile update
+  static int type_profile_sample_stride(ciEnv* env, ciMethod* method);
 
   // Return desired initial compilation level for Xcomp
   static CompLevel initial_compile_level(const methodHandle& method);
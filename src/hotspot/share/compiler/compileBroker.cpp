@@ -69,6 +69,7 @@
 #include "runtime/threadSMR.hpp"
 #include "runtime/timerTrace.hpp"
 #include "runtime/vframe.inline.hpp"
+#include "services/runtimeService.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/dtrace.hpp"
 #include "utilities/events.hpp"
@@ -124,6 +125,7 @@ bool CompileBroker::_initialized = false;
 volatile bool CompileBroker::_should_block = false;
 volatile int  CompileBroker::_print_compilation_warning = 0;
 volatile jint CompileBroker::_should_compile_new_jobs = run_compilation;
+volatile jlong CompileBroker::_cpu_limit_end = 0;
 
 // The installed compiler(s)
 AbstractCompiler* CompileBroker::_compilers[2];
@@ -454,6 +456,8 @@ CompileTask* CompileQueue::get(CompilerThread* thread) {
     save_method = methodHandle(thread, task->method());
 
     remove(task);
+    jlong waited = os::elapsed_counter() - task->time_queued();
+    _wait_times.record((jlong)(TimeHelper::counter_to_seconds(waited) * NANOSECS_PER_SEC));
   }
   purge_stale_tasks(); // may temporarily release MCQ lock
   return task;
@@ -566,9 +570,24 @@ void CompileQueue::print(outputStream* st) {
       task = task->next();
     }
   }
+  if (_wait_times.count() > 0) {
+    st->print_cr("Queue wait of " UINT64_FORMAT " started tasks: 50%%: %.1f ms, 90%%: %.1f ms, 99%%: %.1f ms, max: %.1f ms",
+                 _wait_times.count(),
+                 (double)_wait_times.value_at_percentile(50.0) / NANOSECS_PER_MILLISEC,
+                 (double)_wait_times.value_at_percentile(90.0) / NANOSECS_PER_MILLISEC,
+                 (double)_wait_times.value_at_percentile(99.0) / NANOSECS_PER_MILLISEC,
+                 (double)_wait_times.max() / NANOSECS_PER_MILLISEC);
+  }
   st->cr();
 }
 
+// Copied under the lock, since compiler threads record into the histogram
+// while they take tasks.
+LatencyHistogram CompileQueue::wait_times() const {
+  MutexLocker locker(MethodCompileQueue_lock);
+  return _wait_times;
+}
+
 void CompileQueue::print_tty() {
   stringStream ss;
   // Dump the compile queue into a buffer before locking the tty
@@ -1034,6 +1053,9 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
 
   // Now, we do the more expensive operations.
   julong free_memory = os::free_memory();
+  // The number of compiler threads was sized for the processors available at
+  // startup, do not add threads beyond the processors available now.
+  int active_processors = os::active_processor_count();
   // If SegmentedCodeCache is off, both values refer to the single heap (with type CodeBlobType::All).
   size_t available_cc_np = CodeCache::unallocated_capacity(CodeBlobType::MethodNonProfiled),
          available_cc_p  = CodeCache::unallocated_capacity(CodeBlobType::MethodProfiled);
@@ -1047,6 +1069,11 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
         _c2_compile_queue->size() / c2_tasks_per_thread,
         (int)(free_memory / (200*M)),
         (int)(available_cc_np / (128*K)));
+    new_c2_count = MIN2(new_c2_count, active_processors);
+    if (is_cpu_throttled()) {
+      // More threads would only share the same CPU budget.
+      new_c2_count = old_c2_count;
+    }
 
     for (int i = old_c2_count; i < new_c2_count; i++) {
 #if INCLUDE_JVMCI
@@ -1108,6 +1135,7 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
         _c1_compile_queue->size() / c1_tasks_per_thread,
         (int)(free_memory / (100*M)),
         (int)(available_cc_p / (128*K)));
+    new_c1_count = MIN2(new_c1_count, active_processors);
 
     for (int i = old_c1_count; i < new_c1_count; i++) {
       JavaThread *ct = make_thread(compiler_t, compiler1_object(i), _c1_compile_queue, _compilers[0], THREAD);
@@ -1858,6 +1886,59 @@ CompileLog* CompileBroker::get_log(CompilerThread* ct) {
   return log;
 }
 
+// Is the CPU usage of the compiler thread capped by CompilerThreadCPULimit.
+// Only the threads of the optimizing compiler are: their compilations take
+// the longest and can wait, while C1 compiles are short and needed early.
+bool CompileBroker::is_cpu_limited(CompilerThread* thread) {
+  return CompilerThreadCPULimit < 100 && BackgroundCompilation &&
+         !thread->compiler()->is_c1() && os::is_thread_cpu_time_supported();
+}
+
+// Are the CPU limited compiler threads idle to stay within the limit.
+bool CompileBroker::is_cpu_throttled() {
+  return CompilerThreadCPULimit < 100 && Atomic::load(&_cpu_limit_end) > os::javaTimeNanos();
+}
+
+// The CPU limited compiler threads together stay within CompilerThreadCPULimit
+// percent of a processor, leaving the rest to the application threads. A
+// compilation that started at start_time and used cpu_time nanoseconds
+// reserves cpu_time * 100 / CompilerThreadCPULimit of wall clock time on a
+// timeline shared by the threads, starting where the reservations of the
+// other threads end, and the thread stays idle until its reservation ends.
+void CompileBroker::limit_cpu_usage(CompilerThread* thread, jlong start_time, jlong cpu_time) {
+  if (cpu_time <= 0) {
+    return;
+  }
+  const jlong reserved = cpu_time * 100 / CompilerThreadCPULimit;
+  jlong end = Atomic::load(&_cpu_limit_end);
+  while (true) {
+    const jlong new_end = MAX2(end, start_time) + reserved;
+    const jlong prev = Atomic::cmpxchg(&_cpu_limit_end, end, new_end);
+    if (prev == end) {
+      end = new_end;
+      break;
+    }
+    end = prev;
+  }
+  jlong idle_ms = (end - os::javaTimeNanos()) / NANOSECS_PER_MILLISEC;
+  if (idle_ms <= 0) {
+    return;
+  }
+  if (trace_compiler_threads()) {
+    ResourceMark rm;
+    stringStream msg;
+    msg.print("Compiler thread %s idle for " JLONG_FORMAT " ms after using " JLONG_FORMAT " ms of CPU",
+              thread->name(), idle_ms, cpu_time / NANOSECS_PER_MILLISEC);
+    print_compiler_threads(msg);
+  }
+  ThreadBlockInVM tbivm(thread);
+  while (idle_ms > 0 && !is_compilation_disabled_forever()) {
+    jlong slice_ms = MIN2(idle_ms, (jlong)100);
+    os::naked_short_sleep(slice_ms);
+    idle_ms -= slice_ms;
+  }
+}
+
 // ------------------------------------------------------------------
 // CompileBroker::compiler_thread_loop
 //
@@ -1928,31 +2009,49 @@ void CompileBroker::compiler_thread_loop() {
         }
       }
     } else {
-      // Assign the task to the current thread.  Mark this compilation
-      // thread as active for the profiler.
-      // CompileTaskWrapper also keeps the Method* from being deallocated if redefinition
-      // occurs after fetching the compile task off the queue.
-      CompileTaskWrapper ctw(task);
-      methodHandle method(thread, task->method());
-
-      // Never compile a method if breakpoints are present in it
-      if (method()->number_of_breakpoints() == 0) {
-        // Compile the method.
-        if ((UseCompiler || AlwaysCompileLoopMethods) && CompileBroker::should_compile_new_jobs()) {
-          invoke_compiler_on_method(task);
-          thread->start_idle_timer();
+      jlong start_time = 0;
+      jlong cpu_start = -1;
+      jlong cpu_used = -1;
+      {
+        // Assign the task to the current thread.  Mark this compilation
+        // thread as active for the profiler.
+        // CompileTaskWrapper also keeps the Method* from being deallocated if redefinition
+        // occurs after fetching the compile task off the queue.
+        CompileTaskWrapper ctw(task);
+        methodHandle method(thread, task->method());
+
+        // Never compile a method if breakpoints are present in it
+        if (method()->number_of_breakpoints() == 0) {
+          // Compile the method.
+          if ((UseCompiler || AlwaysCompileLoopMethods) && CompileBroker::should_compile_new_jobs()) {
+            if (is_cpu_limited(thread)) {
+              start_time = os::javaTimeNanos();
+              cpu_start = os::thread_cpu_time(thread);
+            }
+            invoke_compiler_on_method(task);
+            thread->start_idle_timer();
+            if (cpu_start >= 0) {
+              cpu_used = os::thread_cpu_time(thread) - cpu_start;
+            }
+          } else {
+            // After compilation is disabled, remove remaining methods from queue
+            method->clear_queued_for_compilation();
+            task->set_failure_reason("compilation is disabled");
+          }
         } else {
-          // After compilation is disabled, remove remaining methods from queue
-          method->clear_queued_for_compilation();
-          task->set_failure_reason("compilation is disabled");
+          task->set_failure_reason("breakpoints are present");
         }
-      } else {
-        task->set_failure_reason("breakpoints are present");
-      }
 
-      if (UseDynamicNumberOfCompilerThreads) {
-        possibly_add_compiler_threads(thread);
-        assert(!thread->has_pending_exception(), "should have been handled");
+        if (UseDynamicNumberOfCompilerThreads) {
+          possibly_add_compiler_threads(thread);
+          assert(!thread->has_pending_exception(), "should have been handled");
+        }
+      }
+      // Throttle only after the CompileTaskWrapper is gone: a thread waiting
+      // for a blocking compilation is then already notified, and the task
+      // and the method it holds on to are released before sleeping.
+      if (cpu_used >= 0) {
+        limit_cpu_usage(thread, start_time, cpu_used);
       }
     }
   }
@@ -2356,6 +2455,12 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
 
   collect_statistics(thread, time, task);
 
+  if (UsePerfData) {
+    jlong duration_ns = (jlong)(time.seconds() * NANOSECS_PER_SEC);
+    RuntimeService::record_event(RuntimeService::compilation_event, compile_id,
+                                 os::javaTimeNanos() - duration_ns, duration_ns);
+  }
+
   if (PrintCompilation && PrintCompilation2) {
     tty->print("%7d ", (int) tty->time_stamp().milliseconds());  // print timestamp
     tty->print("%4d ", compile_id);    // print compilation number
@@ -2535,6 +2640,11 @@ void CompileBroker::collect_statistics(CompilerThread* thread, elapsedTimer time
     _t_invalidated_compilation.add(time);
   } else {
     // Compilation succeeded
+    MethodCounters* mcs = method->method_counters();
+    if (mcs != nullptr) {
+      // Remembered to estimate the cost of the next compilation of the method
+      mcs->set_compiled_bytes(method->code_size() + task->num_inlined_bytecodes());
+    }
     if (CITime) {
       int bytes_compiled = method->code_size() + task->num_inlined_bytecodes();
       if (is_osr) {
@@ -32,6 +32,7 @@
 #include "compiler/compileTask.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/perfDataTypes.hpp"
+#include "utilities/latencyHistogram.hpp"
 #include "utilities/stack.hpp"
 #if INCLUDE_JVMCI
 #include "jvmci/jvmciCompiler.hpp"
@@ -107,6 +108,7 @@ class CompileQueue : public CHeapObj<mtCompiler> {
   int _peak_size;
   uint _total_added;
   uint _total_removed;
+  LatencyHistogram _wait_times; // How long selected tasks waited in the queue, in nanoseconds, guarded by MethodCompileQueue_lock
 
   void purge_stale_tasks();
  public:
@@ -137,6 +139,7 @@ class CompileQueue : public CHeapObj<mtCompiler> {
   int         get_peak_size()     const          { return _peak_size; }
   uint        get_total_added()   const          { return _total_added; }
   uint        get_total_removed() const          { return _total_removed; }
+  LatencyHistogram wait_times() const;
 
   // Redefine Classes support
   void mark_on_stack();
@@ -183,6 +186,10 @@ class CompileBroker: AllStatic {
   // This flag can be used to stop compilation or turn it back on
   static volatile jint _should_compile_new_jobs;
 
+  // End of the wall clock time, in os::javaTimeNanos(), reserved by the
+  // compilations of the CPU limited compiler threads, see limit_cpu_usage()
+  static volatile jlong _cpu_limit_end;
+
   // The installed compiler(s)
   static AbstractCompiler* _compilers[2];
 
@@ -278,6 +285,9 @@ class CompileBroker: AllStatic {
   static void free_buffer_blob_if_allocated(CompilerThread* thread);
 
   static void invoke_compiler_on_method(CompileTask* task);
+  static bool is_cpu_limited(CompilerThread* thread);
+  static bool is_cpu_throttled();
+  static void limit_cpu_usage(CompilerThread* thread, jlong start_time, jlong cpu_time);
   static void handle_compile_error(CompilerThread* thread, CompileTask* task, ciEnv* ci_env,
                                    int compilable, const char* failure_reason);
   static void update_compile_perf_data(CompilerThread *thread, const methodHandle& method, bool is_osr);
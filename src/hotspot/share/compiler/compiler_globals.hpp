@@ -247,6 +247,17 @@
           "given timeout in milliseconds")                                  \
           range(0, max_intx)                                                \
                                                                             \
+  product(intx, CompileTaskCostScale, 4000, DIAGNOSTIC,                     \
+          "Lower the priority of a compile task that is expected to "       \
+          "compile this many more bytecodes, including inlined ones, by "   \
+          "the weight of the task. 0 ignores the cost of compiles")         \
+          range(0, max_jint)                                                \
+                                                                            \
+  product(intx, CompileTaskDeadline, 1000, DIAGNOSTIC,                      \
+          "Select compile tasks that waited in the queue for more than "    \
+          "this many milliseconds before the other tasks. 0 disables")      \
+          range(0, max_jint)                                                \
+                                                                            \
   product(intx, TieredStopAtLevel, 4,                                       \
           "Stop at given compilation level")                                \
           range(0, 4)                                                       \
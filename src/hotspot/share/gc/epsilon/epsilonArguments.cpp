@@ -24,6 +24,7 @@
 
 #include "gc/epsilon/epsilonArguments.hpp"
 #include "gc/epsilon/epsilonHeap.hpp"
+#include "gc/shared/fullGCForwarding.hpp"
 #include "gc/shared/gcArguments.hpp"
 #include "gc/shared/tlab_globals.hpp"
 #include "logging/log.hpp"
@@ -54,6 +55,10 @@ void EpsilonArguments::initialize() {
     FLAG_SET_DEFAULT(EpsilonElasticTLABDecay, false);
   }
 
+  if (EpsilonSlidingGC) {
+    FullGCForwarding::initialize_flags(MaxHeapSize);
+  }
+
 #ifdef COMPILER2
   // Enable loop strip mining: there are still non-GC safepoints, no need to make it worse
   if (FLAG_IS_DEFAULT(UseCountedLoopSafepoints)) {
@@ -23,21 +23,47 @@
  *
  */
 
+#include "classfile/classLoaderData.inline.hpp"
+#include "classfile/classLoaderDataGraph.hpp"
+#include "code/codeCache.hpp"
+#include "compiler/oopMap.hpp"
 #include "gc/epsilon/epsilonHeap.hpp"
 #include "gc/epsilon/epsilonInitLogger.hpp"
 #include "gc/epsilon/epsilonMemoryPool.hpp"
 #include "gc/epsilon/epsilonThreadLocalData.hpp"
+#include "gc/epsilon/epsilonVMOperations.hpp"
+#include "gc/shared/continuationGCSupport.inline.hpp"
+#include "gc/shared/fullGCForwarding.inline.hpp"
 #include "gc/shared/gcArguments.hpp"
+#include "gc/shared/gcId.hpp"
+#include "gc/shared/gcLocker.inline.hpp"
+#include "gc/shared/gcTraceTime.inline.hpp"
+#include "gc/shared/gcVMOperations.hpp"
+#include "gc/shared/isGCActiveMark.hpp"
 #include "gc/shared/locationPrinter.inline.hpp"
+#include "gc/shared/markBitMap.inline.hpp"
+#include "gc/shared/oopStorageSet.inline.hpp"
+#include "gc/shared/preservedMarks.inline.hpp"
+#include "gc/shared/weakProcessor.hpp"
 #include "logging/log.hpp"
 #include "memory/allocation.hpp"
 #include "memory/allocation.inline.hpp"
+#include "memory/iterator.inline.hpp"
+#include "memory/memoryReserver.hpp"
 #include "memory/metaspaceUtils.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
+#include "oops/access.inline.hpp"
+#include "oops/compressedOops.inline.hpp"
+#include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/globals.hpp"
+#include "runtime/threads.hpp"
+#include "runtime/vmThread.hpp"
+#include "services/memoryService.hpp"
+#include "utilities/copy.hpp"
 #include "utilities/ostream.hpp"
+#include "utilities/stack.inline.hpp"
 
 jint EpsilonHeap::initialize() {
   size_t align = HeapAlignment;
@@ -69,6 +95,23 @@ jint EpsilonHeap::initialize() {
   // Install barrier set
   BarrierSet::set_barrier_set(new EpsilonBarrierSet());
 
+  if (EpsilonSlidingGC) {
+    // Reserve the marking bitmap, it is only committed for the duration of a collection.
+    size_t bitmap_size = MarkBitMap::compute_size(heap_rs.size());
+    ReservedSpace bitmap = MemoryReserver::reserve(bitmap_size,
+                                                   os::vm_allocation_granularity(),
+                                                   os::vm_page_size(),
+                                                   mtGC);
+    if (!bitmap.is_reserved()) {
+      vm_exit_during_initialization("Could not reserve space for the marking bitmap");
+    }
+    _bitmap_region = MemRegion((HeapWord*) bitmap.base(), bitmap.size() / HeapWordSize);
+    _mark_bitmap.initialize(_reserved, _bitmap_region);
+
+    FullGCForwarding::initialize(_reserved);
+    GCLocker::initialize();
+  }
+
   // All done, print out the configuration
   EpsilonInitLogger::print();
 
@@ -173,6 +216,31 @@ HeapWord* EpsilonHeap::allocate_work(size_t size, bool verbose) {
   return res;
 }
 
+HeapWord* EpsilonHeap::allocate_or_collect_work(size_t size, bool verbose) {
+  HeapWord* res = allocate_work(size, verbose);
+  while (res == nullptr && EpsilonSlidingGC) {
+    uint gc_count_before;
+    uint full_gc_count_before;
+    {
+      MutexLocker ml(Heap_lock);
+      // Read the GC counts while holding the Heap_lock
+      gc_count_before      = total_collections();
+      full_gc_count_before = total_full_collections();
+    }
+
+    VM_EpsilonCollect op(gc_count_before, full_gc_count_before, GCCause::_allocation_failure);
+    VMThread::execute(&op);
+
+    res = allocate_work(size, verbose);
+    if (op.prologue_succeeded()) {
+      // Even the collection we requested could not make room: the heap is exhausted.
+      break;
+    }
+    // Otherwise another thread collected while this one was waiting, retry.
+  }
+  return res;
+}
+
 HeapWord* EpsilonHeap::allocate_new_tlab(size_t min_size,
                                          size_t requested_size,
                                          size_t* actual_size) {
@@ -239,7 +307,7 @@ HeapWord* EpsilonHeap::allocate_new_tlab(size_t min_size,
   }
 
   // All prepared, let's do it!
-  HeapWord* res = allocate_work(size);
+  HeapWord* res = allocate_or_collect_work(size);
 
   if (res != nullptr) {
     // Allocation successful
@@ -263,7 +331,7 @@ HeapWord* EpsilonHeap::allocate_new_tlab(size_t min_size,
 
 HeapWord* EpsilonHeap::mem_allocate(size_t size, bool *gc_overhead_limit_was_exceeded) {
   *gc_overhead_limit_was_exceeded = false;
-  return allocate_work(size);
+  return allocate_or_collect_work(size);
 }
 
 HeapWord* EpsilonHeap::allocate_loaded_archive_space(size_t size) {
@@ -298,6 +366,240 @@ void EpsilonHeap::object_iterate(ObjectClosure *cl) {
   _space->object_iterate(cl);
 }
 
+void EpsilonHeap::pin_object(JavaThread* thread, oop obj) {
+  if (EpsilonSlidingGC) {
+    GCLocker::enter(thread);
+  }
+}
+
+void EpsilonHeap::unpin_object(JavaThread* thread, oop obj) {
+  if (EpsilonSlidingGC) {
+    GCLocker::exit(thread);
+  }
+}
+
+// Sliding mark-compact: objects are marked in a side bitmap, then slid
+// towards the bottom of the space in address order. Forwarding pointers are
+// kept in the mark words, the marks that need to survive are preserved on the
+// side. There is no reference processing and no class unloading: everything
+// the runtime points to is considered live.
+
+class EpsilonMarkOopClosure : public BasicOopIterateClosure {
+  Stack<oop, mtGC>* const _stack;
+  MarkBitMap* const _bitmap;
+
+  template <class T>
+  void do_oop_work(T* p) {
+    T heap_oop = RawAccess<>::oop_load(p);
+    if (!CompressedOops::is_null(heap_oop)) {
+      oop obj = CompressedOops::decode_not_null(heap_oop);
+      if (!_bitmap->is_marked(obj)) {
+        _bitmap->mark(obj);
+        ContinuationGCSupport::transform_stack_chunk(obj);
+        _stack->push(obj);
+      }
+    }
+  }
+
+public:
+  EpsilonMarkOopClosure(Stack<oop, mtGC>* stack, MarkBitMap* bitmap) :
+    _stack(stack), _bitmap(bitmap) {}
+
+  void do_oop(oop* p)       { do_oop_work(p); }
+  void do_oop(narrowOop* p) { do_oop_work(p); }
+};
+
+class EpsilonCalcNewLocationObjectClosure : public ObjectClosure {
+  HeapWord* _compact_point;
+  PreservedMarks* const _preserved_marks;
+
+public:
+  EpsilonCalcNewLocationObjectClosure(HeapWord* start, PreservedMarks* pm) :
+    _compact_point(start), _preserved_marks(pm) {}
+
+  void do_object(oop obj) {
+    // Objects that stay in place keep their mark word and need no forwarding.
+    if (cast_from_oop<HeapWord*>(obj) != _compact_point) {
+      _preserved_marks->push_if_necessary(obj, obj->mark());
+      FullGCForwarding::forward_to(obj, cast_to_oop(_compact_point));
+    }
+    _compact_point += obj->size();
+  }
+
+  HeapWord* compact_point() const { return _compact_point; }
+};
+
+class EpsilonAdjustPointersOopClosure : public BasicOopIterateClosure {
+  template <class T>
+  void do_oop_work(T* p) {
+    T heap_oop = RawAccess<>::oop_load(p);
+    if (!CompressedOops::is_null(heap_oop)) {
+      oop obj = CompressedOops::decode_not_null(heap_oop);
+      if (FullGCForwarding::is_forwarded(obj)) {
+        oop new_obj = FullGCForwarding::forwardee(obj);
+        RawAccess<IS_NOT_NULL>::oop_store(p, new_obj);
+      }
+    }
+  }
+
+public:
+  void do_oop(oop* p)       { do_oop_work(p); }
+  void do_oop(narrowOop* p) { do_oop_work(p); }
+};
+
+class EpsilonAdjustPointersObjectClosure : public ObjectClosure {
+  EpsilonAdjustPointersOopClosure _cl;
+
+public:
+  void do_object(oop obj) {
+    obj->oop_iterate(&_cl);
+  }
+};
+
+class EpsilonMoveObjectsObjectClosure : public ObjectClosure {
+public:
+  void do_object(oop obj) {
+    if (FullGCForwarding::is_forwarded(obj)) {
+      oop new_obj = FullGCForwarding::forwardee(obj);
+      // Objects only ever slide down, and the ones below have already been
+      // moved, so the source header is intact until it is copied.
+      size_t size = obj->size();
+      Copy::aligned_conjoint_words(cast_from_oop<HeapWord*>(obj), cast_from_oop<HeapWord*>(new_obj), size);
+      new_obj->init_mark();
+    }
+  }
+};
+
+template <typename ObjectClosureType>
+void EpsilonHeap::walk_bitmap(ObjectClosureType* cl, HeapWord* limit) {
+  HeapWord* addr = _mark_bitmap.get_next_marked_addr(_space->bottom(), limit);
+  while (addr < limit) {
+    oop obj = cast_to_oop(addr);
+    assert(_mark_bitmap.is_marked(obj), "sanity");
+    cl->do_object(obj);
+    addr = _mark_bitmap.get_next_marked_addr(addr + 1, limit);
+  }
+}
+
+void EpsilonHeap::process_roots(OopClosure* cl, bool fix_relocations) {
+  CLDToOopClosure clds(cl, ClassLoaderData::_claim_none);
+  ClassLoaderDataGraph::cld_do(&clds);
+
+  // The whole code cache is scanned below, no need to visit nmethods on stacks.
+  Threads::oops_do(cl, nullptr);
+
+  OopStorageSet::strong_oops_do(cl);
+
+  // Weak roots are treated as strong, nothing is ever cleared.
+  WeakProcessor::oops_do(cl);
+
+  NMethodToOopClosure code(cl, fix_relocations);
+  CodeCache::nmethods_do(&code);
+}
+
+void EpsilonHeap::collect_at_safepoint() {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at a safepoint");
+  assert(EpsilonSlidingGC, "only with sliding GC");
+  assert(!GCLocker::is_active(), "precondition");
+
+  IsSTWGCActiveMark gc_active_mark;
+  SvcGCMarker sgcm(SvcGCMarker::FULL);
+  GCIdMark gc_id_mark;
+  GCTraceTime(Info, gc) t("Pause Full", nullptr, gc_cause(), true);
+  TraceMemoryManagerStats tmms(&_memory_manager, gc_cause(), "end of GC");
+  print_heap_before_gc();
+
+  increment_total_collections(true /* full */);
+
+  if (!os::commit_memory((char*)_bitmap_region.start(), _bitmap_region.byte_size(), false)) {
+    log_warning(gc)("Could not commit native memory for the marking bitmap, GC skipped");
+    return;
+  }
+
+  // Retire TLABs, so that all allocations happen in the compacted space afterwards.
+  ensure_parsability(true);
+  COMPILER2_OR_JVMCI_PRESENT(DerivedPointerTable::clear());
+
+  HeapWord* const bottom = _space->bottom();
+  HeapWord* const top = _space->top();
+  if (bottom < top) {
+    _mark_bitmap.clear_range_large(MemRegion(bottom, top));
+  }
+
+  PreservedMarks preserved_marks;
+
+  {
+    GCTraceTime(Info, gc, phases) tm("Phase 1: Mark live objects", nullptr);
+
+    Stack<oop, mtGC> stack;
+    EpsilonMarkOopClosure cl(&stack, &_mark_bitmap);
+    process_roots(&cl, !NMethodToOopClosure::FixRelocations);
+    while (!stack.is_empty()) {
+      stack.pop()->oop_iterate(&cl);
+    }
+  }
+
+  // Don't add any more derived pointers during the pointer adjustment
+#if COMPILER2_OR_JVMCI
+  assert(DerivedPointerTable::is_active(), "Sanity");
+  DerivedPointerTable::set_active(false);
+#endif
+
+  HeapWord* new_top;
+  {
+    GCTraceTime(Info, gc, phases) tm("Phase 2: Compute new object addresses", nullptr);
+
+    EpsilonCalcNewLocationObjectClosure cl(bottom, &preserved_marks);
+    walk_bitmap(&cl, top);
+    new_top = cl.compact_point();
+  }
+
+  {
+    GCTraceTime(Info, gc, phases) tm("Phase 3: Adjust pointers", nullptr);
+
+    EpsilonAdjustPointersObjectClosure cl;
+    walk_bitmap(&cl, top);
+
+    EpsilonAdjustPointersOopClosure root_cl;
+    process_roots(&root_cl, NMethodToOopClosure::FixRelocations);
+
+    preserved_marks.adjust_during_full_gc();
+  }
+
+  {
+    GCTraceTime(Info, gc, phases) tm("Phase 4: Move objects", nullptr);
+
+    EpsilonMoveObjectsObjectClosure cl;
+    walk_bitmap(&cl, top);
+
+    _space->set_top(new_top);
+    if (ZapUnusedHeapArea && new_top < top) {
+      _space->mangle_unused_area(MemRegion(new_top, top));
+    }
+  }
+
+  log_debug(gc)("Restoring %zu marks", preserved_marks.size());
+  preserved_marks.restore();
+  COMPILER2_OR_JVMCI_PRESENT(DerivedPointerTable::update_pointers());
+
+  if (!os::uncommit_memory((char*)_bitmap_region.start(), _bitmap_region.byte_size())) {
+    log_warning(gc)("Could not uncommit native memory for the marking bitmap");
+  }
+
+  // Occupancy went down, restart the counter and printing steps from here.
+  size_t used = _space->used();
+  _last_counter_update = used;
+  _last_heap_print = used;
+
+  update_capacity_and_used_at_gc();
+  record_whole_heap_examined_timestamp();
+
+  MemoryService::track_memory_usage();
+  _monitoring_support->update_counters();
+
+  print_heap_after_gc();
+}
+
 void EpsilonHeap::print_heap_on(outputStream *st) const {
   st->print_cr("Epsilon Heap");
 
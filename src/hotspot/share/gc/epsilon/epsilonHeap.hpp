@@ -29,6 +29,7 @@
 #include "gc/epsilon/epsilonBarrierSet.hpp"
 #include "gc/epsilon/epsilonMonitoringSupport.hpp"
 #include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/markBitMap.hpp"
 #include "gc/shared/softRefPolicy.hpp"
 #include "gc/shared/space.hpp"
 #include "memory/virtualspace.hpp"
@@ -48,6 +49,8 @@ class EpsilonHeap : public CollectedHeap {
   int64_t _decay_time_ns;
   volatile size_t _last_counter_update;
   volatile size_t _last_heap_print;
+  MemRegion _bitmap_region;
+  MarkBitMap _mark_bitmap;
 
 public:
   static EpsilonHeap* heap();
@@ -87,6 +90,7 @@ class EpsilonHeap : public CollectedHeap {
 
   // Allocation
   HeapWord* allocate_work(size_t size, bool verbose = true);
+  HeapWord* allocate_or_collect_work(size_t size, bool verbose = true);
   HeapWord* mem_allocate(size_t size, bool* gc_overhead_limit_was_exceeded) override;
   HeapWord* allocate_new_tlab(size_t min_size,
                               size_t requested_size,
@@ -101,12 +105,16 @@ class EpsilonHeap : public CollectedHeap {
   void collect(GCCause::Cause cause) override;
   void do_full_collection(bool clear_all_soft_refs) override;
 
+  // Sliding mark-compact of the whole heap, only with EpsilonSlidingGC.
+  void collect_at_safepoint();
+
   // Heap walking support
   void object_iterate(ObjectClosure* cl) override;
 
-  // Object pinning support: every object is implicitly pinned
-  void pin_object(JavaThread* thread, oop obj) override { }
-  void unpin_object(JavaThread* thread, oop obj) override { }
+  // Object pinning support: every object is implicitly pinned, unless
+  // EpsilonSlidingGC can move it. Then JNI critical regions hold off the GC.
+  void pin_object(JavaThread* thread, oop obj) override;
+  void unpin_object(JavaThread* thread, oop obj) override;
 
   // No support for block parsing.
   HeapWord* block_start(const void* addr) const { return nullptr;  }
@@ -140,6 +148,10 @@ class EpsilonHeap : public CollectedHeap {
   void print_heap_info(size_t used) const;
   void print_metaspace_info() const;
 
+  void process_roots(OopClosure* cl, bool fix_relocations);
+  template <typename ObjectClosureType>
+  void walk_bitmap(ObjectClosureType* cl, HeapWord* limit);
+
 };
 
 #endif // SHARE_GC_EPSILON_EPSILONHEAP_HPP
@@ -44,6 +44,10 @@ void EpsilonInitLogger::print_gc_specific() {
     log_info(gc, init)("TLAB: Disabled");
   }
 
+  if (EpsilonSlidingGC) {
+    log_info(gc, init)("Sliding GC: Enabled");
+  }
+
   // Suggest that non-resizable heap might be better for some configurations.
   // We are not adjusting the heap size by ourselves, because it affects startup time.
   if (InitialHeapSize != MaxHeapSize) {
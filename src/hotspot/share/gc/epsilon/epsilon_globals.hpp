@@ -85,7 +85,13 @@
   product(size_t, EpsilonMinHeapExpand, 128 * M, EXPERIMENTAL,              \
           "Min expansion step for heap. Larger value improves performance " \
           "at the potential expense of memory waste.")                      \
-          range(1, max_intx)
+          range(1, max_intx)                                                \
+                                                                            \
+  product(bool, EpsilonSlidingGC, false, EXPERIMENTAL,                      \
+          "Perform a stop-the-world sliding mark-compact collection when "  \
+          "the heap is exhausted, instead of failing the allocation. "      \
+          "No collection happens until the heap is fully expanded and "     \
+          "full. All classes and weakly reachable objects are retained.")
 
 // end of GC_EPSILON_FLAGS
 
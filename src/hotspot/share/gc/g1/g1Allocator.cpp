@@ -365,6 +365,13 @@ bool G1PLABAllocator::may_throw_away_buffer(size_t const words_remaining, size_t
   return (words_remaining * 100 < buffer_size * ParallelGCBufferWastePct);
 }
 
+bool G1PLABAllocator::should_allocate_direct(size_t const required_in_plab, size_t const plab_word_size) const {
+  // Large objects would use up most of a fresh PLAB anyway; allocating them directly
+  // keeps the tail of the current PLAB usable and saves a refill. The PLAB size is the
+  // one of this thread, so threads with boosted PLABs keep more objects in them.
+  return (required_in_plab * 100 > plab_word_size * G1PLABDirectAllocationPercent);
+}
+
 HeapWord* G1PLABAllocator::allocate_direct_or_new_plab(G1HeapRegionAttr dest,
                                                        size_t word_sz,
                                                        bool* plab_refill_failed,
@@ -384,10 +391,11 @@ HeapWord* G1PLABAllocator::allocate_direct_or_new_plab(G1HeapRegionAttr dest,
 
   size_t required_in_plab = PLAB::size_required_for_allocation(word_sz);
 
-  // Only get a new PLAB if the allocation fits into the to-be-allocated PLAB and
-  // retiring the current PLAB would not waste more than ParallelGCBufferWastePct
-  // in the current PLAB. Boosting the PLAB also increasingly allows more waste to occur.
-  if ((required_in_plab <= next_plab_word_size) &&
+  // Only get a new PLAB if the allocation fits into the to-be-allocated PLAB (bounded
+  // by G1PLABDirectAllocationPercent) and retiring the current PLAB would not waste more
+  // than ParallelGCBufferWastePct in the current PLAB. Boosting the PLAB also increasingly
+  // allows more waste to occur.
+  if (!should_allocate_direct(required_in_plab, next_plab_word_size) &&
     may_throw_away_buffer(words_remaining, plab_word_size)) {
 
     alloc_buf->retire();
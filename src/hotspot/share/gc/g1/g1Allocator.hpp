@@ -195,6 +195,9 @@ class G1PLABAllocator : public CHeapObj<mtGC> {
   inline uint alloc_buffers_length(region_type_t dest) const;
 
   bool may_throw_away_buffer(size_t const allocation_word_sz, size_t const buffer_size) const;
+  // Returns whether an allocation requiring required_in_plab words should bypass
+  // a PLAB of plab_word_size words and go directly into the destination region.
+  bool should_allocate_direct(size_t const required_in_plab, size_t const plab_word_size) const;
 public:
   G1PLABAllocator(G1Allocator* allocator);
 
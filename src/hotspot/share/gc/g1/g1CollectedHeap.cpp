@@ -1169,6 +1169,7 @@ G1CollectedHeap::G1CollectedHeap() :
   _collector_state(),
   _old_marking_cycles_started(0),
   _old_marking_cycles_completed(0),
+  _deferred_unloaded_clds(nullptr),
   _eden(),
   _survivor(),
   _gc_timer_stw(new STWGCTimer()),
@@ -2043,9 +2044,9 @@ size_t G1CollectedHeap::tlab_used(Thread* ignored) const {
 }
 
 // For G1 TLABs should not contain humongous objects, so the maximum TLAB size
-// must be equal to the humongous object limit.
+// must not exceed the humongous object limit.
 size_t G1CollectedHeap::max_tlab_size() const {
-  return align_down(_humongous_object_threshold_in_words, MinObjAlignment);
+  return align_down(max_lab_size_for(G1HeapRegion::GrainWords), MinObjAlignment);
 }
 
 size_t G1CollectedHeap::unsafe_max_tlab_alloc(Thread* ignored) const {
@@ -2529,6 +2530,10 @@ void G1CollectedHeap::complete_cleaning(bool class_unloading_occurred) {
 void G1CollectedHeap::unload_classes_and_code(const char* description, BoolObjectClosure* is_alive, GCTimer* timer) {
   GCTraceTime(Debug, gc, phases) debug(description, timer);
 
+  // The concurrent cycle that was to free class loader data unloaded by an
+  // earlier Remark may have been aborted. Do that now.
+  purge_deferred_unloaded_clds(true /* at_safepoint */);
+
   ClassUnloadingContext ctx(workers()->active_workers(),
                             false /* unregister_nmethods_during_purge */,
                             false /* lock_nmethod_free_separately */);
@@ -2550,13 +2555,30 @@ void G1CollectedHeap::unload_classes_and_code(const char* description, BoolObjec
     GCTraceTime(Debug, gc, phases) t("Free Code Blobs", timer);
     ctx.free_nmethods();
   }
-  {
+  // Unloaded class loader data is not reachable from the graph any more, so
+  // the concurrent mark thread can free it after the pause.
+  ClassLoaderData* deferred = nullptr;
+  if (G1ConcurrentPurgeClassLoaderData && !collector_state()->in_full_gc()) {
+    deferred = ctx.take_unloading_class_loader_data();
+  }
+  if (deferred != nullptr) {
+    Atomic::release_store(&_deferred_unloaded_clds, deferred);
+  } else {
+    // Also taken when there is nothing to free concurrently: the metaspaces
+    // must still be purged and the dependency contexts and metadata cleaned.
     GCTraceTime(Debug, gc, phases) t("Purge Class Loader Data", timer);
     ClassLoaderDataGraph::purge(true /* at_safepoint */);
     DEBUG_ONLY(MetaspaceUtils::verify();)
   }
 }
 
+void G1CollectedHeap::purge_deferred_unloaded_clds(bool at_safepoint) {
+  ClassLoaderData* head = Atomic::xchg(&_deferred_unloaded_clds, (ClassLoaderData*)nullptr);
+  if (head != nullptr) {
+    ClassLoaderDataGraph::purge_unloaded(head, at_safepoint);
+  }
+}
+
 class G1BulkUnregisterNMethodTask : public WorkerTask {
   G1HeapRegionClaimer _hrclaimer;
 
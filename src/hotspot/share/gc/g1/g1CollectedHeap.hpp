@@ -55,6 +55,7 @@
 #include "memory/allocation.hpp"
 #include "memory/iterator.hpp"
 #include "memory/memRegion.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/threadSMR.hpp"
 #include "utilities/bitMap.hpp"
@@ -291,6 +292,10 @@ class G1CollectedHeap : public CollectedHeap {
   // concurrent cycles) we have completed.
   volatile uint _old_marking_cycles_completed;
 
+  // Class loader data unloaded during Remark, to be freed by the concurrent
+  // mark thread after the pause.
+  ClassLoaderData* volatile _deferred_unloaded_clds;
+
   // Create a memory mapper for auxiliary data structures of the given size and
   // translation factor.
   static G1RegionToSpaceMapper* create_aux_memory_mapper(const char* description,
@@ -1190,7 +1195,14 @@ class G1CollectedHeap : public CollectedHeap {
 
   // Returns the humongous threshold for a specific region size
   static size_t humongous_threshold_for(size_t region_size) {
-    return (region_size / 2);
+    return region_size * G1HumongousThresholdPercent / 100;
+  }
+
+  // Returns the maximum TLAB and PLAB size for a specific region size. Raising the
+  // humongous threshold must not make the LABs larger than half a region, as every
+  // retired LAB would then waste a large fraction of a region.
+  static size_t max_lab_size_for(size_t region_size) {
+    return MIN2(humongous_threshold_for(region_size), region_size / 2);
   }
 
   // Returns the number of regions the humongous object of the given word size
@@ -1276,6 +1288,10 @@ class G1CollectedHeap : public CollectedHeap {
 
   void unload_classes_and_code(const char* description, BoolObjectClosure* cl, GCTimer* timer);
 
+  // Free class loader data whose purge has been deferred from Remark.
+  bool has_deferred_unloaded_clds() const { return Atomic::load(&_deferred_unloaded_clds) != nullptr; }
+  void purge_deferred_unloaded_clds(bool at_safepoint);
+
   void bulk_unregister_nmethods();
 
   // Verification
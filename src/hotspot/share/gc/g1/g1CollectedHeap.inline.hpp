@@ -97,7 +97,7 @@ size_t G1CollectedHeap::desired_plab_sz(G1HeapRegionAttr dest) {
 }
 
 inline size_t G1CollectedHeap::clamp_plab_size(size_t value) const {
-  return clamp(value, PLAB::min_size(), _humongous_object_threshold_in_words);
+  return clamp(value, PLAB::min_size(), max_lab_size_for(G1HeapRegion::GrainWords));
 }
 
 // Inline functions for G1CollectedHeap
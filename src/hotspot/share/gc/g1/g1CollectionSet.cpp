@@ -312,6 +312,7 @@ double G1CollectionSet::finalize_young_part(double target_pause_time_ms, G1Survi
   double predicted_eden_time = _policy->predict_young_region_other_time_ms(eden_region_length) +
                                _policy->predict_eden_copy_time_ms(eden_region_length);
   double remaining_time_ms = MAX2(target_pause_time_ms - (predicted_base_time_ms + predicted_eden_time), 0.0);
+  _policy->add_predicted_pause_time_ms(predicted_base_time_ms + predicted_eden_time);
 
   log_trace(gc, ergo, cset)("Added young regions to CSet. Eden: %u regions, Survivors: %u regions, "
                             "predicted eden time: %1.2fms, predicted base time: %1.2fms, target pause time: %1.2fms, remaining time: %1.2fms",
@@ -459,6 +460,8 @@ double G1CollectionSet::select_candidates_from_marking(double time_remaining_ms)
     }
   }
 
+  _policy->add_predicted_pause_time_ms(predicted_initial_time_ms);
+
   // Remove selected groups from list of candidate groups.
   if (num_initial_groups > 0) {
     candidates()->remove(&selected_groups);
@@ -564,6 +567,8 @@ void G1CollectionSet::select_candidates_from_retained(double time_remaining_ms)
     optional_time_remaining_ms = MAX2(0.0, optional_time_remaining_ms - predicted_time_ms);
   }
 
+  _policy->add_predicted_pause_time_ms(predicted_initial_time_ms);
+
   if (num_initial_regions == retained_groups->num_regions()) {
     log_debug(gc, ergo, cset)("Retained candidates exhausted.");
   }
@@ -633,6 +638,7 @@ uint G1CollectionSet::select_optional_collection_set_regions(double time_remaini
   uint num_regions_selected = 0;
 
   double total_prediction_ms = select_candidates_from_optional_groups(time_remaining_ms, num_regions_selected);
+  _policy->add_predicted_pause_time_ms(total_prediction_ms);
 
   time_remaining_ms -= total_prediction_ms;
 
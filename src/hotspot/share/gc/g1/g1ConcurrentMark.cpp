@@ -59,6 +59,7 @@
 #include "jvm.h"
 #include "logging/log.hpp"
 #include "memory/allocation.hpp"
+#include "memory/heapInspection.hpp"
 #include "memory/iterator.hpp"
 #include "memory/metaspaceUtils.hpp"
 #include "memory/resourceArea.hpp"
@@ -516,7 +517,9 @@ G1ConcurrentMark::G1ConcurrentMark(G1CollectedHeap* g1h,
   _region_mark_stats(NEW_C_HEAP_ARRAY(G1RegionMarkStats, _g1h->max_reserved_regions(), mtGC)),
   _top_at_mark_starts(NEW_C_HEAP_ARRAY(HeapWord*, _g1h->max_reserved_regions(), mtGC)),
   _top_at_rebuild_starts(NEW_C_HEAP_ARRAY(HeapWord*, _g1h->max_reserved_regions(), mtGC)),
-  _needs_remembered_set_rebuild(false)
+  _needs_remembered_set_rebuild(false),
+  _histogram(nullptr),
+  _completed_histogram(nullptr)
 {
   assert(CGC_lock != nullptr, "CGC_lock must be initialized");
 
@@ -902,6 +905,10 @@ void G1ConcurrentMark::pre_concurrent_start(GCCause::Cause cause) {
   G1CollectedHeap::heap()->run_batch_task(&cl);
 
   _gc_tracer_cm->set_gc_cause(cause);
+
+  // Objects are marked starting with the roots evacuated in this pause.
+  assert(_histogram == nullptr && _completed_histogram == nullptr, "must have been reported or cancelled");
+  _histogram = ConcurrentHeapHistogram::claim(_max_num_tasks);
 }
 
 
@@ -926,6 +933,33 @@ void G1ConcurrentMark::post_concurrent_mark_start() {
 
 void G1ConcurrentMark::post_concurrent_undo_start() {
   root_regions()->cancel_scan();
+  // No marking in this cycle, leave the histogram to the next one.
+  cancel_histogram();
+}
+
+void G1ConcurrentMark::cancel_histogram() {
+  if (_histogram != nullptr) {
+    ConcurrentHeapHistogram::cancel(_histogram);
+    _histogram = nullptr;
+  }
+  ConcurrentHeapHistogram* completed = Atomic::load(&_completed_histogram);
+  if (completed != nullptr) {
+    ConcurrentHeapHistogram::cancel(completed);
+    Atomic::store(&_completed_histogram, (ConcurrentHeapHistogram*)nullptr);
+  }
+}
+
+void G1ConcurrentMark::report_histogram() {
+  // The histogram refers to the classes of the recorded objects. Keep out
+  // safepoints, which may unload classes or cancel the histogram, while it
+  // is printed.
+  SuspendibleThreadSetJoiner sts_join;
+  ConcurrentHeapHistogram* completed = Atomic::load(&_completed_histogram);
+  if (completed != nullptr) {
+    Atomic::store(&_completed_histogram, (ConcurrentHeapHistogram*)nullptr);
+    ConcurrentHeapHistogram::report(completed, "Objects in young regions and objects allocated "
+                                               "since marking started are not included.");
+  }
 }
 
 /*
@@ -1426,6 +1460,10 @@ void G1ConcurrentMark::remark() {
       flush_all_task_caches();
     }
 
+    // The histogram is reported by the concurrent mark thread after the pause.
+    Atomic::store(&_completed_histogram, _histogram);
+    _histogram = nullptr;
+
     // All marking completed. Check bitmap now as we will start to reset TAMSes
     // in parallel below so that we can not do this in the After-Remark verification.
     _g1h->verifier()->verify_bitmap_clear(true /* above_tams_only */);
@@ -2053,6 +2091,8 @@ bool G1ConcurrentMark::concurrent_cycle_abort() {
   // early.
   root_region_scan_abort_and_wait();
 
+  cancel_histogram();
+
   // We haven't started a concurrent cycle no need to do anything; we might have
   // aborted the marking because of shutting down though. In this case the marking
   // might have already completed the abort (leading to in_progress() below to
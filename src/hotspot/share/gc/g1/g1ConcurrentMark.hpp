@@ -37,10 +37,12 @@
 #include "gc/shared/workerThread.hpp"
 #include "gc/shared/workerUtils.hpp"
 #include "memory/allocation.hpp"
+#include "runtime/atomic.hpp"
 #include "utilities/compilerWarnings.hpp"
 #include "utilities/numberSeq.hpp"
 
 class ConcurrentGCTimer;
+class ConcurrentHeapHistogram;
 class G1CollectedHeap;
 class G1ConcurrentMark;
 class G1ConcurrentMarkThread;
@@ -551,6 +553,12 @@ class G1ConcurrentMark : public CHeapObj<mtGC> {
   HeapWord* volatile* _top_at_rebuild_starts;
   // True when Remark pause selected regions for rebuilding.
   bool _needs_remembered_set_rebuild;
+  // Class histogram requested for the current marking cycle, if any.
+  ConcurrentHeapHistogram* _histogram;
+  // Class histogram of a completed marking, reported after Remark.
+  ConcurrentHeapHistogram* volatile _completed_histogram;
+
+  void cancel_histogram();
 public:
   // To be called when an object is marked the first time, e.g. after a successful
   // mark_in_bitmap call. Updates various statistics data.
@@ -681,6 +689,12 @@ class G1ConcurrentMark : public CHeapObj<mtGC> {
 
   void remark();
 
+  // Merge, sort and log the class histogram gathered by the completed
+  // marking, if one was requested. Called by the concurrent mark thread
+  // after Remark.
+  bool has_completed_histogram() const { return Atomic::load(&_completed_histogram) != nullptr; }
+  void report_histogram();
+
   void cleanup();
 
   // Mark in the marking bitmap. Used during evacuation failure to
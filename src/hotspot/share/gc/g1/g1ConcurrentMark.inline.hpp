@@ -38,6 +38,7 @@
 #include "gc/g1/g1RemSetTrackingPolicy.hpp"
 #include "gc/shared/suspendibleThreadSet.hpp"
 #include "gc/shared/taskqueue.inline.hpp"
+#include "memory/heapInspection.hpp"
 #include "utilities/bitMap.inline.hpp"
 
 inline bool G1CMIsAliveClosure::do_object_b(oop obj) {
@@ -234,6 +235,9 @@ inline void G1CMTask::inc_incoming_refs(oop const obj) {
 
 inline void G1ConcurrentMark::add_to_liveness(uint worker_id, oop const obj, size_t size) {
   task(worker_id)->update_liveness(obj, size);
+  if (_histogram != nullptr) {
+    _histogram->record(worker_id, obj);
+  }
 }
 
 inline void G1CMTask::abort_marking_if_regular_check_fail() {
@@ -237,6 +237,27 @@ bool G1ConcurrentMarkThread::subphase_remark() {
   return _cm->has_aborted();
 }
 
+bool G1ConcurrentMarkThread::phase_report_class_histogram() {
+  if (_cm->has_completed_histogram()) {
+    G1ConcPhaseTimer p(_cm, "Concurrent Report Class Histogram");
+    _cm->report_histogram();
+  }
+  return _cm->has_aborted();
+}
+
+bool G1ConcurrentMarkThread::phase_purge_class_loader_data() {
+  G1CollectedHeap* g1h = G1CollectedHeap::heap();
+  if (g1h->has_deferred_unloaded_clds()) {
+    G1ConcPhaseTimer p(_cm, "Concurrent Purge Class Loader Data");
+    // Keep safepoints out while purging: a Full GC or another Remark purges
+    // pending class loader data itself, and walks the dependency contexts and
+    // metaspaces that are freed here.
+    SuspendibleThreadSetJoiner sts_join;
+    g1h->purge_deferred_unloaded_clds(false /* at_safepoint */);
+  }
+  return _cm->has_aborted();
+}
+
 bool G1ConcurrentMarkThread::phase_rebuild_and_scrub() {
   ConcurrentGCBreakpoints::at("AFTER REBUILD STARTED");
   G1ConcPhaseTimer p(_cm, "Concurrent Rebuild Remembered Sets and Scrub Regions");
@@ -295,19 +316,25 @@ void G1ConcurrentMarkThread::concurrent_mark_cycle_do() {
   // Phase 2: Actual mark loop.
   if (phase_mark_loop()) return;
 
-  // Phase 3: Rebuild remembered sets and scrub dead objects.
+  // Phase 3: Report a requested class histogram.
+  if (phase_report_class_histogram()) return;
+
+  // Phase 4: Free metadata of classes unloaded during Remark.
+  if (phase_purge_class_loader_data()) return;
+
+  // Phase 5: Rebuild remembered sets and scrub dead objects.
   if (phase_rebuild_and_scrub()) return;
 
-  // Phase 4: Wait for Cleanup.
+  // Phase 6: Wait for Cleanup.
   if (phase_delay_to_keep_mmu_before_cleanup()) return;
 
-  // Phase 5: Cleanup pause
+  // Phase 7: Cleanup pause
   if (phase_cleanup()) return;
 
-  // Phase 6: Clear CLD claimed marks.
+  // Phase 8: Clear CLD claimed marks.
   if (phase_clear_cld_claimed_marks()) return;
 
-  // Phase 7: Clear bitmap for next mark.
+  // Phase 9: Clear bitmap for next mark.
   phase_clear_bitmap_for_next_mark();
 }
 
@@ -65,6 +65,8 @@ class G1ConcurrentMarkThread: public ConcurrentGCThread {
   bool subphase_delay_to_keep_mmu_before_remark();
   bool subphase_remark();
 
+  bool phase_report_class_histogram();
+  bool phase_purge_class_loader_data();
   bool phase_rebuild_and_scrub();
   bool phase_delay_to_keep_mmu_before_cleanup();
   bool phase_cleanup();
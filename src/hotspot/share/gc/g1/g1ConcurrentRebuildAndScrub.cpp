@@ -134,6 +134,14 @@ class G1RebuildRSAndScrubTask : public WorkerTask {
       } while (start < limit);
     }
 
+    // Returns whether the given object can not contain any references, so there is
+    // no need to iterate over it to rebuild remembered sets. Primitive arrays often
+    // make up most of the old generation (e.g. large byte[] caches), and skipping
+    // them avoids walking them in G1RebuildRemSetChunkSize chunks.
+    static bool has_no_references(const oop obj) {
+      return obj->is_typeArray();
+    }
+
     // Scan for references into regions that need remembered set update for the given
     // live object. Returns the offset to the next object.
     size_t scan_object(G1HeapRegion* hr, HeapWord* current) {
@@ -143,6 +151,9 @@ class G1RebuildRSAndScrubTask : public WorkerTask {
       if (!_should_rebuild_remset) {
         // Not rebuilding, just step to next object.
         add_processed_words(obj_size);
+      } else if (has_no_references(obj)) {
+        // Nothing to scan, only account for looking at the object header.
+        add_processed_words(oopDesc::header_size());
       } else if (obj_size > ProcessingYieldLimitInWords) {
         // Large object, needs to be chunked to avoid stalling safepoints.
         MemRegion mr(current, obj_size);
@@ -231,6 +242,13 @@ class G1RebuildRSAndScrubTask : public WorkerTask {
       assert(_bitmap->is_marked(humongous) || pb == hr->bottom(),
              "Humongous object not live");
 
+      if (has_no_references(humongous)) {
+        // Humongous primitive arrays have no references to scan.
+        log_trace(gc, marking)("Rebuild for humongous region skipped for type array " HR_FORMAT,
+                               HR_FORMAT_PARAMS(hr));
+        return;
+      }
+
       log_trace(gc, marking)("Rebuild for humongous region: " HR_FORMAT " pb: " PTR_FORMAT " TARS: " PTR_FORMAT,
                               HR_FORMAT_PARAMS(hr), p2i(pb), p2i(_cm->top_at_rebuild_start(hr)));
 
@@ -401,14 +401,19 @@ class G1RefineBufferedCards : public StackObj {
   bool refine_cleaned_cards(size_t start_index) {
     bool result = true;
     size_t i = start_index;
+    // The batch is flushed before returning, i.e. before the caller may yield
+    // to a safepoint.
+    G1RefineReferenceBatch batch(_worker_id);
+    G1RefineReferenceBatch* batch_or_null = G1ConcRefinementBatchByRegion ? &batch : nullptr;
     for ( ; i < _node_buffer_capacity; ++i) {
       if (SuspendibleThreadSet::should_yield()) {
         redirty_unrefined_cards(i);
         result = false;
         break;
       }
-      _g1rs->refine_card_concurrently(_node_buffer[i], _worker_id);
+      _g1rs->refine_card_concurrently(_node_buffer[i], _worker_id, batch_or_null);
     }
+    batch.flush();
     _node->set_index(i);
     _stats->inc_refined_cards(i - start_index);
     return result;
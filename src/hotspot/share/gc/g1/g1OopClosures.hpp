@@ -31,6 +31,7 @@
 #include "oops/markWord.hpp"
 
 class G1CollectedHeap;
+class G1RefineReferenceBatch;
 class G1RemSet;
 class G1ConcurrentMark;
 class G1CMBitMap;
@@ -206,11 +207,15 @@ class G1RootRegionScanClosure : public ClaimMetadataVisitingOopIterateClosure {
 class G1ConcurrentRefineOopClosure: public BasicOopIterateClosure {
   G1CollectedHeap* _g1h;
   uint _worker_id;
+  // If set, references are collected here instead of being added to the
+  // remembered sets directly.
+  G1RefineReferenceBatch* _batch;
 
 public:
-  G1ConcurrentRefineOopClosure(G1CollectedHeap* g1h, uint worker_id) :
+  G1ConcurrentRefineOopClosure(G1CollectedHeap* g1h, uint worker_id, G1RefineReferenceBatch* batch = nullptr) :
     _g1h(g1h),
-    _worker_id(worker_id) {
+    _worker_id(worker_id),
+    _batch(batch) {
   }
 
   virtual ReferenceIterationMode reference_iteration_mode() { return DO_FIELDS; }
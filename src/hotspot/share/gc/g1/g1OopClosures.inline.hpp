@@ -153,7 +153,11 @@ inline void G1ConcurrentRefineOopClosure::do_oop_work(T* p) {
     G1HeapRegion* from = _g1h->heap_region_containing(p);
 
     if (from->rem_set()->cset_group() != to_rem_set->cset_group()) {
-      to_rem_set->add_reference(p, _worker_id);
+      if (_batch != nullptr) {
+        _batch->add(_g1h->addr_to_region(obj), p);
+      } else {
+        to_rem_set->add_reference(p, _worker_id);
+      }
     }
   }
 }
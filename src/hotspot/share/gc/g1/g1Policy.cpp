@@ -69,6 +69,7 @@ G1Policy::G1Policy(STWGCTimer* gc_timer) :
   _free_regions_at_end_of_collection(0),
   _card_rs_length(0),
   _pending_cards_at_gc_start(0),
+  _predicted_pause_time_ms(0.0),
   _concurrent_start_to_mixed(),
   _collection_set(nullptr),
   _g1h(nullptr),
@@ -682,6 +683,7 @@ void G1Policy::record_young_collection_start() {
   assert_used_and_recalculate_used_equal(_g1h);
 
   phase_times()->record_cur_collection_start_sec(now.seconds());
+  _predicted_pause_time_ms = 0.0;
 
   // do that for any other surv rate groups
   _eden_surv_rate_group->stop_adding_regions();
@@ -820,6 +822,10 @@ void G1Policy::record_young_collection_end(bool concurrent_operation_is_full_mar
   // We make the assumption that these are rare.
   bool update_stats = !allocation_failure;
 
+  log_debug(gc, ergo)("Pause time prediction: predicted %1.2fms actual %1.2fms error %1.2fms%s",
+                      _predicted_pause_time_ms, pause_time_ms, pause_time_ms - _predicted_pause_time_ms,
+                      update_stats ? "" : " (allocation failure)");
+
   if (update_stats) {
     // We maintain the invariant that all objects allocated by mutator
     // threads will be allocated out of eden regions. So, we can use
@@ -105,6 +105,10 @@ class G1Policy: public CHeapObj<mtGC> {
 
   size_t _pending_cards_at_gc_start;
 
+  // Sum of the predictions for everything added to the collection set of
+  // the current pause, used to report the prediction error at its end.
+  double _predicted_pause_time_ms;
+
   G1ConcurrentStartToMixedTimeTracker _concurrent_start_to_mixed;
 
   bool should_update_surv_rate_group_predictors() {
@@ -243,6 +247,8 @@ class G1Policy: public CHeapObj<mtGC> {
   size_t predict_bytes_to_copy(G1HeapRegion* hr) const;
   size_t pending_cards_at_gc_start() const { return _pending_cards_at_gc_start; }
 
+  void add_predicted_pause_time_ms(double ms) { _predicted_pause_time_ms += ms; }
+
   // GC efficiency for collecting the region based on the time estimate for
   // merging and scanning incoming references.
   double predict_gc_efficiency(G1HeapRegion* hr);
@@ -56,6 +56,7 @@
 #include "utilities/align.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/powerOfTwo.hpp"
+#include "utilities/quickSort.hpp"
 #include "utilities/stack.inline.hpp"
 #include "utilities/ticks.hpp"
 #include CPU_HEADER(gc/g1/g1Globals)
@@ -551,6 +552,12 @@ class G1ScanHRForRegionClosure : public G1HeapRegionClosure {
     static const size_t ExpandedToScanMask = G1CardTable::WordAlreadyScanned;
     static const size_t ToScanMask = G1CardTable::g1_card_already_scanned;
 
+    // Number of words checked at once when skipping long runs of clean or dirty
+    // cards. The combined words are independent loads that the C++ compiler
+    // keeps in vector registers where available.
+    static const uint WordsPerBlock = 4;
+    static const size_t CardsPerBlock = WordsPerBlock * sizeof(Word);
+
     static bool is_card_dirty(const CardValue* const card) {
       return (*card & ToScanMask) == 0;
     }
@@ -567,6 +574,18 @@ class G1ScanHRForRegionClosure : public G1HeapRegionClosure {
         i_card++;
       }
 
+      for (/* empty */; i_card + CardsPerBlock <= _end_card; i_card += CardsPerBlock) {
+        const Word* words = reinterpret_cast<Word*>(i_card);
+        Word all_words = words[0];
+        for (uint i = 1; i < WordsPerBlock; ++i) {
+          all_words &= words[i];
+        }
+        bool has_dirty_cards_in_block = (~all_words & ExpandedToScanMask) != 0;
+        if (has_dirty_cards_in_block) {
+          break;
+        }
+      }
+
       for (/* empty */; i_card < _end_card; i_card += sizeof(Word)) {
         Word word_value = *reinterpret_cast<Word*>(i_card);
         bool has_dirty_cards_in_word = (~word_value & ExpandedToScanMask) != 0;
@@ -593,6 +612,19 @@ class G1ScanHRForRegionClosure : public G1HeapRegionClosure {
         i_card++;
       }
 
+      STATIC_ASSERT(G1CardTable::WordAllDirty == 0);
+      for (/* empty */; i_card + CardsPerBlock <= _end_card; i_card += CardsPerBlock) {
+        const Word* words = reinterpret_cast<Word*>(i_card);
+        Word any_words = words[0];
+        for (uint i = 1; i < WordsPerBlock; ++i) {
+          any_words |= words[i];
+        }
+        bool all_cards_dirty_in_block = (any_words == G1CardTable::WordAllDirty);
+        if (!all_cards_dirty_in_block) {
+          break;
+        }
+      }
+
       for (/* empty */; i_card < _end_card; i_card += sizeof(Word)) {
         Word word_value = *reinterpret_cast<Word*>(i_card);
         bool all_cards_dirty = (word_value == G1CardTable::WordAllDirty);
@@ -1601,7 +1633,8 @@ bool G1RemSet::clean_card_before_refine(CardValue** const card_ptr_addr) {
 }
 
 void G1RemSet::refine_card_concurrently(CardValue* const card_ptr,
-                                        const uint worker_id) {
+                                        const uint worker_id,
+                                        G1RefineReferenceBatch* batch) {
   assert(!_g1h->is_stw_gc_active(), "Only call concurrently");
   check_card_ptr(card_ptr, _ct);
 
@@ -1624,7 +1657,7 @@ void G1RemSet::refine_card_concurrently(CardValue* const card_ptr,
   MemRegion dirty_region(start, MIN2(scan_limit, end));
   assert(!dirty_region.is_empty(), "sanity");
 
-  G1ConcurrentRefineOopClosure conc_refine_cl(_g1h, worker_id);
+  G1ConcurrentRefineOopClosure conc_refine_cl(_g1h, worker_id, batch);
   if (r->oops_on_memregion_seq_iterate_careful<false>(dirty_region, &conc_refine_cl) != nullptr) {
     return;
   }
@@ -1645,6 +1678,42 @@ void G1RemSet::refine_card_concurrently(CardValue* const card_ptr,
   enqueue_for_reprocessing(card_ptr);
 }
 
+int G1RefineReferenceBatch::compare_entries(const Entry& e1, const Entry& e2) {
+  if (e1._region_idx != e2._region_idx) {
+    return e1._region_idx < e2._region_idx ? -1 : 1;
+  }
+  uintptr_t c1 = uintptr_t(e1._from) >> CardTable::card_shift();
+  uintptr_t c2 = uintptr_t(e2._from) >> CardTable::card_shift();
+  if (c1 != c2) {
+    return c1 < c2 ? -1 : 1;
+  }
+  return 0;
+}
+
+void G1RefineReferenceBatch::flush() {
+  if (_num_entries == 0) {
+    return;
+  }
+
+  QuickSort::sort(_entries, _num_entries, compare_entries);
+
+  G1CollectedHeap* g1h = G1CollectedHeap::heap();
+  G1HeapRegionRemSet* rem_set = nullptr;
+  uint cur_region_idx = UINT_MAX;
+  for (uint i = 0; i < _num_entries; i++) {
+    const Entry& e = _entries[i];
+    if (e._region_idx != cur_region_idx) {
+      cur_region_idx = e._region_idx;
+      rem_set = g1h->region_at(cur_region_idx)->rem_set();
+    } else if (compare_entries(_entries[i - 1], e) == 0) {
+      // Same card as the previous entry.
+      continue;
+    }
+    rem_set->add_reference(e._from, _worker_id);
+  }
+  _num_entries = 0;
+}
+
 // Re-dirty and re-enqueue the card to retry refinement later.
 // This is used to deal with a rare race condition in concurrent refinement.
 void G1RemSet::enqueue_for_reprocessing(CardValue* card_ptr) {
@@ -51,6 +51,48 @@ class G1RemSetSamplingTask;
 class G1ScanCardClosure;
 class G1ServiceThread;
 
+// Collects the references found during concurrent refinement of a buffer of
+// cards, and adds them to the remembered sets grouped by target region. The
+// cards of a buffer are sorted by source address, so without grouping,
+// consecutive insertions typically alternate between the remembered sets of
+// different regions. Duplicate references to the same card are dropped.
+//
+// The batch must be flushed before the refining thread may reach a safepoint,
+// as the collected references and the region states they were filtered
+// against are only stable until then.
+class G1RefineReferenceBatch : public StackObj {
+  struct Entry {
+    uint _region_idx;
+    OopOrNarrowOopStar _from;
+  };
+
+  static const uint Capacity = 256;
+
+  Entry _entries[Capacity];
+  uint _num_entries;
+  const uint _worker_id;
+
+  static int compare_entries(const Entry& e1, const Entry& e2);
+
+public:
+  G1RefineReferenceBatch(uint worker_id) : _num_entries(0), _worker_id(worker_id) { }
+  ~G1RefineReferenceBatch() {
+    assert(_num_entries == 0, "must have been flushed");
+  }
+
+  void add(uint region_idx, OopOrNarrowOopStar from) {
+    if (_num_entries == Capacity) {
+      flush();
+    }
+    _entries[_num_entries]._region_idx = region_idx;
+    _entries[_num_entries]._from = from;
+    _num_entries++;
+  }
+
+  // Adds all collected references to the remembered sets of their regions.
+  void flush();
+};
+
 // A G1RemSet in which each heap region has a rem set that records the
 // external heap references into it.  Uses a mod ref bs to track updates,
 // so that they can be used to update the individual region remsets.
@@ -129,9 +171,11 @@ class G1RemSet: public CHeapObj<mtGC> {
   bool clean_card_before_refine(CardValue** const card_ptr_addr);
   // Refine the region corresponding to "card_ptr". Must be called after
   // being filtered by clean_card_before_refine(), and after proper
-  // fence/synchronization.
+  // fence/synchronization. If "batch" is given, the references found are
+  // collected there, and the caller must flush it.
   void refine_card_concurrently(CardValue* const card_ptr,
-                                const uint worker_id);
+                                const uint worker_id,
+                                G1RefineReferenceBatch* batch = nullptr);
 
   // Print accumulated summary info from the start of the VM.
   void print_summary_info();
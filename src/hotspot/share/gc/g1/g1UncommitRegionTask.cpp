@@ -77,23 +77,33 @@ void G1UncommitRegionTask::set_active(bool state) {
   _active = state;
 }
 
+double G1UncommitRegionTask::throughput_mb_per_sec(Tickspan time, uint regions) {
+  double seconds = time.seconds();
+  if (seconds <= 0.0) {
+    return 0.0;
+  }
+  return ((double)regions * G1HeapRegion::GrainBytes / M) / seconds;
+}
+
 void G1UncommitRegionTask::report_execution(Tickspan time, uint regions) {
   _summary_region_count += regions;
   _summary_duration += time;
 
-  log_trace(gc, heap)("Concurrent Uncommit: %zu%s, %u regions, %1.3fms",
+  log_trace(gc, heap)("Concurrent Uncommit: %zu%s, %u regions, %1.3fms, %1.1fMB/s",
                       byte_size_in_proper_unit(regions * G1HeapRegion::GrainBytes),
                       proper_unit_for_byte_size(regions * G1HeapRegion::GrainBytes),
                       regions,
-                      time.seconds() * 1000);
+                      time.seconds() * 1000,
+                      throughput_mb_per_sec(time, regions));
 }
 
 void G1UncommitRegionTask::report_summary() {
-  log_debug(gc, heap)("Concurrent Uncommit Summary: %zu%s, %u regions, %1.3fms",
+  log_debug(gc, heap)("Concurrent Uncommit Summary: %zu%s, %u regions, %1.3fms, %1.1fMB/s",
                       byte_size_in_proper_unit(_summary_region_count * G1HeapRegion::GrainBytes),
                       proper_unit_for_byte_size(_summary_region_count * G1HeapRegion::GrainBytes),
                       _summary_region_count,
-                      _summary_duration.seconds() * 1000);
+                      _summary_duration.seconds() * 1000,
+                      throughput_mb_per_sec(_summary_duration, _summary_region_count));
 }
 
 void G1UncommitRegionTask::clear_summary() {
@@ -112,9 +122,22 @@ void G1UncommitRegionTask::execute() {
   SuspendibleThreadSetJoiner sts;
   G1CollectedHeap* g1h = G1CollectedHeap::heap();
 
+  // Uncommit in steps of at most region_limit regions, and continue with the
+  // next step as long as there is time left and no safepoint is pending.
+  // Ranges of contiguous inactive regions are uncommitted together.
   Ticks start = Ticks::now();
-  uint uncommit_count = g1h->uncommit_regions(region_limit);
-  Tickspan uncommit_time = (Ticks::now() - start);
+  uint uncommit_count = 0;
+  Tickspan uncommit_time;
+  while (true) {
+    uint step_count = g1h->uncommit_regions(region_limit);
+    uncommit_count += step_count;
+    uncommit_time = Ticks::now() - start;
+    if (step_count < region_limit ||
+        uncommit_time.milliseconds() >= UncommitTimeLimitMs ||
+        SuspendibleThreadSet::should_yield()) {
+      break;
+    }
+  }
 
   if (uncommit_count > 0) {
     report_execution(uncommit_time, uncommit_count);
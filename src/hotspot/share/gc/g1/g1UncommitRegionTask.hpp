@@ -30,10 +30,13 @@
 #include "utilities/ticks.hpp"
 
 class G1UncommitRegionTask : public G1ServiceTask {
-  // Each execution of the uncommit task is limited to uncommit at most 128M.
-  // This limit is small enough to ensure that the duration of each invocation
-  // is short, while still making reasonable progress.
+  // The uncommit task uncommits memory in steps of at most 128M. This limit is
+  // small enough to ensure that the duration of each step is short, while still
+  // making reasonable progress.
   static const uint UncommitSizeLimit = 128 * M;
+  // Each execution of the uncommit task keeps uncommitting steps until this
+  // time limit is exceeded, or a safepoint is requested.
+  static const uint UncommitTimeLimitMs = 5;
   // Initial delay in milliseconds after GC before the regions are uncommitted.
   static const uint UncommitInitialDelayMs = 100;
   // The delay between two uncommit task executions.
@@ -57,6 +60,7 @@ class G1UncommitRegionTask : public G1ServiceTask {
   bool is_active();
   void set_active(bool state);
 
+  static double throughput_mb_per_sec(Tickspan time, uint regions);
   void report_execution(Tickspan time, uint regions);
   void report_summary();
   void clear_summary();
@@ -142,6 +142,14 @@
                "percent.")                                                  \
                range(0.001, 100.0)                                          \
                                                                             \
+  product(uint, G1PLABDirectAllocationPercent, 100, EXPERIMENTAL,           \
+          "Objects that need more than this percentage of the current "     \
+          "PLAB size of the copying thread are allocated directly into "    \
+          "the destination region instead of refilling the PLAB. The "      \
+          "default only allocates objects that do not fit into a PLAB "     \
+          "directly.")                                                      \
+          range(1, 100)                                                     \
+                                                                            \
   product(size_t, G1SATBBufferSize, 1*K,                                    \
           "Number of entries in an SATB log buffer.")                       \
           constraint(G1SATBBufferSizeConstraintFunc, AtParse)               \
@@ -157,6 +165,12 @@
           "the buffer will be enqueued for processing.")                    \
           range(0, 100)                                                     \
                                                                             \
+  product(uint, G1HumongousThresholdPercent, 50, EXPERIMENTAL,              \
+          "Objects larger than this percentage of the region size are "     \
+          "allocated as humongous objects. Smaller objects are allocated "  \
+          "in regular regions and are evacuated like other objects.")       \
+          range(50, 100)                                                    \
+                                                                            \
   product(uint, G1ExpandByPercentOfAvailable, 20, EXPERIMENTAL,             \
           "When expanding, % of uncommitted space to claim.")               \
           range(0, 100)                                                     \
@@ -175,6 +189,10 @@
           "Control whether concurrent refinement is performed. "            \
           "Disabling effectively ignores G1RSetUpdatingPauseTimePercent")   \
                                                                             \
+  product(bool, G1ConcRefinementBatchByRegion, false, EXPERIMENTAL,         \
+          "Collect the references found while refining a buffer of cards "  \
+          "and add them to the remembered sets grouped by target region.")  \
+                                                                            \
   develop(uint, G1RemSetArrayOfCardsEntriesBase, 8,                         \
           "Maximum number of entries per region in the Array of Cards "     \
           "card set container per MB of a heap region.")                    \
@@ -343,6 +361,10 @@
           "scan cost related prediction samples. A sample must involve "    \
           "the same or more than this number of code roots to be used.")    \
                                                                             \
+  product(bool, G1ConcurrentPurgeClassLoaderData, true, DIAGNOSTIC,         \
+          "Free the metadata of classes unloaded in the Remark pause "      \
+          "concurrently after the pause.")                                  \
+                                                                            \
   GC_G1_EVACUATION_FAILURE_FLAGS(develop,                                   \
                     develop_pd,                                             \
                     product,                                                \
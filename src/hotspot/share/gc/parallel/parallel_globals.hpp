@@ -40,6 +40,13 @@
           "Use maximum compaction in the Parallel Old garbage collector "   \
           "for a system GC")                                                \
                                                                             \
+  product(uint, ParallelCompactIslands, 0, EXPERIMENTAL,                    \
+          "Split the compacted part of the old generation into this many "  \
+          "islands that are each compacted into themselves during a full "  \
+          "GC, limiting how far objects slide. Not used for maximum "       \
+          "compaction. 0 or 1 disables islands")                            \
+          range(0, 64)                                                      \
+                                                                            \
   product(bool, PSChunkLargeArrays, true,                                   \
           "Process large arrays in chunks")
 
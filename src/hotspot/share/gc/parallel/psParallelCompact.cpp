@@ -56,6 +56,7 @@
 #include "gc/shared/oopStorage.inline.hpp"
 #include "gc/shared/oopStorageSet.inline.hpp"
 #include "gc/shared/oopStorageSetParState.inline.hpp"
+#include "gc/shared/parallelCleaning.hpp"
 #include "gc/shared/preservedMarks.inline.hpp"
 #include "gc/shared/referencePolicy.hpp"
 #include "gc/shared/referenceProcessor.hpp"
@@ -546,6 +547,9 @@ unsigned int        PSParallelCompact::_maximum_compaction_gc_num = 0;
 CollectorCounters*  PSParallelCompact::_counters = nullptr;
 ParMarkBitMap       PSParallelCompact::_mark_bitmap;
 ParallelCompactData PSParallelCompact::_summary_data;
+uint                PSParallelCompact::_num_islands = 0;
+HeapWord*           PSParallelCompact::_island_end[MaxCompactionIslands];
+HeapWord*           PSParallelCompact::_island_new_top[MaxCompactionIslands];
 
 PSParallelCompact::IsAliveClosure PSParallelCompact::_is_alive_closure;
 
@@ -865,6 +869,51 @@ bool PSParallelCompact::check_maximum_compaction(size_t total_live_words,
   return false;
 }
 
+HeapWord* PSParallelCompact::summarize_compaction_islands(HeapWord* beg, HeapWord* top) {
+  assert(_num_islands == 0, "islands already summarized");
+  const uint num_islands = MIN2(ParallelCompactIslands, MaxCompactionIslands);
+  if (num_islands < 2) {
+    return beg;
+  }
+
+  assert(_summary_data.is_region_aligned(beg), "precondition");
+  const size_t beg_region = _summary_data.addr_to_region_idx(beg);
+  const size_t end_region = _summary_data.addr_to_region_idx(_summary_data.region_align_up(top));
+  const size_t regions_per_island = (end_region - beg_region) / num_islands;
+  if (regions_per_island < MinRegionsPerIsland) {
+    return beg;
+  }
+
+  SplitInfo& split_info = _space_info[old_space_id].split_info();
+  HeapWord* island_beg = beg;
+  for (uint i = 1; i < num_islands; ++i) {
+    size_t boundary = MAX2(beg_region + i * regions_per_island,
+                           _summary_data.addr_to_region_idx(island_beg) + 1);
+    // An island must not end inside a live object.
+    while (boundary < end_region && _summary_data.region(boundary)->partial_obj_size() != 0) {
+      ++boundary;
+    }
+    if (boundary >= end_region) {
+      break;
+    }
+
+    HeapWord* const island_end = _summary_data.region_to_addr(boundary);
+    bool done = _summary_data.summarize(split_info,
+                                        island_beg, island_end, nullptr,
+                                        island_beg, island_end,
+                                        &_island_new_top[_num_islands]);
+    assert(done, "island must fit when compacted into itself");
+    _island_end[_num_islands] = island_end;
+
+    log_debug(gc, compaction)("Compaction island %u: [" PTR_FORMAT ", " PTR_FORMAT ") new_top " PTR_FORMAT,
+                              _num_islands, p2i(island_beg), p2i(island_end),
+                              p2i(_island_new_top[_num_islands]));
+    _num_islands++;
+    island_beg = island_end;
+  }
+  return island_beg;
+}
+
 void PSParallelCompact::summary_phase()
 {
   GCTraceTime(Info, gc, phases) tm("Summary Phase", &_gc_timer);
@@ -903,10 +952,16 @@ void PSParallelCompact::summary_phase()
       _summary_data.summarize_dense_prefix(old_space->bottom(), dense_prefix_end);
     }
 
-    // Compacting objs in [dense_prefix_end, old_space->top())
+    // Compacting objs in [dense_prefix_end, old_space->top()), possibly split
+    // into islands that are compacted into themselves.
+    _num_islands = 0;
+    HeapWord* const compaction_beg = maximum_compaction
+                                     ? dense_prefix_end
+                                     : summarize_compaction_islands(dense_prefix_end,
+                                                                    old_space->top());
     _summary_data.summarize(_space_info[id].split_info(),
-                            dense_prefix_end, old_space->top(), nullptr,
-                            dense_prefix_end, old_space->end(),
+                            compaction_beg, old_space->top(), nullptr,
+                            compaction_beg, old_space->end(),
                             _space_info[id].new_top_addr());
   }
 
@@ -1044,7 +1099,7 @@ bool PSParallelCompact::invoke_no_policy(bool clear_all_soft_refs) {
 
     ref_processor()->start_discovery(clear_all_soft_refs);
 
-    ClassUnloadingContext ctx(1 /* num_nmethod_unlink_workers */,
+    ClassUnloadingContext ctx(ParallelScavengeHeap::heap()->workers().active_workers(),
                               false /* unregister_nmethods_during_purge */,
                               false /* lock_nmethod_free_separately */);
 
@@ -1261,6 +1316,19 @@ class MarkFromRootsTask : public WorkerTask {
   }
 };
 
+class PSCodeCacheUnloadingTask : public WorkerTask {
+  CodeCacheUnloadingTask _code_cache_task;
+
+public:
+  PSCodeCacheUnloadingTask(uint num_workers, bool unloading_occurred) :
+      WorkerTask("PSCodeCacheUnloadingTask"),
+      _code_cache_task(num_workers, unloading_occurred) {}
+
+  virtual void work(uint worker_id) {
+    _code_cache_task.work(worker_id);
+  }
+};
+
 class ParallelCompactRefProcProxyTask : public RefProcProxyTask {
   TaskTerminator _terminator;
 
@@ -1347,8 +1415,10 @@ void PSParallelCompact::marking_phase(ParallelOldTracer *gc_tracer) {
       // Follow system dictionary roots and unload classes.
       unloading_occurred = SystemDictionary::do_unloading(&_gc_timer);
 
-      // Unload nmethods.
-      CodeCache::do_unloading(unloading_occurred);
+      // Unload nmethods, in parallel as the code cache may be large.
+      WorkerThreads& workers = ParallelScavengeHeap::heap()->workers();
+      PSCodeCacheUnloadingTask unloading_task(workers.active_workers(), unloading_occurred);
+      workers.run_task(&unloading_task);
     }
 
     {
@@ -1642,6 +1712,8 @@ void PSParallelCompact::verify_forward() {
                        : old_dense_prefix_addr;
   SpaceId bump_ptr_space = old_space_id;
 
+  uint island = 0;
+
   for (uint id = old_space_id; id < last_space_id; ++id) {
     MutableSpace* sp = PSParallelCompact::space(SpaceId(id));
     HeapWord* dense_prefix_addr = dense_prefix(SpaceId(id));
@@ -1654,6 +1726,12 @@ void PSParallelCompact::verify_forward() {
         break;
       }
       assert(mark_bitmap()->is_marked(cur_addr), "inv");
+      // Move to the compaction island containing cur_addr
+      while (id == old_space_id && island < _num_islands && cur_addr >= _island_end[island]) {
+        assert(bump_ptr == _island_new_top[island], "inv");
+        bump_ptr = _island_end[island];
+        island++;
+      }
       assert(bump_ptr <= _space_info[bump_ptr_space].new_top(), "inv");
       // Move to the space containing cur_addr
       if (bump_ptr == _space_info[bump_ptr_space].new_top()) {
@@ -1737,6 +1815,9 @@ void PSParallelCompact::prepare_region_draining_tasks(uint parallel_gc_threads)
       sd.addr_to_region_idx(sd.region_align_up(new_top));
 
     for (size_t cur = end_region - 1; cur + 1 > beg_region; --cur) {
+      if (is_in_island_hole(sd.region_to_addr(cur))) {
+        continue;
+      }
       if (sd.region(cur)->claim_unsafe()) {
         ParCompactionManager* cm = ParCompactionManager::gc_thread_compaction_manager(worker_id);
         bool result = sd.region(cur)->mark_normal();
@@ -1820,6 +1901,10 @@ void PSParallelCompact::fill_range_in_dense_prefix(HeapWord* start, HeapWord* en
   }
 #endif
 
+  fill_range(start, end);
+}
+
+void PSParallelCompact::fill_range(HeapWord* start, HeapWord* end) {
   CollectedHeap::fill_with_objects(start, pointer_delta(end, start));
   HeapWord* addr = start;
   do {
@@ -1829,6 +1914,16 @@ void PSParallelCompact::fill_range_in_dense_prefix(HeapWord* start, HeapWord* en
   } while (addr < end);
 }
 
+void PSParallelCompact::fill_island_holes() {
+  for (uint i = 0; i < _num_islands; ++i) {
+    HeapWord* const start = _island_new_top[i];
+    HeapWord* const end = _island_end[i];
+    if (start < end) {
+      fill_range(start, end);
+    }
+  }
+}
+
 void PSParallelCompact::fill_dead_objs_in_dense_prefix(uint worker_id, uint num_workers) {
   ParMarkBitMap* bitmap = mark_bitmap();
 
@@ -1898,6 +1993,8 @@ void PSParallelCompact::compact() {
     FillDensePrefixAndCompactionTask task(active_gc_threads);
     ParallelScavengeHeap::heap()->workers().run_task(&task);
 
+    fill_island_holes();
+
 #ifdef  ASSERT
     verify_filler_in_dense_prefix();
 
@@ -1940,6 +2037,11 @@ void PSParallelCompact::verify_complete(SpaceId space_id) {
   size_t cur_region;
   for (cur_region = beg_region; cur_region < new_top_region; ++cur_region) {
     const RegionData* const c = sd.region(cur_region);
+    if (is_in_island_hole(sd.region_to_addr(cur_region))) {
+      assert(c->available(), "region %zu not empty: destination_count=%u",
+             cur_region, c->destination_count());
+      continue;
+    }
     assert(c->completed(), "region %zu not filled: destination_count=%u",
            cur_region, c->destination_count());
   }
@@ -2105,7 +2207,8 @@ void PSParallelCompact::decrement_destination_counts(ParCompactionManager* cm,
   for (RegionData* cur = beg; cur < end; ++cur) {
     assert(cur->data_size() > 0, "region must have live data");
     cur->decrement_destination_count();
-    if (cur < enqueue_end && cur->available() && cur->claim()) {
+    if (cur < enqueue_end && cur->available() &&
+        !is_in_island_hole(sd.region_to_addr(cur)) && cur->claim()) {
       if (cur->mark_normal()) {
         cm->push_region(sd.region(cur));
       } else if (cur->mark_copied()) {
@@ -2369,7 +2472,7 @@ bool PSParallelCompact::steal_unavailable_region(ParCompactionManager* cm, size_
   uint active_gc_threads = ParallelScavengeHeap::heap()->workers().active_workers();
 
   while (next < old_new_top) {
-    if (sd.region(next)->mark_shadow()) {
+    if (!is_in_island_hole(sd.region_to_addr(next)) && sd.region(next)->mark_shadow()) {
       region_idx = next;
       return true;
     }
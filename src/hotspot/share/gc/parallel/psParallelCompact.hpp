@@ -707,6 +707,18 @@ class PSParallelCompact : AllStatic {
   static IsAliveClosure       _is_alive_closure;
   static SpaceInfo            _space_info[last_space_id];
 
+  // Compaction islands (see ParallelCompactIslands).  The old space between
+  // the dense prefix and _island_end[_num_islands - 1] is split into islands
+  // that are compacted into themselves; island i ends at _island_end[i] and
+  // its live data ends at _island_new_top[i].  The last island, covering the
+  // remainder of the old space, is summarized as the old space without
+  // islands would be and is not recorded here.
+  static const uint           MaxCompactionIslands = 64;
+  static const size_t         MinRegionsPerIsland = 4;
+  static uint                 _num_islands;
+  static HeapWord*            _island_end[MaxCompactionIslands];
+  static HeapWord*            _island_new_top[MaxCompactionIslands];
+
   // Reference processing (used in ...follow_contents)
   static SpanSubjectToDiscoveryClosure  _span_based_discoverer;
   static ReferenceProcessor*  _ref_processor;
@@ -739,6 +751,10 @@ class PSParallelCompact : AllStatic {
   // make the heap parsable.
   static void fill_dense_prefix_end(SpaceId id);
 
+  // Summarize all but the last compaction island in [beg, top) and return
+  // the start of the last one.
+  static HeapWord* summarize_compaction_islands(HeapWord* beg, HeapWord* top);
+
   static void summary_phase();
 
   static void adjust_pointers();
@@ -753,8 +769,13 @@ class PSParallelCompact : AllStatic {
   // Add available regions to the stack and draining tasks to the task queue.
   static void prepare_region_draining_tasks(uint parallel_gc_threads);
 
+  static void fill_range(HeapWord* start, HeapWord* end);
   static void fill_range_in_dense_prefix(HeapWord* start, HeapWord* end);
 
+  // Fill the space between the end of the compacted data and the end of each
+  // compaction island to keep the old space parsable.
+  static void fill_island_holes();
+
 public:
   static void fill_dead_objs_in_dense_prefix(uint worker_id, uint num_workers);
 
@@ -793,6 +814,12 @@ class PSParallelCompact : AllStatic {
   static inline MutableSpace*     space(SpaceId space_id);
   static inline HeapWord*         new_top(SpaceId space_id);
   static inline HeapWord*         dense_prefix(SpaceId space_id);
+  // Return the end of the compacted data for the destination containing addr;
+  // this is new_top(space_id) unless addr is in a compaction island.
+  static inline HeapWord*         compaction_new_top(SpaceId space_id, HeapWord* addr);
+  // Return true if addr lies in a region past the end of the compacted data
+  // of its compaction island; such regions are only sources, never targets.
+  static inline bool              is_in_island_hole(HeapWord* addr);
   static inline ObjectStartArray* start_array(SpaceId space_id);
 
   // Return the address of the count + 1st live word in the range [beg, end).
@@ -909,7 +936,7 @@ inline void MoveAndUpdateClosure::decrement_words_remaining(size_t words) {
 inline size_t MoveAndUpdateClosure::calculate_words_remaining(size_t region) {
   HeapWord* dest_addr = PSParallelCompact::summary_data().region_to_addr(region);
   PSParallelCompact::SpaceId dest_space_id = PSParallelCompact::space_id(dest_addr);
-  HeapWord* new_top = PSParallelCompact::new_top(dest_space_id);
+  HeapWord* new_top = PSParallelCompact::compaction_new_top(dest_space_id, dest_addr);
   return MIN2(pointer_delta(new_top, dest_addr),
               ParallelCompactData::RegionSize);
 }
@@ -51,6 +51,27 @@ inline HeapWord* PSParallelCompact::new_top(SpaceId id) {
   return _space_info[id].new_top();
 }
 
+inline HeapWord* PSParallelCompact::compaction_new_top(SpaceId id, HeapWord* addr) {
+  assert(id < last_space_id, "id out of range");
+  if (id == old_space_id) {
+    for (uint i = 0; i < _num_islands; ++i) {
+      if (addr < _island_end[i]) {
+        return _island_new_top[i];
+      }
+    }
+  }
+  return _space_info[id].new_top();
+}
+
+inline bool PSParallelCompact::is_in_island_hole(HeapWord* addr) {
+  for (uint i = 0; i < _num_islands; ++i) {
+    if (addr < _island_end[i]) {
+      return addr >= _summary_data.region_align_up(_island_new_top[i]);
+    }
+  }
+  return false;
+}
+
 inline HeapWord* PSParallelCompact::dense_prefix(SpaceId id) {
   assert(id < last_space_id, "id out of range");
   return _space_info[id].dense_prefix();
@@ -156,11 +156,19 @@ class Compacter {
     // The first dead word in this contiguous space. It's an optimization to
     // skip large chunk of live objects at the beginning.
     HeapWord* _first_dead;
+    // Objects at and above this address are left in place, see
+    // SerialFullGCCompactionWindowPercent. The dead space between the new
+    // location of the last moved object and _window_end is filled after
+    // compaction.
+    HeapWord* _window_end;
+    HeapWord* _window_gap_start;
 
     void init(ContiguousSpace* space) {
       _space = space;
       _compaction_top = space->bottom();
       _first_dead = nullptr;
+      _window_end = nullptr;
+      _window_gap_start = nullptr;
     }
   };
 
@@ -173,6 +181,10 @@ class Compacter {
   // Used for BOT update
   TenuredGeneration* _old_gen;
 
+  // Remaining number of words that may be moved within the old generation
+  // before the rest of it is left in place.
+  size_t _window_budget_words;
+
   HeapWord* get_compaction_top(uint index) const {
     return _spaces[index]._compaction_top;
   }
@@ -190,6 +202,50 @@ class Compacter {
     _spaces[index]._first_dead = first_dead;
   }
 
+  HeapWord* get_window_end(uint index) const {
+    HeapWord* window_end = _spaces[index]._window_end;
+    return window_end != nullptr ? window_end : _spaces[index]._space->top();
+  }
+
+  bool is_beyond_window(uint index, HeapWord* addr) const {
+    HeapWord* window_end = _spaces[index]._window_end;
+    return window_end != nullptr && addr >= window_end;
+  }
+
+  // Stop compacting the old generation at addr. The space between the current
+  // compaction top and addr becomes a filler object after compaction.
+  void close_window(uint index, HeapWord* addr) {
+    assert(index == 0, "only the old generation");
+    assert(_index == 0, "must still compact into the old generation");
+    CompactionSpace& cs = _spaces[index];
+    assert(cs._compaction_top < addr, "must have moved objects");
+    cs._window_gap_start = cs._compaction_top;
+    cs._window_end = addr;
+    // Register space for the filler obj
+    alloc(pointer_delta(addr, cs._compaction_top));
+    log_develop_trace(gc, compaction)("Leaving old generation in place from " PTR_FORMAT, p2i(addr));
+  }
+
+  static size_t calculate_window_budget_words(SerialHeap* heap) {
+    const uint percent = SerialFullGCCompactionWindowPercent;
+    if (percent == 100) {
+      return SIZE_MAX;
+    }
+    // Occasionally, we want to ensure a full compaction, which is determined
+    // by the MarkSweepAlwaysCompactCount parameter.
+    if ((heap->total_full_collections() % MarkSweepAlwaysCompactCount) == 0) {
+      return SIZE_MAX;
+    }
+    // The young generation is compacted to after the old generation objects
+    // that are left in place, so only leave them in place if the young
+    // generation is guaranteed to fit.
+    ContiguousSpace* old_space = heap->old_gen()->space();
+    if (old_space->free() < heap->young_gen()->used()) {
+      return SIZE_MAX;
+    }
+    return (old_space->capacity() * percent / 100) / HeapWordSize;
+  }
+
   HeapWord* alloc(size_t words) {
     while (true) {
       if (words <= pointer_delta(_spaces[_index]._space->end(),
@@ -283,6 +339,7 @@ class Compacter {
     }
     _index = 0;
     _old_gen = heap->old_gen();
+    _window_budget_words = calculate_window_budget_words(heap);
   }
 
   void phase2_calculate_new_addr() {
@@ -295,17 +352,32 @@ class Compacter {
 
       DeadSpacer dead_spacer(space);
 
+      bool in_window = true;
+
       while (cur_addr < top) {
         oop obj = cast_to_oop(cur_addr);
         size_t obj_size = obj->size();
         if (obj->is_gc_marked()) {
+          if (i == 0 && in_window && get_compaction_top(i) < cur_addr) {
+            if (_window_budget_words < obj_size) {
+              close_window(i, cur_addr);
+              in_window = false;
+            } else {
+              _window_budget_words -= obj_size;
+            }
+          }
           HeapWord* new_addr = alloc(obj_size);
           forward_obj(obj, new_addr);
           cur_addr += obj_size;
         } else {
           // Skipping the current known-unmarked obj
           HeapWord* next_live_addr = find_next_live_addr(cur_addr + obj_size, top);
-          if (dead_spacer.insert_deadspace(cur_addr, next_live_addr)) {
+          if (!in_window) {
+            // Beyond the window everything stays in place, so dead space
+            // becomes filler objects.
+            CollectedHeap::fill_with_object(cur_addr, next_live_addr);
+            alloc(pointer_delta(next_live_addr, cur_addr));
+          } else if (dead_spacer.insert_deadspace(cur_addr, next_live_addr)) {
             // Register space for the filler obj
             alloc(pointer_delta(next_live_addr, cur_addr));
           } else {
@@ -334,7 +406,7 @@ class Compacter {
 
       while (cur_addr < top) {
         prefetch_write_scan(cur_addr);
-        if (cur_addr < first_dead || cast_to_oop(cur_addr)->is_gc_marked()) {
+        if (cur_addr < first_dead || is_beyond_window(i, cur_addr) || cast_to_oop(cur_addr)->is_gc_marked()) {
           size_t size = cast_to_oop(cur_addr)->oop_iterate_size(&SerialFullGC::adjust_pointer_closure);
           cur_addr += size;
         } else {
@@ -350,6 +422,7 @@ class Compacter {
       ContiguousSpace* space = get_space(i);
       HeapWord* cur_addr = space->bottom();
       HeapWord* top = space->top();
+      HeapWord* const window_end = get_window_end(i);
 
       // Check if the first obj inside this space is forwarded.
       if (!FullGCForwarding::is_forwarded(cast_to_oop(cur_addr))) {
@@ -357,7 +430,7 @@ class Compacter {
         cur_addr = get_first_dead(i);
       }
 
-      while (cur_addr < top) {
+      while (cur_addr < window_end) {
         if (!FullGCForwarding::is_forwarded(cast_to_oop(cur_addr))) {
           cur_addr = *(HeapWord**) cur_addr;
           continue;
@@ -365,6 +438,12 @@ class Compacter {
         cur_addr += relocate(cur_addr);
       }
 
+      HeapWord* const window_gap_start = _spaces[i]._window_gap_start;
+      if (window_gap_start != nullptr) {
+        // All objects have been moved below the gap, so it can be filled now.
+        CollectedHeap::fill_with_object(window_gap_start, window_end);
+      }
+
       // Reset top and unused memory
       HeapWord* new_top = get_compaction_top(i);
       space->set_top(new_top);
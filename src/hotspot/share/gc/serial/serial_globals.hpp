@@ -35,6 +35,13 @@
           "When disabled, informs the GC to shrink the java heap directly"  \
           " to the target size at the next full GC rather than requiring"   \
           " smaller steps during multiple full GCs.")                       \
+                                                                            \
+  product(uint, SerialFullGCCompactionWindowPercent, 100, EXPERIMENTAL,     \
+          "Maximum amount of live data, in percent of the old generation "  \
+          "capacity, a full GC moves within the old generation. Objects "   \
+          "above are left in place. Full compactions done according to "    \
+          "MarkSweepAlwaysCompactCount ignore this limit.")                 \
+          range(1, 100)                                                     \
 
 // end of GC_SERIAL_FLAGS
 
@@ -74,7 +74,17 @@ void ClassUnloadingContext::register_unloading_class_loader_data(ClassLoaderData
 }
 
 void ClassUnloadingContext::purge_class_loader_data() {
-  for (ClassLoaderData* cld = _cld_head; cld != nullptr;) {
+  purge_class_loader_data(_cld_head);
+}
+
+ClassLoaderData* ClassUnloadingContext::take_unloading_class_loader_data() {
+  ClassLoaderData* head = _cld_head;
+  _cld_head = nullptr;
+  return head;
+}
+
+void ClassUnloadingContext::purge_class_loader_data(ClassLoaderData* cld_head) {
+  for (ClassLoaderData* cld = cld_head; cld != nullptr;) {
     assert(cld->is_unloading(), "invariant");
 
     ClassLoaderData* next = cld->unloading_next();
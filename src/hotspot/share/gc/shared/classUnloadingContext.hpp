@@ -66,6 +66,11 @@ class ClassUnloadingContext : public CHeapObj<mtGC> {
   void register_unloading_class_loader_data(ClassLoaderData* cld);
   void purge_class_loader_data();
 
+  // Detach the registered class loader data from this context so that it can
+  // be purged after the context is gone, e.g. concurrently after the pause.
+  ClassLoaderData* take_unloading_class_loader_data();
+  static void purge_class_loader_data(ClassLoaderData* cld_head);
+
   void classes_unloading_do(void f(Klass* const));
 
   // Register unloading nmethods, potentially in parallel.
@@ -94,8 +94,9 @@ bool VM_GC_Operation::skip_operation() const {
 }
 
 static bool should_use_gclocker() {
-  // Only Serial and Parallel use GCLocker to synchronize with threads in JNI critical-sections, in order to handle pinned objects.
-  return UseSerialGC || UseParallelGC;
+  // Only Serial, Parallel and the sliding Epsilon GC use GCLocker to synchronize with threads in JNI
+  // critical-sections, in order to handle pinned objects.
+  return UseSerialGC || UseParallelGC EPSILONGC_ONLY(|| (UseEpsilonGC && EpsilonSlidingGC));
 }
 
 bool VM_GC_Operation::doit_prologue() {
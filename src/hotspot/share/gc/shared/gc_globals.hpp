@@ -257,6 +257,12 @@
   product(uintx, WorkStealingSpinToYieldRatio, 10, EXPERIMENTAL,            \
           "Ratio of hard spins to calls to yield")                          \
                                                                             \
+  product(uint, WorkStealingBatchSize, 1, EXPERIMENTAL,                     \
+          "Maximum number of tasks taken from another queue by one "        \
+          "successful steal. At most half of the tasks of the queue "       \
+          "are taken")                                                      \
+          range(1, 1024)                                                    \
+                                                                            \
   develop(uintx, ObjArrayMarkingStride, 2048,                               \
           "Number of object array elements to push onto the marking stack " \
           "before pushing a continuation entry")                            \
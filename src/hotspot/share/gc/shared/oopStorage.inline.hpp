@@ -29,6 +29,7 @@
 
 #include "memory/allocation.hpp"
 #include "oops/oop.hpp"
+#include "runtime/prefetch.inline.hpp"
 #include "runtime/safepoint.hpp"
 #include "utilities/align.hpp"
 #include "utilities/count_trailing_zeros.hpp"
@@ -200,6 +201,12 @@ class OopStorage::Block /* No base class, to avoid messing up alignment. */ {
   template<typename F> bool iterate(F f);
   template<typename F> bool iterate(F f) const;
 
+  // Prefetch the allocation bitmask, which is what iteration reads first.
+  // Iteration over a sequence of blocks prefetches the next block while
+  // processing the current one, so that skipping empty or sparse blocks
+  // doesn't stall on each block in turn.
+  void prefetch() const;
+
   bool print_containing(const oop* addr, outputStream* st);
 }; // class Block
 
@@ -346,6 +353,10 @@ inline bool OopStorage::Block::iterate_impl(F f, BlockPtr block) {
   return true;
 }
 
+inline void OopStorage::Block::prefetch() const {
+  Prefetch::read(const_cast<uintx*>(&_allocated_bitmask), 0);
+}
+
 template<typename F>
 inline bool OopStorage::Block::iterate(F f) {
   return iterate_impl(f, this);
@@ -371,6 +382,9 @@ inline bool OopStorage::iterate_impl(F f, Storage* storage) {
   size_t limit = blocks->block_count();
   for (size_t i = 0; i < limit; ++i) {
     BlockPtr block = blocks->at(i);
+    if (i + 1 < limit) {
+      blocks->at(i + 1)->prefetch();
+    }
     if (!block->iterate(f)) {
       return false;
     }
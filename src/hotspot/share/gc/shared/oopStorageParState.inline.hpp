@@ -61,6 +61,9 @@ inline void OopStorage::BasicParState::iterate(F f) {
     size_t i = data._segment_start;
     do {
       BlockPtr block = _active_array->at(i);
+      if (i + 1 < data._segment_end) {
+        _active_array->at(i + 1)->prefetch();
+      }
       block->iterate(atf_f);
     } while (++i < data._segment_end);
   }
@@ -34,26 +34,47 @@ PretouchTask::PretouchTask(const char* task_name,
                            char* start_address,
                            char* end_address,
                            size_t page_size,
-                           size_t chunk_size) :
+                           size_t chunk_size,
+                           size_t chunk_alignment) :
     WorkerTask(task_name),
     _cur_addr(start_address),
     _end_addr(end_address),
     _page_size(page_size),
-    _chunk_size(chunk_size) {
+    _chunk_size(chunk_size),
+    _chunk_alignment(chunk_alignment) {
 
   assert(chunk_size >= page_size,
          "Chunk size %zu is smaller than page size %zu",
          chunk_size, page_size);
+  assert(chunk_size >= chunk_alignment,
+         "Chunk size %zu is smaller than chunk alignment %zu",
+         chunk_size, chunk_alignment);
 }
 
 size_t PretouchTask::chunk_size() {
   return PreTouchParallelChunkSize;
 }
 
+size_t PretouchTask::chunk_alignment(size_t page_size) {
+  // With large pages the memory may be backed by large pages even if it is
+  // touched using the small page size, e.g. with transparent huge pages. Use
+  // the large page size for the chunks then, so that a large page is not
+  // populated by multiple workers at the same time.
+  if (UseLargePages && os::large_page_size() > page_size) {
+    return os::large_page_size();
+  }
+  return page_size;
+}
+
 void PretouchTask::work(uint worker_id) {
   while (true) {
     char* cur_start = Atomic::load(&_cur_addr);
     char* cur_end = cur_start + MIN2(_chunk_size, pointer_delta(_end_addr, cur_start, 1));
+    if (cur_end < _end_addr) {
+      // End the chunk at an aligned boundary. Since the chunk size is at
+      // least the alignment, the chunk does not become empty.
+      cur_end = align_down(cur_end, _chunk_alignment);
+    }
     if (cur_start >= cur_end) {
       break;
     } else if (cur_start == Atomic::cmpxchg(&_cur_addr, cur_start, cur_end)) {
@@ -64,10 +85,11 @@ void PretouchTask::work(uint worker_id) {
 
 void PretouchTask::pretouch(const char* task_name, char* start_address, char* end_address,
                             size_t page_size, WorkerThreads* pretouch_workers) {
-  // Page-align the chunk size, so if start_address is also page-aligned (as
-  // is common) then there won't be any pages shared by multiple chunks.
-  size_t chunk_size = align_down_bounded(PretouchTask::chunk_size(), page_size);
-  PretouchTask task(task_name, start_address, end_address, page_size, chunk_size);
+  // Align the chunk size and the chunk boundaries, so there won't be any pages
+  // shared by multiple chunks.
+  size_t chunk_alignment = PretouchTask::chunk_alignment(page_size);
+  size_t chunk_size = align_down_bounded(PretouchTask::chunk_size(), chunk_alignment);
+  PretouchTask task(task_name, start_address, end_address, page_size, chunk_size, chunk_alignment);
   size_t total_bytes = pointer_delta(end_address, start_address, sizeof(char));
 
   if (total_bytes == 0) {
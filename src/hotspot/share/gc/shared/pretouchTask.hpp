@@ -32,13 +32,17 @@ class PretouchTask : public WorkerTask {
   char* const _end_addr;
   size_t _page_size;
   size_t _chunk_size;
+  // Chunk boundaries after the first chunk are aligned to this.
+  size_t _chunk_alignment;
 
 public:
-  PretouchTask(const char* task_name, char* start_address, char* end_address, size_t page_size, size_t chunk_size);
+  PretouchTask(const char* task_name, char* start_address, char* end_address, size_t page_size, size_t chunk_size,
+               size_t chunk_alignment);
 
   virtual void work(uint worker_id);
 
   static size_t chunk_size();
+  static size_t chunk_alignment(size_t page_size);
 
   static void pretouch(const char* task_name, char* start_address, char* end_address,
                        size_t page_size, WorkerThreads* pretouch_workers);
@@ -30,6 +30,7 @@ StringDedup::Stat::Stat() :
   _inspected(0),
   _known(0),
   _known_shared(0),
+  _known_interned(0),
   _new(0),
   _new_bytes(0),
   _deduped(0),
@@ -57,6 +58,7 @@ void StringDedup::Stat::add(const Stat* const stat) {
   _inspected           += stat->_inspected;
   _known               += stat->_known;
   _known_shared        += stat->_known_shared;
+  _known_interned      += stat->_known_interned;
   _new                 += stat->_new;
   _new_bytes           += stat->_new_bytes;
   _deduped             += stat->_deduped;
@@ -211,6 +213,7 @@ void StringDedup::Stat::log_times(const char* prefix) const {
 void StringDedup::Stat::log_statistics(bool total) const {
   double known_percent               = percent_of(_known, _inspected);
   double known_shared_percent        = percent_of(_known_shared, _inspected);
+  double known_interned_percent      = percent_of(_known_interned, _inspected);
   double new_percent                 = percent_of(_new, _inspected);
   double deduped_percent             = percent_of(_deduped, _inspected);
   double deduped_bytes_percent       = percent_of(_deduped_bytes, _new_bytes);
@@ -220,6 +223,7 @@ void StringDedup::Stat::log_statistics(bool total) const {
   log_debug(stringdedup)("    Inspected:    %12zu", _inspected);
   log_debug(stringdedup)("      Known:      %12zu(%5.1f%%)", _known, known_percent);
   log_debug(stringdedup)("      Shared:     %12zu(%5.1f%%)", _known_shared, known_shared_percent);
+  log_debug(stringdedup)("      Interned:   %12zu(%5.1f%%)", _known_interned, known_interned_percent);
   log_debug(stringdedup)("      New:        %12zu(%5.1f%%)" STRDEDUP_BYTES_FORMAT,
                          _new, new_percent, STRDEDUP_BYTES_PARAM(_new_bytes));
   log_debug(stringdedup)("      Replaced:   %12zu(%5.1f%%)", _replaced, replaced_percent);
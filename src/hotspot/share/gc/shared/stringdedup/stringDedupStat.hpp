@@ -39,6 +39,7 @@ class StringDedup::Stat {
   size_t _inspected;
   size_t _known;
   size_t _known_shared;
+  size_t _known_interned;
   size_t _new;
   size_t _new_bytes;
   size_t _deduped;
@@ -106,6 +107,11 @@ class StringDedup::Stat {
     _known_shared++;
   }
 
+  // Track number of inspected strings found in the dynamic StringTable.
+  void inc_known_interned() {
+    _known_interned++;
+  }
+
   // Track number of inspected strings added and accumulated size.
   void inc_new(size_t bytes) {
     _new++;
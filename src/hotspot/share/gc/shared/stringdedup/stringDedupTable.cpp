@@ -594,6 +594,38 @@ bool StringDedup::Table::try_deduplicate_shared(oop java_string) {
 
 #endif // INCLUDE_CDS_JAVA_HEAP
 
+// Deduplicate against the dynamic StringTable.  Interned strings are
+// long-lived and already indexed by content there, so using their value
+// arrays as dedup targets avoids entering a second copy of those arrays
+// into the dedup table.  The lookup compares String contents, so it works
+// for both coders without inflating latin1 values.
+bool StringDedup::Table::try_deduplicate_interned(oop java_string) {
+  typeArrayOop value = java_lang_String::value(java_string);
+  assert(value != nullptr, "precondition");
+  oop found = StringTable::lookup(java_string);
+  // A found string with a different coder has a value array that differs
+  // from value in encoding, so can't be shared.
+  if ((found == nullptr) ||
+      (java_lang_String::is_latin1(found) != java_lang_String::is_latin1(java_string))) {
+    return false;
+  }
+  _cur_stat.inc_known_interned();
+  typeArrayOop found_value = java_lang_String::value(found);
+  if (found_value == value) {
+    // Already sharing the interned string's value, possibly because
+    // java_string is the interned string.
+    return true;
+  } else if (deduplicate_if_permitted(java_string, found_value)) {
+    _cur_stat.inc_deduped(found_value->size() * HeapWordSize);
+    return true;
+  } else {
+    // java_string is (being) interned, but found is a different string
+    // with the same contents, e.g. the table entry was replaced.  Let the
+    // normal dedup table processing handle it.
+    return false;
+  }
+}
+
 bool StringDedup::Table::deduplicate_if_permitted(oop java_string,
                                                   typeArrayOop value) {
   // The non-dedup check and value assignment must be under lock.
@@ -613,6 +645,10 @@ void StringDedup::Table::deduplicate(oop java_string) {
       try_deduplicate_shared(java_string)) {
     return;                     // Done if deduplicated against shared StringTable.
   }
+  if (StringDeduplicationUseStringTable &&
+      try_deduplicate_interned(java_string)) {
+    return;                     // Done if deduplicated against dynamic StringTable.
+  }
   typeArrayOop value = java_lang_String::value(java_string);
   uint hash_code = compute_hash(value);
   TableValue tv = find(value, hash_code);
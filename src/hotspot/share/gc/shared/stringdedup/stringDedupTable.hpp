@@ -98,6 +98,7 @@ class StringDedup::Table : AllStatic {
   static bool deduplicate_if_permitted(oop java_string, typeArrayOop value);
   static bool try_deduplicate_shared(oop java_string);
   static bool try_deduplicate_found_shared(oop java_string, oop found);
+  static bool try_deduplicate_interned(oop java_string);
   static Bucket* make_buckets(size_t number_of_buckets, size_t reserve = 0);
   static void free_buckets(Bucket* buckets, size_t number_of_buckets);
 
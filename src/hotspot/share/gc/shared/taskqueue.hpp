@@ -47,6 +47,7 @@ class TaskQueueStats {
     steal_success,    // number of successful steals
     steal_max_contended_in_a_row, // maximum number of contended steals in a row
     steal_bias_drop,  // number of times the bias has been dropped
+    steal_batched,    // subset of successful steals that were taken in addition to the first one
     overflow,         // number of overflow pushes
     overflow_max_len, // max length of overflow stack
     last_stat_id
@@ -68,6 +69,7 @@ class TaskQueueStats {
     }
   }
   inline void record_bias_drop() { ++_stats[steal_bias_drop]; }
+  inline void record_steal_batched() { ++_stats[steal_batched]; }
   inline void record_overflow(size_t new_length);
 
   TaskQueueStats & operator +=(const TaskQueueStats & addend);
@@ -471,6 +473,11 @@ class GenericTaskQueueSet: public TaskQueueSetSuperImpl<MT> {
   // as for the last pop_global() operation.
   PopResult steal_best_of_2(uint queue_num, E& t);
 
+  // After a successful steal from victim, steals up to WorkStealingBatchSize - 1
+  // additional elements from it into the local queue, but at most half of the
+  // elements remaining in the victim.
+  void steal_batch(T* local_queue, T* victim);
+
 public:
   GenericTaskQueueSet(uint n);
   ~GenericTaskQueueSet();
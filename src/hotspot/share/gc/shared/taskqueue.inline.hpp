@@ -27,6 +27,7 @@
 
 #include "gc/shared/taskqueue.hpp"
 
+#include "gc/shared/gc_globals.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allocation.inline.hpp"
@@ -353,6 +354,7 @@ typename GenericTaskQueueSet<T, MT>::PopResult GenericTaskQueueSet<T, MT>::steal
 
     if (suc == PopResult::Success) {
       local_queue->set_last_stolen_queue_id(sel_k);
+      steal_batch(local_queue, queue(sel_k));
     } else {
       local_queue->invalidate_last_stolen_queue_id();
     }
@@ -363,6 +365,9 @@ typename GenericTaskQueueSet<T, MT>::PopResult GenericTaskQueueSet<T, MT>::steal
     uint k = (queue_num + 1) % 2;
     PopResult res = queue(k)->pop_global(t);
     TASKQUEUE_STATS_ONLY(local_queue->record_steal_attempt(res);)
+    if (res == PopResult::Success) {
+      steal_batch(local_queue, queue(k));
+    }
     return res;
   } else {
     assert(_n == 1, "can't be zero.");
@@ -371,6 +376,31 @@ typename GenericTaskQueueSet<T, MT>::PopResult GenericTaskQueueSet<T, MT>::steal
   }
 }
 
+template<class T, MemTag MT>
+void GenericTaskQueueSet<T, MT>::steal_batch(T* local_queue, T* victim) {
+  if (WorkStealingBatchSize <= 1) {
+    return;
+  }
+
+  // Leave at least half of its elements to the victim and other thieves.
+  uint const n = MIN2(victim->size() / 2, (uint)WorkStealingBatchSize - 1);
+  for (uint i = 0; i < n; i++) {
+    // Only the owner pushes to the local queue, so the check is stable.
+    if (local_queue->size() >= local_queue->max_elems()) {
+      return;
+    }
+    E e;
+    PopResult res = victim->pop_global(e);
+    TASKQUEUE_STATS_ONLY(local_queue->record_steal_attempt(res);)
+    if (res != PopResult::Success) {
+      return;
+    }
+    TASKQUEUE_STATS_ONLY(local_queue->stats.record_steal_batched();)
+    bool pushed = local_queue->push(e);
+    assert(pushed, "must have room");
+  }
+}
+
 template<class T, MemTag MT>
 bool GenericTaskQueueSet<T, MT>::steal(uint queue_num, E& t) {
   uint const num_retries = 2 * _n;
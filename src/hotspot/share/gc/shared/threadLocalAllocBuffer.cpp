@@ -83,23 +83,27 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
 
   print_stats("gc");
 
-  if (_number_of_refills > 0) {
-    // Update allocation history if a reasonable amount of eden was allocated.
-    bool update_allocation_history = used > 0.5 * capacity;
-
-    if (update_allocation_history) {
-      // Average the fraction of eden allocated in a tlab by this
-      // thread for use in the next resize operation.
-      // _gc_waste is not subtracted because it's included in
-      // "used".
-      // The result can be larger than 1.0 due to direct to old allocations.
-      // These allocations should ideally not be counted but since it is not possible
-      // to filter them out here we just cap the fraction to be at most 1.0.
-      // Keep alloc_frac as float and not double to avoid the double to float conversion
-      float alloc_frac = MIN2(1.0f, allocated_since_last_gc / (float) used);
-      _allocation_fraction.sample(alloc_frac);
-    }
+  // Update allocation history if a reasonable amount of eden was allocated.
+  // Threads that did not refill their tlab are only sampled with
+  // TLABTrackIdleThreads; otherwise an idle thread keeps the desired size
+  // it had when it was last busy.
+  bool update_allocation_history = used > 0.5 * capacity &&
+                                   (_number_of_refills > 0 || TLABTrackIdleThreads);
+
+  if (update_allocation_history) {
+    // Average the fraction of eden allocated in a tlab by this
+    // thread for use in the next resize operation.
+    // _gc_waste is not subtracted because it's included in
+    // "used".
+    // The result can be larger than 1.0 due to direct to old allocations.
+    // These allocations should ideally not be counted but since it is not possible
+    // to filter them out here we just cap the fraction to be at most 1.0.
+    // Keep alloc_frac as float and not double to avoid the double to float conversion
+    float alloc_frac = MIN2(1.0f, allocated_since_last_gc / (float) used);
+    _allocation_fraction.sample(alloc_frac);
+  }
 
+  if (_number_of_refills > 0) {
     stats->update_fast_allocations(_number_of_refills,
                                    _allocated_size,
                                    _gc_waste,
@@ -107,9 +111,11 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
   } else {
     assert(_number_of_refills == 0 && _refill_waste == 0 && _gc_waste == 0,
            "tlab stats == 0");
+    stats->update_idle_threads();
   }
 
   stats->update_slow_allocations(_slow_allocations);
+  stats->update_desired_size(desired_size());
 
   reset_statistics();
 }
@@ -335,6 +341,8 @@ PerfVariable* ThreadLocalAllocStats::_perf_total_refill_waste;
 PerfVariable* ThreadLocalAllocStats::_perf_max_refill_waste;
 PerfVariable* ThreadLocalAllocStats::_perf_total_slow_allocations;
 PerfVariable* ThreadLocalAllocStats::_perf_max_slow_allocations;
+PerfVariable* ThreadLocalAllocStats::_perf_idle_threads;
+PerfVariable* ThreadLocalAllocStats::_perf_max_desired_size;
 AdaptiveWeightedAverage ThreadLocalAllocStats::_allocating_threads_avg(0);
 
 static PerfVariable* create_perf_variable(const char* name, PerfData::Units unit, TRAPS) {
@@ -358,6 +366,8 @@ void ThreadLocalAllocStats::initialize() {
     _perf_max_refill_waste        = create_perf_variable("maxRefillWaste", PerfData::U_Bytes, CHECK);
     _perf_total_slow_allocations  = create_perf_variable("slowAlloc",      PerfData::U_None,  CHECK);
     _perf_max_slow_allocations    = create_perf_variable("maxSlowAlloc",   PerfData::U_None,  CHECK);
+    _perf_idle_threads            = create_perf_variable("idleThreads",    PerfData::U_None,  CHECK);
+    _perf_max_desired_size        = create_perf_variable("maxDesiredSize", PerfData::U_Bytes, CHECK);
   }
 }
 
@@ -371,7 +381,9 @@ ThreadLocalAllocStats::ThreadLocalAllocStats() :
     _total_refill_waste(0),
     _max_refill_waste(0),
     _total_slow_allocations(0),
-    _max_slow_allocations(0) {}
+    _max_slow_allocations(0),
+    _idle_threads(0),
+    _max_desired_size(0) {}
 
 unsigned int ThreadLocalAllocStats::allocating_threads_avg() {
   return MAX2((unsigned int)(_allocating_threads_avg.average() + 0.5), 1U);
@@ -396,6 +408,14 @@ void ThreadLocalAllocStats::update_slow_allocations(unsigned int allocations) {
   _max_slow_allocations    = MAX2(_max_slow_allocations, allocations);
 }
 
+void ThreadLocalAllocStats::update_idle_threads() {
+  _idle_threads += 1;
+}
+
+void ThreadLocalAllocStats::update_desired_size(size_t desired_size) {
+  _max_desired_size = MAX2(_max_desired_size, desired_size);
+}
+
 void ThreadLocalAllocStats::update(const ThreadLocalAllocStats& other) {
   _allocating_threads      += other._allocating_threads;
   _total_refills           += other._total_refills;
@@ -407,6 +427,8 @@ void ThreadLocalAllocStats::update(const ThreadLocalAllocStats& other) {
   _max_refill_waste         = MAX2(_max_refill_waste, other._max_refill_waste);
   _total_slow_allocations  += other._total_slow_allocations;
   _max_slow_allocations     = MAX2(_max_slow_allocations, other._max_slow_allocations);
+  _idle_threads            += other._idle_threads;
+  _max_desired_size         = MAX2(_max_desired_size, other._max_desired_size);
 }
 
 void ThreadLocalAllocStats::reset() {
@@ -420,6 +442,8 @@ void ThreadLocalAllocStats::reset() {
   _max_refill_waste        = 0;
   _total_slow_allocations  = 0;
   _max_slow_allocations    = 0;
+  _idle_threads            = 0;
+  _max_desired_size        = 0;
 }
 
 void ThreadLocalAllocStats::publish() {
@@ -434,11 +458,13 @@ void ThreadLocalAllocStats::publish() {
   log_debug(gc, tlab)("TLAB totals: thrds: %d  refills: %d max: %d"
                       " slow allocs: %d max %d waste: %4.1f%%"
                       " gc: %zuB max: %zuB"
-                      " slow: %zuB max: %zuB",
+                      " slow: %zuB max: %zuB"
+                      " idle thrds: %d max desired size: %zuKB",
                       _allocating_threads, _total_refills, _max_refills,
                       _total_slow_allocations, _max_slow_allocations, waste_percent,
                       _total_gc_waste * HeapWordSize, _max_gc_waste * HeapWordSize,
-                      _total_refill_waste * HeapWordSize, _max_refill_waste * HeapWordSize);
+                      _total_refill_waste * HeapWordSize, _max_refill_waste * HeapWordSize,
+                      _idle_threads, _max_desired_size / (K / HeapWordSize));
 
   if (UsePerfData) {
     _perf_allocating_threads      ->set_value(_allocating_threads);
@@ -451,6 +477,8 @@ void ThreadLocalAllocStats::publish() {
     _perf_max_refill_waste        ->set_value(_max_refill_waste);
     _perf_total_slow_allocations  ->set_value(_total_slow_allocations);
     _perf_max_slow_allocations    ->set_value(_max_slow_allocations);
+    _perf_idle_threads            ->set_value(_idle_threads);
+    _perf_max_desired_size        ->set_value(_max_desired_size * HeapWordSize);
   }
 }
 
@@ -198,6 +198,8 @@ class ThreadLocalAllocStats : public StackObj {
   static PerfVariable* _perf_max_refill_waste;
   static PerfVariable* _perf_total_slow_allocations;
   static PerfVariable* _perf_max_slow_allocations;
+  static PerfVariable* _perf_idle_threads;
+  static PerfVariable* _perf_max_desired_size;
 
   static AdaptiveWeightedAverage _allocating_threads_avg;
 
@@ -211,6 +213,8 @@ class ThreadLocalAllocStats : public StackObj {
   size_t       _max_refill_waste;
   unsigned int _total_slow_allocations;
   unsigned int _max_slow_allocations;
+  unsigned int _idle_threads;
+  size_t       _max_desired_size;
 
 public:
   static void initialize();
@@ -223,6 +227,8 @@ class ThreadLocalAllocStats : public StackObj {
                                size_t gc_waste,
                                size_t refill_waste);
   void update_slow_allocations(unsigned int allocations);
+  void update_idle_threads();
+  void update_desired_size(size_t desired_size);
   void update(const ThreadLocalAllocStats& other);
 
   void reset();
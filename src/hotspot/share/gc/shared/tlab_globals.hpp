@@ -66,6 +66,11 @@
           "Allocation averaging weight")                                    \
           range(0, 100)                                                     \
                                                                             \
+  product(bool, TLABTrackIdleThreads, true,                                 \
+          "Also update the allocation history of threads that did not "     \
+          "refill their TLAB since the last GC, so that the desired TLAB "  \
+          "size of idle threads shrinks")                                   \
+                                                                            \
   /* At GC all TLABs are retired, and each thread's active  */              \
   /* TLAB is assumed to be half full on average. The        */              \
   /* remaining space is waste, proportional to TLAB size.   */              \
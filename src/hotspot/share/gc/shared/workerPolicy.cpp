@@ -82,7 +82,7 @@ uint WorkerPolicy::parallel_worker_threads() {
 //  Else
 //    Calculate the number of GC threads based on the number of Java threads.
 //    Calculate the number of GC threads based on the size of the heap.
-//    Use the larger.
+//    Use the larger, but no more than the processors currently available.
 uint WorkerPolicy::calc_default_active_workers(uintx total_workers,
                                                const uintx min_workers,
                                                uintx active_workers,
@@ -114,6 +114,13 @@ uint WorkerPolicy::calc_default_active_workers(uintx total_workers,
   uintx max_active_workers =
     MAX2(active_workers_by_JT, active_workers_by_heap_size);
 
+  // The total number of workers was sized for the processors available at
+  // startup. The processors available now can be fewer, e.g. after the
+  // CPU quota of the container was lowered, and more workers than that
+  // only add scheduling overhead.
+  uintx active_processors = (uintx) os::active_processor_count();
+  max_active_workers = MIN2(max_active_workers, MAX2(active_processors, min_workers));
+
   new_active_workers = MIN2(max_active_workers, (uintx) total_workers);
 
   // Increase GC workers instantly but decrease them more
@@ -131,9 +138,10 @@ uint WorkerPolicy::calc_default_active_workers(uintx total_workers,
   log_trace(gc, task)("WorkerPolicy::calc_default_active_workers() : "
     "active_workers(): %zu  new_active_workers: %zu  "
     "prev_active_workers: %zu\n"
-    " active_workers_by_JT: %zu  active_workers_by_heap_size: %zu",
+    " active_workers_by_JT: %zu  active_workers_by_heap_size: %zu"
+    "  active_processors: %zu",
     active_workers, new_active_workers, prev_active_workers,
-    active_workers_by_JT, active_workers_by_heap_size);
+    active_workers_by_JT, active_workers_by_heap_size, active_processors);
   assert(new_active_workers > 0, "Always need at least 1");
   return new_active_workers;
 }
@@ -27,6 +27,7 @@
 
 #include "gc/shared/gc_globals.hpp"
 #include "gc/shenandoah/shenandoahNumberSeq.hpp"
+#include "runtime/os.hpp"
 
 enum CardStatType {
   DIRTY_RUN,
@@ -37,6 +38,7 @@ enum CardStatType {
   MAX_CLEAN_RUN,
   DIRTY_SCAN_OBJS,
   ALTERNATIONS,
+  SCAN_TIME,
   MAX_CARD_STAT_TYPE
 };
 
@@ -61,6 +63,8 @@ class ShenandoahCardStats: public CHeapObj<mtGC> {
 
   size_t _alternation_cnt;
 
+  jlong _start_ticks;
+
 public:
   ShenandoahCardStats(size_t cards_in_cluster, HdrSeq* card_stats) :
     _cards_in_cluster(cards_in_cluster),
@@ -70,7 +74,8 @@ class ShenandoahCardStats: public CHeapObj<mtGC> {
     _max_dirty_run(0),
     _max_clean_run(0),
     _dirty_scan_obj_cnt(0),
-    _alternation_cnt(0)
+    _alternation_cnt(0),
+    _start_ticks(ShenandoahEnableCardStats ? os::elapsed_counter() : 0)
   { }
 
   ~ShenandoahCardStats() {
@@ -92,6 +97,10 @@ class ShenandoahCardStats: public CHeapObj<mtGC> {
 
       // Update global stats for alternation counts
       _local_card_stats[ALTERNATIONS].add(_alternation_cnt);
+
+      // Update global stats for time spent scanning the chunk, in microseconds
+      jlong ticks = os::elapsed_counter() - _start_ticks;
+      _local_card_stats[SCAN_TIME].add(ticks * 1000000.0 / os::elapsed_frequency());
     }
   }
 
@@ -56,11 +56,17 @@ class ShenandoahLeftRightIterator {
   idx_t _end;
   ShenandoahRegionPartitions* _partitions;
   ShenandoahFreeSetPartitionId _partition;
+  bool _use_empty;
 public:
   explicit ShenandoahLeftRightIterator(ShenandoahRegionPartitions* partitions, ShenandoahFreeSetPartitionId partition, bool use_empty = false)
-    : _idx(0), _end(0), _partitions(partitions), _partition(partition) {
-    _idx = use_empty ? _partitions->leftmost_empty(_partition) : _partitions->leftmost(_partition);
-    _end = use_empty ? _partitions->rightmost_empty(_partition) : _partitions->rightmost(_partition);
+    : _idx(0), _end(0), _partitions(partitions), _partition(partition), _use_empty(use_empty) {
+    reset();
+  }
+
+  // Restart the iteration from the current partition boundaries.
+  void reset() {
+    _idx = _use_empty ? _partitions->leftmost_empty(_partition) : _partitions->leftmost(_partition);
+    _end = _use_empty ? _partitions->rightmost_empty(_partition) : _partitions->rightmost(_partition);
   }
 
   bool has_next() const {
@@ -87,11 +93,17 @@ class ShenandoahRightLeftIterator {
   idx_t _end;
   ShenandoahRegionPartitions* _partitions;
   ShenandoahFreeSetPartitionId _partition;
+  bool _use_empty;
 public:
   explicit ShenandoahRightLeftIterator(ShenandoahRegionPartitions* partitions, ShenandoahFreeSetPartitionId partition, bool use_empty = false)
-    : _idx(0), _end(0), _partitions(partitions), _partition(partition) {
-    _idx = use_empty ? _partitions->rightmost_empty(_partition) : _partitions->rightmost(_partition);
-    _end = use_empty ? _partitions->leftmost_empty(_partition) : _partitions->leftmost(_partition);
+    : _idx(0), _end(0), _partitions(partitions), _partition(partition), _use_empty(use_empty) {
+    reset();
+  }
+
+  // Restart the iteration from the current partition boundaries.
+  void reset() {
+    _idx = _use_empty ? _partitions->rightmost_empty(_partition) : _partitions->rightmost(_partition);
+    _end = _use_empty ? _partitions->leftmost_empty(_partition) : _partitions->leftmost(_partition);
   }
 
   bool has_next() const {
@@ -780,14 +792,35 @@ HeapWord* ShenandoahFreeSet::allocate_from_partition_with_affiliation(Shenandoah
   }
 }
 
+uint ShenandoahFreeSet::preferred_numa_node() const {
+  return _heap->is_numa_local_allocation() ? _heap->current_numa_node_index() : ANY_NUMA_NODE;
+}
+
+bool ShenandoahFreeSet::skip_in_numa_pass(idx_t idx, uint numa_node, int pass) const {
+  if (numa_node == ANY_NUMA_NODE) {
+    return false;
+  }
+  bool is_local = _heap->numa_node_index_for_region(idx) == numa_node;
+  return (pass == 0) != is_local;
+}
+
 template<typename Iter>
 HeapWord* ShenandoahFreeSet::allocate_with_affiliation(Iter& iterator, ShenandoahAffiliation affiliation, ShenandoahAllocRequest& req, bool& in_new_region) {
-  for (idx_t idx = iterator.current(); iterator.has_next(); idx = iterator.next()) {
-    ShenandoahHeapRegion* r = _heap->get_region(idx);
-    if (r->affiliation() == affiliation) {
-      HeapWord* result = try_allocate_in(r, req, in_new_region);
-      if (result != nullptr) {
-        return result;
+  uint numa_node = preferred_numa_node();
+  for (int pass = (numa_node == ANY_NUMA_NODE) ? 1 : 0; pass < 2; pass++) {
+    if (pass == 1 && numa_node != ANY_NUMA_NODE) {
+      iterator.reset();
+    }
+    for (idx_t idx = iterator.current(); iterator.has_next(); idx = iterator.next()) {
+      if (skip_in_numa_pass(idx, numa_node, pass)) {
+        continue;
+      }
+      ShenandoahHeapRegion* r = _heap->get_region(idx);
+      if (r->affiliation() == affiliation) {
+        HeapWord* result = try_allocate_in(r, req, in_new_region);
+        if (result != nullptr) {
+          return result;
+        }
       }
     }
   }
@@ -877,13 +910,22 @@ void ShenandoahFreeSet::update_allocation_bias() {
 
 template<typename Iter>
 HeapWord* ShenandoahFreeSet::allocate_from_regions(Iter& iterator, ShenandoahAllocRequest &req, bool &in_new_region) {
-  for (idx_t idx = iterator.current(); iterator.has_next(); idx = iterator.next()) {
-    ShenandoahHeapRegion* r = _heap->get_region(idx);
-    size_t min_size = (req.type() == ShenandoahAllocRequest::_alloc_tlab) ? req.min_size() : req.size();
-    if (alloc_capacity(r) >= min_size) {
-      HeapWord* result = try_allocate_in(r, req, in_new_region);
-      if (result != nullptr) {
-        return result;
+  uint numa_node = preferred_numa_node();
+  for (int pass = (numa_node == ANY_NUMA_NODE) ? 1 : 0; pass < 2; pass++) {
+    if (pass == 1 && numa_node != ANY_NUMA_NODE) {
+      iterator.reset();
+    }
+    for (idx_t idx = iterator.current(); iterator.has_next(); idx = iterator.next()) {
+      if (skip_in_numa_pass(idx, numa_node, pass)) {
+        continue;
+      }
+      ShenandoahHeapRegion* r = _heap->get_region(idx);
+      size_t min_size = (req.type() == ShenandoahAllocRequest::_alloc_tlab) ? req.min_size() : req.size();
+      if (alloc_capacity(r) >= min_size) {
+        HeapWord* result = try_allocate_in(r, req, in_new_region);
+        if (result != nullptr) {
+          return result;
+        }
       }
     }
   }
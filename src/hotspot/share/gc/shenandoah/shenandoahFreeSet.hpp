@@ -365,6 +365,13 @@ class ShenandoahFreeSet : public CHeapObj<mtGC> {
   // Update allocation bias and decided whether to allocate from the left or right side of the heap.
   void update_allocation_bias();
 
+  // With ShenandoahNUMALocalAllocation, the region scans below make two passes over the iterated range:
+  // the first pass only tries regions bound to the NUMA node of the allocating thread, the second pass
+  // tries the remaining regions.
+  static const uint ANY_NUMA_NODE = UINT_MAX;
+  uint preferred_numa_node() const;
+  bool skip_in_numa_pass(idx_t idx, uint numa_node, int pass) const;
+
   // Search for regions to satisfy allocation request using iterator.
   template<typename Iter>
   HeapWord* allocate_from_regions(Iter& iterator, ShenandoahAllocRequest &req, bool &in_new_region);
@@ -403,6 +403,8 @@ jint ShenandoahHeap::initialize() {
   _regions = NEW_C_HEAP_ARRAY(ShenandoahHeapRegion*, _num_regions, mtGC);
   _affiliations = NEW_C_HEAP_ARRAY(uint8_t, _num_regions, mtGC);
 
+  initialize_numa();
+
   {
     ShenandoahHeapLocker locker(lock());
     _free_set = new ShenandoahFreeSet(this, _num_regions);
@@ -418,6 +420,10 @@ jint ShenandoahHeap::initialize() {
       _regions[i] = r;
       assert(!collection_set()->is_in(i), "New region should not be in collection set");
 
+      if (is_committed) {
+        make_region_numa_local(r);
+      }
+
       _affiliations[i] = ShenandoahAffiliation::FREE;
     }
 
@@ -546,6 +552,8 @@ ShenandoahHeap::ShenandoahHeap(ShenandoahCollectorPolicy* policy) :
   _num_regions(0),
   _regions(nullptr),
   _affiliations(nullptr),
+  _numa_node_count(1),
+  _numa_node_ids(nullptr),
   _gc_state_changed(false),
   _gc_no_progress_count(0),
   _cancel_requested_time(0),
@@ -585,6 +593,38 @@ ShenandoahHeap::ShenandoahHeap(ShenandoahCollectorPolicy* policy) :
 #pragma warning( pop )
 #endif
 
+void ShenandoahHeap::initialize_numa() {
+  if (!UseNUMA || !ShenandoahNUMALocalAllocation) {
+    return;
+  }
+  size_t num_nodes = os::numa_get_groups_num();
+  if (num_nodes <= 1) {
+    return;
+  }
+  _numa_node_ids = NEW_C_HEAP_ARRAY(uint, num_nodes, mtGC);
+  _numa_node_count = (uint)os::numa_get_leaf_groups(_numa_node_ids, num_nodes);
+  _numa_node_count = MAX2(1U, MIN2(_numa_node_count, (uint)_num_regions));
+  log_info(gc, init)("NUMA local allocation: %u nodes", _numa_node_count);
+}
+
+uint ShenandoahHeap::current_numa_node_index() const {
+  assert(is_numa_local_allocation(), "Should only be called with NUMA local allocation");
+  uint id = (uint)os::numa_get_group_id();
+  for (uint i = 0; i < _numa_node_count; i++) {
+    if (_numa_node_ids[i] == id) {
+      return i;
+    }
+  }
+  return 0;
+}
+
+void ShenandoahHeap::make_region_numa_local(ShenandoahHeapRegion* r) {
+  if (is_numa_local_allocation()) {
+    uint id = _numa_node_ids[numa_node_index_for_region(r->index())];
+    os::numa_make_local((char*) r->bottom(), ShenandoahHeapRegion::region_size_bytes(), (int) id);
+  }
+}
+
 void ShenandoahHeap::print_heap_on(outputStream* st) const {
   st->print_cr("Shenandoah Heap");
   st->print_cr(" %zu%s max, %zu%s soft max, %zu%s committed, %zu%s used",
@@ -290,6 +290,13 @@ class ShenandoahHeap : public CollectedHeap {
   ShenandoahHeapRegion** _regions;
   uint8_t* _affiliations;       // Holds array of enum ShenandoahAffiliation, including FREE status in non-generational mode
 
+  // NUMA support. When enabled, the heap is split into _numa_node_count
+  // contiguous slices of regions, each slice bound to one NUMA node.
+  uint      _numa_node_count;
+  uint*     _numa_node_ids;
+
+  void initialize_numa();
+
 public:
 
   inline HeapWord* base() const { return _heap_region.start(); }
@@ -302,6 +309,13 @@ class ShenandoahHeap : public CollectedHeap {
 
   inline ShenandoahHeapRegion* get_region(size_t region_idx) const;
 
+  inline bool is_numa_local_allocation() const { return _numa_node_count > 1; }
+  inline uint numa_node_index_for_region(size_t region_idx) const {
+    return (uint)(region_idx * _numa_node_count / _num_regions);
+  }
+  uint current_numa_node_index() const;
+  void make_region_numa_local(ShenandoahHeapRegion* r);
+
   void heap_region_iterate(ShenandoahHeapRegionClosure* blk) const;
   void parallel_heap_region_iterate(ShenandoahHeapRegionClosure* blk) const;
 
@@ -55,10 +55,57 @@
  *
  * The allocatable space when GC is running is "free" at the start of phase, but the
  * accounted budget is based on "used". So, we need to adjust the tax knowing that.
+ *
+ * The linear tax assumes the application would consume all taxable space before the cycle
+ * completes. With ShenandoahAdaptivePacing, we predict the time until the end of the cycle
+ * from the recorded durations of the remaining phases, and the allocations during that time
+ * from the recorded allocation rate. If those allocations fit into the taxable space, the tax
+ * is scaled down accordingly. Bursts above the prediction still deplete the budget and stall.
  */
 
+void ShenandoahPacer::start_phase(PacingPhase phase) {
+  double now = os::elapsedTime();
+  double elapsed = now - _phase_start;
+  intptr_t allocated = Atomic::xchg(&_allocated, (intptr_t)0, memory_order_relaxed);
+  if (_phase >= _mark && elapsed > 0) {
+    _phase_times[_phase]->add(elapsed);
+    _alloc_rate->add(allocated / elapsed);
+  }
+  _phase = phase;
+  _phase_start = now;
+}
+
+double ShenandoahPacer::adaptive_tax_factor(PacingPhase phase, size_t taxable_bytes) const {
+  // Be conservative: take the upper bound at this many standard deviations.
+  const double sds = 2.0;
+  const double min_factor = 0.1;
+
+  if (_alloc_rate->num() == 0) {
+    return 1.0;
+  }
+  double remaining_time = 0;
+  for (int p = phase; p <= _update_refs; p++) {
+    TruncatedSeq* times = _phase_times[p];
+    if (times->num() == 0) {
+      // No history yet, keep the linear budget.
+      return 1.0;
+    }
+    remaining_time += times->davg() + sds * times->dsd();
+  }
+  double rate = _alloc_rate->davg() + sds * _alloc_rate->dsd();
+  double expected_bytes = rate * HeapWordSize * remaining_time;
+  double factor = clamp(expected_bytes / taxable_bytes, min_factor, 1.0);
+
+  log_info(gc, ergo)("Adaptive pacing. Expected Remaining Time: %.3fs, Expected Allocs: %zu%s, Tax Factor: %.2f",
+                     remaining_time,
+                     byte_size_in_proper_unit((size_t)expected_bytes), proper_unit_for_byte_size((size_t)expected_bytes),
+                     factor);
+  return factor;
+}
+
 void ShenandoahPacer::setup_for_mark() {
   assert(ShenandoahPacing, "Only be here when pacing is enabled");
+  start_phase(_mark);
 
   size_t live = update_and_get_progress_history();
   size_t free = _heap->free_set()->available();
@@ -70,6 +117,9 @@ void ShenandoahPacer::setup_for_mark() {
 
   double tax = 1.0 * live / taxable; // base tax for available free space
   tax *= 1;                          // mark can succeed with immediate garbage, claim all available space
+  if (ShenandoahAdaptivePacing) {
+    tax *= adaptive_tax_factor(_mark, taxable);
+  }
   tax *= ShenandoahPacingSurcharge;  // additional surcharge to help unclutter heap
 
   restart_with(non_taxable, tax);
@@ -84,6 +134,7 @@ void ShenandoahPacer::setup_for_mark() {
 
 void ShenandoahPacer::setup_for_evac() {
   assert(ShenandoahPacing, "Only be here when pacing is enabled");
+  start_phase(_evac);
 
   size_t used = _heap->collection_set()->used();
   size_t free = _heap->free_set()->available();
@@ -95,6 +146,9 @@ void ShenandoahPacer::setup_for_evac() {
 
   double tax = 1.0 * used / taxable; // base tax for available free space
   tax *= 2;                          // evac is followed by update-refs, claim 1/2 of remaining free
+  if (ShenandoahAdaptivePacing) {
+    tax *= adaptive_tax_factor(_evac, taxable);
+  }
   tax = MAX2<double>(1, tax);        // never allocate more than GC processes during the phase
   tax *= ShenandoahPacingSurcharge;  // additional surcharge to help unclutter heap
 
@@ -110,6 +164,7 @@ void ShenandoahPacer::setup_for_evac() {
 
 void ShenandoahPacer::setup_for_update_refs() {
   assert(ShenandoahPacing, "Only be here when pacing is enabled");
+  start_phase(_update_refs);
 
   size_t used = _heap->used();
   size_t free = _heap->free_set()->available();
@@ -121,6 +176,9 @@ void ShenandoahPacer::setup_for_update_refs() {
 
   double tax = 1.0 * used / taxable; // base tax for available free space
   tax *= 1;                          // update-refs is the last phase, claim the remaining free
+  if (ShenandoahAdaptivePacing) {
+    tax *= adaptive_tax_factor(_update_refs, taxable);
+  }
   tax = MAX2<double>(1, tax);        // never allocate more than GC processes during the phase
   tax *= ShenandoahPacingSurcharge;  // additional surcharge to help unclutter heap
 
@@ -145,6 +203,7 @@ void ShenandoahPacer::setup_for_update_refs() {
 
 void ShenandoahPacer::setup_for_idle() {
   assert(ShenandoahPacing, "Only be here when pacing is enabled");
+  start_phase(_idle);
 
   size_t initial = _heap->max_capacity() / 100 * ShenandoahPacingIdleSlack;
   double tax = 1;
@@ -163,6 +222,7 @@ void ShenandoahPacer::setup_for_idle() {
 
 void ShenandoahPacer::setup_for_reset() {
   assert(ShenandoahPacing, "Only be here when pacing is enabled");
+  start_phase(_reset);
 
   size_t initial = _heap->max_capacity();
   restart_with(initial, 1.0);
@@ -217,6 +277,26 @@ bool ShenandoahPacer::claim_for_alloc(size_t words) {
 template bool ShenandoahPacer::claim_for_alloc<true>(size_t words);
 template bool ShenandoahPacer::claim_for_alloc<false>(size_t words);
 
+// Claim the tax as soon as there is any budget left, going into debt for the rest.
+// The next allocators then stall until GC pays the debt off, instead of this thread
+// waiting for the whole tax while smaller claims keep draining the budget.
+bool ShenandoahPacer::claim_with_debt(size_t words) {
+  assert(ShenandoahPacing, "Only be here when pacing is enabled");
+
+  intptr_t tax = MAX2<intptr_t>(1, words * Atomic::load(&_tax_rate));
+
+  intptr_t cur = 0;
+  intptr_t new_val = 0;
+  do {
+    cur = Atomic::load(&_budget);
+    if (cur <= 0) {
+      return false;
+    }
+    new_val = cur - tax;
+  } while (Atomic::cmpxchg(&_budget, cur, new_val, memory_order_relaxed) != cur);
+  return true;
+}
+
 void ShenandoahPacer::unpace_for_alloc(intptr_t epoch, size_t words) {
   assert(ShenandoahPacing, "Only be here when pacing is enabled");
 
@@ -236,6 +316,10 @@ intptr_t ShenandoahPacer::epoch() {
 void ShenandoahPacer::pace_for_alloc(size_t words) {
   assert(ShenandoahPacing, "Only be here when pacing is enabled");
 
+  if (ShenandoahAdaptivePacing) {
+    Atomic::add(&_allocated, (intptr_t)words, memory_order_relaxed);
+  }
+
   // Fast path: try to allocate right away
   bool claimed = claim_for_alloc<false>(words);
   if (claimed) {
@@ -261,7 +345,7 @@ void ShenandoahPacer::pace_for_alloc(size_t words) {
   while (!claimed && os::javaTimeNanos() < deadline) {
     // We could instead assist GC, but this would suffice for now.
     wait(1);
-    claimed = claim_for_alloc<false>(words);
+    claimed = ShenandoahAdaptivePacing ? claim_with_debt(words) : claim_for_alloc<false>(words);
   }
   if (!claimed) {
     // Spent local time budget to wait for enough GC progress.
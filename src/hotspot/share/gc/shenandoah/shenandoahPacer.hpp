@@ -29,6 +29,8 @@
 #include "gc/shenandoah/shenandoahPadding.hpp"
 #include "gc/shenandoah/shenandoahSharedVariables.hpp"
 #include "memory/allocation.hpp"
+#include "runtime/mutex.hpp"
+#include "runtime/os.hpp"
 #include "runtime/task.hpp"
 
 class ShenandoahHeap;
@@ -56,12 +58,31 @@ class ShenandoahPeriodicPacerNotifyTask : public PeriodicTask {
  *
  * Currently it implements simple tax-and-spend pacing policy: GC threads provide
  * credit, allocating thread spend the credit, or stall when credit is not available.
+ *
+ * With ShenandoahAdaptivePacing, the tax is additionally scaled down when the allocations
+ * expected until the end of the cycle fit into the taxable free space.
  */
 class ShenandoahPacer : public CHeapObj<mtGC> {
+  friend class ShenandoahPacerTest;
 private:
+  enum PacingPhase {
+    _idle,
+    _reset,
+    _mark,
+    _evac,
+    _update_refs,
+    _num_phases
+  };
+
   ShenandoahHeap* _heap;
   double _last_time;
   TruncatedSeq* _progress_history;
+
+  // Adaptive pacing history
+  PacingPhase _phase;
+  double _phase_start;
+  TruncatedSeq* _phase_times[_num_phases];
+  TruncatedSeq* _alloc_rate;
   Monitor* _wait_monitor;
   ShenandoahSharedFlag _need_notify_waiters;
   ShenandoahPeriodicPacerNotifyTask _notify_waiters_task;
@@ -80,17 +101,29 @@ class ShenandoahPacer : public CHeapObj<mtGC> {
   volatile intptr_t _progress;
   shenandoah_padding(3);
 
+  // Heavily updated, protect from accidental false sharing
+  shenandoah_padding(4);
+  volatile intptr_t _allocated;
+  shenandoah_padding(5);
+
 public:
   explicit ShenandoahPacer(ShenandoahHeap* heap) :
           _heap(heap),
           _last_time(os::elapsedTime()),
           _progress_history(new TruncatedSeq(5)),
+          _phase(_idle),
+          _phase_start(os::elapsedTime()),
+          _alloc_rate(new TruncatedSeq(10)),
           _wait_monitor(new Monitor(Mutex::safepoint-1, "ShenandoahWaitMonitor_lock", true)),
           _notify_waiters_task(this),
           _epoch(0),
           _tax_rate(1),
           _budget(0),
-          _progress(PACING_PROGRESS_UNINIT) {
+          _progress(PACING_PROGRESS_UNINIT),
+          _allocated(0) {
+    for (int p = 0; p < _num_phases; p++) {
+      _phase_times[p] = new TruncatedSeq(5);
+    }
     _notify_waiters_task.enroll();
   }
 
@@ -127,6 +160,11 @@ class ShenandoahPacer : public CHeapObj<mtGC> {
   inline void add_budget(size_t words);
   void restart_with(size_t non_taxable_bytes, double tax_rate);
 
+  bool claim_with_debt(size_t words);
+
+  void start_phase(PacingPhase phase);
+  double adaptive_tax_factor(PacingPhase phase, size_t taxable_bytes) const;
+
   size_t update_and_get_progress_history();
 
   void wait(size_t time_ms);
@@ -692,7 +692,8 @@ class ShenandoahScanRemembered: public CHeapObj<mtGC> {
    "dirty_cards", "clean_cards",
    "max_dirty_run", "max_clean_run",
    "dirty_scan_objs",
-   "alternations"
+   "alternations",
+   "scan_time_us"
   };
 
   // The statistics are collected and logged separately for
@@ -831,6 +832,12 @@ class ShenandoahScanRemembered: public CHeapObj<mtGC> {
   void process_clusters(size_t first_cluster, size_t count, HeapWord* end_of_range, ClosureType* oops,
                         bool use_write_table, uint worker_id);
 
+  // Return the highest card index in [from_index, to_index] that holds a dirty card if FIND_DIRTY,
+  // or a clean card otherwise. Return from_index - 1 if there is no such card. Runs of cards that
+  // we are not looking for are skipped a word of cards at a time.
+  template <bool FIND_DIRTY>
+  static inline ssize_t find_last_card(const CardValue* ctbm, ssize_t from_index, ssize_t to_index);
+
   template <typename ClosureType>
   void process_humongous_clusters(ShenandoahHeapRegion* r, size_t first_cluster, size_t count,
                                   HeapWord* end_of_range, ClosureType* oops, bool use_write_table);
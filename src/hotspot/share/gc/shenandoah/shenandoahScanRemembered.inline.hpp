@@ -140,9 +140,8 @@ void ShenandoahScanRemembered::process_clusters(size_t first_cluster, size_t cou
       // ==== BEGIN DIRTY card range processing ====
 
       const size_t dirty_r = cur_index;  // record right end of dirty range (inclusive)
-      while (--cur_index >= (ssize_t)start_card_index && ctbm[cur_index] == CardTable::dirty_card_val()) {
-        // walk back over contiguous dirty cards to find left end of dirty range (inclusive)
-      }
+      // walk back over contiguous dirty cards to find left end of dirty range (inclusive)
+      cur_index = find_last_card<false>(ctbm, (ssize_t)start_card_index, cur_index - 1);
       // [dirty_l, dirty_r] is a "maximal" closed interval range of dirty card indices:
       // it may not be maximal if we are using the write_table, because of concurrent
       // mutations dirtying the card-table. It may also not be maximal if an upper bound
@@ -277,18 +276,48 @@ void ShenandoahScanRemembered::process_clusters(size_t first_cluster, size_t cou
       assert(use_write_table || ctbm[cur_index] == CardTable::clean_card_val(), "Error");
 
       // walk back over contiguous clean cards
-      size_t i = 0;
-      while (--cur_index >= (ssize_t)start_card_index && ctbm[cur_index] == CardTable::clean_card_val()) {
-        NOT_PRODUCT(i++);
-      }
+      NOT_PRODUCT(const ssize_t clean_r = cur_index;)
+      cur_index = find_last_card<true>(ctbm, (ssize_t)start_card_index, cur_index - 1);
       // Record alternations, clean run length, and clean card count
-      NOT_PRODUCT(stats.record_clean_run(i);)
+      NOT_PRODUCT(stats.record_clean_run(clean_r - cur_index - 1);)
 
       // ==== END CLEAN card range processing ====
     }
   }
 }
 
+template <bool FIND_DIRTY>
+inline ssize_t ShenandoahScanRemembered::find_last_card(const CardValue* ctbm, ssize_t from_index, ssize_t to_index) {
+  const CardValue skip_val = FIND_DIRTY ? CardTable::clean_card_val() : CardTable::dirty_card_val();
+  const uintptr_t skip_word = (~(uintptr_t)0 / 0xff) * skip_val;
+  const ssize_t cards_per_word = (ssize_t)sizeof(uintptr_t);
+
+  ssize_t i = to_index;
+  // Walk down to a word boundary one card at a time
+  while (i >= from_index && !is_aligned(&ctbm[i + 1], sizeof(uintptr_t))) {
+    if (ctbm[i] != skip_val) {
+      return i;
+    }
+    i--;
+  }
+  // Skip whole words of cards that we are not looking for
+  while (i - cards_per_word + 1 >= from_index) {
+    const uintptr_t w = *(const uintptr_t*)&ctbm[i - cards_per_word + 1];
+    if (w != skip_word) {
+      break;
+    }
+    i -= cards_per_word;
+  }
+  // Find the card within the word, or walk over the remainder of the range
+  while (i >= from_index) {
+    if (ctbm[i] != skip_val) {
+      return i;
+    }
+    i--;
+  }
+  return from_index - 1;
+}
+
 // Given that this range of clusters is known to span a humongous object spanned by region r, scan the
 // portion of the humongous object that corresponds to the specified range.
 template <typename ClosureType>
@@ -373,6 +373,11 @@
           "reserve/waste is incorrect, at the risk that application "       \
           "runs out of memory too early.")                                  \
                                                                             \
+  product(bool, ShenandoahNUMALocalAllocation, false, EXPERIMENTAL,         \
+          "With UseNUMA, bind each heap region to a NUMA node when it is "  \
+          "committed, and let mutator and GC allocations prefer regions "   \
+          "bound to the node of the allocating thread.")                    \
+                                                                            \
   product(uintx, ShenandoahOldEvacRatioPercent, 75, EXPERIMENTAL,           \
           "The maximum proportion of evacuation from old-gen memory, "      \
           "expressed as a percentage. The default value 75 denotes that no" \
@@ -435,6 +440,13 @@
           "uniform during the cycle. In percent of free space.")            \
           range(0, 100)                                                     \
                                                                             \
+  product(bool, ShenandoahAdaptivePacing, false, EXPERIMENTAL,              \
+          "Scale the pacing tax by the allocations expected until the end " \
+          "of the cycle, predicted from the recorded allocation rate and "  \
+          "the recorded durations of the concurrent phases. Stalled "       \
+          "allocators take the budget as soon as it becomes positive, "     \
+          "spreading the stalls across all allocating threads.")            \
+                                                                            \
   product(double, ShenandoahPacingSurcharge, 1.1, EXPERIMENTAL,             \
           "Additional pacing tax surcharge to help unclutter the heap. "    \
           "Larger values makes the pacing more aggressive. Lower values "   \
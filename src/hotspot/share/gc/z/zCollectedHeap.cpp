@@ -48,6 +48,7 @@
 #include "memory/universe.hpp"
 #include "oops/stackChunkOop.hpp"
 #include "runtime/continuationJavaClasses.hpp"
+#include "runtime/cpuTimeCounters.hpp"
 #include "runtime/java.hpp"
 #include "runtime/jniHandles.inline.hpp"
 #include "runtime/stackWatermarkSet.hpp"
@@ -87,6 +88,9 @@ jint ZCollectedHeap::initialize() {
 
   ZInitialize::finish();
 
+  // Create CPU time counter
+  CPUTimeCounters::create_counter(CPUTimeGroups::CPUTimeType::gc_parallel_workers);
+
   return JNI_OK;
 }
 
@@ -322,6 +326,26 @@ void ZCollectedHeap::gc_threads_do(ThreadClosure* tc) const {
   _runtime_workers.threads_do(tc);
 }
 
+void ZCollectedHeap::update_worker_threads_cpu_time() {
+  assert(Thread::current()->is_VM_thread(),
+         "Must be called from VM thread to avoid races");
+  if (!UsePerfData || !os::is_thread_cpu_time_supported()) {
+    return;
+  }
+
+  // Ensure ThreadTotalCPUTimeClosure destructor is called before publishing gc
+  // time.
+  {
+    ThreadTotalCPUTimeClosure tttc(CPUTimeGroups::CPUTimeType::gc_parallel_workers);
+    // The young and old generation workers never terminate, so it is safe for
+    // the VMThread to read their CPU times. They also do all of the concurrent
+    // work, so this covers both pause and concurrent phases.
+    _heap.threads_do(&tttc);
+  }
+
+  CPUTimeCounters::publish_gc_total_cpu_time();
+}
+
 VirtualSpaceSummary ZCollectedHeap::create_heap_space_summary() {
   const uintptr_t start = ZAddressHeapBase;
 
@@ -105,6 +105,8 @@ class ZCollectedHeap : public CollectedHeap {
 
   void gc_threads_do(ThreadClosure* tc) const override;
 
+  void update_worker_threads_cpu_time();
+
   VirtualSpaceSummary create_heap_space_summary() override;
 
   bool contains_null(const oop* p) const override;
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "gc/z/zCommitter.hpp"
+#include "gc/z/zGlobals.hpp"
+#include "gc/z/zHeap.inline.hpp"
+#include "gc/z/zLock.inline.hpp"
+#include "gc/z/zNUMA.hpp"
+#include "gc/z/zStat.hpp"
+#include "gc/z/z_globals.hpp"
+#include "logging/log.hpp"
+#include "utilities/align.hpp"
+
+static const ZStatCounter ZCounterCommitAhead("Memory", "Commit Ahead", ZStatUnitBytesPerSecond);
+
+ZCommitter::ZCommitter(uint32_t id, ZPartition* partition)
+  : _id(id),
+    _partition(partition),
+    _lock(),
+    _stop(false) {
+  set_name("ZCommitter#%u", id);
+  create_and_start();
+}
+
+bool ZCommitter::wait(uint64_t timeout) const {
+  ZLocker<ZConditionLock> locker(&_lock);
+  while (!ZCommitAhead && !_stop) {
+    _lock.wait();
+  }
+
+  if (!_stop && timeout > 0) {
+    _lock.wait(timeout);
+  }
+
+  return !_stop;
+}
+
+bool ZCommitter::should_continue() const {
+  ZLocker<ZConditionLock> locker(&_lock);
+  return !_stop;
+}
+
+size_t ZCommitter::target_cached() const {
+  // Keep enough memory mapped to cover ZCommitAheadWindow milliseconds of
+  // allocation at the predicted allocation rate. The allocation rate is for
+  // the whole heap, so split it evenly among the partitions.
+  const ZStatMutatorAllocRateStats stats = ZStatMutatorAllocRate::stats();
+  const double rate = MAX2(stats._predict, stats._avg + stats._sd);
+  const double window = double(ZCommitAheadWindow) / MILLIUNITS;
+  const double target = rate * window / ZNUMA::count();
+
+  return align_up((size_t)target, ZGranuleSize);
+}
+
+void ZCommitter::run_thread() {
+  while (wait(IntervalMs)) {
+    const size_t target = target_cached();
+    if (target == 0) {
+      continue;
+    }
+
+    size_t total_committed = 0;
+
+    while (should_continue()) {
+      // Commit chunk
+      const size_t committed = _partition->commit_ahead(target);
+      if (committed == 0) {
+        // Done
+        break;
+      }
+
+      total_committed += committed;
+    }
+
+    if (total_committed > 0) {
+      // Update statistics
+      ZStatInc(ZCounterCommitAhead, total_committed);
+      log_debug(gc, heap)("Committer (%u) Committed Ahead: %zuM(%.0f%%), Target: %zuM",
+                          _id, total_committed / M, percent_of(total_committed, ZHeap::heap()->max_capacity()),
+                          target / M);
+    }
+  }
+}
+
+void ZCommitter::terminate() {
+  ZLocker<ZConditionLock> locker(&_lock);
+  _stop = true;
+  _lock.notify_all();
+}
@@ -31,6 +31,11 @@
 #include "gc/z/zLock.inline.hpp"
 #include "gc/z/zStat.hpp"
 #include "logging/log.hpp"
+#include "runtime/os.hpp"
+#include "utilities/align.hpp"
+#ifdef LINUX
+#include "osContainer_linux.hpp"
+#endif
 
 #include <limits>
 
@@ -925,9 +930,70 @@ static ZDirectorStats sample_stats() {
   };
 }
 
+// Lower the soft max capacity while the container is under memory pressure,
+// and raise it back once the pressure has cleared. The limit is lowered in
+// steps of 10%, but never below the memory in use, so a sustained pressure
+// makes the heap shrink as fast as GC can reclaim memory. The memory that is
+// no longer used is then uncommitted by the uncommitters. Under pressure the
+// limit is never raised, even if more memory is in use than it allows.
+size_t ZDirector::adjusted_soft_max_capacity_limit(double pressure_percent, double threshold,
+                                                   size_t limit, size_t soft_max_capacity,
+                                                   size_t min_capacity, size_t used,
+                                                   size_t max_capacity) {
+  if (pressure_percent >= threshold) {
+    const size_t lowest = MAX2(min_capacity, align_up(used, ZGranuleSize));
+    const size_t lowered = align_down(MIN2(limit, soft_max_capacity) / 10 * 9, ZGranuleSize);
+    return MIN2(limit, MAX2(lowest, lowered));
+  } else if (pressure_percent < threshold / 2 && limit < max_capacity) {
+    return MIN2(max_capacity, align_up(limit + max_capacity / 10, ZGranuleSize));
+  }
+  return limit;
+}
+
+static void adjust_soft_max_capacity_limit() {
+#ifdef LINUX
+  static double last_sample = 0.0;
+
+  if (ZSoftMaxHeapPressureThreshold == 0 || !OSContainer::is_containerized()) {
+    return;
+  }
+
+  // Sample at most once per second, the pressure is a 10 second average
+  const double now = os::elapsedTime();
+  if (now - last_sample < 1.0) {
+    return;
+  }
+  last_sample = now;
+
+  const jlong pressure = OSContainer::memory_pressure();
+  if (pressure < 0) {
+    // Not supported
+    return;
+  }
+
+  ZHeap* const heap = ZHeap::heap();
+  const double pressure_percent = (double)pressure / 100.0;
+  const size_t limit = heap->soft_max_capacity_limit();
+  const size_t new_limit = ZDirector::adjusted_soft_max_capacity_limit(pressure_percent,
+                                                                       ZSoftMaxHeapPressureThreshold,
+                                                                       limit,
+                                                                       heap->soft_max_capacity(),
+                                                                       heap->min_capacity(),
+                                                                       heap->used(),
+                                                                       heap->max_capacity());
+
+  if (new_limit != limit) {
+    log_info(gc, heap)("Memory pressure %.2f%%, soft max capacity limit: %zuM -> %zuM",
+                       pressure_percent, limit / M, new_limit / M);
+    heap->set_soft_max_capacity_limit(new_limit);
+  }
+#endif
+}
+
 void ZDirector::run_thread() {
   // Main loop
   while (wait_for_tick()) {
+    adjust_soft_max_capacity_limit();
     ZDirectorStats stats = sample_stats();
     if (!start_gc(stats)) {
       adjust_gc(stats);
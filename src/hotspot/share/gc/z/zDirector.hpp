@@ -45,6 +45,13 @@ class ZDirector : public ZThread {
   ZDirector();
 
   static void evaluate_rules();
+
+  // The soft max capacity limit to use next, given the memory pressure of
+  // the container and the threshold (both in percent) and the current heap
+  static size_t adjusted_soft_max_capacity_limit(double pressure_percent, double threshold,
+                                                 size_t limit, size_t soft_max_capacity,
+                                                 size_t min_capacity, size_t used,
+                                                 size_t max_capacity);
 };
 
 #endif // SHARE_GC_Z_ZDIRECTOR_HPP
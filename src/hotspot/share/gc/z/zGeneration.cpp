@@ -53,6 +53,7 @@
 #include "gc/z/zWorkers.hpp"
 #include "interpreter/oopMapCache.hpp"
 #include "logging/log.hpp"
+#include "memory/heapInspection.hpp"
 #include "memory/universe.hpp"
 #include "prims/jvmtiTagMap.hpp"
 #include "runtime/atomic.hpp"
@@ -88,6 +89,7 @@ static const ZStatPhaseConcurrent ZPhaseConcurrentRelocatedYoung("Concurrent Rel
 static const ZStatPhaseConcurrent ZPhaseConcurrentMarkOld("Concurrent Mark", ZGenerationId::old);
 static const ZStatPhaseConcurrent ZPhaseConcurrentMarkContinueOld("Concurrent Mark Continue", ZGenerationId::old);
 static const ZStatPhasePause      ZPhasePauseMarkEndOld("Pause Mark End", ZGenerationId::old);
+static const ZStatPhaseConcurrent ZPhaseConcurrentReportClassHistogramOld("Concurrent Report Class Histogram", ZGenerationId::old);
 static const ZStatPhaseConcurrent ZPhaseConcurrentMarkFreeOld("Concurrent Mark Free", ZGenerationId::old);
 static const ZStatPhaseConcurrent ZPhaseConcurrentProcessNonStrongOld("Concurrent Process Non-Strong", ZGenerationId::old);
 static const ZStatPhaseConcurrent ZPhaseConcurrentResetRelocationSetOld("Concurrent Reset Relocation Set", ZGenerationId::old);
@@ -151,6 +153,10 @@ void ZGeneration::mark_flush(Thread* thread) {
   _mark.flush(thread);
 }
 
+void ZGeneration::mark_histogram(ConcurrentHeapHistogram* histogram, uint table_offset) {
+  _mark.set_histogram(histogram, table_offset);
+}
+
 void ZGeneration::mark_free() {
    _mark.free();
 }
@@ -431,6 +437,7 @@ class VM_ZOperation : public VM_Operation {
 
     // Update statistics
     ZStatSample(ZSamplerJavaThreads, (uint64_t)Threads::number_of_threads());
+    ZCollectedHeap::heap()->update_worker_threads_cpu_time();
   }
 
   virtual void doit_epilogue() {
@@ -888,6 +895,10 @@ bool ZGenerationYoung::mark_end() {
   // Enter mark completed phase
   set_phase(Phase::MarkComplete);
 
+  // Young objects of a major collection have all been recorded in the
+  // class histogram, later young collections must not add to it
+  mark_histogram(nullptr, 0);
+
   // Update statistics
   stat_heap()->at_mark_end(_page_allocator->stats(this));
 
@@ -959,7 +970,8 @@ ZGenerationOld::ZGenerationOld(ZPageTable* page_table, ZPageAllocator* page_allo
     _unload(&_workers),
     _total_collections_at_start(0),
     _young_seqnum_at_reloc_start(0),
-    _jfr_tracer() {
+    _jfr_tracer(),
+    _histogram(nullptr) {
   ZGeneration::_old = this;
 }
 
@@ -1002,25 +1014,30 @@ void ZGenerationOld::collect(ConcurrentGCTimer* timer) {
     abortpoint();
   }
 
-  // Phase 3: Concurrent Mark Free
+  // Phase 3: Concurrent Report Class Histogram
+  concurrent_report_class_histogram();
+
+  abortpoint();
+
+  // Phase 4: Concurrent Mark Free
   concurrent_mark_free();
 
   abortpoint();
 
-  // Phase 4: Concurrent Process Non-Strong References
+  // Phase 5: Concurrent Process Non-Strong References
   concurrent_process_non_strong_references();
 
   abortpoint();
 
-  // Phase 5: Concurrent Reset Relocation Set
+  // Phase 6: Concurrent Reset Relocation Set
   concurrent_reset_relocation_set();
 
   abortpoint();
 
-  // Phase 6: Pause Verify
+  // Phase 7: Pause Verify
   pause_verify();
 
-  // Phase 7: Concurrent Select Relocation Set
+  // Phase 8: Concurrent Select Relocation Set
   concurrent_select_relocation_set();
 
   abortpoint();
@@ -1028,12 +1045,12 @@ void ZGenerationOld::collect(ConcurrentGCTimer* timer) {
   {
     ZDriverLocker locker;
 
-    // Phase 8: Concurrent Remap Roots
+    // Phase 9: Concurrent Remap Roots
     concurrent_remap_young_roots();
 
     abortpoint();
 
-    // Phase 9: Pause Relocate Start
+    // Phase 10: Pause Relocate Start
     pause_relocate_start();
   }
 
@@ -1041,7 +1058,7 @@ void ZGenerationOld::collect(ConcurrentGCTimer* timer) {
   // to let concurrent_relocate() call abort_page()
   // on the remaining entries in the relocation set.
 
-  // Phase 10: Concurrent Relocate
+  // Phase 11: Concurrent Relocate
   concurrent_relocate();
 }
 
@@ -1091,6 +1108,17 @@ void ZGenerationOld::concurrent_mark_continue() {
   mark_follow();
 }
 
+void ZGenerationOld::concurrent_report_class_histogram() {
+  if (_histogram == nullptr) {
+    return;
+  }
+  // Classes are unloaded later in this cycle, by this thread, so the
+  // classes of the recorded objects are still alive.
+  ZStatTimerOld timer(ZPhaseConcurrentReportClassHistogramOld);
+  ConcurrentHeapHistogram::report(_histogram, "Objects allocated since marking started are not included.");
+  _histogram = nullptr;
+}
+
 void ZGenerationOld::concurrent_mark_free() {
   ZStatTimerOld timer(ZPhaseConcurrentMarkFreeOld);
   mark_free();
@@ -1210,6 +1238,19 @@ void ZGenerationOld::mark_start() {
   // Reset marking information
   _mark.start();
 
+  // A requested class histogram is gathered from this major collection.
+  // The young generation marking was started in the same pause, and its
+  // workers record into the tables in front of the old generation ones.
+  if (_histogram != nullptr) {
+    // Left behind by an aborted cycle
+    ConcurrentHeapHistogram::cancel(_histogram);
+  }
+  _histogram = ConcurrentHeapHistogram::claim(ZYoungGCThreads + ZOldGCThreads);
+  if (_histogram != nullptr) {
+    ZGeneration::young()->mark_histogram(_histogram, 0);
+    mark_histogram(_histogram, ZYoungGCThreads);
+  }
+
   // Update statistics
   stat_heap()->at_mark_start(_page_allocator->update_and_stats(this));
 
@@ -1247,6 +1288,9 @@ bool ZGenerationOld::mark_end() {
   // Verify after mark
   ZVerify::after_mark();
 
+  // A requested class histogram is complete, and reported after the pause
+  mark_histogram(nullptr, 0);
+
   // Update statistics
   stat_heap()->at_mark_end(_page_allocator->stats(this));
 
@@ -38,6 +38,7 @@
 #include "gc/z/zWorkers.hpp"
 #include "memory/allocation.hpp"
 
+class ConcurrentHeapHistogram;
 class ThreadClosure;
 class ZForwardingTable;
 class ZGenerationOld;
@@ -160,6 +161,7 @@ class ZGeneration {
   template <bool resurrect, bool gc_thread, bool follow, bool finalizable>
   void mark_object_if_active(zaddress addr);
   void mark_flush(Thread* thread);
+  void mark_histogram(ConcurrentHeapHistogram* histogram, uint table_offset);
 
   // Relocation
   void synchronize_relocation();
@@ -271,6 +273,7 @@ class ZGenerationOld : public ZGeneration {
   uint                _total_collections_at_start;
   uint32_t            _young_seqnum_at_reloc_start;
   ZOldTracer          _jfr_tracer;
+  ConcurrentHeapHistogram* _histogram;
 
   void flip_mark_start();
   void flip_relocate_start();
@@ -287,6 +290,7 @@ class ZGenerationOld : public ZGeneration {
   void concurrent_mark();
   bool pause_mark_end();
   void concurrent_mark_continue();
+  void concurrent_report_class_histogram();
   void concurrent_mark_free();
   void concurrent_process_non_strong_references();
   void concurrent_reset_relocation_set();
@@ -107,6 +107,14 @@ size_t ZHeap::soft_max_capacity() const {
   return _page_allocator.soft_max_capacity();
 }
 
+size_t ZHeap::soft_max_capacity_limit() const {
+  return _page_allocator.soft_max_capacity_limit();
+}
+
+void ZHeap::set_soft_max_capacity_limit(size_t limit) {
+  _page_allocator.set_soft_max_capacity_limit(limit);
+}
+
 size_t ZHeap::capacity() const {
   return _page_allocator.capacity();
 }
@@ -247,8 +255,8 @@ void ZHeap::account_undo_alloc_page(ZPage* page) {
                 p2i(Thread::current()), ZUtils::thread_name(), p2i(page), page->size());
 }
 
-ZPage* ZHeap::alloc_page(ZPageType type, size_t size, ZAllocationFlags flags, ZPageAge age) {
-  ZPage* const page = _page_allocator.alloc_page(type, size, flags, age);
+ZPage* ZHeap::alloc_page(ZPageType type, size_t size, ZAllocationFlags flags, ZPageAge age, uint32_t preferred_partition) {
+  ZPage* const page = _page_allocator.alloc_page(type, size, flags, age, preferred_partition);
   if (page != nullptr) {
     // Insert page table entry
     _page_table.insert(page);
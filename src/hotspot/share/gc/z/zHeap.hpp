@@ -77,6 +77,8 @@ class ZHeap {
   size_t min_capacity() const;
   size_t max_capacity() const;
   size_t soft_max_capacity() const;
+  size_t soft_max_capacity_limit() const;
+  void set_soft_max_capacity_limit(size_t limit);
   size_t capacity() const;
   size_t used() const;
   size_t used_generation(ZGenerationId id) const;
@@ -109,7 +111,7 @@ class ZHeap {
   void mark_flush(Thread* thread);
 
   // Page allocation
-  ZPage* alloc_page(ZPageType type, size_t size, ZAllocationFlags flags, ZPageAge age);
+  ZPage* alloc_page(ZPageType type, size_t size, ZAllocationFlags flags, ZPageAge age, uint32_t preferred_partition);
   void undo_alloc_page(ZPage* page);
   void free_page(ZPage* page);
   size_t free_empty_pages(ZGenerationId id, const ZArray<ZPage*>* pages);
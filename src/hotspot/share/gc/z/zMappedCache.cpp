@@ -652,6 +652,10 @@ size_t ZMappedCache::remove_discontiguous(size_t size, ZArray<ZVirtualMemory>* o
   return remove_discontiguous_with_strategy<RemovalStrategy::SizeClasses>(size, out);
 }
 
+size_t ZMappedCache::size() const {
+  return _size;
+}
+
 size_t ZMappedCache::reset_min() {
   const size_t old_min = _min;
 
@@ -131,6 +131,8 @@ class ZMappedCache {
   ZVirtualMemory remove_contiguous(size_t size);
   size_t remove_discontiguous(size_t size, ZArray<ZVirtualMemory>* out);
 
+  size_t size() const;
+
   size_t reset_min();
   size_t remove_from_min(size_t max_size, ZArray<ZVirtualMemory>* out);
 
@@ -54,6 +54,7 @@
 #include "gc/z/zUtils.inline.hpp"
 #include "gc/z/zWorkers.hpp"
 #include "logging/log.hpp"
+#include "memory/heapInspection.hpp"
 #include "memory/iterator.inline.hpp"
 #include "oops/objArrayOop.inline.hpp"
 #include "oops/oop.inline.hpp"
@@ -89,7 +90,9 @@ ZMark::ZMark(ZGeneration* generation, ZPageTable* page_table)
     _nterminateflush(0),
     _ntrycomplete(0),
     _ncontinue(0),
-    _nworkers(0) {}
+    _nworkers(0),
+    _histogram(nullptr),
+    _histogram_offset(0) {}
 
 size_t ZMark::calculate_nstripes(uint nworkers) const {
   // Calculate the number of stripes from the number of workers we use,
@@ -111,6 +114,9 @@ void ZMark::start() {
   _ntrycomplete = 0;
   _ncontinue = 0;
 
+  // Detach any histogram left behind by an aborted cycle
+  set_histogram(nullptr, 0);
+
   // Set number of workers to use
   _nworkers = workers()->active_workers();
 
@@ -422,6 +428,10 @@ void ZMark::mark_and_follow(ZMarkContext* context, ZMarkStackEntry entry) {
     const size_t size = ZUtils::object_size(addr);
     const size_t aligned_size = align_up(size, page->object_alignment());
     context->cache()->inc_live(page, aligned_size);
+
+    if (_histogram != nullptr) {
+      _histogram->record(_histogram_offset + WorkerThread::worker_id(), to_oop(addr));
+    }
   }
 
   // Follow
@@ -984,6 +994,11 @@ bool ZMark::end() {
   return true;
 }
 
+void ZMark::set_histogram(ConcurrentHeapHistogram* histogram, uint table_offset) {
+  _histogram = histogram;
+  _histogram_offset = table_offset;
+}
+
 void ZMark::free() {
   // Free any unused mark stack space
   _marking_smr.free();
@@ -32,6 +32,7 @@
 #include "oops/oopsHierarchy.hpp"
 #include "utilities/globalDefinitions.hpp"
 
+class ConcurrentHeapHistogram;
 class Thread;
 class ZGeneration;
 class ZMarkContext;
@@ -67,6 +68,8 @@ class ZMark {
   size_t             _ntrycomplete;
   size_t             _ncontinue;
   uint               _nworkers;
+  ConcurrentHeapHistogram* _histogram;
+  uint               _histogram_offset;
 
   size_t calculate_nstripes(uint nworkers) const;
 
@@ -113,6 +116,10 @@ class ZMark {
 
   bool flush(Thread* thread);
 
+  // Record newly marked objects in the given class histogram, using the
+  // tables starting at table_offset, one per worker.
+  void set_histogram(ConcurrentHeapHistogram* histogram, uint table_offset);
+
   // Following work
   void prepare_work();
   void finish_work();
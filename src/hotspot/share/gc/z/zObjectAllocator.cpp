@@ -25,6 +25,7 @@
 #include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zHeuristics.hpp"
 #include "gc/z/zLock.inline.hpp"
+#include "gc/z/zNUMA.hpp"
 #include "gc/z/zObjectAllocator.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageTable.inline.hpp"
@@ -56,11 +57,12 @@ ZPage* const* ZObjectAllocator::shared_small_page_addr() const {
 }
 
 ZPage* ZObjectAllocator::alloc_page(ZPageType type, size_t size, ZAllocationFlags flags) {
-  return ZHeap::heap()->alloc_page(type, size, flags, _age);
+  // Prefer the partition of the NUMA node the allocating thread is running on
+  return ZHeap::heap()->alloc_page(type, size, flags, _age, ZNUMA::id());
 }
 
-ZPage* ZObjectAllocator::alloc_page_for_relocation(ZPageType type, size_t size, ZAllocationFlags flags) {
-  return ZHeap::heap()->alloc_page(type, size, flags, _age);
+ZPage* ZObjectAllocator::alloc_page_for_relocation(ZPageType type, size_t size, ZAllocationFlags flags, uint32_t preferred_partition) {
+  return ZHeap::heap()->alloc_page(type, size, flags, _age, preferred_partition);
 }
 
 void ZObjectAllocator::undo_alloc_page(ZPage* page) {
@@ -74,7 +74,7 @@ class ZObjectAllocator {
   zaddress alloc_object_for_relocation(size_t size);
   void undo_alloc_object_for_relocation(zaddress addr, size_t size);
 
-  ZPage* alloc_page_for_relocation(ZPageType type, size_t size, ZAllocationFlags flags);
+  ZPage* alloc_page_for_relocation(ZPageType type, size_t size, ZAllocationFlags flags, uint32_t preferred_partition);
 
   ZPageAge age() const;
 
@@ -408,7 +408,7 @@ class ZPageAllocation : public StackObj {
   ZFuture<bool>              _stall_result;
 
 public:
-  ZPageAllocation(ZPageType type, size_t size, ZAllocationFlags flags, ZPageAge age)
+  ZPageAllocation(ZPageType type, size_t size, ZAllocationFlags flags, ZPageAge age, uint32_t preferred_partition)
     : _type(type),
       _size(size),
       _flags(flags),
@@ -416,7 +416,7 @@ class ZPageAllocation : public StackObj {
       _start_timestamp(Ticks::now()),
       _young_seqnum(ZGeneration::young()->seqnum()),
       _old_seqnum(ZGeneration::old()->seqnum()),
-      _initiating_numa_id(ZNUMA::id()),
+      _initiating_numa_id(preferred_partition),
       _is_multi_partition(false),
       _single_partition_allocation(size),
       _multi_partition_allocation(size),
@@ -603,6 +603,7 @@ ZPartition::ZPartition(uint32_t numa_id, ZPageAllocator* page_allocator)
   : _page_allocator(page_allocator),
     _cache(),
     _uncommitter(numa_id, this),
+    _committer(numa_id, this),
     _min_capacity(ZNUMA::calculate_share(numa_id, page_allocator->min_capacity())),
     _max_capacity(ZNUMA::calculate_share(numa_id, page_allocator->max_capacity())),
     _current_max_capacity(_max_capacity),
@@ -835,6 +836,84 @@ size_t ZPartition::uncommit(uint64_t* timeout) {
   return flushed;
 }
 
+size_t ZPartition::commit_ahead(size_t target) {
+  ZVirtualMemory vmem;
+
+  {
+    // We need to join the suspendible thread set while manipulating capacity
+    // and used, to make sure GC safepoints will have a consistent view.
+    SuspendibleThreadSetJoiner sts_joiner;
+    ZLocker<ZLock> locker(&_page_allocator->_lock);
+
+    const size_t cached = _cache.size();
+    if (cached >= target || !_page_allocator->_stalled.is_empty()) {
+      // Enough memory is already mapped, or allocations are stalled, in
+      // which case the available memory is left to them.
+      return 0;
+    }
+
+    // We commit chunks at a time (same limit as when uncommitting), so
+    // that the page allocator lock is not held off for too long.
+    const size_t limit = MAX2(ZGranuleSize, align_down(256 * M / ZNUMA::count(), ZGranuleSize));
+    const size_t headroom = MIN2(available(), _current_max_capacity - _capacity);
+    const size_t size = align_down(MIN3(target - cached, limit, headroom), ZGranuleSize);
+
+    if (size == 0) {
+      // Nothing to commit
+      return 0;
+    }
+
+    vmem = claim_virtual(size);
+    if (vmem.is_null()) {
+      // No contiguous virtual memory available
+      return 0;
+    }
+
+    // Record the memory as claimed while it is being committed and mapped
+    const size_t increased = increase_capacity(size);
+    assert(increased == size, "Must succeed %zu == %zu", increased, size);
+    Atomic::add(&_claimed, size);
+  }
+
+  // Commit and map the memory
+  claim_physical(vmem);
+  const size_t committed = commit_physical(vmem);
+  const ZVirtualMemory committed_vmem = vmem.first_part(committed);
+  const ZVirtualMemory non_committed_vmem = vmem.last_part(committed);
+
+  if (committed_vmem.size() > 0) {
+    sort_segments_physical(committed_vmem);
+    map_virtual(committed_vmem);
+    check_numa_mismatch(committed_vmem, _numa_id);
+  }
+
+  if (non_committed_vmem.size() > 0) {
+    // Free the virtual and physical memory we failed to commit
+    free_physical(non_committed_vmem);
+    free_virtual(non_committed_vmem);
+  }
+
+  {
+    SuspendibleThreadSetJoiner sts_joiner;
+    ZLocker<ZLock> locker(&_page_allocator->_lock);
+
+    if (committed_vmem.size() > 0) {
+      _cache.insert(committed_vmem);
+    }
+
+    // Adjust claimed and capacity to reflect the commit
+    Atomic::sub(&_claimed, vmem.size());
+    if (non_committed_vmem.size() > 0) {
+      decrease_capacity(non_committed_vmem.size(), true /* set_max_capacity */);
+    }
+
+    // Allocations may have stalled while the memory was claimed
+    _page_allocator->satisfy_stalled();
+  }
+
+  return committed;
+}
+
 void ZPartition::sort_segments_physical(const ZVirtualMemory& vmem) {
   verify_virtual_memory_association(vmem, true /* check_multi_partition */);
 
@@ -1152,6 +1231,7 @@ void ZPartition::free_memory_alloc_failed(ZMemoryAllocation* allocation) {
 
 void ZPartition::threads_do(ThreadClosure* tc) const {
   tc->do_thread(const_cast<ZUncommitter*>(&_uncommitter));
+  tc->do_thread(const_cast<ZCommitter*>(&_committer));
 }
 
 void ZPartition::print_on(outputStream* st) const {
@@ -1262,6 +1342,7 @@ ZPageAllocator::ZPageAllocator(size_t min_capacity,
     _physical(max_capacity),
     _min_capacity(min_capacity),
     _max_capacity(max_capacity),
+    _soft_max_capacity_limit(max_capacity),
     _used(0),
     _used_generations{0,0},
     _collection_stats{{0, 0},{0, 0}},
@@ -1324,7 +1405,15 @@ size_t ZPageAllocator::max_capacity() const {
 size_t ZPageAllocator::soft_max_capacity() const {
   const size_t current_max_capacity = ZPageAllocator::current_max_capacity();
   const size_t soft_max_heapsize = Atomic::load(&SoftMaxHeapSize);
-  return MIN2(soft_max_heapsize, current_max_capacity);
+  return MIN3(soft_max_heapsize, current_max_capacity, soft_max_capacity_limit());
+}
+
+size_t ZPageAllocator::soft_max_capacity_limit() const {
+  return Atomic::load(&_soft_max_capacity_limit);
+}
+
+void ZPageAllocator::set_soft_max_capacity_limit(size_t limit) {
+  Atomic::store(&_soft_max_capacity_limit, limit);
 }
 
 size_t ZPageAllocator::current_max_capacity() const {
@@ -1443,10 +1532,10 @@ static void check_out_of_memory_during_initialization() {
   }
 }
 
-ZPage* ZPageAllocator::alloc_page(ZPageType type, size_t size, ZAllocationFlags flags, ZPageAge age) {
+ZPage* ZPageAllocator::alloc_page(ZPageType type, size_t size, ZAllocationFlags flags, ZPageAge age, uint32_t preferred_partition) {
   EventZPageAllocation event;
 
-  ZPageAllocation allocation(type, size, flags, age);
+  ZPageAllocation allocation(type, size, flags, age, preferred_partition);
 
   // Allocate the page
   ZPage* const page = alloc_page_inner(&allocation);
@@ -27,6 +27,7 @@
 #include "gc/z/zAddress.hpp"
 #include "gc/z/zAllocationFlags.hpp"
 #include "gc/z/zArray.hpp"
+#include "gc/z/zCommitter.hpp"
 #include "gc/z/zGenerationId.hpp"
 #include "gc/z/zGranuleMap.hpp"
 #include "gc/z/zList.hpp"
@@ -62,6 +63,7 @@ class ZPartition {
   ZPageAllocator* const _page_allocator;
   ZMappedCache          _cache;
   ZUncommitter          _uncommitter;
+  ZCommitter            _committer;
   const size_t          _min_capacity;
   const size_t          _max_capacity;
   volatile size_t       _current_max_capacity;
@@ -103,6 +105,7 @@ class ZPartition {
   bool claim_capacity(ZMemoryAllocation* allocation);
 
   size_t uncommit(uint64_t* timeout);
+  size_t commit_ahead(size_t target);
 
   void sort_segments_physical(const ZVirtualMemory& vmem);
 
@@ -158,6 +161,7 @@ class ZPageAllocator {
   ZPhysicalMemoryManager      _physical;
   const size_t                _min_capacity;
   const size_t                _max_capacity;
+  volatile size_t             _soft_max_capacity_limit;
   volatile size_t             _used;
   volatile size_t             _used_generations[2];
   struct {
@@ -251,6 +255,8 @@ class ZPageAllocator {
   size_t min_capacity() const;
   size_t max_capacity() const;
   size_t soft_max_capacity() const;
+  size_t soft_max_capacity_limit() const;
+  void set_soft_max_capacity_limit(size_t limit);
   size_t current_max_capacity() const;
   size_t capacity() const;
   size_t used() const;
@@ -265,7 +271,7 @@ class ZPageAllocator {
   ZPageAllocatorStats stats(ZGeneration* generation) const;
   ZPageAllocatorStats update_and_stats(ZGeneration* generation);
 
-  ZPage* alloc_page(ZPageType type, size_t size, ZAllocationFlags flags, ZPageAge age);
+  ZPage* alloc_page(ZPageType type, size_t size, ZAllocationFlags flags, ZPageAge age, uint32_t preferred_partition);
   void safe_destroy_page(ZPage* page);
   void free_page(ZPage* page);
   void free_pages(ZGenerationId id, const ZArray<ZPage*>* pages);
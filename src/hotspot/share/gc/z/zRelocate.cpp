@@ -33,6 +33,7 @@
 #include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zIndexDistributor.inline.hpp"
 #include "gc/z/zIterator.inline.hpp"
+#include "gc/z/zNUMA.inline.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageAge.hpp"
 #include "gc/z/zRelocate.hpp"
@@ -385,7 +386,46 @@ zaddress ZRelocate::forward_object(ZForwarding* forwarding, zaddress_unsafe from
   return to_addr;
 }
 
-static ZPage* alloc_page(ZAllocatorForRelocation* allocator, ZPageType type, size_t size) {
+static bool is_numa_relocation_enabled() {
+  return ZNUMARelocation && ZNUMA::count() > 1;
+}
+
+// Returns the partition (NUMA node) that target pages for objects relocated
+// from the given page should be allocated in. Mutator pages are allocated on
+// the NUMA node of the allocating thread, so keeping relocated objects on the
+// node of their from-page keeps them close to the threads that allocated,
+// and are most likely to access, them. Relocation done by mutators, through
+// the load barrier, already allocates on the accessing thread's node.
+static uint32_t target_partition_id(ZPage* from_page) {
+  if (is_numa_relocation_enabled() && !from_page->is_multi_partition()) {
+    return from_page->single_partition_id();
+  }
+
+  // Use the NUMA node of the relocating thread
+  return ZNUMA::id();
+}
+
+// Returns the number of partitions that relocation target pages are tracked
+// for. Without NUMA-aware relocation all target pages share a single slot.
+static uint32_t target_partition_count() {
+  return is_numa_relocation_enabled() ? ZNUMA::count() : 1;
+}
+
+static uint32_t target_index(ZPageAge age, uint32_t partition_id) {
+  const uint32_t partition_slot = is_numa_relocation_enabled() ? partition_id : 0;
+  return partition_slot * ZAllocator::_relocation_allocators + (static_cast<uint>(age) - 1);
+}
+
+static ZPage** alloc_target_array() {
+  const uint32_t length = target_partition_count() * ZAllocator::_relocation_allocators;
+  ZPage** const array = NEW_C_HEAP_ARRAY(ZPage*, length, mtGC);
+  for (uint32_t i = 0; i < length; ++i) {
+    array[i] = nullptr;
+  }
+  return array;
+}
+
+static ZPage* alloc_page(ZGeneration* generation, ZAllocatorForRelocation* allocator, ZPageType type, size_t size, uint32_t partition_id) {
   if (ZStressRelocateInPlace) {
     // Simulate failure to allocate a new page. This will
     // cause the page being relocated to be relocated in-place.
@@ -396,10 +436,19 @@ static ZPage* alloc_page(ZAllocatorForRelocation* allocator, ZPageType type, siz
   flags.set_non_blocking();
   flags.set_gc_relocation();
 
-  return allocator->alloc_page_for_relocation(type, size, flags);
+  ZPage* const page = allocator->alloc_page_for_relocation(type, size, flags, partition_id);
+  if (page != nullptr && ZNUMA::count() > 1) {
+    generation->stat_relocation()->at_alloc_target_page(page, partition_id);
+  }
+
+  return page;
 }
 
 static void retire_target_page(ZGeneration* generation, ZPage* page) {
+  if (ZNUMA::count() > 1) {
+    generation->stat_relocation()->at_retire_target_page(page);
+  }
+
   if (generation->is_young() && page->is_old()) {
     generation->increase_promoted(page->used());
   } else {
@@ -425,9 +474,9 @@ class ZRelocateSmallAllocator {
     : _generation(generation),
       _in_place_count(0) {}
 
-  ZPage* alloc_and_retire_target_page(ZForwarding* forwarding, ZPage* target) {
+  ZPage* alloc_and_retire_target_page(ZForwarding* forwarding, ZPage* target, uint32_t partition_id) {
     ZAllocatorForRelocation* const allocator = ZAllocator::relocation(forwarding->to_age());
-    ZPage* const page = alloc_page(allocator, forwarding->type(), forwarding->size());
+    ZPage* const page = alloc_page(_generation, allocator, forwarding->type(), forwarding->size(), partition_id);
     if (page == nullptr) {
       Atomic::inc(&_in_place_count);
     }
@@ -440,7 +489,7 @@ class ZRelocateSmallAllocator {
     return page;
   }
 
-  void share_target_page(ZPage* page) {
+  void share_target_page(ZPage* page, uint32_t partition_id) {
     // Does nothing
   }
 
@@ -467,7 +516,7 @@ class ZRelocateMediumAllocator {
 private:
   ZGeneration* const _generation;
   ZConditionLock     _lock;
-  ZPage*             _shared[ZAllocator::_relocation_allocators];
+  ZPage** const      _shared;
   bool               _in_place;
   volatile size_t    _in_place_count;
 
@@ -475,27 +524,29 @@ class ZRelocateMediumAllocator {
   ZRelocateMediumAllocator(ZGeneration* generation)
     : _generation(generation),
       _lock(),
-      _shared(),
+      _shared(alloc_target_array()),
       _in_place(false),
       _in_place_count(0) {}
 
   ~ZRelocateMediumAllocator() {
-    for (uint i = 0; i < ZAllocator::_relocation_allocators; ++i) {
+    const uint32_t length = target_partition_count() * ZAllocator::_relocation_allocators;
+    for (uint32_t i = 0; i < length; ++i) {
       if (_shared[i] != nullptr) {
         retire_target_page(_generation, _shared[i]);
       }
     }
+    FREE_C_HEAP_ARRAY(ZPage*, _shared);
   }
 
-  ZPage* shared(ZPageAge age) {
-    return _shared[static_cast<uint>(age) - 1];
+  ZPage* shared(ZPageAge age, uint32_t partition_id) {
+    return _shared[target_index(age, partition_id)];
   }
 
-  void set_shared(ZPageAge age, ZPage* page) {
-    _shared[static_cast<uint>(age) - 1] = page;
+  void set_shared(ZPageAge age, uint32_t partition_id, ZPage* page) {
+    _shared[target_index(age, partition_id)] = page;
   }
 
-  ZPage* alloc_and_retire_target_page(ZForwarding* forwarding, ZPage* target) {
+  ZPage* alloc_and_retire_target_page(ZForwarding* forwarding, ZPage* target, uint32_t partition_id) {
     ZLocker<ZConditionLock> locker(&_lock);
 
     // Wait for any ongoing in-place relocation to complete
@@ -508,10 +559,10 @@ class ZRelocateMediumAllocator {
     // current target page if another thread shared a page, or allocated
     // a new page.
     const ZPageAge to_age = forwarding->to_age();
-    if (shared(to_age) == target) {
+    if (shared(to_age, partition_id) == target) {
       ZAllocatorForRelocation* const allocator = ZAllocator::relocation(forwarding->to_age());
-      ZPage* const to_page = alloc_page(allocator, forwarding->type(), forwarding->size());
-      set_shared(to_age, to_page);
+      ZPage* const to_page = alloc_page(_generation, allocator, forwarding->type(), forwarding->size(), partition_id);
+      set_shared(to_age, partition_id, to_page);
       if (to_page == nullptr) {
         Atomic::inc(&_in_place_count);
         _in_place = true;
@@ -523,18 +574,18 @@ class ZRelocateMediumAllocator {
       }
     }
 
-    return shared(to_age);
+    return shared(to_age, partition_id);
   }
 
-  void share_target_page(ZPage* page) {
+  void share_target_page(ZPage* page, uint32_t partition_id) {
     const ZPageAge age = page->age();
 
     ZLocker<ZConditionLock> locker(&_lock);
     assert(_in_place, "Invalid state");
-    assert(shared(age) == nullptr, "Invalid state");
+    assert(shared(age, partition_id) == nullptr, "Invalid state");
     assert(page != nullptr, "Invalid page");
 
-    set_shared(age, page);
+    set_shared(age, partition_id, page);
     _in_place = false;
 
     _lock.notify_all();
@@ -562,7 +613,8 @@ class ZRelocateWork : public StackObj {
 private:
   Allocator* const    _allocator;
   ZForwarding*        _forwarding;
-  ZPage*              _target[ZAllocator::_relocation_allocators];
+  uint32_t            _partition_id;
+  ZPage** const       _target;
   ZGeneration* const  _generation;
   size_t              _other_promoted;
   size_t              _other_compacted;
@@ -570,11 +622,11 @@ class ZRelocateWork : public StackObj {
 
 
   ZPage* target(ZPageAge age) {
-    return _target[static_cast<uint>(age) - 1];
+    return _target[target_index(age, _partition_id)];
   }
 
   void set_target(ZPageAge age, ZPage* page) {
-    _target[static_cast<uint>(age) - 1] = page;
+    _target[target_index(age, _partition_id)] = page;
   }
 
   size_t object_alignment() const {
@@ -892,7 +944,7 @@ class ZRelocateWork : public StackObj {
       // relocated as the new target, which will cause it to be relocated
       // in-place.
       const ZPageAge to_age = _forwarding->to_age();
-      ZPage* to_page = _allocator->alloc_and_retire_target_page(_forwarding, target(to_age));
+      ZPage* to_page = _allocator->alloc_and_retire_target_page(_forwarding, target(to_age), _partition_id);
       set_target(to_age, to_page);
       if (to_page != nullptr) {
         continue;
@@ -910,15 +962,18 @@ class ZRelocateWork : public StackObj {
   ZRelocateWork(Allocator* allocator, ZGeneration* generation)
     : _allocator(allocator),
       _forwarding(nullptr),
-      _target(),
+      _partition_id(0),
+      _target(alloc_target_array()),
       _generation(generation),
       _other_promoted(0),
       _other_compacted(0) {}
 
   ~ZRelocateWork() {
-    for (uint i = 0; i < ZAllocator::_relocation_allocators; ++i) {
+    const uint32_t length = target_partition_count() * ZAllocator::_relocation_allocators;
+    for (uint32_t i = 0; i < length; ++i) {
       _allocator->free_target_page(_target[i]);
     }
+    FREE_C_HEAP_ARRAY(ZPage*, _target);
     // Report statistics on-behalf of non-worker threads
     _generation->increase_promoted(_other_promoted);
     _generation->increase_compacted(_other_compacted);
@@ -970,6 +1025,7 @@ class ZRelocateWork : public StackObj {
 
   void do_forwarding(ZForwarding* forwarding) {
     _forwarding = forwarding;
+    _partition_id = target_partition_id(_forwarding->page());
 
     _forwarding->page()->log_msg(" (relocate page)");
 
@@ -1012,7 +1068,7 @@ class ZRelocateWork : public StackObj {
 
       // Different pages when promoting
       ZPage* const target_page = target(_forwarding->to_age());
-      _allocator->share_target_page(target_page);
+      _allocator->share_target_page(target_page, _partition_id);
 
     } else {
       // Wait for all other threads to call release_page
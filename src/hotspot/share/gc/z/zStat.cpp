@@ -30,11 +30,14 @@
 #include "gc/z/zGeneration.inline.hpp"
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zNMethodTable.hpp"
+#include "gc/z/zNUMA.inline.hpp"
+#include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageAllocator.inline.hpp"
 #include "gc/z/zRelocationSetSelector.inline.hpp"
 #include "gc/z/zStat.hpp"
 #include "gc/z/zTracer.inline.hpp"
 #include "gc/z/zUtils.inline.hpp"
+#include "gc/z/zValue.inline.hpp"
 #include "memory/metaspaceUtils.hpp"
 #include "memory/resourceArea.hpp"
 #include "runtime/atomic.hpp"
@@ -1463,7 +1466,9 @@ ZStatRelocation::ZStatRelocation()
     _small_selected(),
     _small_in_place_count(),
     _medium_selected(),
-    _medium_in_place_count() {}
+    _medium_in_place_count(),
+    _numa_relocated(0),
+    _numa_remote_pages(0) {}
 
 void ZStatRelocation::at_select_relocation_set(const ZRelocationSetSelectorStats& selector_stats) {
   _selector_stats = selector_stats;
@@ -1471,6 +1476,8 @@ void ZStatRelocation::at_select_relocation_set(const ZRelocationSetSelectorStats
 
 void ZStatRelocation::at_install_relocation_set(size_t forwarding_usage) {
   _forwarding_usage = forwarding_usage;
+  _numa_relocated.set_all(0);
+  _numa_remote_pages.set_all(0);
 }
 
 void ZStatRelocation::at_relocate_end(size_t small_in_place_count, size_t medium_in_place_count) {
@@ -1478,6 +1485,22 @@ void ZStatRelocation::at_relocate_end(size_t small_in_place_count, size_t medium
   _medium_in_place_count = medium_in_place_count;
 }
 
+void ZStatRelocation::at_alloc_target_page(const ZPage* page, uint32_t preferred_partition) {
+  if (page->is_multi_partition() || page->single_partition_id() != preferred_partition) {
+    // Target page did not end up on the preferred NUMA node
+    Atomic::inc(_numa_remote_pages.addr(preferred_partition), memory_order_relaxed);
+  }
+}
+
+void ZStatRelocation::at_retire_target_page(const ZPage* page) {
+  if (page->is_multi_partition()) {
+    // Not attributable to a single NUMA node
+    return;
+  }
+
+  Atomic::add(_numa_relocated.addr(page->single_partition_id()), page->used(), memory_order_relaxed);
+}
+
 void ZStatRelocation::print_page_summary() {
   LogTarget(Info, gc, reloc) lt;
 
@@ -1537,6 +1560,26 @@ void ZStatRelocation::print_page_summary() {
   print_summary("Large", large_summary, 0 /* in_place_count */);
 
   lt.print("Forwarding Usage: %zuM", _forwarding_usage / M);
+
+  if (ZNUMA::count() == 1) {
+    // No NUMA summary to print
+    return;
+  }
+
+  ZStatTablePrinter numa(20, 12);
+  lt.print("%s", numa()
+           .fill()
+           .right("Relocated")
+           .right("Remote Pages")
+           .end());
+
+  for (uint32_t numa_id = 0; numa_id < ZNUMA::count(); ++numa_id) {
+    lt.print("%s", numa()
+             .left("NUMA Node %u:", numa_id)
+             .right("%zuM", Atomic::load(_numa_relocated.addr(numa_id)) / M)
+             .right("%zu", Atomic::load(_numa_remote_pages.addr(numa_id)))
+             .end());
+  }
 }
 
 void ZStatRelocation::print_age_table() {
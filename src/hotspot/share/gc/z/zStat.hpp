@@ -32,6 +32,7 @@
 #include "gc/z/zRelocationSetSelector.hpp"
 #include "gc/z/zThread.hpp"
 #include "gc/z/zTracer.hpp"
+#include "gc/z/zValue.hpp"
 #include "logging/logHandle.hpp"
 #include "memory/allocation.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -530,6 +531,8 @@ class ZStatRelocation {
   size_t                      _small_in_place_count;
   size_t                      _medium_selected;
   size_t                      _medium_in_place_count;
+  ZPerNUMA<size_t>            _numa_relocated;
+  ZPerNUMA<size_t>            _numa_remote_pages;
 
   void print(const char* name,
              ZStatRelocationSummary selector_group,
@@ -542,6 +545,9 @@ class ZStatRelocation {
   void at_install_relocation_set(size_t forwarding_usage);
   void at_relocate_end(size_t small_in_place_count, size_t medium_in_place_count);
 
+  void at_alloc_target_page(const ZPage* page, uint32_t preferred_partition);
+  void at_retire_target_page(const ZPage* page);
+
   void print_page_summary();
   void print_age_table();
 };
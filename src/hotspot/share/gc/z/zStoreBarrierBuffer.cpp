@@ -25,13 +25,17 @@
 #include "gc/z/zAddress.inline.hpp"
 #include "gc/z/zBarrier.inline.hpp"
 #include "gc/z/zGeneration.inline.hpp"
+#include "gc/z/zStat.hpp"
 #include "gc/z/zStoreBarrierBuffer.inline.hpp"
 #include "gc/z/zUncoloredRoot.inline.hpp"
 #include "memory/resourceArea.hpp"
 #include "runtime/threadSMR.hpp"
 #include "utilities/ostream.hpp"
+#include "utilities/quickSort.hpp"
 #include "utilities/vmError.hpp"
 
+static const ZStatCounter ZCounterStoreBarrierBufferFlush("Memory", "Store Barrier Buffer Flush", ZStatUnitOpsPerSecond);
+
 ByteSize ZStoreBarrierEntry::p_offset() {
   return byte_offset_of(ZStoreBarrierEntry, _p);
 }
@@ -65,6 +69,13 @@ void ZStoreBarrierBuffer::clear() {
   _current = BufferSizeBytes;
 }
 
+int ZStoreBarrierBuffer::compare_entries(const ZStoreBarrierEntry& e1, const ZStoreBarrierEntry& e2) {
+  if (e1._p == e2._p) {
+    return 0;
+  }
+  return e1._p < e2._p ? -1 : 1;
+}
+
 bool ZStoreBarrierBuffer::is_empty() const {
   return _current == BufferSizeBytes;
 }
@@ -275,10 +286,28 @@ void ZStoreBarrierBuffer::flush() {
   OnError on_error(this);
   VMErrorCallbackMark mark(&on_error);
 
+  ZStatInc(ZCounterStoreBarrierBufferFlush);
+
+  // Mark all previous values first, and then add the remembered set entries
+  // for the fields, instead of alternating between the two.
   for (size_t i = current(); i < BufferLength; ++i) {
-    const ZStoreBarrierEntry& entry = _buffer[i];
-    const zaddress addr = ZBarrier::make_load_good(entry._prev);
-    ZBarrier::mark_and_remember(entry._p, addr);
+    const zaddress addr = ZBarrier::make_load_good(_buffer[i]._prev);
+    if (!is_null(addr)) {
+      ZBarrier::mark<ZMark::DontResurrect, ZMark::AnyThread, ZMark::Follow, ZMark::Strong>(addr);
+    }
+  }
+
+  // Sort the entries by field address, so that fields on the same page are
+  // remembered consecutively, and repeated stores to the same field are only
+  // remembered once.
+  QuickSort::sort(&_buffer[current()], BufferLength - current(), compare_entries);
+
+  for (size_t i = current(); i < BufferLength; ++i) {
+    volatile zpointer* const p = _buffer[i]._p;
+    if (i > current() && p == _buffer[i - 1]._p) {
+      continue;
+    }
+    ZBarrier::remember(p);
   }
 
   clear();
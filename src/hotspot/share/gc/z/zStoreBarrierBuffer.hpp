@@ -65,6 +65,8 @@ class ZStoreBarrierBuffer : public CHeapObj<mtGC> {
 
   void clear();
 
+  static int compare_entries(const ZStoreBarrierEntry& e1, const ZStoreBarrierEntry& e2);
+
   bool is_old_mark() const;
   bool stored_during_old_mark() const;
   bool is_empty() const;
@@ -55,6 +55,23 @@
           "Uncommit memory if it has been unused for the specified "        \
           "amount of time (in seconds)")                                    \
                                                                             \
+  product(double, ZSoftMaxHeapPressureThreshold, 0, EXPERIMENTAL,           \
+          "Lower the soft max heap size while the memory pressure of the "  \
+          "container (the share of time stalled on memory) is at least "    \
+          "this percent, and restore it when the pressure clears. "         \
+          "0 disables")                                                     \
+          range(0, 100)                                                     \
+                                                                            \
+  product(bool, ZCommitAhead, false, EXPERIMENTAL,                          \
+          "Commit and map memory in the background ahead of allocation")    \
+                                                                            \
+  product(uintx, ZCommitAheadWindow, 100, EXPERIMENTAL,                     \
+          "Amount of memory to keep committed and mapped ahead of "         \
+          "allocation when ZCommitAhead is enabled, expressed as the "      \
+          "allocation time (in milliseconds) at the predicted allocation "  \
+          "rate")                                                           \
+          range(1, max_jint)                                                \
+                                                                            \
   product(double, ZYoungCompactionLimit, 25.0,                              \
           "Maximum allowed garbage in young pages")                         \
           range(0, 100)                                                     \
@@ -75,6 +92,10 @@
   product(bool, ZStressRelocateInPlace, false, DIAGNOSTIC,                  \
           "Always relocate pages in-place")                                 \
                                                                             \
+  product(bool, ZNUMARelocation, true, DIAGNOSTIC,                          \
+          "Relocate objects to pages on the same NUMA node as the page "    \
+          "they are relocated from")                                        \
+                                                                            \
   product(bool, ZVerifyRoots, trueInDebug, DIAGNOSTIC,                      \
           "Verify roots")                                                   \
                                                                             \
@@ -1852,6 +1852,13 @@ void LinkResolver::resolve_invokedynamic(CallInfo& result, const constantPoolHan
     if (is_done) return;
   }
 
+  // Another invokedynamic in this class referring to the same bootstrap
+  // specifier may already have been linked to a CallSite we can reuse.
+  if (ShareStringConcatCallSites && is_shareable_bootstrap(pool, pool_index)) {
+    bool is_done = resolve_shared_invokedynamic(result, pool, indy_index, CHECK);
+    if (is_done) return;
+  }
+
   // The initial step in Call Site Specifier Resolution is to resolve the symbolic
   // reference to a method handle which will be the bootstrap method for a dynamic
   // call site.  If resolution for the java.lang.invoke.MethodHandle for the bootstrap
@@ -1879,6 +1886,47 @@ void LinkResolver::resolve_invokedynamic(CallInfo& result, const constantPoolHan
   ArchiveUtils::log_to_classlist(&bootstrap_specifier, CHECK);
 }
 
+// Bootstrap methods whose linkage result depends only on the bootstrap
+// specifier (the BSM, name, type and static arguments), not on the identity
+// of the call site. javac emits one CONSTANT_InvokeDynamic entry for all
+// string concatenations with the same recipe and types in a class, so these
+// sites can share the CallSite of whichever was linked first.
+bool LinkResolver::is_shareable_bootstrap(const constantPoolHandle& pool, int pool_index) {
+  int bsm = pool->bootstrap_method_ref_index_at(pool_index);
+  if (!pool->tag_at(bsm).is_method_handle() ||
+      pool->method_handle_ref_kind_at(bsm) != JVM_REF_invokeStatic) {
+    return false;
+  }
+  int bsm_ref = pool->method_handle_index_at(bsm);
+  Symbol* bsm_klass = pool->klass_name_at(pool->uncached_klass_ref_index_at(bsm_ref));
+  Symbol* bsm_name = pool->uncached_name_ref_at(bsm_ref);
+  return bsm_klass->equals("java/lang/invoke/StringConcatFactory") &&
+         (bsm_name->equals("makeConcatWithConstants") || bsm_name->equals("makeConcat"));
+}
+
+bool LinkResolver::resolve_shared_invokedynamic(CallInfo& result, const constantPoolHandle& pool,
+                                                int indy_index, TRAPS) {
+  // Sites share the CallSite of the first site that refers to the same
+  // CONSTANT_InvokeDynamic, once that one is linked.
+  int first = pool->cache()->shared_indy_index(indy_index);
+  if (first == indy_index) {
+    return false;
+  }
+  ResolvedIndyEntry* other = pool->resolved_indy_entry_at(first);
+  if (!other->is_resolved()) {
+    return false;
+  }
+  methodHandle method(THREAD, other->method());
+  Handle appendix(THREAD, pool->resolved_reference_from_indy(first));
+  result.set_handle(vmClasses::MethodHandle_klass(), method, appendix, CHECK_false);
+  if (log_is_enabled(Debug, methodhandles, indy)) {
+    ResourceMark rm(THREAD);
+    log_debug(methodhandles, indy)("resolve_invokedynamic: %s indy#%d shares CallSite of indy#%d @CP[%d]",
+                                   pool->pool_holder()->external_name(), indy_index, first, other->constant_pool_index());
+  }
+  return true;
+}
+
 void LinkResolver::resolve_dynamic_call(CallInfo& result,
                                         BootstrapInfo& bootstrap_specifier,
                                         TRAPS) {
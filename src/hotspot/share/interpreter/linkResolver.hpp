@@ -278,6 +278,10 @@ class LinkResolver: AllStatic {
                                       const constantPoolHandle& pool, int index, TRAPS);
   static void resolve_invokehandle   (CallInfo& result,
                                       const constantPoolHandle& pool, int index, TRAPS);
+
+  static bool is_shareable_bootstrap(const constantPoolHandle& pool, int pool_index);
+  static bool resolve_shared_invokedynamic(CallInfo& result, const constantPoolHandle& pool,
+                                           int indy_index, TRAPS);
  public:
   // constant pool resolving
   static void check_klass_accessibility(Klass* ref_klass, Klass* sel_klass, TRAPS);
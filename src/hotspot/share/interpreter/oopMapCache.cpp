@@ -429,10 +429,14 @@ void InterpreterOopMap::copy_from(const OopMapCacheEntry* src) {
 inline unsigned int OopMapCache::hash_value_for(const methodHandle& method, int bci) const {
   // We use method->code_size() rather than method->identity_hash() below since
   // the mark may not be present if a pointer to the method is already reversed.
+  // Only the low bits survive the modulo by the table size, so also fold in the
+  // method's idnum; otherwise methods of the same shape in a class (accessors,
+  // overloads) probe the same slots and keep evicting each other.
   return   ((unsigned int) bci)
          ^ ((unsigned int) method->max_locals()         << 2)
          ^ ((unsigned int) method->code_size()          << 4)
-         ^ ((unsigned int) method->size_of_parameters() << 6);
+         ^ ((unsigned int) method->size_of_parameters() << 6)
+         ^ ((unsigned int) method->method_idnum()       * 7);
 }
 
 OopMapCacheEntry* volatile OopMapCache::_old_entries = nullptr;
@@ -112,6 +112,11 @@ NO_TRANSITION(void, jfr_set_enabled(JNIEnv* env, jclass jvm, jlong event_type_id
     } else {
       LeakProfiler::stop();
     }
+  } else if (EventCPUTimeSample::eventId == event_type_id) {
+    JavaThread* thread = JavaThread::thread_from_jni_environment(env);
+    MACOS_AARCH64_ONLY(ThreadWXEnable __wx(WXWrite, thread));
+    ThreadInVMfromNative transition(thread);
+    JfrThreadSampling::set_cpu_time_sample_period(JNI_TRUE == enabled ? JfrOptionSet::cpu_time_sample_period() : 0);
   }
 NO_TRANSITION_END
 
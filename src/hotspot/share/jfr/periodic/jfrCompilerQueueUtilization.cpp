@@ -79,6 +79,10 @@ void JfrCompilerQueueUtilization::send_events() {
       event.set_totalAddedCount(current_added);
       event.set_totalRemovedCount(current_removed);
       event.set_compilerThreadCount(entry->get_compiler_thread_count());
+      const LatencyHistogram wait_times = entry->compilerQueue->wait_times();
+      event.set_queueWaitMedian(wait_times.value_at_percentile(50.0));
+      event.set_queueWait99(wait_times.value_at_percentile(99.0));
+      event.set_queueWaitMax(wait_times.max());
       event.commit();
 
       entry->added = current_added;
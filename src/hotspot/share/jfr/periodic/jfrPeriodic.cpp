@@ -57,6 +57,7 @@
 #include "runtime/flags/jvmFlag.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/mutex.hpp"
 #include "runtime/os.hpp"
 #include "runtime/os_perf.hpp"
 #include "runtime/thread.inline.hpp"
@@ -745,3 +746,19 @@ TRACE_REQUEST_FUNC(JavaMonitorStatistics) {
   event.set_count(ObjectSynchronizer::in_use_list_count());
   event.commit();
 }
+
+TRACE_REQUEST_FUNC(VMLockStatistics) {
+  if (!ProfileVMLocks) {
+    return;
+  }
+  Mutex::locks_do([&](Mutex* m) {
+    if (m->acquire_count() > 0) {
+      EventVMLockStatistics event;
+      event.set_name(m->name());
+      event.set_acquisitions(m->acquire_count());
+      event.set_contended(m->contended_count());
+      event.set_blockedTime(m->contended_nanos());
+      event.commit();
+    }
+  });
+}
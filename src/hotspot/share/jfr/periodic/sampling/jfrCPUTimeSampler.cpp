@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+
+#include "jfr/periodic/sampling/jfrCPUTimeSampler.hpp"
+#include "jfr/support/jfrThreadLocal.hpp"
+#include "jfr/utilities/jfrSpinlockHelper.hpp"
+#include "logging/log.hpp"
+#include "runtime/javaThread.hpp"
+#include "runtime/osThread.hpp"
+#include "runtime/threadSMR.hpp"
+#include "utilities/debug.hpp"
+
+#ifdef LINUX
+
+#include "signals_posix.hpp"
+
+#include <signal.h>
+#include <time.h>
+
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+
+STATIC_ASSERT(sizeof(timer_t) <= sizeof(void*));
+
+static const int cpu_timer_signal = SIGPROF;
+
+// Protects the period and the per-thread timers against concurrent
+// thread start and exit.
+static volatile int _lock = 0;
+static int64_t _period_millis = 0;
+static bool _handler_installed = false;
+
+static void handle_cpu_timer_signal(int sig, siginfo_t* info, void* context) {
+  // Runs in signal context on the sampled thread; must be async signal safe.
+  Thread* const t = Thread::current_or_null_safe();
+  if (t != nullptr && t->is_Java_thread()) {
+    t->jfr_thread_local()->add_pending_cpu_time_sample();
+  }
+}
+
+static bool install_signal_handler() {
+  if (_handler_installed) {
+    return true;
+  }
+  struct sigaction current;
+  if (sigaction(cpu_timer_signal, nullptr, &current) != 0) {
+    return false;
+  }
+  const void* const handler = (current.sa_flags & SA_SIGINFO) != 0 ?
+    CAST_FROM_FN_PTR(void*, current.sa_sigaction) : CAST_FROM_FN_PTR(void*, current.sa_handler);
+  if (handler != CAST_FROM_FN_PTR(void*, SIG_DFL) && handler != CAST_FROM_FN_PTR(void*, SIG_IGN)) {
+    log_warning(jfr)("CPU time sampling is disabled because a SIGPROF handler is already installed");
+    return false;
+  }
+  if (PosixSignals::install_generic_signal_handler(cpu_timer_signal, CAST_FROM_FN_PTR(void*, handle_cpu_timer_signal)) == (void*)-1) {
+    return false;
+  }
+  _handler_installed = true;
+  return true;
+}
+
+static bool arm_timer(timer_t timer, int64_t period_millis) {
+  struct itimerspec spec;
+  spec.it_interval.tv_sec = period_millis / 1000;
+  spec.it_interval.tv_nsec = (period_millis % 1000) * 1000000;
+  spec.it_value = spec.it_interval;
+  return timer_settime(timer, 0, &spec, nullptr) == 0;
+}
+
+static void delete_timer(JfrThreadLocal* tl) {
+  assert(tl->has_cpu_timer(), "invariant");
+  timer_delete((timer_t)tl->cpu_timer());
+  tl->clear_cpu_timer();
+}
+
+static void create_timer(JavaThread* jt, clockid_t clock, int64_t period_millis) {
+  JfrThreadLocal* const tl = jt->jfr_thread_local();
+  assert(!tl->has_cpu_timer(), "invariant");
+  struct sigevent sev;
+  memset(&sev, 0, sizeof(sev));
+  sev.sigev_notify = SIGEV_THREAD_ID;
+  sev.sigev_signo = cpu_timer_signal;
+  sev.sigev_notify_thread_id = jt->osthread()->thread_id();
+  timer_t timer;
+  if (timer_create(clock, &sev, &timer) != 0) {
+    log_debug(jfr, system)("Failed to create CPU time timer: %s", os::strerror(errno));
+    return;
+  }
+  if (!arm_timer(timer, period_millis)) {
+    log_debug(jfr, system)("Failed to arm CPU time timer: %s", os::strerror(errno));
+    timer_delete(timer);
+    return;
+  }
+  tl->set_cpu_timer((void*)timer);
+}
+
+// Hidden threads, such as compiler threads, are never sampled.
+static bool is_timed(JavaThread* jt) {
+  return !jt->is_hidden_from_external_view();
+}
+
+static void update_timer(JavaThread* jt, int64_t period_millis) {
+  JfrThreadLocal* const tl = jt->jfr_thread_local();
+  if (tl->is_cpu_timer_disabled() || !is_timed(jt)) {
+    // exiting or hidden
+    return;
+  }
+  if (period_millis == 0) {
+    if (tl->has_cpu_timer()) {
+      delete_timer(tl);
+    }
+    return;
+  }
+  if (tl->has_cpu_timer()) {
+    arm_timer((timer_t)tl->cpu_timer(), period_millis);
+    return;
+  }
+  clockid_t clock;
+  if (pthread_getcpuclockid(jt->osthread()->pthread_id(), &clock) == 0) {
+    create_timer(jt, clock, period_millis);
+  }
+}
+
+bool JfrCPUTimeSampling::is_supported() {
+  return true;
+}
+
+bool JfrCPUTimeSampling::set_period(int64_t period_millis) {
+  assert(period_millis >= 0, "invariant");
+  JfrSpinlockHelper lock(&_lock);
+  if (period_millis == _period_millis) {
+    return true;
+  }
+  if (period_millis > 0 && !install_signal_handler()) {
+    return false;
+  }
+  _period_millis = period_millis;
+  for (JavaThreadIteratorWithHandle jtiwh; JavaThread* const jt = jtiwh.next(); ) {
+    update_timer(jt, period_millis);
+  }
+  log_debug(jfr, system)("CPU time sampling period set to " INT64_FORMAT " ms", period_millis);
+  return true;
+}
+
+void JfrCPUTimeSampling::on_javathread_start(JavaThread* jt) {
+  assert(jt == Thread::current(), "invariant");
+  JfrSpinlockHelper lock(&_lock);
+  JfrThreadLocal* const tl = jt->jfr_thread_local();
+  if (_period_millis > 0 && !tl->has_cpu_timer() && is_timed(jt)) {
+    create_timer(jt, CLOCK_THREAD_CPUTIME_ID, _period_millis);
+  }
+}
+
+void JfrCPUTimeSampling::on_javathread_exit(JavaThread* jt) {
+  JfrSpinlockHelper lock(&_lock);
+  JfrThreadLocal* const tl = jt->jfr_thread_local();
+  if (tl->has_cpu_timer()) {
+    delete_timer(tl);
+  }
+  tl->disable_cpu_timer();
+}
+
+#else // LINUX
+
+bool JfrCPUTimeSampling::is_supported() {
+  return false;
+}
+
+bool JfrCPUTimeSampling::set_period(int64_t period_millis) {
+  if (period_millis > 0) {
+    log_info(jfr)("CPU time sampling is not supported on this platform");
+    return false;
+  }
+  return true;
+}
+
+void JfrCPUTimeSampling::on_javathread_start(JavaThread* jt) {}
+
+void JfrCPUTimeSampling::on_javathread_exit(JavaThread* jt) {}
+
+#endif // LINUX
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+
+#ifndef SHARE_JFR_PERIODIC_SAMPLING_JFRCPUTIMESAMPLER_HPP
+#define SHARE_JFR_PERIODIC_SAMPLING_JFRCPUTIMESAMPLER_HPP
+
+#include "memory/allStatic.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class JavaThread;
+
+//
+// Per-thread CPU time timers driving the CPUTimeSample event.
+//
+// Each Java thread gets a timer on its own CPU time clock that signals
+// the thread after every sampling period of consumed CPU time. The signal
+// handler only increments a pending sample count in the thread local;
+// the stack trace is taken by the JFR sampler thread, so threads that do
+// not consume CPU are never visited. Only supported on Linux.
+//
+class JfrCPUTimeSampling : AllStatic {
+ public:
+  static bool is_supported();
+  // Arms the timers of all Java threads with the given period, or disarms
+  // them if the period is 0. Returns false if timers could not be armed.
+  static bool set_period(int64_t period_millis);
+  static void on_javathread_start(JavaThread* jt);
+  static void on_javathread_exit(JavaThread* jt);
+};
+
+#endif // SHARE_JFR_PERIODIC_SAMPLING_JFRCPUTIMESAMPLER_HPP
@@ -25,6 +25,7 @@
 #include "classfile/javaThreadStatus.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "jfr/recorder/jfrRecorder.hpp"
+#include "jfr/periodic/sampling/jfrCPUTimeSampler.hpp"
 #include "jfr/periodic/sampling/jfrCallTrace.hpp"
 #include "jfr/periodic/sampling/jfrThreadSampler.hpp"
 #include "jfr/recorder/checkpoint/types/traceid/jfrTraceIdLoadBarrier.inline.hpp"
@@ -109,6 +110,8 @@ class JfrThreadSampleClosure {
   bool do_sample_thread(JavaThread* thread, JfrStackFrame* frames, u4 max_frames, JfrSampleType type);
   uint java_entries() { return _added_java; }
   uint native_entries() { return _added_native; }
+  traceid last_stacktrace_id() const { return _last_stacktrace_id; }
+  void reset() { _added_java = 0; _added_native = 0; }
 
  private:
   bool sample_thread_in_java(JavaThread* thread, JfrStackFrame* frames, u4 max_frames);
@@ -118,6 +121,7 @@ class JfrThreadSampleClosure {
   Thread* _self;
   uint _added_java;
   uint _added_native;
+  traceid _last_stacktrace_id;
 };
 
 class OSThreadSampler : public SuspendedThreadTask {
@@ -276,6 +280,7 @@ bool JfrThreadSampleClosure::sample_thread_in_java(JavaThread* thread, JfrStackF
   traceid id = JfrStackTraceRepository::add(sampler.stacktrace());
   assert(id != 0, "Stacktrace id should not be 0");
   event->set_stackTrace(id);
+  _last_stacktrace_id = id;
   return true;
 }
 
@@ -301,11 +306,13 @@ bool JfrThreadSampleClosure::sample_thread_in_native(JavaThread* thread, JfrStac
   traceid id = JfrStackTraceRepository::add(cb.stacktrace());
   assert(id != 0, "Stacktrace id should not be 0");
   event->set_stackTrace(id);
+  _last_stacktrace_id = id;
   return true;
 }
 
 static const uint MAX_NR_OF_JAVA_SAMPLES = 5;
 static const uint MAX_NR_OF_NATIVE_SAMPLES = 1;
+static const uint MAX_NR_OF_CPU_TIME_SAMPLES = 16;
 
 void JfrThreadSampleClosure::commit_events(JfrSampleType type) {
   if (JAVA_SAMPLE == type) {
@@ -331,7 +338,8 @@ JfrThreadSampleClosure::JfrThreadSampleClosure(EventExecutionSample* events, Eve
   _events_native(events_native),
   _self(Thread::current()),
   _added_java(0),
-  _added_native(0) {
+  _added_native(0),
+  _last_stacktrace_id(0) {
 }
 
 class JfrThreadSampler : public NonJavaThread {
@@ -342,8 +350,10 @@ class JfrThreadSampler : public NonJavaThread {
   JfrStackFrame* const _frames;
   JavaThread* _last_thread_java;
   JavaThread* _last_thread_native;
+  JavaThread* _last_thread_cpu_time;
   int64_t _java_period_millis;
   int64_t _native_period_millis;
+  int64_t _cpu_time_period_millis;
   const size_t _min_size; // for enqueue buffer monitoring
   int _cur_index;
   const u4 _max_frames;
@@ -354,7 +364,8 @@ class JfrThreadSampler : public NonJavaThread {
 
   JavaThread* next_thread(ThreadsList* t_list, JavaThread* first_sampled, JavaThread* current);
   void task_stacktrace(JfrSampleType type, JavaThread** last_thread);
-  JfrThreadSampler(int64_t java_period_millis, int64_t native_period_millis, u4 max_frames);
+  void task_cpu_time_stacktrace();
+  JfrThreadSampler(int64_t java_period_millis, int64_t native_period_millis, int64_t cpu_time_period_millis, u4 max_frames);
   ~JfrThreadSampler();
 
   void start_thread();
@@ -363,6 +374,7 @@ class JfrThreadSampler : public NonJavaThread {
   void disenroll();
   void set_java_period(int64_t period_millis);
   void set_native_period(int64_t period_millis);
+  void set_cpu_time_period(int64_t period_millis);
  protected:
   virtual void post_run();
  public:
@@ -374,6 +386,7 @@ class JfrThreadSampler : public NonJavaThread {
   static void on_javathread_suspend(JavaThread* thread);
   int64_t get_java_period() const { return Atomic::load(&_java_period_millis); };
   int64_t get_native_period() const { return Atomic::load(&_native_period_millis); };
+  int64_t get_cpu_time_period() const { return Atomic::load(&_cpu_time_period_millis); };
 };
 
 static void clear_transition_block(JavaThread* jt) {
@@ -416,20 +429,23 @@ bool JfrThreadSampleClosure::do_sample_thread(JavaThread* thread, JfrStackFrame*
   return ret;
 }
 
-JfrThreadSampler::JfrThreadSampler(int64_t java_period_millis, int64_t native_period_millis, u4 max_frames) :
+JfrThreadSampler::JfrThreadSampler(int64_t java_period_millis, int64_t native_period_millis, int64_t cpu_time_period_millis, u4 max_frames) :
   _sample(),
   _sampler_thread(nullptr),
   _frames(JfrCHeapObj::new_array<JfrStackFrame>(max_frames)),
   _last_thread_java(nullptr),
   _last_thread_native(nullptr),
+  _last_thread_cpu_time(nullptr),
   _java_period_millis(java_period_millis),
   _native_period_millis(native_period_millis),
+  _cpu_time_period_millis(cpu_time_period_millis),
   _min_size(max_frames * 2 * wordSize), // each frame tags at most 2 words, min size is a full stacktrace
   _cur_index(-1),
   _max_frames(max_frames),
   _disenrolled(true) {
   assert(_java_period_millis >= 0, "invariant");
   assert(_native_period_millis >= 0, "invariant");
+  assert(_cpu_time_period_millis >= 0, "invariant");
 }
 
 JfrThreadSampler::~JfrThreadSampler() {
@@ -446,6 +462,11 @@ void JfrThreadSampler::set_native_period(int64_t period_millis) {
   Atomic::store(&_native_period_millis, period_millis);
 }
 
+void JfrThreadSampler::set_cpu_time_period(int64_t period_millis) {
+  assert(period_millis >= 0, "invariant");
+  Atomic::store(&_cpu_time_period_millis, period_millis);
+}
+
 static inline bool is_released(JavaThread* jt) {
   return !jt->is_trace_suspend();
 }
@@ -514,12 +535,14 @@ void JfrThreadSampler::run() {
 
   int64_t last_java_ms = get_monotonic_ms();
   int64_t last_native_ms = last_java_ms;
+  int64_t last_cpu_time_ms = last_java_ms;
   while (true) {
     if (!_sample.trywait()) {
       // disenrolled
       _sample.wait();
       last_java_ms = get_monotonic_ms();
       last_native_ms = last_java_ms;
+      last_cpu_time_ms = last_java_ms;
     }
     _sample.signal();
 
@@ -527,10 +550,12 @@ void JfrThreadSampler::run() {
     java_period_millis = java_period_millis == 0 ? max_jlong : MAX2<int64_t>(java_period_millis, 1);
     int64_t native_period_millis = get_native_period();
     native_period_millis = native_period_millis == 0 ? max_jlong : MAX2<int64_t>(native_period_millis, 1);
+    int64_t cpu_time_period_millis = get_cpu_time_period();
+    cpu_time_period_millis = cpu_time_period_millis == 0 ? max_jlong : MAX2<int64_t>(cpu_time_period_millis, 1);
 
-    // If both periods are max_jlong, it implies the sampler is in the process of
+    // If all periods are max_jlong, it implies the sampler is in the process of
     // disenrolling. Loop back for graceful disenroll by means of the semaphore.
-    if (java_period_millis == max_jlong && native_period_millis == max_jlong) {
+    if (java_period_millis == max_jlong && native_period_millis == max_jlong && cpu_time_period_millis == max_jlong) {
       continue;
     }
 
@@ -547,8 +572,9 @@ void JfrThreadSampler::run() {
      */
     const int64_t next_j = java_period_millis + (last_java_ms - now_ms);
     const int64_t next_n = native_period_millis + (last_native_ms - now_ms);
+    const int64_t next_c = cpu_time_period_millis + (last_cpu_time_ms - now_ms);
 
-    const int64_t sleep_to_next = MIN2<int64_t>(next_j, next_n);
+    const int64_t sleep_to_next = MIN3<int64_t>(next_j, next_n, next_c);
 
     if (sleep_to_next > 0) {
       os::naked_sleep(sleep_to_next);
@@ -564,6 +590,10 @@ void JfrThreadSampler::run() {
       task_stacktrace(NATIVE_SAMPLE, &_last_thread_native);
       last_native_ms = get_monotonic_ms();
     }
+    if (next_c <= sleep_to_next) {
+      task_cpu_time_stacktrace();
+      last_cpu_time_ms = get_monotonic_ms();
+    }
   }
 }
 
@@ -639,6 +669,72 @@ void JfrThreadSampler::task_stacktrace(JfrSampleType type, JavaThread** last_thr
   }
 }
 
+// Samples the threads that consumed at least one CPU time period since they were
+// last visited, as signalled by their CPU timers (see JfrCPUTimeSampling).
+// Each sample accounts for all periods consumed since the previous one.
+void JfrThreadSampler::task_cpu_time_stacktrace() {
+  ResourceMark rm;
+  EventExecutionSample samples[MAX_NR_OF_JAVA_SAMPLES];
+  EventNativeMethodSample samples_native[MAX_NR_OF_NATIVE_SAMPLES];
+  EventCPUTimeSample cpu_time_samples[MAX_NR_OF_CPU_TIME_SAMPLES];
+  JfrThreadSampleClosure sample_task(samples, samples_native);
+
+  const u8 period_nanos = (u8)MAX2<int64_t>(get_cpu_time_period(), 1) * NANOSECS_PER_MILLISEC;
+  uint num_samples = 0;
+  u4 lost_samples = 0;
+  JavaThread* start = nullptr;
+  {
+    MutexLocker tlock(Threads_lock);
+    ThreadsListHandle tlh;
+    _cur_index = tlh.list()->find_index_of_JavaThread(_last_thread_cpu_time);
+    JavaThread* current = _cur_index != -1 ? _last_thread_cpu_time : nullptr;
+    // See task_stacktrace() for why the enqueue buffer is renewed pre-emptively.
+    const JfrBuffer* enqueue_buffer = get_enqueue_buffer();
+    assert(enqueue_buffer != nullptr, "invariant");
+
+    while (num_samples < MAX_NR_OF_CPU_TIME_SAMPLES) {
+      current = next_thread(tlh.list(), start, current);
+      if (current == nullptr) {
+        break;
+      }
+      if (start == nullptr) {
+        start = current;
+      }
+      JfrThreadLocal* const tl = current->jfr_thread_local();
+      if (!tl->has_pending_cpu_time_samples()) {
+        continue;
+      }
+      const u4 pending = tl->take_pending_cpu_time_samples();
+      const JfrSampleType type = thread_state_in_native(current) ? NATIVE_SAMPLE : JAVA_SAMPLE;
+      assert(enqueue_buffer->free_size() >= _min_size, "invariant");
+      sample_task.reset();
+      if (!sample_task.do_sample_thread(current, _frames, _max_frames, type)) {
+        // Excluded, or consuming CPU in the VM where no stack trace can be taken.
+        lost_samples += pending;
+        continue;
+      }
+      EventCPUTimeSample& event = cpu_time_samples[num_samples++];
+      event.set_sampledThread(JfrThreadLocal::thread_id(current));
+      event.set_stackTrace(sample_task.last_stacktrace_id());
+      event.set_state(static_cast<u8>(JavaThreadStatus::RUNNABLE));
+      event.set_cpuTime(pending * period_nanos);
+      enqueue_buffer = renew_if_full(enqueue_buffer);
+    }
+    _last_thread_cpu_time = current;
+  }
+  log_trace(jfr)("JFR CPU time sampling done with %u samples, %u lost", num_samples, lost_samples);
+  if (EventCPUTimeSample::is_enabled()) {
+    for (uint i = 0; i < num_samples; ++i) {
+      cpu_time_samples[i].commit();
+    }
+  }
+  if (lost_samples > 0) {
+    EventCPUTimeSamplesLost event;
+    event.set_lostSamples(lost_samples);
+    event.commit();
+  }
+}
+
 static JfrThreadSampling* _instance = nullptr;
 
 JfrThreadSampling& JfrThreadSampling::instance() {
@@ -667,38 +763,41 @@ JfrThreadSampling::~JfrThreadSampling() {
 }
 
 #ifdef ASSERT
-static void assert_periods(const JfrThreadSampler* sampler, int64_t java_period_millis, int64_t native_period_millis) {
+static void assert_periods(const JfrThreadSampler* sampler, int64_t java_period_millis, int64_t native_period_millis, int64_t cpu_time_period_millis) {
   assert(sampler != nullptr, "invariant");
   assert(sampler->get_java_period() == java_period_millis, "invariant");
   assert(sampler->get_native_period() == native_period_millis, "invariant");
+  assert(sampler->get_cpu_time_period() == cpu_time_period_millis, "invariant");
 }
 #endif
 
-static void log(int64_t java_period_millis, int64_t native_period_millis) {
-  log_trace(jfr)("Updated thread sampler for java: " INT64_FORMAT "  ms, native " INT64_FORMAT " ms", java_period_millis, native_period_millis);
+static void log(int64_t java_period_millis, int64_t native_period_millis, int64_t cpu_time_period_millis) {
+  log_trace(jfr)("Updated thread sampler for java: " INT64_FORMAT "  ms, native " INT64_FORMAT " ms, cpu time " INT64_FORMAT " ms",
+                 java_period_millis, native_period_millis, cpu_time_period_millis);
 }
 
-void JfrThreadSampling::create_sampler(int64_t java_period_millis, int64_t native_period_millis) {
+void JfrThreadSampling::create_sampler(int64_t java_period_millis, int64_t native_period_millis, int64_t cpu_time_period_millis) {
   assert(_sampler == nullptr, "invariant");
-  log_trace(jfr)("Creating thread sampler for java:" INT64_FORMAT " ms, native " INT64_FORMAT " ms", java_period_millis, native_period_millis);
-  _sampler = new JfrThreadSampler(java_period_millis, native_period_millis, JfrOptionSet::stackdepth());
+  log_trace(jfr)("Creating thread sampler for java:" INT64_FORMAT " ms, native " INT64_FORMAT " ms, cpu time " INT64_FORMAT " ms",
+                 java_period_millis, native_period_millis, cpu_time_period_millis);
+  _sampler = new JfrThreadSampler(java_period_millis, native_period_millis, cpu_time_period_millis, JfrOptionSet::stackdepth());
   _sampler->start_thread();
   _sampler->enroll();
 }
 
-void JfrThreadSampling::update_run_state(int64_t java_period_millis, int64_t native_period_millis) {
-  if (java_period_millis > 0 || native_period_millis > 0) {
+void JfrThreadSampling::update_run_state(int64_t java_period_millis, int64_t native_period_millis, int64_t cpu_time_period_millis) {
+  if (java_period_millis > 0 || native_period_millis > 0 || cpu_time_period_millis > 0) {
     if (_sampler == nullptr) {
-      create_sampler(java_period_millis, native_period_millis);
+      create_sampler(java_period_millis, native_period_millis, cpu_time_period_millis);
     } else {
       _sampler->enroll();
     }
-    DEBUG_ONLY(assert_periods(_sampler, java_period_millis, native_period_millis);)
-    log(java_period_millis, native_period_millis);
+    DEBUG_ONLY(assert_periods(_sampler, java_period_millis, native_period_millis, cpu_time_period_millis);)
+    log(java_period_millis, native_period_millis, cpu_time_period_millis);
     return;
   }
   if (_sampler != nullptr) {
-    DEBUG_ONLY(assert_periods(_sampler, java_period_millis, native_period_millis);)
+    DEBUG_ONLY(assert_periods(_sampler, java_period_millis, native_period_millis, cpu_time_period_millis);)
     _sampler->disenroll();
   }
 }
@@ -706,20 +805,40 @@ void JfrThreadSampling::update_run_state(int64_t java_period_millis, int64_t nat
 void JfrThreadSampling::set_sampling_period(bool is_java_period, int64_t period_millis) {
   int64_t java_period_millis = 0;
   int64_t native_period_millis = 0;
+  int64_t cpu_time_period_millis = 0;
   if (is_java_period) {
     java_period_millis = period_millis;
     if (_sampler != nullptr) {
       _sampler->set_java_period(java_period_millis);
       native_period_millis = _sampler->get_native_period();
+      cpu_time_period_millis = _sampler->get_cpu_time_period();
     }
   } else {
     native_period_millis = period_millis;
     if (_sampler != nullptr) {
       _sampler->set_native_period(native_period_millis);
       java_period_millis = _sampler->get_java_period();
+      cpu_time_period_millis = _sampler->get_cpu_time_period();
     }
   }
-  update_run_state(java_period_millis, native_period_millis);
+  update_run_state(java_period_millis, native_period_millis, cpu_time_period_millis);
+}
+
+void JfrThreadSampling::set_cpu_time_sampling_period(int64_t period_millis) {
+  int64_t java_period_millis = 0;
+  int64_t native_period_millis = 0;
+  if (period_millis > 0 && !JfrCPUTimeSampling::set_period(period_millis)) {
+    period_millis = 0;
+  }
+  if (_sampler != nullptr) {
+    _sampler->set_cpu_time_period(period_millis);
+    java_period_millis = _sampler->get_java_period();
+    native_period_millis = _sampler->get_native_period();
+  }
+  update_run_state(java_period_millis, native_period_millis, period_millis);
+  if (period_millis == 0) {
+    JfrCPUTimeSampling::set_period(0);
+  }
 }
 
 void JfrThreadSampling::set_java_sample_period(int64_t period_millis) {
@@ -738,6 +857,14 @@ void JfrThreadSampling::set_native_sample_period(int64_t period_millis) {
   instance().set_sampling_period(false, period_millis);
 }
 
+void JfrThreadSampling::set_cpu_time_sample_period(int64_t period_millis) {
+  assert(period_millis >= 0, "invariant");
+  if (_instance == nullptr && 0 == period_millis) {
+    return;
+  }
+  instance().set_cpu_time_sampling_period(period_millis);
+}
+
 void JfrThreadSampling::on_javathread_suspend(JavaThread* thread) {
   JfrThreadSampler::on_javathread_suspend(thread);
 }
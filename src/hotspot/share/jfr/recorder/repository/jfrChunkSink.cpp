@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+
+#include "jfr/recorder/repository/jfrChunkSink.hpp"
+#include "jfr/utilities/jfrAllocation.hpp"
+#include "logging/log.hpp"
+#include "runtime/os.hpp"
+#include "utilities/bytes.hpp"
+
+#ifndef _WINDOWS
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#endif
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+JfrChunkSink* JfrChunkSink::create(const char* path) {
+  assert(path != nullptr, "invariant");
+#ifdef _WINDOWS
+  log_warning(jfr)("chunksink=%s is not supported on this platform", path);
+  return nullptr;
+#else
+  struct sockaddr_un addr;
+  if (strlen(path) >= sizeof(addr.sun_path)) {
+    log_warning(jfr)("chunksink=%s exceeds the maximum socket path length", path);
+    return nullptr;
+  }
+  return new JfrChunkSink(path);
+#endif
+}
+
+JfrChunkSink::JfrChunkSink(const char* path) : _path(nullptr), _fd(-1) {
+  const size_t len = strlen(path);
+  _path = JfrCHeapObj::new_array<char>(len + 1);
+  strncpy(_path, path, len + 1);
+}
+
+JfrChunkSink::~JfrChunkSink() {
+  disconnect();
+  JfrCHeapObj::free(_path, strlen(_path) + 1);
+}
+
+#ifndef _WINDOWS
+// Waits at most timeout_ms for the socket to become writable.
+static bool wait_writable(int fd, jlong timeout_ms) {
+  const jlong deadline = os::javaTimeMillis() + timeout_ms;
+  for (;;) {
+    const jlong left = deadline - os::javaTimeMillis();
+    if (left <= 0) {
+      errno = ETIMEDOUT;
+      return false;
+    }
+    struct pollfd pfd;
+    pfd.fd = fd;
+    pfd.events = POLLOUT;
+    pfd.revents = 0;
+    const int res = ::poll(&pfd, 1, (int)left);
+    if (res > 0) {
+      return true;
+    }
+    if (res == 0) {
+      errno = ETIMEDOUT;
+      return false;
+    }
+    if (errno != EINTR) {
+      return false;
+    }
+  }
+}
+#endif
+
+bool JfrChunkSink::connect() {
+  assert(!is_connected(), "invariant");
+#ifdef _WINDOWS
+  return false;
+#else
+  const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd == -1) {
+    return false;
+  }
+  // Segments may be sent from inside a safepoint operation, so neither
+  // connecting nor sending may wait for the peer longer than a bounded
+  // time, see send().
+  const int flags = ::fcntl(fd, F_GETFL);
+  if (flags == -1 || ::fcntl(fd, F_SETFL, flags | O_NONBLOCK) == -1) {
+    log_debug(jfr, system)("Unable to make chunk sink %s non-blocking: %s", _path, os::strerror(errno));
+    os::socket_close(fd);
+    return false;
+  }
+  struct sockaddr_un addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strncpy(addr.sun_path, _path, sizeof(addr.sun_path) - 1);
+  if (os::connect(fd, (struct sockaddr*)&addr, sizeof(addr)) == -1) {
+    int error = errno;
+    if (error == EINPROGRESS) {
+      socklen_t error_len = sizeof(error);
+      if (!wait_writable(fd, connect_timeout_ms)) {
+        error = errno;
+      } else if (::getsockopt(fd, SOL_SOCKET, SO_ERROR, &error, &error_len) == -1) {
+        error = errno;
+      }
+    }
+    if (error != 0) {
+      log_debug(jfr, system)("Unable to connect to chunk sink %s: %s", _path, os::strerror(error));
+      os::socket_close(fd);
+      return false;
+    }
+  }
+  _fd = fd;
+  log_debug(jfr, system)("Connected to chunk sink %s", _path);
+  return true;
+#endif
+}
+
+void JfrChunkSink::disconnect() {
+  if (is_connected()) {
+    os::socket_close(_fd);
+    _fd = -1;
+  }
+}
+
+bool JfrChunkSink::send(const void* buf, size_t len) {
+  assert(is_connected(), "invariant");
+#ifdef _WINDOWS
+  return false;
+#else
+  const char* pos = (const char*)buf;
+  while (len > 0) {
+    const ssize_t sent = os::send(_fd, const_cast<char*>(pos), len, MSG_NOSIGNAL);
+    if (sent == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+      // The socket buffer is full. Give the peer some time to read.
+      if (wait_writable(_fd, send_timeout_ms)) {
+        continue;
+      }
+    }
+    if (sent <= 0) {
+      // A peer that does not drain its socket buffer in time is dropped for
+      // the rest of the chunk, as the record being sent can not be
+      // completed later.
+      if (sent == -1 && errno == ETIMEDOUT) {
+        log_info(jfr, system)("Chunk sink %s does not keep up, disconnected", _path);
+      } else {
+        log_info(jfr, system)("Chunk sink %s disconnected: %s", _path, os::strerror(errno));
+      }
+      disconnect();
+      return false;
+    }
+    pos += sent;
+    len -= (size_t)sent;
+  }
+  return true;
+#endif
+}
+
+bool JfrChunkSink::send_record_header(RecordType type, int64_t offset, int64_t len) {
+  u1 header[record_header_size];
+  header[0] = (u1)type;
+  Bytes::put_Java_u8(&header[1], (u8)offset);
+  Bytes::put_Java_u8(&header[1 + sizeof(int64_t)], (u8)len);
+  return send(header, record_header_size);
+}
+
+void JfrChunkSink::begin_chunk() {
+  // A connection lost mid-chunk is only re-established here,
+  // at a chunk boundary, so a consumer never sees a partial chunk.
+  if (is_connected() || connect()) {
+    send_record_header(CHUNK_BEGIN, 0, 0);
+  }
+}
+
+void JfrChunkSink::end_chunk(int64_t size) {
+  if (is_connected()) {
+    send_record_header(CHUNK_END, 0, size);
+  }
+}
+
+void JfrChunkSink::write(int64_t offset, const u1* buf, intptr_t len) {
+  assert(len >= 0, "invariant");
+  if (is_connected() && len > 0 && send_record_header(SEGMENT, offset, len)) {
+    send(buf, (size_t)len);
+  }
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+
+#ifndef SHARE_JFR_RECORDER_REPOSITORY_JFRCHUNKSINK_HPP
+#define SHARE_JFR_RECORDER_REPOSITORY_JFRCHUNKSINK_HPP
+
+#include "jfr/writers/jfrStreamSink.hpp"
+
+//
+// Mirrors chunk segments, as they are flushed by the chunk writer,
+// to a UNIX-domain stream socket (-XX:FlightRecorderOptions:chunksink=<path>).
+//
+// The disk repository remains authoritative; the sink is a best-effort
+// copy for out-of-process consumers. Every record starts with a u1 tag
+// followed by two big-endian s8 values:
+//
+//   CHUNK_BEGIN (1)  0       0
+//   SEGMENT     (2)  offset  length  <length bytes>
+//   CHUNK_END   (3)  0       size
+//
+// A SEGMENT with an offset below the current end of the chunk overwrites
+// previously sent bytes, as done for chunk header updates.
+//
+// A connection is attempted at the beginning of every chunk. The socket is
+// non-blocking, and the writer waits at most connect_timeout_ms for the
+// connection and send_timeout_ms for room in the socket buffer each time
+// it fills up. If the peer goes away, or does not read within that time,
+// the connection is closed and mirroring stops until the next chunk begins.
+// A consumer that sees the connection close before CHUNK_END has an
+// incomplete chunk.
+//
+class JfrChunkSink : public JfrStreamSink {
+ private:
+  enum RecordType {
+    CHUNK_BEGIN = 1,
+    SEGMENT = 2,
+    CHUNK_END = 3
+  };
+  static const size_t record_header_size = sizeof(u1) + 2 * sizeof(int64_t);
+  static const jlong connect_timeout_ms = 100;
+  static const jlong send_timeout_ms = 100;
+
+  char* _path;
+  int _fd;
+
+  JfrChunkSink(const char* path);
+  bool connect();
+  void disconnect();
+  bool send(const void* buf, size_t len);
+  bool send_record_header(RecordType type, int64_t offset, int64_t len);
+
+ public:
+  static JfrChunkSink* create(const char* path);
+  ~JfrChunkSink();
+
+  bool is_connected() const { return _fd != -1; }
+  void begin_chunk();
+  void end_chunk(int64_t size);
+  virtual void write(int64_t offset, const u1* buf, intptr_t len);
+};
+
+#endif // SHARE_JFR_RECORDER_REPOSITORY_JFRCHUNKSINK_HPP
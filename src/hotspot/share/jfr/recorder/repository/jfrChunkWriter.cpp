@@ -23,7 +23,9 @@
  */
 
 #include "jfr/recorder/repository/jfrChunk.hpp"
+#include "jfr/recorder/repository/jfrChunkSink.hpp"
 #include "jfr/recorder/repository/jfrChunkWriter.hpp"
+#include "jfr/recorder/service/jfrOptionSet.hpp"
 #include "jfr/utilities/jfrTime.hpp"
 #include "jfr/utilities/jfrTypes.hpp"
 #include "runtime/mutexLocker.hpp"
@@ -225,11 +227,17 @@ int64_t JfrChunkWriter::flush_chunk(bool flushpoint) {
   return sz_written;
 }
 
-JfrChunkWriter::JfrChunkWriter() : JfrChunkWriterBase(nullptr), _chunk(new JfrChunk()) {}
+JfrChunkWriter::JfrChunkWriter() : JfrChunkWriterBase(nullptr), _chunk(new JfrChunk()), _sink(nullptr) {
+  if (JfrOptionSet::chunk_sink() != nullptr) {
+    _sink = JfrChunkSink::create(JfrOptionSet::chunk_sink());
+    set_sink(_sink);
+  }
+}
 
 JfrChunkWriter::~JfrChunkWriter() {
   assert(_chunk != nullptr, "invariant");
   delete _chunk;
+  delete _sink;
 }
 
 void JfrChunkWriter::set_path(const char* path) {
@@ -277,6 +285,9 @@ bool JfrChunkWriter::open() {
   const bool is_open = this->has_valid_fd();
   if (is_open) {
     assert(0 == this->current_offset(), "invariant");
+    if (_sink != nullptr) {
+      _sink->begin_chunk();
+    }
     _chunk->reset();
     JfrChunkHeadWriter head(this, HEADER_SIZE);
   }
@@ -286,6 +297,9 @@ bool JfrChunkWriter::open() {
 int64_t JfrChunkWriter::close() {
   assert(this->has_valid_fd(), "invariant");
   const int64_t size_written = flush_chunk(false);
+  if (_sink != nullptr) {
+    _sink->end_chunk(size_written);
+  }
   this->close_fd();
   assert(!this->is_valid(), "invariant");
   return size_written;
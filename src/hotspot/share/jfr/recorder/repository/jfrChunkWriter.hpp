@@ -35,12 +35,14 @@ typedef WriterHost<BigEndianEncoder, CompressedIntegerEncoder, JfrBufferedChunkW
 
 class JfrChunk;
 class JfrChunkHeadWriter;
+class JfrChunkSink;
 
 class JfrChunkWriter : public JfrChunkWriterBase {
   friend class JfrChunkHeadWriter;
   friend class JfrRepository;
  private:
   JfrChunk* _chunk;
+  JfrChunkSink* _sink;
   void set_path(const char* path);
   int64_t flush_chunk(bool flushpoint);
   bool open();
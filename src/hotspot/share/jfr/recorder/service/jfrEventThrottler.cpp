@@ -34,7 +34,20 @@ constexpr static const JfrSamplerParams _disabled_params = {
                                                              false // reconfigure
                                                            };
 
-static JfrEventThrottler* _throttler = nullptr;
+struct JfrThrottledEvent {
+  JfrEventId id;
+  const char* name;
+};
+
+// Events declared with throttle="true" in metadata.xml.
+static const JfrThrottledEvent _throttled_events[] = {
+  { JfrObjectAllocationSampleEvent, "jdk.ObjectAllocationSample" },
+  { JfrJavaMonitorEnterEvent,       "jdk.JavaMonitorEnter" },
+  { JfrThreadParkEvent,             "jdk.ThreadPark" }
+};
+
+static const size_t _number_of_throttlers = ARRAY_SIZE(_throttled_events);
+static JfrEventThrottler* _throttlers[_number_of_throttlers] = { nullptr };
 
 JfrEventThrottler::JfrEventThrottler(JfrEventId event_id) :
   JfrAdaptiveSampler(),
@@ -47,30 +60,47 @@ JfrEventThrottler::JfrEventThrottler(JfrEventId event_id) :
   _update(false) {}
 
 bool JfrEventThrottler::create() {
-  assert(_throttler == nullptr, "invariant");
-  _throttler = new JfrEventThrottler(JfrObjectAllocationSampleEvent);
-  return _throttler != nullptr && _throttler->initialize();
+  for (size_t i = 0; i < _number_of_throttlers; ++i) {
+    assert(_throttlers[i] == nullptr, "invariant");
+    _throttlers[i] = new JfrEventThrottler(_throttled_events[i].id);
+    if (_throttlers[i] == nullptr || !_throttlers[i]->initialize()) {
+      return false;
+    }
+  }
+  return true;
 }
 
 void JfrEventThrottler::destroy() {
-  delete _throttler;
-  _throttler = nullptr;
+  for (size_t i = 0; i < _number_of_throttlers; ++i) {
+    delete _throttlers[i];
+    _throttlers[i] = nullptr;
+  }
 }
 
-// There is currently only one throttler instance, for the jdk.ObjectAllocationSample event.
-// When introducing additional throttlers, also add a lookup map keyed by event id.
+static size_t index_of(JfrEventId event_id) {
+  for (size_t i = 0; i < _number_of_throttlers; ++i) {
+    if (_throttled_events[i].id == event_id) {
+      return i;
+    }
+  }
+  return _number_of_throttlers;
+}
+
+// The set of throttled events is small, a linear scan is sufficient.
 JfrEventThrottler* JfrEventThrottler::for_event(JfrEventId event_id) {
-  assert(_throttler != nullptr, "JfrEventThrottler has not been properly initialized");
-  assert(event_id == JfrObjectAllocationSampleEvent, "Event type has an unconfigured throttler");
-  return event_id == JfrObjectAllocationSampleEvent ? _throttler : nullptr;
+  const size_t index = index_of(event_id);
+  assert(index < _number_of_throttlers, "Event type has an unconfigured throttler");
+  assert(index == _number_of_throttlers || _throttlers[index] != nullptr, "JfrEventThrottler has not been properly initialized");
+  return index < _number_of_throttlers ? _throttlers[index] : nullptr;
 }
 
 void JfrEventThrottler::configure(JfrEventId event_id, int64_t sample_size, int64_t period_ms) {
-  if (event_id != JfrObjectAllocationSampleEvent) {
+  const size_t index = index_of(event_id);
+  if (index == _number_of_throttlers) {
     return;
   }
-  assert(_throttler != nullptr, "JfrEventThrottler has not been properly initialized");
-  _throttler->configure(sample_size, period_ms);
+  assert(_throttlers[index] != nullptr, "JfrEventThrottler has not been properly initialized");
+  _throttlers[index]->configure(sample_size, period_ms);
 }
 
 /*
@@ -93,7 +123,7 @@ void JfrEventThrottler::configure(int64_t sample_size, int64_t period_ms) {
 bool JfrEventThrottler::accept(JfrEventId event_id, int64_t timestamp /* 0 */) {
   JfrEventThrottler* const throttler = for_event(event_id);
   if (throttler == nullptr) return true;
-  return _throttler->_disabled ? true : _throttler->sample(timestamp);
+  return throttler->_disabled ? true : throttler->sample(timestamp);
 }
 
 /*
@@ -239,16 +269,15 @@ inline double compute_ewma_alpha_coefficient(size_t lookback_count) {
  *
  * Monitoring the relation of average sample size to the window set point, i.e the target,
  * is a good indicator of how the throttler is performing over time.
- *
- * Note: there is currently only one throttler instance, for the ObjectAllocationSample event.
- * When introducing additional throttlers, also provide a map from the event id to the event name.
  */
-static void log(const JfrSamplerWindow* expired, double* sample_size_ewma) {
+static void log(JfrEventId event_id, const JfrSamplerWindow* expired, double* sample_size_ewma) {
   assert(sample_size_ewma != nullptr, "invariant");
   if (log_is_enabled(Debug, jfr, system, throttle)) {
+    const size_t index = index_of(event_id);
+    assert(index < _number_of_throttlers, "invariant");
     *sample_size_ewma = exponentially_weighted_moving_average(static_cast<double>(expired->sample_size()), compute_ewma_alpha_coefficient(expired->params().window_lookback_count), *sample_size_ewma);
-    log_debug(jfr, system, throttle)("jdk.ObjectAllocationSample: avg.sample size: %0.4f, window set point: %zu, sample size: %zu, population size: %zu, ratio: %.4f, window duration: %zu ms\n",
-      *sample_size_ewma, expired->params().sample_points_per_window, expired->sample_size(), expired->population_size(),
+    log_debug(jfr, system, throttle)("%s: avg.sample size: %0.4f, window set point: %zu, sample size: %zu, population size: %zu, ratio: %.4f, window duration: %zu ms\n",
+      _throttled_events[index].name, *sample_size_ewma, expired->params().sample_points_per_window, expired->sample_size(), expired->population_size(),
       expired->population_size() == 0 ? 0 : static_cast<double>(expired->sample_size()) / static_cast<double>(expired->population_size()),
       expired->params().window_duration_ms);
   }
@@ -267,7 +296,7 @@ static void log(const JfrSamplerWindow* expired, double* sample_size_ewma) {
 const JfrSamplerParams& JfrEventThrottler::next_window_params(const JfrSamplerWindow* expired) {
   assert(expired != nullptr, "invariant");
   assert(_lock, "invariant");
-  log(expired, &_sample_size_ewma);
+  log(_event_id, expired, &_sample_size_ewma);
   if (_update) {
     return update_params(expired); // Updates _last_params in-place.
   }
@@ -104,6 +104,18 @@ void JfrOptionSet::set_old_object_queue_size(jlong value) {
   _old_object_queue_size = value;
 }
 
+jlong JfrOptionSet::cpu_time_sample_period() {
+  return _cpu_time_sample_period;
+}
+
+void JfrOptionSet::set_cpu_time_sample_period(jlong value) {
+  _cpu_time_sample_period = value;
+}
+
+const char* JfrOptionSet::chunk_sink() {
+  return _chunk_sink;
+}
+
 u4 JfrOptionSet::stackdepth() {
   return _stack_depth;
 }
@@ -166,6 +178,8 @@ const char* const default_stack_depth = "64";
 const char* const default_retransform = "true";
 const char* const default_old_object_queue_size = "256";
 const char* const default_preserve_repository = "false";
+const char* const default_chunk_sink = nullptr;
+const char* const default_cpu_time_sample_period = "10";
 DEBUG_ONLY(const char* const default_sample_protection = "false";)
 
 // statics
@@ -262,6 +276,20 @@ static DCmdArgument<bool> _dcmd_preserve_repository(
   false,
   default_preserve_repository);
 
+static DCmdArgument<char*> _dcmd_chunk_sink(
+  "chunksink",
+  "UNIX-domain socket that receives chunk segments as they are flushed",
+  "STRING",
+  false,
+  default_chunk_sink);
+
+static DCmdArgument<jlong> _dcmd_cpu_time_sample_period(
+  "cpusampleperiod",
+  "Thread CPU time, in milliseconds, between two CPU time samples of a thread (minimum 1)",
+  "INT",
+  false,
+  default_cpu_time_sample_period);
+
 static DCmdParser _parser;
 
 static void register_parser_options() {
@@ -277,6 +305,8 @@ static void register_parser_options() {
   _parser.add_dcmd_option(&_dcmd_retransform);
   _parser.add_dcmd_option(&_dcmd_old_object_queue_size);
   _parser.add_dcmd_option(&_dcmd_preserve_repository);
+  _parser.add_dcmd_option(&_dcmd_chunk_sink);
+  _parser.add_dcmd_option(&_dcmd_cpu_time_sample_period);
   DEBUG_ONLY(_parser.add_dcmd_option(&_dcmd_sample_protection);)
 }
 
@@ -315,6 +345,8 @@ jlong JfrOptionSet::_thread_buffer_size = 0;
 jlong JfrOptionSet::_memory_size = 0;
 jlong JfrOptionSet::_num_global_buffers = 0;
 jlong JfrOptionSet::_old_object_queue_size = 0;
+const char* JfrOptionSet::_chunk_sink = nullptr;
+jlong JfrOptionSet::_cpu_time_sample_period = 10;
 u4 JfrOptionSet::_stack_depth = STACK_DEPTH_DEFAULT;
 jboolean JfrOptionSet::_retransform = JNI_TRUE;
 #ifdef ASSERT
@@ -332,6 +364,12 @@ bool JfrOptionSet::initialize(JavaThread* thread) {
     set_retransform(_dcmd_retransform.value());
   }
   set_old_object_queue_size(_dcmd_old_object_queue_size.value());
+  _chunk_sink = _dcmd_chunk_sink.value();
+  if (_dcmd_cpu_time_sample_period.value() < 1) {
+    log_error(arguments) ("-XX:FlightRecorderOptions:cpusampleperiod must be at least 1");
+    return false;
+  }
+  set_cpu_time_sample_period(_dcmd_cpu_time_sample_period.value());
   return adjust_memory_options();
 }
 
@@ -44,6 +44,8 @@ class JfrOptionSet : public AllStatic {
   static jlong _memory_size;
   static jlong _num_global_buffers;
   static jlong _old_object_queue_size;
+  static jlong _cpu_time_sample_period;
+  static const char* _chunk_sink;
   static u4 _stack_depth;
   static jboolean _retransform;
   static jboolean _sample_protection;
@@ -65,6 +67,9 @@ class JfrOptionSet : public AllStatic {
   static void set_num_global_buffers(jlong value);
   static jint old_object_queue_size();
   static void set_old_object_queue_size(jlong value);
+  static jlong cpu_time_sample_period();
+  static void set_cpu_time_sample_period(jlong value);
+  static const char* chunk_sink();
   static u4 stackdepth();
   static void set_stackdepth(u4 depth);
   static bool can_retransform();
@@ -193,26 +193,52 @@ void JfrStackTraceRepository::record_for_leak_profiler(JavaThread* current_threa
   }
 }
 
-traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  assert(stacktrace._nr_of_frames > 0, "invariant");
-  const size_t index = stacktrace._hash % TABLE_SIZE;
+const JfrStackTrace* JfrStackTraceRepository::lookup(const JfrStackTrace& stacktrace, size_t index) const {
+  assert(JfrStacktrace_lock->owned_by_self(), "invariant");
   const JfrStackTrace* table_entry = _table[index];
-
   while (table_entry != nullptr) {
     if (table_entry->equals(stacktrace)) {
-      return table_entry->id();
+      return table_entry;
     }
     table_entry = table_entry->next();
   }
+  return nullptr;
+}
+
+traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
+  assert(stacktrace._nr_of_frames > 0, "invariant");
+  const size_t index = stacktrace._hash % TABLE_SIZE;
+  {
+    MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
+    const JfrStackTrace* const existing = lookup(stacktrace, index);
+    if (existing != nullptr) {
+      return existing->id();
+    }
+  }
 
   if (!stacktrace.have_lineno()) {
     return 0;
   }
 
-  traceid id = ++_next_id;
-  _table[index] = new JfrStackTrace(id, stacktrace, _table[index]);
-  ++_entries;
+  // Copy the frames outside of the lock, all threads recording
+  // stack traces serialize on it. Another thread may have installed
+  // an equal trace in the meantime, so repeat the lookup before publishing.
+  JfrStackTrace* const entry = new JfrStackTrace(0, stacktrace, nullptr);
+  traceid id = 0;
+  {
+    MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
+    const JfrStackTrace* const existing = lookup(stacktrace, index);
+    if (existing == nullptr) {
+      id = ++_next_id;
+      entry->set_id(id);
+      entry->_next = _table[index];
+      _table[index] = entry;
+      ++_entries;
+      return id;
+    }
+    id = existing->id();
+  }
+  delete entry;
   return id;
 }
 
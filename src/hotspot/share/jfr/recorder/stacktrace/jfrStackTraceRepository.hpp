@@ -69,6 +69,7 @@ class JfrStackTraceRepository : public JfrCHeapObj {
 
   static traceid next_id();
 
+  const JfrStackTrace* lookup(const JfrStackTrace& stacktrace, size_t index) const;
   traceid add_trace(const JfrStackTrace& stacktrace);
   static traceid add(JfrStackTraceRepository& repo, const JfrStackTrace& stacktrace);
   static traceid add(const JfrStackTrace& stacktrace);
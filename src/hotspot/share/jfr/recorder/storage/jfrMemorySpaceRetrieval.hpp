@@ -61,6 +61,63 @@ class JfrMspaceRetrieval {
   }
 };
 
+/*
+ * Variant of JfrMspaceRetrieval for a live list that is not modified after
+ * preallocation, like the global buffers of JfrStorage. Instead of having all
+ * threads start at the list head, contending on the first buffers, each thread
+ * starts scanning at a node derived from its identity and wraps around.
+ */
+template <typename Mspace>
+class JfrMspaceSpreadRetrieval : AllStatic {
+ public:
+  typedef typename Mspace::Node Node;
+  static Node* acquire(Mspace* mspace, bool free_list, Thread* thread, size_t size, bool previous_epoch) {
+    if (free_list) {
+      return JfrMspaceRetrieval<Mspace>::acquire(mspace, free_list, thread, size, previous_epoch);
+    }
+    Node* const head = mspace->live_list(previous_epoch).head();
+    if (head == nullptr) {
+      return nullptr;
+    }
+    Node* const start = start_node(head, thread);
+    Node* node = start;
+    do {
+      if (try_acquire(mspace, node, thread, size)) {
+        return node;
+      }
+      node = node->_next != nullptr ? (Node*)node->_next : head;
+    } while (node != start);
+    return nullptr;
+  }
+ private:
+  static const size_t max_spread = 32;
+
+  static Node* start_node(Node* head, Thread* thread) {
+    const uintptr_t identity = reinterpret_cast<uintptr_t>(thread);
+    size_t skip = static_cast<size_t>((identity >> 4) ^ (identity >> 12)) % max_spread;
+    Node* node = head;
+    while (skip-- > 0) {
+      node = node->_next != nullptr ? (Node*)node->_next : head;
+    }
+    return node;
+  }
+
+  static bool try_acquire(Mspace* mspace, Node* node, Thread* thread, size_t size) {
+    if (node->retired()) {
+      return false;
+    }
+    if (node->try_acquire(thread)) {
+      assert(!node->retired(), "invariant");
+      if (node->free_size() >= size) {
+        return true;
+      }
+      node->set_retired();
+      mspace->register_full(node, thread);
+    }
+    return false;
+  }
+};
+
 template <typename Mspace>
 class JfrMspaceRemoveRetrieval : AllStatic {
  public:
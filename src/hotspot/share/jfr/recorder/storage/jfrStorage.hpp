@@ -38,7 +38,7 @@ class JfrPostBox;
 class JfrStorage;
 class JfrStorageControl;
 
-typedef JfrMemorySpace<JfrStorage, JfrMspaceRetrieval, JfrLinkedList<JfrBuffer> > JfrStorageMspace;
+typedef JfrMemorySpace<JfrStorage, JfrMspaceSpreadRetrieval, JfrLinkedList<JfrBuffer> > JfrStorageMspace;
 typedef JfrMemorySpace<JfrStorage, JfrMspaceRemoveRetrieval, JfrConcurrentQueue<JfrBuffer>, JfrLinkedList<JfrBuffer> > JfrThreadLocalMspace;
 typedef JfrFullStorage<JfrBuffer*, JfrValueNode> JfrFullList;
 
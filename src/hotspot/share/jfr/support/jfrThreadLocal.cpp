@@ -26,6 +26,7 @@
 #include "jfr/jni/jfrJavaSupport.hpp"
 #include "jfr/leakprofiler/checkpoint/objectSampleCheckpoint.hpp"
 #include "jfr/periodic/jfrThreadCPULoadEvent.hpp"
+#include "jfr/periodic/sampling/jfrCPUTimeSampler.hpp"
 #include "jfr/recorder/checkpoint/jfrCheckpointManager.hpp"
 #include "jfr/recorder/checkpoint/types/traceid/jfrOopTraceId.inline.hpp"
 #include "jfr/recorder/jfrRecorder.hpp"
@@ -70,6 +71,10 @@ JfrThreadLocal::JfrThreadLocal() :
   _wallclock_time(os::javaTimeNanos()),
   _stackdepth(0),
   _entering_suspend_flag(0),
+  _pending_cpu_time_samples(0),
+  _cpu_timer(nullptr),
+  _has_cpu_timer(false),
+  _cpu_timer_disabled(false),
   _non_reentrant_nesting(0),
   _vthread_epoch(0),
   _vthread_excluded(false),
@@ -86,6 +91,18 @@ u8 JfrThreadLocal::add_data_lost(u8 value) {
   return _data_lost;
 }
 
+void JfrThreadLocal::add_pending_cpu_time_sample() {
+  Atomic::inc(&_pending_cpu_time_samples);
+}
+
+u4 JfrThreadLocal::take_pending_cpu_time_samples() {
+  return Atomic::xchg(&_pending_cpu_time_samples, (u4)0);
+}
+
+bool JfrThreadLocal::has_pending_cpu_time_samples() const {
+  return Atomic::load(&_pending_cpu_time_samples) != 0;
+}
+
 bool JfrThreadLocal::has_thread_blob() const {
   return _thread.valid();
 }
@@ -130,6 +147,9 @@ void JfrThreadLocal::on_start(Thread* t) {
       send_java_thread_start_event(JavaThread::cast(t));
     }
   }
+  if (t->is_Java_thread()) {
+    JfrCPUTimeSampling::on_javathread_start(JavaThread::cast(t));
+  }
   if (t->jfr_thread_local()->has_cached_stack_trace()) {
     t->jfr_thread_local()->clear_cached_stack_trace();
   }
@@ -224,6 +244,7 @@ void JfrThreadLocal::on_exit(Thread* t) {
     JavaThread* const jt = JavaThread::cast(t);
     send_java_thread_end_event(jt, JfrThreadLocal::jvm_thread_id(jt));
     JfrThreadCPULoadEvent::send_event_for_thread(jt);
+    JfrCPUTimeSampling::on_javathread_exit(jt);
   }
   release(tl, Thread::current()); // because it could be that Thread::current() != t
 }
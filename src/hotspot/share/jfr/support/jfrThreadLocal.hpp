@@ -64,6 +64,10 @@ class JfrThreadLocal {
   jlong _wallclock_time;
   mutable u4 _stackdepth;
   volatile jint _entering_suspend_flag;
+  volatile u4 _pending_cpu_time_samples;
+  void* _cpu_timer;
+  bool _has_cpu_timer;
+  bool _cpu_timer_disabled;
   int32_t _non_reentrant_nesting;
   u2 _vthread_epoch;
   bool _vthread_excluded;
@@ -223,6 +227,39 @@ class JfrThreadLocal {
     return _entering_suspend_flag != 0;
   }
 
+  // CPU-time sampling. Samples are added from the signal handler of
+  // the thread's CPU timer and taken by the sampler thread.
+  void add_pending_cpu_time_sample();
+  u4 take_pending_cpu_time_samples();
+  bool has_pending_cpu_time_samples() const;
+
+  bool has_cpu_timer() const {
+    return _has_cpu_timer;
+  }
+
+  void* cpu_timer() const {
+    assert(_has_cpu_timer, "invariant");
+    return _cpu_timer;
+  }
+
+  void set_cpu_timer(void* timer) {
+    _cpu_timer = timer;
+    _has_cpu_timer = true;
+  }
+
+  void clear_cpu_timer() {
+    _cpu_timer = nullptr;
+    _has_cpu_timer = false;
+  }
+
+  bool is_cpu_timer_disabled() const {
+    return _cpu_timer_disabled;
+  }
+
+  void disable_cpu_timer() {
+    _cpu_timer_disabled = true;
+  }
+
   u8 data_lost() const {
     return _data_lost;
   }
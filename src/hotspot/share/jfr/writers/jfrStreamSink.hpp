@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+
+#ifndef SHARE_JFR_WRITERS_JFRSTREAMSINK_HPP
+#define SHARE_JFR_WRITERS_JFRSTREAMSINK_HPP
+
+#include "jfr/utilities/jfrAllocation.hpp"
+
+//
+// A stream sink receives a copy of every segment a StreamWriterHost
+// writes to its file descriptor, tagged with the stream offset
+// the segment was written at. Offsets are not monotonic, since
+// writers seek back to patch already written data.
+//
+class JfrStreamSink : public JfrCHeapObj {
+ public:
+  virtual ~JfrStreamSink() {}
+  virtual void write(int64_t offset, const u1* buf, intptr_t len) = 0;
+};
+
+#endif // SHARE_JFR_WRITERS_JFRSTREAMSINK_HPP
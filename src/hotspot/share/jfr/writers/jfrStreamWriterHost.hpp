@@ -26,6 +26,7 @@
 #define SHARE_JFR_WRITERS_JFRSTREAMWRITERHOST_HPP
 
 #include "jfr/utilities/jfrTypes.hpp"
+#include "jfr/writers/jfrStreamSink.hpp"
 #include "jfr/writers/jfrMemoryWriterHost.inline.hpp"
 
 template <typename Adapter, typename AP> // Adapter and AllocationPolicy
@@ -35,6 +36,7 @@ class StreamWriterHost : public MemoryWriterHost<Adapter, AP> {
  private:
   int64_t _stream_pos;
   fio_fd _fd;
+  JfrStreamSink* _sink;
   int64_t current_stream_position() const;
 
   void write_bytes(const u1* buf, intptr_t len);
@@ -57,6 +59,7 @@ class StreamWriterHost : public MemoryWriterHost<Adapter, AP> {
   bool is_valid() const;
   void close_fd();
   void reset(fio_fd fd);
+  void set_sink(JfrStreamSink* sink);
 };
 
 #endif // SHARE_JFR_WRITERS_JFRSTREAMWRITERHOST_HPP
@@ -31,17 +31,17 @@
 
 template <typename Adapter, typename AP>
 StreamWriterHost<Adapter, AP>::StreamWriterHost(typename Adapter::StorageType* storage, Thread* thread) :
-  MemoryWriterHost<Adapter, AP>(storage, thread), _stream_pos(0), _fd(invalid_fd) {
+  MemoryWriterHost<Adapter, AP>(storage, thread), _stream_pos(0), _fd(invalid_fd), _sink(nullptr) {
 }
 
 template <typename Adapter, typename AP>
 StreamWriterHost<Adapter, AP>::StreamWriterHost(typename Adapter::StorageType* storage, size_t size) :
-  MemoryWriterHost<Adapter, AP>(storage, size), _stream_pos(0), _fd(invalid_fd) {
+  MemoryWriterHost<Adapter, AP>(storage, size), _stream_pos(0), _fd(invalid_fd), _sink(nullptr) {
 }
 
 template <typename Adapter, typename AP>
 StreamWriterHost<Adapter, AP>::StreamWriterHost(Thread* thread) :
-  MemoryWriterHost<Adapter, AP>(thread), _stream_pos(0), _fd(invalid_fd) {
+  MemoryWriterHost<Adapter, AP>(thread), _stream_pos(0), _fd(invalid_fd), _sink(nullptr) {
 }
 
 template <typename Adapter, typename AP>
@@ -74,6 +74,9 @@ inline void StreamWriterHost<Adapter, AP>::write_bytes(void* dest, const void* b
 template <typename Adapter, typename AP>
 inline void StreamWriterHost<Adapter, AP>::write_bytes(const u1* buf, intptr_t len) {
   assert(len >= 0, "invariant");
+  if (_sink != nullptr) {
+    _sink->write(_stream_pos, buf, len);
+  }
   while (len > 0) {
     const unsigned int nBytes = len > INT_MAX ? INT_MAX : (unsigned int)len;
     const bool successful_write = os::write(_fd, buf, nBytes);
@@ -155,4 +158,9 @@ inline void StreamWriterHost<Adapter, AP>::reset(fio_fd fd) {
   this->hard_reset();
 }
 
+template <typename Adapter, typename AP>
+inline void StreamWriterHost<Adapter, AP>::set_sink(JfrStreamSink* sink) {
+  _sink = sink;
+}
+
 #endif // SHARE_JFR_WRITERS_JFRSTREAMWRITERHOST_INLINE_HPP
@@ -29,6 +29,7 @@
 #include "memory/allocation.hpp"
 #include "memory/resourceArea.hpp"
 #include "runtime/atomic.hpp"
+#include "utilities/spinYield.hpp"
 
 class AsyncLogWriter::Locker : public StackObj {
   Thread*& _holder;
@@ -81,20 +82,92 @@ Thread* AsyncLogWriter::ConsumerLocker::_holder = nullptr;
 const LogDecorations& AsyncLogWriter::None = LogDecorations(LogLevel::Warning, LogTagSetMapping<LogTag::__NO_TAG>::tagset(),
                                       LogDecorators::None);
 
-bool AsyncLogWriter::Buffer::push_back(LogFileStreamOutput* output, const LogDecorations& decorations, const char* msg, const size_t msg_len) {
-  const size_t len = msg_len;
-  const size_t sz = Message::calc_size(len);
+char* AsyncLogWriter::Buffer::reserve(size_t size, size_t headroom, PushResult& result) {
+  size_t pos = Atomic::load(&_pos);
+  while (true) {
+    if ((pos & ClosedBit) != 0) {
+      result = PushResult::Closed;
+      return nullptr;
+    }
+    if (pos + size > _capacity - headroom) {
+      result = PushResult::Full;
+      return nullptr;
+    }
+    size_t witness = Atomic::cmpxchg(&_pos, pos, pos + size);
+    if (witness == pos) {
+      result = PushResult::Success;
+      return _buf + pos;
+    }
+    pos = witness;
+  }
+}
+
+AsyncLogWriter::Buffer::PushResult
+AsyncLogWriter::Buffer::try_push_back(LogFileStreamOutput* output, const LogDecorations& decorations, const char* msg, const size_t msg_len) {
   const bool is_token = output == nullptr;
   // Always leave headroom for the flush token. Pushing a token must succeed.
   const size_t headroom = (!is_token) ? Message::calc_size(0) : 0;
 
-  if (_pos + sz <= (_capacity - headroom)) {
-    new(_buf + _pos) Message(output, decorations, msg, len);
-    _pos += sz;
-    return true;
+  PushResult result;
+  char* p = reserve(Message::calc_size(msg_len), headroom, result);
+  if (p != nullptr) {
+    Message* m = new (p) Message(output, decorations, msg, msg_len);
+    m->commit();
   }
+  return result;
+}
 
-  return false;
+AsyncLogWriter::Buffer::PushResult
+AsyncLogWriter::Buffer::try_push_back(LogFileStreamOutput* output, LogMessageBuffer::Iterator msg_iterator) {
+  size_t size = 0;
+  for (LogMessageBuffer::Iterator it = msg_iterator; !it.is_at_end(); it++) {
+    size += Message::calc_size(strlen(it.message()));
+  }
+  if (size == 0) {
+    return PushResult::Success;
+  }
+
+  PushResult result;
+  char* p = reserve(size, Message::calc_size(0), result);
+  if (p != nullptr) {
+    for (; !msg_iterator.is_at_end(); msg_iterator++) {
+      const char* msg = msg_iterator.message();
+      const size_t msg_len = strlen(msg);
+      Message* m = new (p) Message(output, msg_iterator.decorations(), msg, msg_len);
+      m->commit();
+      p += Message::calc_size(msg_len);
+    }
+  }
+  return result;
+}
+
+void AsyncLogWriter::Buffer::open() {
+  assert((_pos & ClosedBit) != 0, "already open");
+  Atomic::release_store(&_pos, _pos & ~ClosedBit);
+}
+
+void AsyncLogWriter::Buffer::close() {
+  Atomic::fetch_then_or(&_pos, ClosedBit);
+}
+
+void AsyncLogWriter::Buffer::reset() {
+  const size_t pos = Atomic::load(&_pos);
+  const size_t used = pos & ~ClosedBit;
+  memset(_buf + start(), 0, used - start());
+  Atomic::release_store(&_pos, start() | (pos & ClosedBit));
+}
+
+const AsyncLogWriter::Message* AsyncLogWriter::Buffer::Iterator::next() {
+  assert(hasNext(), "sanity check");
+  auto msg = reinterpret_cast<Message*>(_buf._buf + _curr);
+  // The space has been reserved, but the producer may not have finished
+  // copying the message yet.
+  SpinYield spin;
+  while (!msg->is_committed()) {
+    spin.wait();
+  }
+  _curr = MIN2(_curr + msg->size(), _buf.end());
+  return msg;
 }
 
 void AsyncLogWriter::Buffer::push_flush_token() {
@@ -111,8 +184,10 @@ void AsyncLogWriter::enqueue_locked(LogFileStreamOutput* output, const LogDecora
   void* stalled_message = nullptr;
   {
     ConsumerLocker clocker;
+    // The consumer may have swapped buffers since the lock-free attempt failed.
+    // The current buffer is always open while the consumer lock is held.
     if (_buffer->push_back(output, decorations, msg, msg_len)) {
-      _data_available = true;
+      Atomic::store(&_data_available, true);
       clocker.notify();
       return;
     }
@@ -126,7 +201,7 @@ void AsyncLogWriter::enqueue_locked(LogFileStreamOutput* output, const LogDecora
         return;
       }
       _stalled_message = new (stalled_message) Message(output, decorations, msg, msg_len);
-      _data_available = true;
+      Atomic::store(&_data_available, true);
       clocker.notify();
       // Note: we still hold the producer lock so cannot race against other threads trying to log a message
       while (_stalled_message != nullptr) {
@@ -178,11 +253,53 @@ bool AsyncLogWriter::is_enqueue_allowed() {
   return true;
 }
 
+// Wakes up the consumer unless another producer has already done so since it last took a buffer.
+void AsyncLogWriter::notify_data_available() {
+  if (!Atomic::load(&_data_available) && !Atomic::cmpxchg(&_data_available, false, true)) {
+    ConsumerLocker clocker;
+    clocker.notify();
+  }
+}
+
+// Tries to push into the current buffer without taking any lock. Returns false if the
+// buffer is full, in which case the caller falls back to the locked path.
+template <typename PUSH>
+bool AsyncLogWriter::enqueue_lock_free(PUSH push) {
+#ifdef ASSERT
+  if (TestingAsyncLoggingDeathTest || TestingAsyncLoggingDeathTestNoCrash) {
+    // The recursive log induced by the death tests is only detected on the locked path.
+    return false;
+  }
+#endif // ASSERT
+
+  while (true) {
+    Buffer* buffer = Atomic::load_acquire(&_buffer);
+    switch (push(buffer)) {
+      case Buffer::PushResult::Success:
+        notify_data_available();
+        return true;
+      case Buffer::PushResult::Full:
+        return false;
+      case Buffer::PushResult::Closed:
+        // The consumer is swapping buffers, retry with the new one.
+        break;
+    }
+  }
+}
+
 bool AsyncLogWriter::enqueue(LogFileStreamOutput& output, const LogDecorations& decorations, const char* msg) {
   if (!is_enqueue_allowed()) {
     return false;
   }
 
+  assert(msg != nullptr, "enqueuing a null message!");
+  const size_t msg_len = strlen(msg);
+  if (AsyncLogWriter::instance()->enqueue_lock_free([&](Buffer* buffer) {
+        return buffer->try_push_back(&output, decorations, msg, msg_len);
+      })) {
+    return true;
+  }
+
   ProducerLocker plocker;
 
 #ifdef ASSERT
@@ -203,6 +320,12 @@ bool AsyncLogWriter::enqueue(LogFileStreamOutput& output, LogMessageBuffer::Iter
   }
 
   // If we get here we know the AsyncLogWriter is initialized.
+  if (AsyncLogWriter::instance()->enqueue_lock_free([&](Buffer* buffer) {
+        return buffer->try_push_back(&output, msg_iterator);
+      })) {
+    return true;
+  }
+
   ProducerLocker plocker;
   for (; !msg_iterator.is_at_end(); msg_iterator++) {
     AsyncLogWriter::instance()->enqueue_locked(&output, msg_iterator.decorations(), msg_iterator.message());
@@ -222,6 +345,7 @@ AsyncLogWriter::AsyncLogWriter()
   size_t size = AsyncLogBufferSize / 2;
   _buffer = new Buffer(size);
   _buffer_staging = new Buffer(size);
+  _buffer_staging->close();
   log_info(logging)("AsyncLogBuffer estimates memory use: %zu bytes", size * 2);
   if (os::create_thread(this, os::asynclog_thread)) {
     _initialized = true;
@@ -232,18 +356,30 @@ AsyncLogWriter::AsyncLogWriter()
 
 bool AsyncLogWriter::write(AsyncLogMap<AnyObj::RESOURCE_AREA>& snapshot) {
   int req = 0;
+  // Consecutive messages to the same output are written as one batch and
+  // flushed together, instead of flushing the stream after every message.
+  LogFileStreamOutput* pending = nullptr;
   auto it = _buffer_staging->iterator();
   while (it.hasNext()) {
     const Message* e = it.next();
 
     if (!e->is_token()){
-      e->output()->write_blocking(e->decorations(), e->message());
+      if (e->output() != pending) {
+        if (pending != nullptr) {
+          pending->flush_blocking();
+        }
+        pending = e->output();
+      }
+      e->output()->write_blocking_unflushed(e->decorations(), e->message());
     } else {
       // This is a flush token. Record that we found it and then
       // signal the flushing thread after the loop.
       req++;
     }
   }
+  if (pending != nullptr) {
+    pending->flush_blocking();
+  }
 
   LogDecorations decorations(LogLevel::Warning, LogTagSetMapping<LogTag::__NO_TAG>::tagset(),
                              LogDecorators::All);
@@ -269,14 +405,21 @@ void AsyncLogWriter::run() {
     AsyncLogMap<AnyObj::RESOURCE_AREA> snapshot;
     {
       ConsumerLocker clocker;
-      while (!_data_available) {
+      while (!Atomic::load(&_data_available)) {
         clocker.wait();
       }
+      // Cleared before the swap, so that a producer pushing into the new
+      // buffer is guaranteed to wake us up again.
+      Atomic::store(&_data_available, false);
 
       // Only doing a swap and statistics under the lock to
       // guarantee that I/O jobs don't block logsites.
-      _buffer_staging->reset();
-      swap(_buffer, _buffer_staging);
+      // The staging buffer was reset after it was last written.
+      Buffer* full = _buffer;
+      _buffer_staging->open();
+      Atomic::release_store(&_buffer, _buffer_staging);
+      _buffer_staging = full;
+      _buffer_staging->close();
 
       // move counters to snapshot and reset them.
       _stats.iterate([&] (LogFileStreamOutput* output, uint32_t& counter) {
@@ -287,10 +430,10 @@ void AsyncLogWriter::run() {
         }
         return true;
       });
-      _data_available = false;
     }
 
     bool saw_flush_token = write(snapshot);
+    _buffer_staging->reset();
 
     // Any stalled message must be written *after* the buffer has been written.
     // This is because we try hard to output messages in program-order.
@@ -347,7 +490,7 @@ void AsyncLogWriter::flush() {
       ConsumerLocker clocker;
       // Push directly in-case we are at logical max capacity, as this must not get dropped.
       _instance->_buffer->push_flush_token();
-      _instance->_data_available = true;
+      Atomic::store(&_instance->_data_available, true);
       clocker.notify();
     }
 
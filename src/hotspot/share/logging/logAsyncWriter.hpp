@@ -28,6 +28,7 @@
 #include "logging/logDecorations.hpp"
 #include "logging/logMessageBuffer.hpp"
 #include "memory/allocation.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/mutex.hpp"
 #include "runtime/os.inline.hpp"
 #include "runtime/nonJavaThread.hpp"
@@ -53,6 +54,9 @@ class LogFileStreamOutput;
 // enqueue() is the basic operation of AsyncLogWriter. Two overloading versions of it are provided to match LogOutput::write().
 // They are both MT-safe and non-blocking. Derived classes of LogOutput can invoke the corresponding enqueue() in write() and
 // return 0. AsyncLogWriter is responsible of copying necessary data.
+// Producers reserve space in the current buffer with a CAS and copy their message in without taking any lock. Only when
+// the buffer is full do they fall back to the producer and consumer locks, to either drop the message or stall.
+// Messages are consumed in reservation order, so the messages of each thread are written in program order.
 //
 // flush() ensures that all pending messages have been written out before it returns. It is not MT-safe in itself. When users
 // change the logging configuration via jcmd, LogConfiguration::configure_output() calls flush() under the protection of the
@@ -60,6 +64,7 @@ class LogFileStreamOutput;
 class AsyncLogWriter : public NonJavaThread {
   friend class AsyncLogTest;
   friend class AsyncLogTest_logBuffer_vm_Test;
+  friend class AsyncLogTest_closedBuffer_vm_Test;
   class Locker;
   class ProducerLocker;
   class ConsumerLocker;
@@ -87,6 +92,9 @@ class AsyncLogWriter : public NonJavaThread {
     ~Message() = delete;
     LogFileStreamOutput* const _output;
     const LogDecorations _decorations;
+    // Not initialized by the constructor. Buffers are zeroed before reuse, so the consumer
+    // sees false until the producer has finished constructing the message.
+    volatile bool _committed;
    public:
     // msglen excludes NUL-byte
     Message(LogFileStreamOutput* output, const LogDecorations& decorations, const char* msg, const size_t msglen)
@@ -104,6 +112,9 @@ class AsyncLogWriter : public NonJavaThread {
       return calc_size(strlen(message()));
     }
 
+    void commit() { Atomic::release_store(&_committed, true); }
+    bool is_committed() const { return Atomic::load_acquire(&_committed); }
+
     inline bool is_token() const { return _output == nullptr; }
     LogFileStreamOutput* output() const { return _output; }
     const LogDecorations& decorations() const { return _decorations; }
@@ -111,15 +122,27 @@ class AsyncLogWriter : public NonJavaThread {
   };
 
   class Buffer : public CHeapObj<mtLogging> {
+   public:
+    enum class PushResult { Success, Full, Closed };
+
+   private:
+    // Set in _pos while the buffer does not accept messages, i.e. while it is not the current buffer.
+    static const size_t ClosedBit = ~(SIZE_MAX >> 1);
+
     char* _buf;
-    size_t _pos;
+    volatile size_t _pos;
     const size_t _capacity;
 
+    // Ensure _pos is Message-aligned
+    size_t start() const { return align_up(_buf, alignof(Message)) - _buf; }
+    size_t end() const { return Atomic::load_acquire(&_pos) & ~ClosedBit; }
+    char* reserve(size_t size, size_t headroom, PushResult& result);
+
    public:
     Buffer(size_t capacity) :  _pos(0), _capacity(capacity) {
       _buf = NEW_C_HEAP_ARRAY(char, capacity, mtLogging);
-      // Ensure _pos is Message-aligned
-      _pos = align_up(_buf, alignof(Message)) - _buf;
+      memset(_buf, 0, capacity);
+      _pos = start();
       assert(capacity >= Message::calc_size(0), "capcity must be great a token size");
     }
 
@@ -128,30 +151,32 @@ class AsyncLogWriter : public NonJavaThread {
     }
 
     void push_flush_token();
-    bool push_back(LogFileStreamOutput* output, const LogDecorations& decorations, const char* msg, const size_t msg_len);
-
-    void reset() {
-      // Ensure _pos is Message-aligned
-      _pos = align_up(_buf, alignof(Message)) - _buf;
+    PushResult try_push_back(LogFileStreamOutput* output, const LogDecorations& decorations, const char* msg, const size_t msg_len);
+    // Pushes all lines of msg_iterator as one contiguous reservation, so they cannot be interleaved with other messages.
+    PushResult try_push_back(LogFileStreamOutput* output, LogMessageBuffer::Iterator msg_iterator);
+    bool push_back(LogFileStreamOutput* output, const LogDecorations& decorations, const char* msg, const size_t msg_len) {
+      return try_push_back(output, decorations, msg, msg_len) == PushResult::Success;
     }
 
+    // Only the consumer opens and closes buffers. When close() returns no new space can be reserved,
+    // but producers may still be copying into already reserved space; the iterator waits for them.
+    void open();
+    void close();
+    // Zeroes the used part of the buffer and rewinds it, leaving it open or closed as it was.
+    void reset();
+
     class Iterator {
       const Buffer& _buf;
       size_t _curr;
 
     public:
-      Iterator(const Buffer& buffer): _buf(buffer), _curr(0) {}
+      Iterator(const Buffer& buffer): _buf(buffer), _curr(buffer.start()) {}
 
       bool hasNext() const {
-        return _curr < _buf._pos;
+        return _curr < _buf.end();
       }
 
-      const Message* next() {
-        assert(hasNext(), "sanity check");
-        auto msg = reinterpret_cast<Message*>(_buf._buf + _curr);
-        _curr = MIN2(_curr + msg->size(), _buf._pos);
-        return msg;
-      }
+      const Message* next();
     };
 
     Iterator iterator() const {
@@ -167,13 +192,14 @@ class AsyncLogWriter : public NonJavaThread {
   // This allows a producer to await progress from the consumer thread (by only releasing the producer lock)), whilst preventing all other producers from progressing.
   PlatformMonitor _producer_lock;
   PlatformMonitor _consumer_lock;
-  bool _data_available;
+  volatile bool _data_available;
   // _initialized is set to true if the constructor succeeds
   volatile bool _initialized;
   AsyncLogMap<AnyObj::C_HEAP> _stats;
 
   // ping-pong buffers
-  Buffer* _buffer;
+  // _buffer is read by producers without a lock. It is only changed by the consumer while holding the consumer lock.
+  Buffer* volatile _buffer;
   Buffer* _buffer_staging;
 
   // Stalled message
@@ -185,6 +211,9 @@ class AsyncLogWriter : public NonJavaThread {
   static const LogDecorations& None;
 
   AsyncLogWriter();
+  template <typename PUSH>
+  bool enqueue_lock_free(PUSH push);
+  void notify_data_available();
   void enqueue_locked(LogFileStreamOutput* output, const LogDecorations& decorations, const char* msg);
   bool write(AsyncLogMap<AnyObj::RESOURCE_AREA>& snapshot);
   void run() override;
@@ -0,0 +1,418 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+#include "logging/logBinaryFileOutput.hpp"
+#include "logging/logDecorations.hpp"
+#include "logging/logMessageBuffer.hpp"
+#include "logging/logTagSet.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/os.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/permitForbiddenFunctions.hpp"
+
+// File format
+//
+// All values are in the byte order of the writing machine; the byte order
+// marker in the header tells the decoder which one it is.
+//
+// Header, at the start of every file (including rotated ones):
+//   u1[8] magic          "HSULBIN" followed by NUL
+//   u4    version        FormatVersion
+//   u4    byte order     0x01020304
+//   u1    sizeof(long)
+//   u1    sizeof(void*)
+//   u2    unused
+//   u8    frequency      os::elapsed_frequency(), ticks per second
+//
+// Followed by records, consisting of a u1 kind, a u4 payload size and the payload:
+//   DefineString:  u4 id, the string (no NUL terminator)
+//   Message:       u1 level, u4 tags id, u8 ticks, u4 format id,
+//                  u4 prefix size, the prefix, the arguments
+//   Text:          u1 level, u4 tags id, u8 ticks, the message
+//
+// Ticks are os::elapsed_counter(), i.e. time since VM start. Ids refer to
+// strings defined earlier in the same file; tags ids to the label of the
+// tagset ("gc,heap") and format ids to the printf format string.
+//
+// The arguments of a Message record are stored in the order the format string
+// consumes them, including '*' widths and precisions:
+//   Integers, characters, pointers:  8 bytes, signed values sign-extended
+//   Floating point:                  8 byte IEEE double
+//   Strings:                         u4 size (0xffffffff for null), the string
+
+static const char  Magic[8] = "HSULBIN";
+static const u4    FormatVersion = 1;
+static const u4    ByteOrderMarker = 0x01020304;
+
+enum RecordKind : u1 {
+  DefineString = 1,
+  Message      = 2,
+  Text         = 3
+};
+
+static const u4 NullStringSize = 0xffffffff;
+
+const char* const LogBinaryFileOutput::Prefix = "binfile=";
+const char* const LogBinaryFileOutput::FileOpenMode = "ab";
+volatile int LogBinaryFileOutput::_instances = 0;
+
+// Fixed size buffer for assembling a record, to avoid any allocation on the logging path.
+// Running out of space is recorded, and the caller then falls back to a text record.
+class LogBinaryBuffer : public StackObj {
+  static const size_t Capacity = 1024;
+  u1 _buf[Capacity];
+  size_t _pos;
+  bool _overflow;
+
+ public:
+  LogBinaryBuffer() : _pos(0), _overflow(false) {}
+
+  void put(const void* data, size_t size) {
+    if (_overflow || size > Capacity - _pos) {
+      _overflow = true;
+      return;
+    }
+    memcpy(_buf + _pos, data, size);
+    _pos += size;
+  }
+
+  void put_u1(u1 value) { put(&value, sizeof(value)); }
+  void put_u4(u4 value) { put(&value, sizeof(value)); }
+  void put_u8(u8 value) { put(&value, sizeof(value)); }
+
+  void put_string(const char* str) {
+    if (str == nullptr) {
+      put_u4(NullStringSize);
+    } else {
+      const size_t len = strlen(str);
+      put_u4(checked_cast<u4>(len));
+      put(str, len);
+    }
+  }
+
+  // The payload may include data written after the contents of this buffer.
+  void begin_record(RecordKind kind, size_t payload_size) {
+    put_u1(kind);
+    put_u4(checked_cast<u4>(payload_size));
+  }
+
+  bool overflow() const { return _overflow; }
+  const u1* data() const { return _buf; }
+  size_t size() const  { return _pos; }
+};
+
+// Copies the arguments consumed by fmt from args into buf. Returns false if fmt
+// contains a conversion that can't be stored, e.g. %n or long double.
+static bool encode_arguments(const char* fmt, va_list args, LogBinaryBuffer& buf) {
+  enum Length { None, Char, Short, Long, LongLong, Size, IntMax, PtrDiff, LongDouble };
+
+  const char* p = fmt;
+  while ((p = strchr(p, '%')) != nullptr) {
+    p++;
+    if (*p == '%') {
+      p++;
+      continue;
+    }
+    while (*p != '\0' && strchr("-+ #0'", *p) != nullptr) {
+      p++;
+    }
+    if (*p == '*') {
+      buf.put_u8((u8)(s8)va_arg(args, int));
+      p++;
+    } else {
+      while (isdigit(*p)) p++;
+    }
+    if (*p == '.') {
+      p++;
+      if (*p == '*') {
+        buf.put_u8((u8)(s8)va_arg(args, int));
+        p++;
+      } else {
+        while (isdigit(*p)) p++;
+      }
+    }
+
+    Length length = None;
+    switch (*p) {
+      case 'h': length = Short;    p++; if (*p == 'h') { length = Char;     p++; } break;
+      case 'l': length = Long;     p++; if (*p == 'l') { length = LongLong; p++; } break;
+      case 'z': length = Size;       p++; break;
+      case 'j': length = IntMax;     p++; break;
+      case 't': length = PtrDiff;    p++; break;
+      case 'L': length = LongDouble; p++; break;
+      default: break;
+    }
+
+    switch (*p) {
+      case 'd':
+      case 'i':
+        switch (length) {
+          case None:
+          case Char:
+          case Short:    buf.put_u8((u8)(s8)va_arg(args, int)); break;
+          case Long:     buf.put_u8((u8)(s8)va_arg(args, long)); break;
+          case LongLong: buf.put_u8((u8)(s8)va_arg(args, long long)); break;
+          case Size:     buf.put_u8((u8)(s8)va_arg(args, ssize_t)); break;
+          case IntMax:   buf.put_u8((u8)(s8)va_arg(args, intmax_t)); break;
+          case PtrDiff:  buf.put_u8((u8)(s8)va_arg(args, ptrdiff_t)); break;
+          default:       return false;
+        }
+        break;
+      case 'u':
+      case 'o':
+      case 'x':
+      case 'X':
+        switch (length) {
+          case None:
+          case Char:
+          case Short:    buf.put_u8((u8)va_arg(args, unsigned int)); break;
+          case Long:     buf.put_u8((u8)va_arg(args, unsigned long)); break;
+          case LongLong: buf.put_u8((u8)va_arg(args, unsigned long long)); break;
+          case Size:     buf.put_u8((u8)va_arg(args, size_t)); break;
+          case IntMax:   buf.put_u8((u8)va_arg(args, uintmax_t)); break;
+          case PtrDiff:  buf.put_u8((u8)va_arg(args, ptrdiff_t)); break;
+          default:       return false;
+        }
+        break;
+      case 'c':
+        if (length != None) return false;
+        buf.put_u8((u8)(s8)va_arg(args, int));
+        break;
+      case 's':
+        if (length != None) return false;
+        buf.put_string(va_arg(args, const char*));
+        break;
+      case 'p':
+        buf.put_u8((u8)p2u(va_arg(args, void*)));
+        break;
+      case 'e': case 'E':
+      case 'f': case 'F':
+      case 'g': case 'G':
+      case 'a': case 'A': {
+        if (length == LongDouble) return false;
+        double value = va_arg(args, double);
+        buf.put(&value, sizeof(value));
+        break;
+      }
+      default:
+        // %n, wide characters, or a malformed format.
+        return false;
+    }
+    p++;
+  }
+  return !buf.overflow();
+}
+
+LogBinaryFileOutput::LogBinaryFileOutput(const char* name)
+  : LogFileOutput(name, Prefix, FileOpenMode), _strings(), _next_string_id(0), _file(0) {
+  Atomic::inc(&_instances);
+}
+
+LogBinaryFileOutput::~LogBinaryFileOutput() {
+  Atomic::dec(&_instances);
+}
+
+bool LogBinaryFileOutput::write_bytes(const void* data, size_t size) {
+  if (fwrite(data, 1, size, _stream) != size) {
+    return false;
+  }
+  _current_size += size;
+  return true;
+}
+
+void LogBinaryFileOutput::file_opened() {
+  // Strings have to be defined again in the new file.
+  _file++;
+
+  LogBinaryBuffer header;
+  header.put(Magic, sizeof(Magic));
+  header.put_u4(FormatVersion);
+  header.put_u4(ByteOrderMarker);
+  header.put_u1(sizeof(long));
+  header.put_u1(sizeof(void*));
+  header.put_u1(0); // unused
+  header.put_u1(0);
+  header.put_u8((u8)os::elapsed_frequency());
+  write_bytes(header.data(), header.size());
+}
+
+// Must be called with the rotation lock held.
+u4 LogBinaryFileOutput::string_id(const void* key, const char* str) {
+  bool created = false;
+  StringId* entry = _strings.put_if_absent(key, StringId{_next_string_id, _file}, &created);
+  if (created) {
+    _next_string_id++;
+  } else if (entry->_file == _file) {
+    return entry->_id;
+  }
+  entry->_file = _file;
+
+  const size_t len = strlen(str);
+  LogBinaryBuffer record;
+  record.begin_record(DefineString, 4 + len);
+  record.put_u4(entry->_id);
+  write_bytes(record.data(), record.size());
+  write_bytes(str, len);
+  return entry->_id;
+}
+
+u4 LogBinaryFileOutput::tagset_id(const LogTagSet& tagset) {
+  char label[256];
+  tagset.label(label, sizeof(label));
+  return string_id(&tagset, label);
+}
+
+// Must be called with the rotation lock held.
+int LogBinaryFileOutput::write_text(LogLevelType level, const LogTagSet& tagset, const char* msg) {
+  const u4 tags = tagset_id(tagset);
+  const size_t len = strlen(msg);
+  LogBinaryBuffer record;
+  record.begin_record(Text, 1 + 4 + 8 + len);
+  record.put_u1(static_cast<u1>(level));
+  record.put_u4(tags);
+  record.put_u8((u8)os::elapsed_counter());
+  if (!write_bytes(record.data(), record.size()) || !write_bytes(msg, len)) {
+    return -1;
+  }
+  return static_cast<int>(record.size() + len);
+}
+
+void LogBinaryFileOutput::flush_if_urgent(LogLevelType level) {
+  if (level >= LogLevel::Warning) {
+    fflush(_stream);
+  }
+}
+
+// Must be called with the rotation lock held. Used for messages that can't be encoded.
+// As in LogTagSet::vwrite, long messages use malloc rather than os::malloc since NMT may log.
+void LogBinaryFileOutput::write_formatted(LogLevelType level, const LogTagSet& tagset, const char* prefix,
+                                          const char* fmt, va_list args) {
+  char buf[512];
+  va_list saved_args;           // For re-format on buf overflow.
+  va_copy(saved_args, args);
+  const size_t prefix_len = strlen(prefix);
+  const size_t buf_prefix_len = MIN2(prefix_len, sizeof(buf) - 1);
+  memcpy(buf, prefix, buf_prefix_len);
+  buf[buf_prefix_len] = '\0';
+  int ret = os::vsnprintf(buf + buf_prefix_len, sizeof(buf) - buf_prefix_len, fmt, args);
+  if (ret < 0 || prefix_len + ret < sizeof(buf)) {
+    write_text(level, tagset, buf);
+  } else {
+    const size_t newbuf_len = prefix_len + ret + 1;
+    char* newbuf = (char*)permit_forbidden_function::malloc(newbuf_len);
+    if (newbuf != nullptr) {
+      memcpy(newbuf, prefix, prefix_len);
+      os::vsnprintf(newbuf + prefix_len, newbuf_len - prefix_len, fmt, saved_args);
+      write_text(level, tagset, newbuf);
+      permit_forbidden_function::free(newbuf);
+    } else {
+      // Native OOM, write the truncated message.
+      write_text(level, tagset, buf);
+    }
+  }
+  va_end(saved_args);
+}
+
+void LogBinaryFileOutput::write(LogLevelType level, const LogTagSet& tagset, const char* prefix,
+                                const char* fmt, va_list args) {
+  // The arguments are encoded before taking the lock, the ids are filled in below.
+  LogBinaryBuffer arguments;
+  va_list encoded_args;
+  va_copy(encoded_args, args);
+  const bool encoded = encode_arguments(fmt, encoded_args, arguments);
+  va_end(encoded_args);
+
+  RotationLocker lock(_rotation_semaphore);
+  if (_stream == nullptr) {
+    // An error has occurred with this output, avoid writing to it.
+    return;
+  }
+
+  bool written = false;
+  if (encoded) {
+    const u4 tags = tagset_id(tagset);
+    const u4 format = string_id(fmt, fmt);
+    const size_t prefix_len = strlen(prefix);
+    LogBinaryBuffer record;
+    record.begin_record(Message, 1 + 4 + 8 + 4 + 4 + prefix_len + arguments.size());
+    record.put_u1(static_cast<u1>(level));
+    record.put_u4(tags);
+    record.put_u8((u8)os::elapsed_counter());
+    record.put_u4(format);
+    record.put_u4(checked_cast<u4>(prefix_len));
+    record.put(prefix, prefix_len);
+    if (!record.overflow()) {
+      write_bytes(record.data(), record.size());
+      write_bytes(arguments.data(), arguments.size());
+      written = true;
+    }
+  }
+  if (!written) {
+    write_formatted(level, tagset, prefix, fmt, args);
+  }
+
+  flush_if_urgent(level);
+  if (should_rotate()) {
+    rotate();
+  }
+}
+
+int LogBinaryFileOutput::write(const LogDecorations& decorations, const char* msg) {
+  RotationLocker lock(_rotation_semaphore);
+  if (_stream == nullptr) {
+    // An error has occurred with this output, avoid writing to it.
+    return 0;
+  }
+
+  int written = write_text(decorations.level(), decorations.tagset(), msg);
+  flush_if_urgent(decorations.level());
+  if (should_rotate()) {
+    rotate();
+  }
+  return written;
+}
+
+int LogBinaryFileOutput::write(LogMessageBuffer::Iterator msg_iterator) {
+  RotationLocker lock(_rotation_semaphore);
+  if (_stream == nullptr) {
+    // An error has occurred with this output, avoid writing to it.
+    return 0;
+  }
+
+  int written = 0;
+  LogLevelType max_level = LogLevel::First;
+  for (; !msg_iterator.is_at_end(); msg_iterator++) {
+    const LogDecorations& decorations = msg_iterator.decorations();
+    int ret = write_text(decorations.level(), decorations.tagset(), msg_iterator.message());
+    if (ret < 0) {
+      return -1;
+    }
+    written += ret;
+    max_level = MAX2(max_level, decorations.level());
+  }
+  flush_if_urgent(max_level);
+  if (should_rotate()) {
+    rotate();
+  }
+  return written;
+}
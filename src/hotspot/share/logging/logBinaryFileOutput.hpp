@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+#ifndef SHARE_LOGGING_LOGBINARYFILEOUTPUT_HPP
+#define SHARE_LOGGING_LOGBINARYFILEOUTPUT_HPP
+
+#include "logging/logFileOutput.hpp"
+#include "logging/logLevel.hpp"
+#include "runtime/atomic.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/resourceHash.hpp"
+
+class LogTagSet;
+
+// A log file output that writes compact binary records instead of text.
+//
+// Messages logged through LogTagSet::vwrite (i.e. the log_xxx(tags)(fmt, ...)
+// macros) are not formatted; the record holds the level, tagset, timestamp,
+// an id for the format string and the raw arguments. Format strings and tagset
+// labels are written once per file, the first time they are used. Messages that
+// are already formatted text (LogStream, LogMessage), or whose format contains
+// conversions that can't be captured, are written as text records.
+//
+// Decorators are ignored: every record carries the uptime, level and tags.
+// The file does not go through async logging and is only flushed by stdio when
+// its buffer fills up, for warnings and errors, and when the file is closed.
+//
+// The format is described in logBinaryFileOutput.cpp and decoded by
+// src/utils/LogBinaryDecoder.
+class LogBinaryFileOutput : public LogFileOutput {
+ private:
+  static const char* const FileOpenMode;
+  static volatile int _instances;
+
+  struct StringId {
+    u4 _id;
+    // The file in which the string was last defined, see file_opened().
+    u4 _file;
+  };
+  ResourceHashtable<const void*, StringId, 1031, AnyObj::C_HEAP, mtLogging> _strings;
+  u4 _next_string_id;
+  u4 _file;
+
+  bool write_bytes(const void* data, size_t size);
+  u4 string_id(const void* key, const char* str);
+  u4 tagset_id(const LogTagSet& tagset);
+  int write_text(LogLevelType level, const LogTagSet& tagset, const char* msg);
+  void write_formatted(LogLevelType level, const LogTagSet& tagset, const char* prefix, const char* fmt, va_list args);
+  void flush_if_urgent(LogLevelType level);
+
+ protected:
+  void file_opened() override;
+
+ public:
+  static const char* const Prefix;
+
+  LogBinaryFileOutput(const char* name);
+  ~LogBinaryFileOutput() override;
+
+  // True while any binary output exists, so that LogTagSet::vwrite only looks for them when needed.
+  static bool is_in_use() {
+    return Atomic::load(&_instances) > 0;
+  }
+
+  bool is_binary() const override {
+    return true;
+  }
+
+  // Write an unformatted message. prefix is the output of the tagset's prefix writer.
+  void write(LogLevelType level, const LogTagSet& tagset, const char* prefix, const char* fmt, va_list args);
+
+  int write(const LogDecorations& decorations, const char* msg) override;
+  int write(LogMessageBuffer::Iterator msg_iterator) override;
+};
+
+#endif // SHARE_LOGGING_LOGBINARYFILEOUTPUT_HPP
@@ -24,6 +24,7 @@
 #include "jvm.h"
 #include "logging/log.hpp"
 #include "logging/logAsyncWriter.hpp"
+#include "logging/logBinaryFileOutput.hpp"
 #include "logging/logConfiguration.hpp"
 #include "logging/logDecorations.hpp"
 #include "logging/logDecorators.hpp"
@@ -190,6 +191,8 @@ LogOutput* LogConfiguration::new_output(const char* name,
   LogOutput* output;
   if (strncmp(name, LogFileOutput::Prefix, strlen(LogFileOutput::Prefix)) == 0) {
     output = new LogFileOutput(name);
+  } else if (strncmp(name, LogBinaryFileOutput::Prefix, strlen(LogBinaryFileOutput::Prefix)) == 0) {
+    output = new LogBinaryFileOutput(name);
   } else {
     errstream->print_cr("Unsupported log output type: %s", name);
     return nullptr;
@@ -632,6 +635,9 @@ void LogConfiguration::print_command_line_help(outputStream* out) {
   out->print_cr(" stdout/stderr");
   out->print_cr(" file=<filename>");
   out->print_cr("  If the filename contains %%p, %%t and/or %%hn, they will expand to the JVM's PID, startup timestamp and host name, respectively.");
+  out->print_cr(" binfile=<filename>");
+  out->print_cr("  Like file=, but messages are written as binary records holding the unformatted message and its arguments."
+                " Decorators are ignored. Use src/utils/LogBinaryDecoder to convert the file to text.");
   out->cr();
 
   out->print_cr("Available log output options:");
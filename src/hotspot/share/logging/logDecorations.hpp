@@ -64,6 +64,14 @@ class LogDecorations {
     _level = level;
   }
 
+  LogLevelType level() const {
+    return _level;
+  }
+
+  const LogTagSet& tagset() const {
+    return _tagset;
+  }
+
   void print_decoration(LogDecorators::Decorator decorator, outputStream* st) const;
   const char* decoration(LogDecorators::Decorator decorator, char* buf, size_t buflen) const;
 
@@ -44,12 +44,16 @@ char        LogFileOutput::_pid_str[PidBufferSize];
 char        LogFileOutput::_vm_start_time_str[StartTimeBufferSize];
 
 LogFileOutput::LogFileOutput(const char* name)
+    : LogFileOutput(name, Prefix, FileOpenMode) {
+}
+
+LogFileOutput::LogFileOutput(const char* name, const char* prefix, const char* file_open_mode)
     : LogFileStreamOutput(nullptr), _name(os::strdup_check_oom(name, mtLogging)),
-      _file_name(nullptr), _archive_name(nullptr), _current_file(0),
+      _file_open_mode(file_open_mode), _file_name(nullptr), _archive_name(nullptr), _current_file(0),
       _file_count(DefaultFileCount), _is_default_file_count(true), _archive_name_len(0),
       _rotate_size(DefaultFileSize), _current_size(0), _rotation_semaphore(1) {
-  assert(strstr(name, Prefix) == name, "invalid output name '%s': missing prefix: %s", name, Prefix);
-  _file_name = make_file_name(name + strlen(Prefix), _pid_str, _vm_start_time_str);
+  assert(strstr(name, prefix) == name, "invalid output name '%s': missing prefix: %s", name, prefix);
+  _file_name = make_file_name(name + strlen(prefix), _pid_str, _vm_start_time_str);
 }
 
 const char* LogFileOutput::cur_log_file_name() {
@@ -237,7 +241,7 @@ bool LogFileOutput::initialize(const char* options, outputStream* errstream) {
     increment_file_count();
   }
 
-  _stream = os::fopen(_file_name, FileOpenMode);
+  _stream = os::fopen(_file_name, _file_open_mode);
   if (_stream == nullptr) {
     errstream->print_cr("Error opening log file '%s': %s",
                         _file_name, os::strerror(errno));
@@ -248,23 +252,11 @@ bool LogFileOutput::initialize(const char* options, outputStream* errstream) {
     log_trace(logging)("Truncating log file");
     os::ftruncate(os::get_fileno(_stream), 0);
   }
+  file_opened();
 
   return true;
 }
 
-class RotationLocker : public StackObj {
-  Semaphore& _sem;
-
- public:
-  RotationLocker(Semaphore& sem) : _sem(sem) {
-    sem.wait();
-  }
-
-  ~RotationLocker() {
-    _sem.signal();
-  }
-};
-
 int LogFileOutput::write_blocking(const LogDecorations& decorations, const char* msg) {
   RotationLocker lock(_rotation_semaphore);
   if (_stream == nullptr) {
@@ -286,6 +278,37 @@ int LogFileOutput::write_blocking(const LogDecorations& decorations, const char*
   return written;
 }
 
+int LogFileOutput::write_blocking_unflushed(const LogDecorations& decorations, const char* msg) {
+  RotationLocker lock(_rotation_semaphore);
+  if (_stream == nullptr) {
+    // An error has occurred with this output, avoid writing to it.
+    return 0;
+  }
+
+  int written = write_internal(decorations, msg);
+  if (written > 0) {
+    _current_size += written;
+  }
+  return written;
+}
+
+// Rotation is only checked when a batch is flushed, so a file may exceed
+// its size limit by the messages of one batch.
+bool LogFileOutput::flush_blocking() {
+  RotationLocker lock(_rotation_semaphore);
+  if (_stream == nullptr) {
+    return true;
+  }
+
+  if (!flush()) {
+    return false;
+  }
+  if (should_rotate()) {
+    rotate();
+  }
+  return true;
+}
+
 int LogFileOutput::write(const LogDecorations& decorations, const char* msg) {
   if (_stream == nullptr) {
     // An error has occurred with this output, avoid writing to it.
@@ -358,7 +381,7 @@ void LogFileOutput::rotate() {
   archive();
 
   // Open the active log file using the same stream as before
-  _stream = os::fopen(_file_name, FileOpenMode);
+  _stream = os::fopen(_file_name, _file_open_mode);
   if (_stream == nullptr) {
     jio_fprintf(defaultStream::error_stream(), "Could not reopen file '%s' during log rotation (%s).\n",
                 _file_name, os::strerror(errno));
@@ -368,6 +391,7 @@ void LogFileOutput::rotate() {
   // Reset accumulated size, increase current file counter, and check for file count wrap-around.
   _current_size = 0;
   increment_file_count();
+  file_opened();
 }
 
 char* LogFileOutput::make_file_name(const char* file_name,
@@ -50,6 +50,7 @@ class LogFileOutput : public LogFileStreamOutput {
   static char         _vm_start_time_str[StartTimeBufferSize];
 
   const char* _name;
+  const char* _file_open_mode;
   char* _file_name;
   char* _archive_name;
 
@@ -60,25 +61,47 @@ class LogFileOutput : public LogFileStreamOutput {
 
   size_t  _archive_name_len;
   size_t  _rotate_size;
+
+  void archive();
+  char *make_file_name(const char* file_name, const char* pid_string, const char* timestamp_string);
+
+  void increment_file_count() {
+    _current_file++;
+    if (_current_file == _file_count) {
+      _current_file = 0;
+    }
+  }
+
+ protected:
+  class RotationLocker : public StackObj {
+    Semaphore& _sem;
+
+   public:
+    RotationLocker(Semaphore& sem) : _sem(sem) {
+      sem.wait();
+    }
+
+    ~RotationLocker() {
+      _sem.signal();
+    }
+  };
+
   size_t  _current_size;
 
   // Semaphore used for synchronizing file rotations and writes
   Semaphore _rotation_semaphore;
 
-  void archive();
+  // For subclasses writing files of a different format, name must start with prefix.
+  LogFileOutput(const char* name, const char* prefix, const char* file_open_mode);
+
   void rotate();
-  char *make_file_name(const char* file_name, const char* pid_string, const char* timestamp_string);
 
   bool should_rotate() {
     return _file_count > 0 && _rotate_size > 0 && _current_size >= _rotate_size;
   }
 
-  void increment_file_count() {
-    _current_file++;
-    if (_current_file == _file_count) {
-      _current_file = 0;
-    }
-  }
+  // Called after the active log file has been (re)opened, before anything is written to it.
+  virtual void file_opened() {}
 
  public:
   LogFileOutput(const char *name);
@@ -88,6 +111,8 @@ class LogFileOutput : public LogFileStreamOutput {
   virtual int write(const LogDecorations& decorations, const char* msg);
   virtual int write(LogMessageBuffer::Iterator msg_iterator);
   virtual int write_blocking(const LogDecorations& decorations, const char* msg);
+  virtual int write_blocking_unflushed(const LogDecorations& decorations, const char* msg);
+  virtual bool flush_blocking();
   virtual void force_rotate();
   virtual void describe(outputStream* out);
 
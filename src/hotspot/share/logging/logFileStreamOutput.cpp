@@ -173,6 +173,16 @@ int LogFileStreamOutput::write_blocking(const LogDecorations& decorations, const
   return flush() ? written : -1;
 }
 
+int LogFileStreamOutput::write_blocking_unflushed(const LogDecorations& decorations, const char* msg) {
+  FileLocker flocker(_stream);
+  return write_internal(decorations, msg);
+}
+
+bool LogFileStreamOutput::flush_blocking() {
+  FileLocker flocker(_stream);
+  return flush();
+}
+
 int LogFileStreamOutput::write(const LogDecorations& decorations, const char* msg) {
   if (AsyncLogWriter::enqueue(*this, decorations, msg)) {
     return 0;
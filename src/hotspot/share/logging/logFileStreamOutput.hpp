@@ -58,6 +58,10 @@ class LogFileStreamOutput : public LogOutput {
   virtual int write(LogMessageBuffer::Iterator msg_iterator);
   // Write API used by AsyncLogWriter
   virtual int write_blocking(const LogDecorations& decorations, const char* msg);
+  // Batched write API used by AsyncLogWriter. Messages written with write_blocking_unflushed()
+  // are only guaranteed to reach the file after a subsequent flush_blocking().
+  virtual int write_blocking_unflushed(const LogDecorations& decorations, const char* msg);
+  virtual bool flush_blocking();
   virtual void describe(outputStream* out);
 };
 
@@ -101,6 +101,12 @@ class LogOutput : public CHeapObj<mtLogging> {
   virtual bool set_option(const char* key, const char* value, outputStream* errstream) = 0;
   virtual int write(const LogDecorations& decorations, const char* msg) = 0;
   virtual int write(LogMessageBuffer::Iterator msg_iterator) = 0;
+
+  // Binary outputs (LogBinaryFileOutput) are also handed the unformatted
+  // message by LogTagSet::vwrite, and are then skipped for the formatted text.
+  virtual bool is_binary() const {
+    return false;
+  }
 };
 
 #endif // SHARE_LOGGING_LOGOUTPUT_HPP
@@ -111,6 +111,7 @@ class outputStream;
   LOG_TAG(jvmci) \
   LOG_TAG(jvmti) \
   LOG_TAG(lambda) \
+  LOG_TAG(latency) \
   LOG_TAG(library) \
   LOG_TAG(link) \
   LOG_TAG(liveness) \
@@ -23,6 +23,7 @@
  */
 #include "jvm.h"
 #include "logging/logAsyncWriter.hpp"
+#include "logging/logBinaryFileOutput.hpp"
 #include "logging/logDecorations.hpp"
 #include "logging/logFileStreamOutput.hpp"
 #include "logging/logLevel.hpp"
@@ -72,6 +73,10 @@ bool LogTagSet::has_output(const LogOutput* output) {
 }
 
 void LogTagSet::log(LogLevelType level, const char* msg) {
+  log(level, msg, false /* skip_binary */);
+}
+
+void LogTagSet::log(LogLevelType level, const char* msg, bool skip_binary) {
   // Increasing the atomic reader counter in iterator(level) must
   // happen before the creation of LogDecorations instance so
   // wait_until_no_readers() in LogConfiguration::configure_output()
@@ -81,6 +86,9 @@ void LogTagSet::log(LogLevelType level, const char* msg) {
   LogDecorations decorations(level, *this, _decorators);
 
   for (; it != _output_list.end(); it++) {
+    if (skip_binary && (*it)->is_binary()) {
+      continue;
+    }
     (*it)->write(decorations, msg);
   }
 }
@@ -119,8 +127,38 @@ void LogTagSet::write(LogLevelType level, const char* fmt, ...) {
 
 const size_t vwrite_buffer_size = 512;
 
+bool LogTagSet::write_binary(LogLevelType level, const char* fmt, va_list args) {
+  bool text_needed = false;
+  char prefix[vwrite_buffer_size];
+  prefix[0] = '\0';
+  bool has_prefix = false;
+  LogOutputList::Iterator it = _output_list.iterator(level);
+  for (; it != _output_list.end(); it++) {
+    if (!(*it)->is_binary()) {
+      text_needed = true;
+      continue;
+    }
+    if (!has_prefix) {
+      _write_prefix(prefix, sizeof(prefix));
+      has_prefix = true;
+    }
+    va_list output_args;
+    va_copy(output_args, args);
+    static_cast<LogBinaryFileOutput*>(*it)->write(level, *this, prefix, fmt, output_args);
+    va_end(output_args);
+  }
+  return text_needed;
+}
+
 void LogTagSet::vwrite(LogLevelType level, const char* fmt, va_list args) {
   assert(level >= LogLevel::First && level <= LogLevel::Last, "Log level:%d is incorrect", level);
+  // Binary outputs get the message without formatting it, which is all
+  // that is needed if there are no other outputs.
+  const bool skip_binary = LogBinaryFileOutput::is_in_use();
+  if (skip_binary && !write_binary(level, fmt, args)) {
+    return;
+  }
+
   char buf[vwrite_buffer_size];
   va_list saved_args;           // For re-format on buf overflow.
   va_copy(saved_args, args);
@@ -137,8 +175,8 @@ void LogTagSet::vwrite(LogLevelType level, const char* fmt, va_list args) {
   assert(ret >= 0, "Log message buffer issue");
   if (ret < 0) {
     // Error, just log contents in buf.
-    log(level, buf);
-    log(level, "Log message buffer issue");
+    log(level, buf, skip_binary);
+    log(level, "Log message buffer issue", skip_binary);
     va_end(saved_args);
     return;
   }
@@ -146,7 +184,7 @@ void LogTagSet::vwrite(LogLevelType level, const char* fmt, va_list args) {
 
   size_t newbuf_len = (size_t)ret + prefix_len + 1; // total bytes needed including prefix.
   if (newbuf_len <= sizeof(buf)) {
-    log(level, buf);
+    log(level, buf, skip_binary);
   } else {
     // Buffer too small, allocate a large enough buffer using malloc/free to avoid circularity.
     // Since logging is a very basic function, conceivably used within NMT itself, avoid os::malloc/free
@@ -156,9 +194,9 @@ void LogTagSet::vwrite(LogLevelType level, const char* fmt, va_list args) {
       ret = os::vsnprintf(newbuf + prefix_len, newbuf_len - prefix_len, fmt, saved_args);
       assert(ret >= 0, "Log message newbuf issue");
       // log the contents in newbuf even with error happened.
-      log(level, newbuf);
+      log(level, newbuf, skip_binary);
       if (ret < 0) {
-        log(level, "Log message newbuf issue");
+        log(level, "Log message newbuf issue", skip_binary);
       }
       permit_forbidden_function::free(newbuf);
     } else {
@@ -169,9 +207,9 @@ void LogTagSet::vwrite(LogLevelType level, const char* fmt, va_list args) {
       ret = os::snprintf(buf + sizeof(buf) - ltr, ltr, "%s", trunc_msg);
       assert(ret >= 0, "Log message buffer issue");
       // log the contents in newbuf even with error happened.
-      log(level, buf);
+      log(level, buf, skip_binary);
       if (ret < 0) {
-        log(level, "Log message buffer issue under OOM");
+        log(level, "Log message buffer issue under OOM", skip_binary);
       }
     }
   }
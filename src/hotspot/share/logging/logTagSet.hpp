@@ -63,6 +63,11 @@ class LogTagSet {
   template <LogTagType T0, LogTagType T1, LogTagType T2, LogTagType T3, LogTagType T4, LogTagType GuardTag>
   friend class LogTagSetMapping;
 
+  // Hands the unformatted message to the binary outputs.
+  // Returns true if there are other outputs that need the formatted text.
+  bool write_binary(LogLevelType level, const char* fmt, va_list args);
+  void log(LogLevelType level, const char* msg, bool skip_binary);
+
  public:
   static void describe_tagsets(outputStream* out);
   static void list_all_tagsets(outputStream* out);
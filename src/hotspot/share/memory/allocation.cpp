@@ -47,14 +47,14 @@ char* AllocateHeap(size_t size,
 char* AllocateHeap(size_t size,
                    MemTag mem_tag,
                    AllocFailType alloc_failmode /* = AllocFailStrategy::EXIT_OOM*/) {
-  return AllocateHeap(size, mem_tag, CALLER_PC, alloc_failmode);
+  return AllocateHeap(size, mem_tag, MALLOC_CALLER_PC, alloc_failmode);
 }
 
 char* ReallocateHeap(char *old,
                      size_t size,
                      MemTag mem_tag,
                      AllocFailType alloc_failmode) {
-  char* p = (char*) os::realloc(old, size, mem_tag, CALLER_PC);
+  char* p = (char*) os::realloc(old, size, mem_tag, MALLOC_CALLER_PC);
   if (p == nullptr && alloc_failmode == AllocFailStrategy::EXIT_OOM) {
     vm_exit_out_of_memory(size, OOM_MALLOC_ERROR, "ReallocateHeap");
   }
@@ -118,7 +118,7 @@ void* AnyObj::operator new(size_t size, Arena *arena) {
 }
 
 void* AnyObj::operator new(size_t size, MemTag mem_tag) throw() {
-  address res = (address)AllocateHeap(size, mem_tag, CALLER_PC);
+  address res = (address)AllocateHeap(size, mem_tag, MALLOC_CALLER_PC);
   DEBUG_ONLY(set_allocation_type(res, C_HEAP);)
   return res;
 }
@@ -126,7 +126,7 @@ void* AnyObj::operator new(size_t size, MemTag mem_tag) throw() {
 void* AnyObj::operator new(size_t size, const std::nothrow_t&  nothrow_constant,
     MemTag mem_tag) throw() {
   // should only call this with std::nothrow, use other operator new() otherwise
-    address res = (address)AllocateHeap(size, mem_tag, CALLER_PC, AllocFailStrategy::RETURN_NULL);
+    address res = (address)AllocateHeap(size, mem_tag, MALLOC_CALLER_PC, AllocFailStrategy::RETURN_NULL);
     DEBUG_ONLY(if (res!= nullptr) set_allocation_type(res, C_HEAP);)
   return res;
 }
@@ -203,6 +203,18 @@ class Arena : public CHeapObjBase {
   void *Arealloc( void *old_ptr, size_t old_size, size_t new_size,
       AllocFailType alloc_failmode = AllocFailStrategy::EXIT_OOM);
 
+  // Grow the latest allocation in place, if the current chunk has room for it.
+  // Unlike Arealloc, never relocates; returns false if it cannot extend.
+  bool Aextend(void* ptr, size_t old_size, size_t new_size) {
+    char* c_old = (char*)ptr;
+    if (c_old + ARENA_ALIGN(old_size) == _hwm &&
+        pointer_delta(_max, c_old, 1) >= ARENA_ALIGN(new_size)) {
+      _hwm = c_old + ARENA_ALIGN(new_size);
+      return true;
+    }
+    return false;
+  }
+
   // Determine if pointer belongs to this Arena or not.
   bool contains( const void *ptr ) const;
 
@@ -53,17 +53,19 @@ using metaspace::InternalStats;
 #define LOGFMT         "CLMS @" PTR_FORMAT " "
 #define LOGFMT_ARGS    p2i(this)
 
-ClassLoaderMetaspace::ClassLoaderMetaspace(Mutex* lock, Metaspace::MetaspaceType space_type) :
+ClassLoaderMetaspace::ClassLoaderMetaspace(Mutex* lock, Metaspace::MetaspaceType space_type, bool transient) :
     ClassLoaderMetaspace(lock, space_type,
                          MetaspaceContext::context_nonclass(),
                          MetaspaceContext::context_class(),
-                         CompressedKlassPointers::klass_alignment_in_words())
+                         CompressedKlassPointers::klass_alignment_in_words(),
+                         transient)
 {}
 
 ClassLoaderMetaspace::ClassLoaderMetaspace(Mutex* lock, Metaspace::MetaspaceType space_type,
                                            MetaspaceContext* non_class_context,
                                            MetaspaceContext* class_context,
-                                           size_t klass_alignment_words) :
+                                           size_t klass_alignment_words,
+                                           bool transient) :
   _lock(lock),
   _space_type(space_type),
   _non_class_space_arena(nullptr),
@@ -74,7 +76,8 @@ ClassLoaderMetaspace::ClassLoaderMetaspace(Mutex* lock, Metaspace::MetaspaceType
       non_class_context,
       ArenaGrowthPolicy::policy_for_space_type(space_type, false),
       Metaspace::min_allocation_alignment_words,
-      "non-class arena");
+      "non-class arena",
+      transient);
 
   // If needed, initialize class arena
   if (class_context != nullptr) {
@@ -82,7 +85,8 @@ ClassLoaderMetaspace::ClassLoaderMetaspace(Mutex* lock, Metaspace::MetaspaceType
         class_context,
         ArenaGrowthPolicy::policy_for_space_type(space_type, true),
         klass_alignment_words,
-        "class arena");
+        "class arena",
+        transient);
   }
 
   UL2(debug, "born (nonclass arena: " PTR_FORMAT ", class arena: " PTR_FORMAT ".",
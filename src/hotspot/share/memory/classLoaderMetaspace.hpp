@@ -83,10 +83,13 @@ class ClassLoaderMetaspace : public CHeapObj<mtClass> {
   ClassLoaderMetaspace(Mutex* lock, Metaspace::MetaspaceType space_type,
                        metaspace::MetaspaceContext* non_class_context,
                        metaspace::MetaspaceContext* class_context,
-                       size_t klass_alignment_words);
+                       size_t klass_alignment_words,
+                       bool transient = false);
 
 public:
-  ClassLoaderMetaspace(Mutex* lock, Metaspace::MetaspaceType space_type);
+  // transient: the loader is expected to be unloaded, keep its chunks apart from
+  //  those of long-lived loaders (see MetaspaceSeparateTransientLoaders).
+  ClassLoaderMetaspace(Mutex* lock, Metaspace::MetaspaceType space_type, bool transient = false);
 
   ~ClassLoaderMetaspace();
 
@@ -194,6 +194,23 @@ void CodeHeap::on_code_mapping(char* base, size_t size) {
   extern void linux_wrap_code(char* base, size_t size);
   linux_wrap_code(base, size);
 #endif
+  advise_hot_segment(base, size);
+}
+
+void CodeHeap::advise_hot_segment(char* base, size_t size) {
+  if (CodeCacheHotSegmentSize == 0 || !UseLargePages || _code_blob_type == CodeBlobType::NonNMethod) {
+    return;
+  }
+  // The hot segment is the low end of the heap, where hot nmethods are
+  // placed (see CodeCacheHotInvocationThreshold).
+  const size_t lp_size = os::large_page_size();
+  char* const hot_beg = align_up(_memory.low_boundary(), lp_size);
+  char* const hot_end = align_down(_memory.low_boundary() + CodeCacheHotSegmentSize, lp_size);
+  char* const beg = MAX2(base, hot_beg);
+  char* const end = MIN2(base + size, hot_end);
+  if (beg < end) {
+    os::realign_memory(beg, pointer_delta(end, beg, 1), lp_size);
+  }
 }
 
 
@@ -268,14 +285,14 @@ bool CodeHeap::expand_by(size_t size) {
 }
 
 
-void* CodeHeap::allocate(size_t instance_size) {
+void* CodeHeap::allocate(size_t instance_size, bool first_fit) {
   size_t number_of_segments = size_to_segments(instance_size + header_size());
   assert(segments_to_size(number_of_segments) >= sizeof(FreeBlock), "not enough room for FreeList");
   assert_locked_or_safepoint(CodeCache_lock);
 
   // First check if we can satisfy request from freelist
   NOT_PRODUCT(verify());
-  HeapBlock* block = search_freelist(number_of_segments);
+  HeapBlock* block = search_freelist(number_of_segments, first_fit);
   NOT_PRODUCT(verify());
 
   if (block != nullptr) {
@@ -643,10 +660,12 @@ void CodeHeap::add_to_freelist(HeapBlock* a) {
 }
 
 /**
- * Search freelist for an entry on the list with the best fit.
+ * Search freelist for an entry on the list with the best fit, or with
+ * 'first_fit' for the lowest-addressed entry that fits, whose leading
+ * part is then returned.
  * @return null, if no one was found
  */
-HeapBlock* CodeHeap::search_freelist(size_t length) {
+HeapBlock* CodeHeap::search_freelist(size_t length, bool first_fit) {
   FreeBlock* found_block  = nullptr;
   FreeBlock* found_prev   = nullptr;
   size_t     found_length = _next_segment; // max it out to begin with
@@ -657,10 +676,11 @@ HeapBlock* CodeHeap::search_freelist(size_t length) {
 
   length = length < CodeCacheMinBlockLength ? CodeCacheMinBlockLength : length;
 
-  // Search for best-fitting block
+  // Search for best-fitting block, or for the first (lowest address) fitting
+  // block; the freelist is sorted by address.
   while(cur != nullptr) {
     size_t cur_length = cur->length();
-    if (cur_length == length) {
+    if (cur_length == length || (first_fit && cur_length > length)) {
       // We have a perfect fit
       found_block  = cur;
       found_prev   = prev;
@@ -702,6 +722,25 @@ HeapBlock* CodeHeap::search_freelist(size_t length) {
     // This is necessary due to a dubious assert in nmethod.cpp(PcDescCache::reset_to()).
     // Can't use invalidate() here because it works on segment_size units (too coarse).
     DEBUG_ONLY(memset((void*)res->allocated_space(), badCodeHeapNewVal, sizeof(FreeBlock) - sizeof(HeapBlock)));
+  } else if (first_fit) {
+    // Hand out the leading part of the block, so that the allocation gets
+    // the lowest free address. The remainder above it takes the place of
+    // the block on the freelist.
+    FreeBlock* rest = (FreeBlock*)split_block(found_block, length);
+    rest->set_free();
+    rest->set_link(found_block->link());
+    if (found_prev == nullptr) {
+      assert(_freelist == found_block, "sanity check");
+      _freelist = rest;
+    } else {
+      assert((found_prev->link() == found_block), "sanity check");
+      found_prev->set_link(rest);
+    }
+    if (_last_insert_point == found_block) {
+      _last_insert_point = rest;
+    }
+    res = (HeapBlock*)found_block;
+    DEBUG_ONLY(memset((void*)res->allocated_space(), badCodeHeapNewVal, sizeof(FreeBlock) - sizeof(HeapBlock)));
   } else {
     // Truncate the free block and return the truncated part
     // as new HeapBlock. The remaining free block does not
@@ -140,7 +140,7 @@ class CodeHeap : public CHeapObj<mtCode> {
 
   // Toplevel freelist management
   void add_to_freelist(HeapBlock* b);
-  HeapBlock* search_freelist(size_t length);
+  HeapBlock* search_freelist(size_t length, bool first_fit);
 
   // Iteration helpers
   void*      next_used(HeapBlock* b) const;
@@ -148,6 +148,8 @@ class CodeHeap : public CHeapObj<mtCode> {
 
   // to perform additional actions on creation of executable code
   void on_code_mapping(char* base, size_t size);
+  // Ask for large pages for newly committed memory in the hot segment
+  void advise_hot_segment(char* base, size_t size);
 
  public:
   CodeHeap(const char* name, const CodeBlobType code_blob_type);
@@ -157,7 +159,11 @@ class CodeHeap : public CHeapObj<mtCode> {
   bool  expand_by(size_t size);                  // expands committed memory by size
 
   // Memory allocation
-  void* allocate (size_t size); // Allocate 'size' bytes in the code cache or return null
+  // Allocate 'size' bytes in the code cache or return null. With 'first_fit',
+  // the lowest free address that fits is used instead of the best fit. Either
+  // way, when no free block fits, the allocation is taken from the top of the
+  // used part of the heap.
+  void* allocate (size_t size, bool first_fit = false);
   void  deallocate(void* p);    // Deallocate memory
   // Free the tail of segments allocated by the last call to 'allocate()' which exceed 'used_size'.
   // ATTENTION: this is only safe to use if there was no other call to 'allocate()' after
@@ -28,6 +28,7 @@
 #include "classfile/vmClasses.hpp"
 #include "gc/shared/collectedHeap.hpp"
 #include "logging/log.hpp"
+#include "logging/logStream.hpp"
 #include "logging/logTag.hpp"
 #include "memory/heapInspection.hpp"
 #include "memory/resourceArea.hpp"
@@ -36,6 +37,7 @@
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
+#include "runtime/safepoint.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/macros.hpp"
 #include "utilities/stack.inline.hpp"
@@ -322,7 +324,8 @@ class HierarchyClosure : public KlassInfoClosure {
 };
 
 void KlassHierarchy::print_class_hierarchy(outputStream* st, bool print_interfaces,
-                                           bool print_subclasses, char* classname) {
+                                           bool print_subclasses, bool print_secondary_supers,
+                                           char* classname) {
   ResourceMark rm;
   Stack <KlassInfoEntry*, mtClass> class_stack;
   GrowableArray<KlassInfoEntry*> elements;
@@ -382,7 +385,7 @@ void KlassHierarchy::print_class_hierarchy(outputStream* st, bool print_interfac
   while (!class_stack.is_empty()) {
     KlassInfoEntry* curr_cie = class_stack.pop();
     if (curr_cie->do_print()) {
-      print_class(st, curr_cie, print_interfaces);
+      print_class(st, curr_cie, print_interfaces, print_secondary_supers);
       if (curr_cie->subclasses() != nullptr) {
         // Current class has subclasses, so push all of them onto the stack.
         for (int i = 0; i < curr_cie->subclasses()->length(); i++) {
@@ -453,7 +456,8 @@ static void print_interface(outputStream* st, InstanceKlass* intf_klass, const c
   st->print(" (%s intf)\n", intf_type);
 }
 
-void KlassHierarchy::print_class(outputStream* st, KlassInfoEntry* cie, bool print_interfaces) {
+void KlassHierarchy::print_class(outputStream* st, KlassInfoEntry* cie, bool print_interfaces,
+                                 bool print_secondary_supers) {
   ResourceMark rm;
   InstanceKlass* klass = (InstanceKlass*)cie->klass();
   int indent = 0;
@@ -489,6 +493,14 @@ void KlassHierarchy::print_class(outputStream* st, KlassInfoEntry* cie, bool pri
       }
     }
   }
+
+  // Print the shape of the secondary supers table, which determines how
+  // many probes a subtype check against this class needs.
+  if (print_secondary_supers) {
+    print_indent(st, indent);
+    st->print_cr("  secondary supers:");
+    klass->print_secondary_supers_on(st);
+  }
 }
 
 void KlassInfoHisto::print_histo_on(outputStream* st) {
@@ -610,6 +622,93 @@ void HeapInspection::heap_inspection(outputStream* st, WorkerThreads* workers) {
   st->flush();
 }
 
+volatile bool ConcurrentHeapHistogram::_requested = false;
+
+ConcurrentHeapHistogram::ConcurrentHeapHistogram(uint num_tables) :
+  _num_tables(num_tables),
+  _tables(NEW_C_HEAP_ARRAY(KlassInfoTable*, num_tables, mtServiceability)),
+  _missed_count(0) {
+  for (uint i = 0; i < _num_tables; i++) {
+    _tables[i] = new KlassInfoTable(false);
+  }
+}
+
+ConcurrentHeapHistogram::~ConcurrentHeapHistogram() {
+  for (uint i = 0; i < _num_tables; i++) {
+    delete _tables[i];
+  }
+  FREE_C_HEAP_ARRAY(KlassInfoTable*, _tables);
+}
+
+void ConcurrentHeapHistogram::record(uint table_id, oop obj) {
+  assert(table_id < _num_tables, "table id out of range: %u", table_id);
+  KlassInfoTable* const cit = _tables[table_id];
+  if (cit->allocation_failed() || !cit->record_instance(obj)) {
+    Atomic::inc(&_missed_count);
+  }
+}
+
+void ConcurrentHeapHistogram::print_on(outputStream* st) {
+  ResourceMark rm;
+
+  KlassInfoTable cit(false);
+  if (cit.allocation_failed()) {
+    st->print_cr("ERROR: Ran out of C-heap; histogram not generated");
+    return;
+  }
+
+  uintx missed_count = Atomic::load(&_missed_count);
+  for (uint i = 0; i < _num_tables; i++) {
+    if (!_tables[i]->allocation_failed() && !cit.merge(_tables[i])) {
+      missed_count++;
+    }
+  }
+  if (missed_count != 0) {
+    st->print_cr("WARNING: Ran out of C-heap; undercounted instances in data below");
+  }
+
+  // Sort and print klass instance info
+  KlassInfoHisto histo(&cit);
+  HistoClosure hc(&histo);
+
+  cit.iterate(&hc);
+
+  histo.sort();
+  histo.print_histo_on(st);
+  st->flush();
+}
+
+void ConcurrentHeapHistogram::request() {
+  Atomic::store(&_requested, true);
+}
+
+bool ConcurrentHeapHistogram::is_requested() {
+  return Atomic::load(&_requested);
+}
+
+ConcurrentHeapHistogram* ConcurrentHeapHistogram::claim(uint num_tables) {
+  assert_at_safepoint();
+  if (!Atomic::cmpxchg(&_requested, true, false)) {
+    return nullptr;
+  }
+  return new ConcurrentHeapHistogram(num_tables);
+}
+
+void ConcurrentHeapHistogram::report(ConcurrentHeapHistogram* histogram, const char* omitted) {
+  LogTarget(Info, gc, classhisto) lt;
+  if (lt.is_enabled()) {
+    LogStream ls(lt);
+    ls.print_cr("Class histogram of the objects marked by concurrent marking. %s", omitted);
+    histogram->print_on(&ls);
+  }
+  delete histogram;
+}
+
+void ConcurrentHeapHistogram::cancel(ConcurrentHeapHistogram* histogram) {
+  delete histogram;
+  request();
+}
+
 class FindInstanceClosure : public ObjectClosure {
  private:
   Klass* _klass;
@@ -102,7 +102,7 @@ class KlassInfoBucket: public CHeapObj<mtInternal> {
   void iterate(KlassInfoClosure* cic);
 };
 
-class KlassInfoTable: public StackObj {
+class KlassInfoTable: public CHeapObj<mtServiceability> {
  private:
   static const int _num_buckets = 20011;
   size_t _size_of_instances_in_words;
@@ -134,12 +134,13 @@ class KlassInfoTable: public StackObj {
 class KlassHierarchy : AllStatic {
  public:
   static void print_class_hierarchy(outputStream* st, bool print_interfaces,  bool print_subclasses,
-                                    char* classname);
+                                    bool print_secondary_supers, char* classname);
 
  private:
   static void set_do_print_for_class_hierarchy(KlassInfoEntry* cie, KlassInfoTable* cit,
                                                bool print_subclasse);
-  static void print_class(outputStream* st, KlassInfoEntry* cie, bool print_subclasses);
+  static void print_class(outputStream* st, KlassInfoEntry* cie, bool print_interfaces,
+                          bool print_secondary_supers);
 };
 
 class KlassInfoHisto : public StackObj {
@@ -204,6 +205,48 @@ class HeapInspection : public StackObj {
   static void find_instances_at_safepoint(Klass* k, GrowableArray<oop>* result) NOT_SERVICES_RETURN;
 };
 
+// Class histogram of the objects found live by a concurrent marking cycle.
+// A histogram requested with request() is claimed by the collector when the
+// next marking cycle starts. Marking workers record each object they mark
+// into a table of their own, and the tables are merged and logged with
+// gc+classhisto when marking completes, so no separate heap walk is needed.
+// Objects the collector does not mark are not included: objects allocated
+// after the start of marking, and with G1 the objects in young regions.
+// The log output says which objects are omitted.
+class ConcurrentHeapHistogram : public CHeapObj<mtServiceability> {
+ private:
+  static volatile bool _requested;
+
+  uint             _num_tables;
+  KlassInfoTable** _tables;
+  volatile uintx   _missed_count;
+
+  ConcurrentHeapHistogram(uint num_tables);
+
+ public:
+  ~ConcurrentHeapHistogram();
+
+  // Record a newly marked object. Each table id must only be used by one
+  // thread at a time.
+  void record(uint table_id, oop obj) NOT_SERVICES_RETURN;
+
+  // Merge the tables and print the sorted histogram.
+  void print_on(outputStream* st) NOT_SERVICES_RETURN;
+
+  static void request() NOT_SERVICES_RETURN;
+  static bool is_requested() NOT_SERVICES_RETURN_(false);
+
+  // Returns a histogram with num_tables tables if one has been requested,
+  // otherwise nullptr. Called at a safepoint when marking starts.
+  static ConcurrentHeapHistogram* claim(uint num_tables) NOT_SERVICES_RETURN_(nullptr);
+  // Logs and deletes a histogram from a completed marking cycle. omitted
+  // describes the live objects the histogram does not include.
+  static void report(ConcurrentHeapHistogram* histogram, const char* omitted) NOT_SERVICES_RETURN;
+  // Deletes a histogram from an aborted marking cycle. The request stays
+  // pending for the next one.
+  static void cancel(ConcurrentHeapHistogram* histogram) NOT_SERVICES_RETURN;
+};
+
 // Parallel heap inspection task. Parallel inspection can fail due to
 // a native OOM when allocating memory for TL-KlassInfoTable.
 // _success will be set false on an OOM, and serial inspection tried.
@@ -59,6 +59,7 @@
 #include "runtime/init.hpp"
 #include "runtime/java.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/timerTrace.hpp"
 #include "utilities/copy.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/formatBuffer.hpp"
@@ -740,7 +741,9 @@ void Metaspace::global_initialize() {
     if (!FLAG_IS_DEFAULT(CompressedClassSpaceBaseAddress)) {
       log_warning(metaspace)("CDS active - ignoring CompressedClassSpaceBaseAddress.");
     }
-    MetaspaceShared::initialize_runtime_shared_and_meta_spaces();
+    { TraceTime timer("Map CDS archive", TRACETIME_LOG(Info, startuptime));
+      MetaspaceShared::initialize_runtime_shared_and_meta_spaces();
+    }
     // If any of the archived space fails to map, UseSharedSpaces
     // is reset to false.
   }
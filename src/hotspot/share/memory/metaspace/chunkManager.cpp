@@ -49,7 +49,7 @@ namespace metaspace {
 void ChunkManager::return_chunk_simple_locked(Metachunk* c) {
   assert_lock_strong(Metaspace_lock);
   SOMETIMES(c->verify();)
-  _chunks.add(c);
+  freelists_for(c)->add(c);
   c->reset_used_words();
   // Tracing
   log_debug(metaspace)("ChunkManager %s: returned chunk " METACHUNK_FORMAT ".",
@@ -62,10 +62,15 @@ void ChunkManager::return_chunk_simple_locked(Metachunk* c) {
 ChunkManager::ChunkManager(const char* name, VirtualSpaceList* space_list) :
   _vslist(space_list),
   _name(name),
-  _chunks()
+  _chunks(),
+  _transient_chunks()
 {
 }
 
+FreeChunkListVector* ChunkManager::freelists_for(const Metachunk* c) {
+  return freelists(c->vsnode()->is_in_transient_area(c));
+}
+
 // Given a chunk, split it into a target chunk of a smaller size (higher target level)
 //  and at least one, possible several splinter chunks.
 // The original chunk must be outside of the freelist and its state must be free.
@@ -88,7 +93,7 @@ void ChunkManager::split_chunk_and_add_splinters(Metachunk* c, chunklevel_t targ
 
   DEBUG_ONLY(size_t committed_words_before = c->committed_words();)
 
-  c->vsnode()->split(target_level, c, &_chunks);
+  c->vsnode()->split(target_level, c, freelists_for(c));
 
   // Splitting should never fail.
   assert(c->level() == target_level, "Sanity");
@@ -107,14 +112,15 @@ void ChunkManager::split_chunk_and_add_splinters(Metachunk* c, chunklevel_t targ
   InternalStats::inc_num_chunk_splits();
 }
 
-Metachunk* ChunkManager::get_chunk(chunklevel_t preferred_level, chunklevel_t max_level, size_t min_committed_words) {
+Metachunk* ChunkManager::get_chunk(chunklevel_t preferred_level, chunklevel_t max_level, size_t min_committed_words,
+                                   bool transient) {
   assert(preferred_level <= max_level, "Sanity");
   assert(chunklevel::level_fitting_word_size(min_committed_words) >= max_level, "Sanity");
 
   Metachunk* c;
   {
     MutexLocker fcl(Metaspace_lock, Mutex::_no_safepoint_check_flag);
-    c = get_chunk_locked(preferred_level, max_level, min_committed_words);
+    c = get_chunk_locked(preferred_level, max_level, min_committed_words, transient);
   }
 
   if (c != nullptr) {
@@ -124,25 +130,10 @@ Metachunk* ChunkManager::get_chunk(chunklevel_t preferred_level, chunklevel_t ma
   return c;
 }
 
-// On success, returns a chunk of level of <preferred_level>, but at most <max_level>.
-//  The first first <min_committed_words> of the chunk are guaranteed to be committed.
-// On error, will return null.
-//
-// This function may fail for two reasons:
-// - Either we are unable to reserve space for a new chunk (if the underlying VirtualSpaceList
-//   is non-expandable but needs expanding - aka out of compressed class space).
-// - Or, if the necessary space cannot be committed because we hit a commit limit.
-//   This may be either the GC threshold or MaxMetaspaceSize.
-Metachunk* ChunkManager::get_chunk_locked(chunklevel_t preferred_level, chunklevel_t max_level, size_t min_committed_words) {
-  assert_lock_strong(Metaspace_lock);
-  SOMETIMES(verify_locked();)
-  DEBUG_ONLY(chunklevel::check_valid_level(max_level);)
-  DEBUG_ONLY(chunklevel::check_valid_level(preferred_level);)
-
-  UL2(debug, "requested chunk: pref_level: " CHKLVL_FORMAT
-     ", max_level: " CHKLVL_FORMAT ", min committed size: %zu.",
-     preferred_level, max_level, min_committed_words);
-
+// Search the given freelists for a chunk of level of <preferred_level>, but at most <max_level>,
+//  preferring chunks which are committed far enough to hold <min_committed_words>.
+Metachunk* ChunkManager::search_freelists(FreeChunkListVector* lists, chunklevel_t preferred_level,
+                                          chunklevel_t max_level, size_t min_committed_words) {
   // First, optimistically look for a chunk which is already committed far enough to hold min_word_size.
 
   // 1) Search best or smaller committed chunks (first attempt):
@@ -151,34 +142,70 @@ Metachunk* ChunkManager::get_chunk_locked(chunklevel_t preferred_level, chunklev
   //    this is to prevent large loaders (eg boot) from unnecessarily gobbling up
   //    all the tiny splinter chunks lambdas leave around.
   Metachunk* c = nullptr;
-  c = _chunks.search_chunk_ascending(preferred_level, MIN2((chunklevel_t)(preferred_level + 2), max_level), min_committed_words);
+  c = lists->search_chunk_ascending(preferred_level, MIN2((chunklevel_t)(preferred_level + 2), max_level), min_committed_words);
 
   // 2) Search larger committed chunks:
   //    If that did not yield anything, look at larger chunks, which may be committed. We would have to split
   //    them first, of course.
   if (c == nullptr) {
-    c = _chunks.search_chunk_descending(preferred_level, min_committed_words);
+    c = lists->search_chunk_descending(preferred_level, min_committed_words);
   }
   // 3) Search best or smaller committed chunks (second attempt):
   //    Repeat (1) but now consider even the tiniest chunks as long as they are large enough to hold the
   //    committed min size.
   if (c == nullptr) {
-    c = _chunks.search_chunk_ascending(preferred_level, max_level, min_committed_words);
+    c = lists->search_chunk_ascending(preferred_level, max_level, min_committed_words);
   }
   // if we did not get anything yet, there are no free chunks committed enough. Repeat search but look for uncommitted chunks too:
   // 4) Search best or smaller chunks, can be uncommitted:
   if (c == nullptr) {
-    c = _chunks.search_chunk_ascending(preferred_level, max_level, 0);
+    c = lists->search_chunk_ascending(preferred_level, max_level, 0);
   }
   // 5) Search a larger uncommitted chunk:
   if (c == nullptr) {
-    c = _chunks.search_chunk_descending(preferred_level, 0);
+    c = lists->search_chunk_descending(preferred_level, 0);
   }
+  return c;
+}
+
+// On success, returns a chunk of level of <preferred_level>, but at most <max_level>.
+//  The first first <min_committed_words> of the chunk are guaranteed to be committed.
+// On error, will return null.
+//
+// This function may fail for two reasons:
+// - Either we are unable to reserve space for a new chunk (if the underlying VirtualSpaceList
+//   is non-expandable but needs expanding - aka out of compressed class space).
+// - Or, if the necessary space cannot be committed because we hit a commit limit.
+//   This may be either the GC threshold or MaxMetaspaceSize.
+Metachunk* ChunkManager::get_chunk_locked(chunklevel_t preferred_level, chunklevel_t max_level, size_t min_committed_words,
+                                          bool transient) {
+  assert_lock_strong(Metaspace_lock);
+  SOMETIMES(verify_locked();)
+  DEBUG_ONLY(chunklevel::check_valid_level(max_level);)
+  DEBUG_ONLY(chunklevel::check_valid_level(preferred_level);)
+
+  UL2(debug, "requested chunk: pref_level: " CHKLVL_FORMAT
+     ", max_level: " CHKLVL_FORMAT ", min committed size: %zu%s.",
+     preferred_level, max_level, min_committed_words, transient ? ", transient" : "");
+
+  FreeChunkListVector* const own_lists = freelists(transient);
+  FreeChunkListVector* const other_lists = freelists(!transient);
+
+  Metachunk* c = search_freelists(own_lists, preferred_level, max_level, min_committed_words);
 
   if (c != nullptr) {
     UL(trace, "taken from freelist.");
   }
 
+  // Next, take over a completely free root chunk from the other side.
+  if (c == nullptr) {
+    c = other_lists->search_chunk_ascending(chunklevel::ROOT_CHUNK_LEVEL, chunklevel::ROOT_CHUNK_LEVEL, 0);
+    if (c != nullptr) {
+      c->vsnode()->set_transient_area(c, transient);
+      UL(trace, "taken over free root chunk.");
+    }
+  }
+
   // Failing all that, allocate a new root chunk from the connected virtual space.
   // This may fail if the underlying vslist cannot be expanded (e.g. compressed class space)
   if (c == nullptr) {
@@ -187,9 +214,19 @@ Metachunk* ChunkManager::get_chunk_locked(chunklevel_t preferred_level, chunklev
       UL(info, "failed to get new root chunk.");
     } else {
       assert(c->level() == chunklevel::ROOT_CHUNK_LEVEL, "root chunk expected");
+      c->vsnode()->set_transient_area(c, transient);
       UL(debug, "allocated new root chunk.");
     }
   }
+
+  // Out of address space: rather than failing, mix with the other side. The chunk
+  //  stays part of the other side's root chunk area and returns to its freelists.
+  if (c == nullptr) {
+    c = search_freelists(other_lists, preferred_level, max_level, min_committed_words);
+    if (c != nullptr) {
+      UL(debug, "taken from the other side's freelist.");
+    }
+  }
   if (c == nullptr) {
     // If we end up here, we found no match in the freelists and were unable to get a new
     // root chunk (so we used up all address space, e.g. out of CompressedClassSpace).
@@ -266,7 +303,7 @@ void ChunkManager::return_chunk_locked(Metachunk* c) {
   Metachunk* merged = nullptr;
   if (!c->is_root_chunk()) {
     // Only attempt merging if we are not of the lowest level already.
-    merged = c->vsnode()->merge(c, &_chunks);
+    merged = c->vsnode()->merge(c, freelists_for(c));
   }
 
   if (merged != nullptr) {
@@ -300,7 +337,7 @@ bool ChunkManager::attempt_enlarge_chunk(Metachunk* c) {
   {
     MutexLocker fcl(Metaspace_lock, Mutex::_no_safepoint_check_flag);
     old_word_size = c->word_size();
-    enlarged = c->vsnode()->attempt_enlarge_chunk(c, &_chunks);
+    enlarged = c->vsnode()->attempt_enlarge_chunk(c, freelists_for(c));
   }
 
   if (enlarged) {
@@ -351,6 +388,9 @@ void ChunkManager::purge() {
     for (Metachunk* c = _chunks.first_at_level(l); c != nullptr; c = c->next()) {
       c->uncommit_locked();
     }
+    for (Metachunk* c = _transient_chunks.first_at_level(l); c != nullptr; c = c->next()) {
+      c->uncommit_locked();
+    }
   }
 
   const size_t reserved_after = _vslist->reserved_words();
@@ -394,15 +434,16 @@ size_t ChunkManager::calc_committed_word_size() const {
 
 size_t ChunkManager::calc_committed_word_size_locked() const {
   assert_lock_strong(Metaspace_lock);
-  return _chunks.calc_committed_word_size();
+  return _chunks.calc_committed_word_size() + _transient_chunks.calc_committed_word_size();
 }
 
 // Update statistics.
 void ChunkManager::add_to_statistics(ChunkManagerStats* out) const {
   MutexLocker fcl(Metaspace_lock, Mutex::_no_safepoint_check_flag);
   for (chunklevel_t l = chunklevel::ROOT_CHUNK_LEVEL; l <= chunklevel::HIGHEST_CHUNK_LEVEL; l++) {
-    out->_num_chunks[l] += _chunks.num_chunks_at_level(l);
-    out->_committed_word_size[l] += _chunks.calc_committed_word_size_at_level(l);
+    out->_num_chunks[l] += _chunks.num_chunks_at_level(l) + _transient_chunks.num_chunks_at_level(l);
+    out->_committed_word_size[l] += _chunks.calc_committed_word_size_at_level(l) +
+                                    _transient_chunks.calc_committed_word_size_at_level(l);
   }
   DEBUG_ONLY(out->verify();)
 }
@@ -418,10 +459,11 @@ void ChunkManager::verify_locked() const {
   assert_lock_strong(Metaspace_lock);
   assert(_vslist != nullptr, "No vslist");
   _chunks.verify();
+  _transient_chunks.verify();
 }
 
 bool ChunkManager::contains_chunk(Metachunk* c) const {
-  return _chunks.contains(c);
+  return _chunks.contains(c) || _transient_chunks.contains(c);
 }
 
 #endif // ASSERT
@@ -436,6 +478,10 @@ void ChunkManager::print_on_locked(outputStream* st) const {
   st->print_cr("cm %s: %d chunks, total word size: %zu.", _name,
                total_num_chunks(), total_word_size());
   _chunks.print_on(st);
+  if (_transient_chunks.num_chunks() > 0) {
+    st->print_cr("transient:");
+    _transient_chunks.print_on(st);
+  }
 }
 
 } // namespace metaspace
@@ -52,6 +52,13 @@ struct ChunkManagerStats;
 // The freelists are double linked double headed; fully committed chunks
 //  are added to the front, others to the back.
 //
+// Arenas of loaders which are expected to be unloaded ("transient" arenas,
+//  see -XX:+MetaspaceSeparateTransientLoaders) are served from root chunk
+//  areas of their own, which have a separate set of freelists. Splinters of
+//  those areas are never handed to long-lived arenas, so once the transient
+//  loaders die the area merges back into a free root chunk which can be
+//  uncommitted or reused as a whole. Free root chunks change sides on demand.
+//
 // Level
 //          +--------------------+   +--------------------+
 //  0  +----|  free root chunk   |---|  free root chunk   |---...
@@ -81,6 +88,19 @@ class ChunkManager : public CHeapObj<mtMetaspace> {
   // Freelists
   FreeChunkListVector _chunks;
 
+  // Freelists for chunks in root chunk areas reserved for transient arenas.
+  FreeChunkListVector _transient_chunks;
+
+  FreeChunkListVector* freelists(bool transient) { return transient ? &_transient_chunks : &_chunks; }
+
+  // Returns the freelists a free chunk c belongs to.
+  FreeChunkListVector* freelists_for(const Metachunk* c);
+
+  // Search the given freelists for a chunk of level of <preferred_level>, but at most <max_level>,
+  //  preferring chunks which are committed far enough to hold <min_committed_words>.
+  static Metachunk* search_freelists(FreeChunkListVector* lists, chunklevel_t preferred_level,
+                                     chunklevel_t max_level, size_t min_committed_words);
+
   // Returns true if this manager contains the given chunk. Slow (walks free lists) and
   // only needed for verifications.
   DEBUG_ONLY(bool contains_chunk(Metachunk* c) const;)
@@ -95,7 +115,8 @@ class ChunkManager : public CHeapObj<mtMetaspace> {
   //  chunks.
   void split_chunk_and_add_splinters(Metachunk* c, chunklevel_t target_level);
 
-  Metachunk* get_chunk_locked(chunklevel_t preferred_level, chunklevel_t max_level, size_t min_committed_words);
+  Metachunk* get_chunk_locked(chunklevel_t preferred_level, chunklevel_t max_level, size_t min_committed_words,
+                              bool transient);
 
   // Return a single chunk to the freelist without doing any merging, and adjust accounting.
   void return_chunk_simple_locked(Metachunk* c);
@@ -122,7 +143,10 @@ class ChunkManager : public CHeapObj<mtMetaspace> {
   //   is non-expandable but needs expanding - aka out of compressed class space).
   // - Or, if the necessary space cannot be committed because we hit a commit limit.
   //   This may be either the GC threshold or MaxMetaspaceSize.
-  Metachunk* get_chunk(chunklevel_t preferred_level, chunklevel_t max_level, size_t min_committed_words);
+  //
+  // With transient=true, the chunk is taken from a root chunk area reserved for transient arenas.
+  Metachunk* get_chunk(chunklevel_t preferred_level, chunklevel_t max_level, size_t min_committed_words,
+                       bool transient = false);
 
   // Convenience function - get a chunk of a given level, uncommitted.
   Metachunk* get_chunk(chunklevel_t lvl) { return get_chunk(lvl, lvl, 0); }
@@ -158,10 +182,10 @@ class ChunkManager : public CHeapObj<mtMetaspace> {
   DEBUG_ONLY(void verify_locked() const;)
 
   // Returns total number of chunks
-  int total_num_chunks() const              { return _chunks.num_chunks(); }
+  int total_num_chunks() const              { return _chunks.num_chunks() + _transient_chunks.num_chunks(); }
 
   // Returns number of words in all free chunks (regardless of commit state).
-  size_t total_word_size() const            { return _chunks.word_size(); }
+  size_t total_word_size() const            { return _chunks.word_size() + _transient_chunks.word_size(); }
 
   // Calculates the total number of committed words over all chunks. Walks chunks.
   size_t calc_committed_word_size() const;
@@ -89,7 +89,7 @@ Metachunk* MetaspaceArena::allocate_new_chunk(size_t requested_word_size) {
   const chunklevel_t max_level = chunklevel::level_fitting_word_size(requested_word_size);
   const chunklevel_t preferred_level = MIN2(max_level, next_chunk_level());
 
-  Metachunk* c = _chunk_manager->get_chunk(preferred_level, max_level, requested_word_size);
+  Metachunk* c = _chunk_manager->get_chunk(preferred_level, max_level, requested_word_size, _transient);
   if (c == nullptr) {
     return nullptr;
   }
@@ -112,14 +112,16 @@ void MetaspaceArena::add_allocation_to_fbl(MetaBlock bl) {
 MetaspaceArena::MetaspaceArena(MetaspaceContext* context,
                const ArenaGrowthPolicy* growth_policy,
                size_t allocation_alignment_words,
-               const char* name) :
+               const char* name,
+               bool transient) :
   _allocation_alignment_words(allocation_alignment_words),
   _chunk_manager(context->cm()),
   _growth_policy(growth_policy),
   _chunks(),
   _fbl(nullptr),
   _total_used_words_counter(context->used_words_counter()),
-  _name(name)
+  _name(name),
+  _transient(transient)
 {
   // Check arena allocation alignment
   assert(is_power_of_2(_allocation_alignment_words) &&
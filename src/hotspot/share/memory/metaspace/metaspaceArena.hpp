@@ -106,6 +106,10 @@ class MetaspaceArena : public CHeapObj<mtClass> {
   // A name for purely debugging/logging purposes.
   const char* const _name;
 
+  // True if this arena belongs to a loader expected to be unloaded; its chunks
+  // are taken from root chunk areas reserved for such arenas (see ChunkManager).
+  const bool _transient;
+
   ChunkManager* chunk_manager() const           { return _chunk_manager; }
 
   // free block list
@@ -136,7 +140,8 @@ class MetaspaceArena : public CHeapObj<mtClass> {
   MetaspaceArena(MetaspaceContext* context,
                  const ArenaGrowthPolicy* growth_policy,
                  size_t allocation_alignment_words,
-                 const char* name);
+                 const char* name,
+                 bool transient = false);
 
   ~MetaspaceArena();
 
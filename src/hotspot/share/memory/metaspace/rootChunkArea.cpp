@@ -40,7 +40,8 @@ namespace metaspace {
 
 RootChunkArea::RootChunkArea(const MetaWord* base) :
   _base(base),
-  _first_chunk(nullptr)
+  _first_chunk(nullptr),
+  _is_transient(false)
 {}
 
 RootChunkArea::~RootChunkArea() {
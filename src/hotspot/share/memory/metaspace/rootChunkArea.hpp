@@ -60,6 +60,10 @@ class RootChunkArea {
   // folded, this is the root chunk covering the whole area size.
   Metachunk* _first_chunk;
 
+  // True if the chunks of this area are reserved for transient arenas
+  //  (see ChunkManager).
+  bool _is_transient;
+
 public:
 
   RootChunkArea(const MetaWord* base);
@@ -112,6 +116,9 @@ class RootChunkArea {
   //  and it should be free.
   bool is_free() const;
 
+  bool is_transient() const         { return _is_transient; }
+  void set_transient(bool v)        { _is_transient = v; }
+
   //// Debug stuff ////
 
 #ifdef ASSERT
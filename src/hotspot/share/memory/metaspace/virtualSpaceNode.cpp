@@ -366,6 +366,19 @@ Metachunk* VirtualSpaceNode::merge(Metachunk* c, FreeChunkListVector* freelists)
   return c2;
 }
 
+// Returns true if the root chunk area containing c is reserved for transient arenas.
+bool VirtualSpaceNode::is_in_transient_area(const Metachunk* c) const {
+  assert_lock_strong(Metaspace_lock);
+  return _root_chunk_area_lut.get_area_by_address(c->base())->is_transient();
+}
+
+// Reserve the root chunk area containing c for transient arenas, or release it again.
+void VirtualSpaceNode::set_transient_area(const Metachunk* c, bool v) {
+  assert_lock_strong(Metaspace_lock);
+  assert(c->is_root_chunk(), "Only whole root chunk areas can change owners");
+  _root_chunk_area_lut.get_area_by_address(c->base())->set_transient(v);
+}
+
 // Given a chunk c, which must be "in use" and must not be a root chunk, attempt to
 // enlarge it in place by claiming its trailing buddy.
 //
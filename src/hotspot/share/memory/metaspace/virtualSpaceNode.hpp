@@ -208,6 +208,13 @@ class VirtualSpaceNode : public CHeapObj<mtClass> {
   // On success, true is returned, false otherwise.
   bool attempt_enlarge_chunk(Metachunk* c, FreeChunkListVector* freelists);
 
+  // Returns true if the root chunk area containing c is reserved for transient arenas.
+  bool is_in_transient_area(const Metachunk* c) const;
+
+  // Reserve the root chunk area containing c for transient arenas, or release it again.
+  //  May only be called for root chunks.
+  void set_transient_area(const Metachunk* c, bool v);
+
   // Attempts to uncommit free areas according to the rules set in settings.
   // Returns number of words uncommitted.
   size_t uncommit_free_areas();
@@ -41,8 +41,8 @@ class MallocSite : public AllocationSite {
   MallocSite(const NativeCallStack& stack, MemTag mem_tag) :
     AllocationSite(stack, mem_tag) {}
 
-  void allocate(size_t size)      { _c.allocate(size);   }
-  void deallocate(size_t size)    { _c.deallocate(size); }
+  void allocate(size_t size, size_t count = 1)   { _c.allocate(size, count);   }
+  void deallocate(size_t size, size_t count = 1) { _c.deallocate(size, count); }
 
   // Memory allocated from this code path
   size_t size()  const { return _c.size(); }
@@ -123,6 +123,8 @@ class MallocSiteTable : AllStatic {
   static uint16_t pos_idx_from_marker(uint32_t marker) { return marker & 0xFFFF; }
 
  public:
+  // Marker of an allocation that is not recorded in this table
+  static const uint32_t no_marker = UINT32_MAX;
 
   static bool initialize();
 
@@ -132,6 +134,9 @@ class MallocSiteTable : AllStatic {
   // Access and copy a call stack from this table. Shared lock should be
   // acquired before access the entry.
   static inline bool access_stack(NativeCallStack& stack, const MallocHeader& header) {
+    if (header.mst_marker() == no_marker) {
+      return false;
+    }
     MallocSite* site = malloc_site(header.mst_marker());
     if (site != nullptr) {
       stack = *site->call_stack();
@@ -143,22 +148,26 @@ class MallocSiteTable : AllStatic {
   // Record a new allocation from specified call path.
   // Return true if the allocation is recorded successfully and updates marker
   // to indicate the entry where the allocation information was recorded.
+  // A sampled allocation is recorded weight times.
   // Return false only occurs under rare scenarios:
   //  1. out of memory
   //  2. overflow hash bucket
   static inline bool allocation_at(const NativeCallStack& stack, size_t size,
-      uint32_t* marker, MemTag mem_tag) {
+      uint32_t* marker, MemTag mem_tag, size_t weight = 1) {
     MallocSite* site = lookup_or_add(stack, marker, mem_tag);
-    if (site != nullptr) site->allocate(size);
+    if (site != nullptr) site->allocate(size * weight, weight);
     return site != nullptr;
   }
 
   // Record memory deallocation. marker indicates where the allocation
   // information was recorded.
-  static inline bool deallocation_at(size_t size, uint32_t marker) {
+  static inline bool deallocation_at(size_t size, uint32_t marker, size_t weight = 1) {
+    if (marker == no_marker) {
+      return false;
+    }
     MallocSite* site = malloc_site(marker);
     if (site != nullptr) {
-      site->deallocate(size);
+      site->deallocate(size * weight, weight);
       return true;
     }
     return false;
@@ -161,11 +161,30 @@ bool MallocTracker::initialize(NMT_TrackingLevel level) {
   }
 
   if (level == NMT_detail) {
+    MallocStackSampler::_interval = NMTDetailSampleInterval;
     return MallocSiteTable::initialize();
   }
   return true;
 }
 
+size_t MallocStackSampler::_interval = 0;
+THREAD_LOCAL size_t MallocStackSampler::_mallocs_until_sample = 0;
+THREAD_LOCAL unsigned int MallocStackSampler::_rnd = 0;
+
+// The distance to the next sample is geometrically distributed with mean
+// _interval, which gives every malloc the same 1 in _interval chance of
+// being sampled without the period aliasing with the allocation pattern.
+size_t MallocStackSampler::pick_next_sample() {
+  if (_rnd == 0) {
+    _rnd = (unsigned int)(p2i(&_rnd) >> 3) | 1;
+  }
+  _rnd = os::next_random(_rnd);
+  // Uniform in (0, 1]
+  const double u = (double)(_rnd + 1) / 2147483648.0;
+  const double n = log(u) / log(1.0 - 1.0 / (double)_interval);
+  return 1 + (size_t)MIN2(n, (double)(100 * _interval));
+}
+
 // Record a malloc memory allocation
 void* MallocTracker::record_malloc(void* malloc_base, size_t size, MemTag mem_tag,
   const NativeCallStack& stack)
@@ -176,7 +195,15 @@ void* MallocTracker::record_malloc(void* malloc_base, size_t size, MemTag mem_ta
   MallocMemorySummary::record_malloc(size, mem_tag);
   uint32_t mst_marker = 0;
   if (MemTracker::tracking_level() == NMT_detail) {
-    MallocSiteTable::allocation_at(stack, size, &mst_marker, mem_tag);
+    // Every malloc takes part in the sampling decision, whether its stack
+    // comes from MALLOC_CALLER_PC or from the caller, so that all recorded
+    // mallocs stand for the same weight.
+    if (!MallocStackSampler::is_enabled() ||
+        (MallocStackSampler::should_sample() && !stack.is_empty())) {
+      MallocSiteTable::allocation_at(stack, size, &mst_marker, mem_tag, MallocStackSampler::weight());
+    } else {
+      mst_marker = MallocSiteTable::no_marker;
+    }
   }
 
   // Uses placement global new operator to initialize malloc header
@@ -215,7 +242,7 @@ void* MallocTracker::record_free_block(void* memblock) {
 void MallocTracker::deaccount(MallocHeader::FreeInfo free_info) {
   MallocMemorySummary::record_free(free_info.size, free_info.mem_tag);
   if (MemTracker::tracking_level() == NMT_detail) {
-    MallocSiteTable::deallocation_at(free_info.size, free_info.mst_marker);
+    MallocSiteTable::deallocation_at(free_info.size, free_info.mst_marker, MallocStackSampler::weight());
   }
 }
 
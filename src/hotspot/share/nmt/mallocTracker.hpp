@@ -26,6 +26,7 @@
 #ifndef SHARE_NMT_MALLOCTRACKER_HPP
 #define SHARE_NMT_MALLOCTRACKER_HPP
 
+#include "memory/padded.hpp"
 #include "nmt/mallocHeader.hpp"
 #include "nmt/memTag.hpp"
 #include "nmt/nmtCommon.hpp"
@@ -60,18 +61,18 @@ class MemoryCounter {
     update_peak(size, count);
   }
 
-  inline void allocate(size_t sz) {
-    size_t cnt = Atomic::add(&_count, size_t(1), memory_order_relaxed);
+  inline void allocate(size_t sz, size_t n = 1) {
+    size_t cnt = Atomic::add(&_count, n, memory_order_relaxed);
     if (sz > 0) {
       size_t sum = Atomic::add(&_size, sz, memory_order_relaxed);
       update_peak(sum, cnt);
     }
   }
 
-  inline void deallocate(size_t sz) {
-    assert(count() > 0, "Nothing allocated yet");
+  inline void deallocate(size_t sz, size_t n = 1) {
+    assert(count() >= n, "Nothing allocated yet");
     assert(size() >= sz, "deallocation > allocated");
-    Atomic::dec(&_count, memory_order_relaxed);
+    Atomic::sub(&_count, n, memory_order_relaxed);
     if (sz > 0) {
       Atomic::sub(&_size, sz, memory_order_relaxed);
     }
@@ -145,12 +146,14 @@ class MallocMemorySummary;
 
 // A snapshot of malloc'd memory, includes malloc memory
 // usage by tags and memory used by tracking itself.
+// The counters of each tag, and the total counter, are padded so that
+// threads allocating with different tags do not share cache lines.
 class MallocMemorySnapshot {
   friend class MallocMemorySummary;
 
  private:
-  MallocMemory      _malloc[mt_number_of_tags];
-  MemoryCounter     _all_mallocs;
+  PaddedEnd<MallocMemory>   _malloc[mt_number_of_tags];
+  PaddedEnd<MemoryCounter>  _all_mallocs;
 
 
  public:
@@ -260,6 +263,47 @@ class MallocMemorySummary : AllStatic {
 
 };
 
+// Sampling of the call stacks recorded by detail tracking. With
+// NMTDetailSampleInterval set to N, each malloc has a 1 in N chance to have
+// its call stack walked and recorded in the MallocSiteTable; its call site
+// is then charged N times its size and count. The summary counters are
+// always exact.
+class MallocStackSampler : AllStatic {
+  friend class MallocTracker;
+
+  static size_t _interval;
+  // Number of mallocs left before this thread takes the next sample
+  static THREAD_LOCAL size_t _mallocs_until_sample;
+  static THREAD_LOCAL unsigned int _rnd;
+
+  static size_t pick_next_sample();
+
+ public:
+  static inline bool is_enabled() { return _interval > 1; }
+
+  // The number of mallocs a sampled malloc stands for
+  static inline size_t weight() { return is_enabled() ? _interval : 1; }
+
+  // Returns true if the next malloc of this thread will be sampled, without
+  // taking the decision. Used to skip walking the stack of other mallocs.
+  static inline bool will_sample() {
+    return !is_enabled() || _mallocs_until_sample <= 1;
+  }
+
+  // Returns true if the call stack of the current malloc should be recorded
+  static inline bool should_sample() {
+    if (!is_enabled()) {
+      return true;
+    }
+    if (_mallocs_until_sample > 1) {
+      _mallocs_until_sample--;
+      return false;
+    }
+    _mallocs_until_sample = pick_next_sample();
+    return true;
+  }
+};
+
 // Main class called from MemTracker to track malloc activities
 class MallocTracker : AllStatic {
  public:
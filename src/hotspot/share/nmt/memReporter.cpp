@@ -310,6 +310,10 @@ void MemDetailReporter::report_detail() {
   // Start detail report
   outputStream* out = output();
   out->print_cr("Details:\n");
+  if (MallocStackSampler::is_enabled()) {
+    out->print_cr("(Malloc call sites are sampled 1 in %zu, their totals are estimates.)\n",
+                  MallocStackSampler::weight());
+  }
 
   int num_omitted =
       report_malloc_sites() +
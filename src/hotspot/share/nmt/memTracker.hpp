@@ -42,6 +42,14 @@
 #define CALLER_PC  ((MemTracker::tracking_level() == NMT_detail) ?  \
                     NativeCallStack(1) : FAKE_CALLSTACK)
 
+// CALLER_PC for malloc. Mallocs that will not be sampled for detail tracking
+// get an empty call stack, so that their stack is not walked. The sampling
+// decision itself is taken by MallocTracker::record_malloc().
+#define MALLOC_CALLER_PC ((MemTracker::tracking_level() == NMT_detail) ?  \
+                          (MallocStackSampler::will_sample() ?            \
+                           NativeCallStack(1) : NativeCallStack()) :      \
+                          FAKE_CALLSTACK)
+
 class MemTracker : AllStatic {
   friend class VirtualMemoryTrackerTest;
 
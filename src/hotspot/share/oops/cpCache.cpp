@@ -59,6 +59,7 @@
 #include "runtime/synchronizer.hpp"
 #include "runtime/vm_version.hpp"
 #include "utilities/macros.hpp"
+#include "utilities/resourceHash.hpp"
 
 // Implementation of ConstantPoolCache
 
@@ -75,6 +76,32 @@ static Array<T>* initialize_resolved_entries_array(ClassLoaderData* loader_data,
   return nullptr;
 }
 
+// javac emits one CONSTANT_InvokeDynamic for all call sites of a class with
+// the same bootstrap specifier, so many indy entries may refer to the same
+// constant pool index. Remember the first one for each, so that sites which
+// can share a CallSite find it without scanning all indy entries.
+static Array<u2>* initialize_indy_shared_index_array(ClassLoaderData* loader_data,
+                                                     const GrowableArray<ResolvedIndyEntry>& entries, TRAPS) {
+  ResourceMark rm(THREAD);
+  ResourceHashtable<u2, u2, 256, AnyObj::RESOURCE_AREA, mtClass> first_entry;
+  GrowableArray<u2> shared_index(entries.length());
+  bool has_shared = false;
+  for (int i = 0; i < entries.length(); i++) {
+    bool created;
+    u2* first = first_entry.put_if_absent(entries.at(i).constant_pool_index(), (u2)i, &created);
+    has_shared |= !created;
+    shared_index.append(*first);
+  }
+  if (!has_shared) {
+    return nullptr;
+  }
+  Array<u2>* result = MetadataFactory::new_array<u2>(loader_data, shared_index.length(), CHECK_NULL);
+  for (int i = 0; i < shared_index.length(); i++) {
+    result->at_put(i, shared_index.at(i));
+  }
+  return result;
+}
+
 void ConstantPoolCache::set_direct_or_vtable_call(Bytecodes::Code invoke_code,
                                                        int method_index,
                                                        const methodHandle& method,
@@ -385,9 +412,11 @@ ConstantPoolCache* ConstantPoolCache::allocate(ClassLoaderData* loader_data,
   Array<ResolvedFieldEntry>* resolved_field_entries = initialize_resolved_entries_array(loader_data, field_entries, CHECK_NULL);
   Array<ResolvedIndyEntry>* resolved_indy_entries = initialize_resolved_entries_array(loader_data, indy_entries, CHECK_NULL);
   Array<ResolvedMethodEntry>* resolved_method_entries = initialize_resolved_entries_array(loader_data, method_entries, CHECK_NULL);
+  Array<u2>* indy_shared_index = initialize_indy_shared_index_array(loader_data, indy_entries, CHECK_NULL);
 
   return new (loader_data, size, MetaspaceObj::ConstantPoolCacheType, THREAD)
-              ConstantPoolCache(invokedynamic_map, resolved_indy_entries, resolved_field_entries, resolved_method_entries);
+              ConstantPoolCache(invokedynamic_map, resolved_indy_entries, resolved_field_entries, resolved_method_entries,
+                                indy_shared_index);
 }
 
 // Record the GC marking cycle when redefined vs. when found in the loom stack chunks.
@@ -589,6 +618,10 @@ void ConstantPoolCache::deallocate_contents(ClassLoaderData* data) {
   set_resolved_references(OopHandle());
   MetadataFactory::free_array<u2>(data, _reference_map);
   set_reference_map(nullptr);
+  if (_indy_shared_index != nullptr) {
+    MetadataFactory::free_array<u2>(data, _indy_shared_index);
+    _indy_shared_index = nullptr;
+  }
 #if INCLUDE_CDS
   if (_resolved_indy_entries != nullptr) {
     MetadataFactory::free_array<ResolvedIndyEntry>(data, _resolved_indy_entries);
@@ -707,6 +740,7 @@ void ConstantPoolCache::metaspace_pointers_do(MetaspaceClosure* it) {
   log_trace(aot)("Iter(ConstantPoolCache): %p", this);
   it->push(&_constant_pool);
   it->push(&_reference_map);
+  it->push(&_indy_shared_index);
   if (_resolved_indy_entries != nullptr) {
     it->push(&_resolved_indy_entries, MetaspaceClosure::_writable);
   }
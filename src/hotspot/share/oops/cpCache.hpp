@@ -75,6 +75,10 @@ class ConstantPoolCache: public MetaspaceObj {
   Array<ResolvedFieldEntry>*  _resolved_field_entries;
   Array<ResolvedMethodEntry>* _resolved_method_entries;
 
+  // For each indy entry, the first indy entry that refers to the same
+  // CONSTANT_InvokeDynamic. Null if no two indy entries refer to the same one.
+  Array<u2>*                  _indy_shared_index;
+
   // Sizing
   DEBUG_ONLY(friend class ClassVerifier;)
 
@@ -94,7 +98,8 @@ class ConstantPoolCache: public MetaspaceObj {
   ConstantPoolCache(const intStack& invokedynamic_references_map,
                     Array<ResolvedIndyEntry>* indy_info,
                     Array<ResolvedFieldEntry>* field_entries,
-                    Array<ResolvedMethodEntry>* mehtod_entries);
+                    Array<ResolvedMethodEntry>* mehtod_entries,
+                    Array<u2>* indy_shared_index);
 
   // Initialization
   void initialize(const intArray& invokedynamic_references_map);
@@ -177,6 +182,7 @@ class ConstantPoolCache: public MetaspaceObj {
   Array<ResolvedIndyEntry>* resolved_indy_entries()          { return _resolved_indy_entries; }
   inline ResolvedIndyEntry* resolved_indy_entry_at(int index) const;
   inline int resolved_indy_entries_length() const;
+  inline int shared_indy_index(int index) const;
   void print_resolved_indy_entries(outputStream* st)   const;
 
   Array<ResolvedMethodEntry>* resolved_method_entries()          { return _resolved_method_entries; }
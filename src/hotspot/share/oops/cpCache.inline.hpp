@@ -37,12 +37,14 @@
 inline ConstantPoolCache::ConstantPoolCache(const intStack& invokedynamic_references_map,
                                             Array<ResolvedIndyEntry>* invokedynamic_info,
                                             Array<ResolvedFieldEntry>* field_entries,
-                                            Array<ResolvedMethodEntry>* method_entries) :
+                                            Array<ResolvedMethodEntry>* method_entries,
+                                            Array<u2>* indy_shared_index) :
                                                   _constant_pool(nullptr),
                                                   _gc_epoch(0),
                                                   _resolved_indy_entries(invokedynamic_info),
                                                   _resolved_field_entries(field_entries),
-                                                  _resolved_method_entries(method_entries) {
+                                                  _resolved_method_entries(method_entries),
+                                                  _indy_shared_index(indy_shared_index) {
   CDS_JAVA_HEAP_ONLY(_archived_references_index = -1;)
 }
 
@@ -75,4 +77,8 @@ inline ResolvedIndyEntry* ConstantPoolCache::resolved_indy_entry_at(int index) c
 inline int ConstantPoolCache::resolved_indy_entries_length() const {
   return _resolved_indy_entries->length();
 }
+
+inline int ConstantPoolCache::shared_indy_index(int index) const {
+  return _indy_shared_index == nullptr ? index : _indy_shared_index->at(index);
+}
 #endif // SHARE_OOPS_CPCACHE_INLINE_HPP
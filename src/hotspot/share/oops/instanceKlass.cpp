@@ -2501,8 +2501,9 @@ inline DependencyContext InstanceKlass::dependencies() {
   return dep_context;
 }
 
-void InstanceKlass::mark_dependent_nmethods(DeoptimizationScope* deopt_scope, KlassDepChange& changes) {
-  dependencies().mark_dependent_nmethods(deopt_scope, changes);
+void InstanceKlass::mark_dependent_nmethods(DeoptimizationScope* deopt_scope, KlassDepChange& changes,
+                                            CheckedNMethodSet* checked) {
+  dependencies().mark_dependent_nmethods(deopt_scope, changes, checked);
 }
 
 void InstanceKlass::add_dependent_nmethod(nmethod* nm) {
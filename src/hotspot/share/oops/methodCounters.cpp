@@ -31,6 +31,7 @@
 MethodCounters::MethodCounters(const methodHandle& mh) :
   _prev_time(0),
   _rate(0),
+  _compiled_bytes(0),
   _highest_comp_level(0),
   _highest_osr_comp_level(0)
 {
@@ -41,6 +41,7 @@ class MethodCounters : public MetaspaceObj {
   int               _invoke_mask;                 // per-method Tier0InvokeNotifyFreqLog
   int               _backedge_mask;               // per-method Tier0BackedgeNotifyFreqLog
   int               _prev_event_count;            // Total number of events saved at previous callback
+  int               _compiled_bytes;              // Bytecodes, including inlined ones, of the last compilation
 #if COMPILER2_OR_JVMCI
   u2                _interpreter_throwout_count; // Count of times method was exited via exception while interpreting
 #endif
@@ -101,6 +102,8 @@ class MethodCounters : public MetaspaceObj {
   void set_prev_time(jlong time)                 { _prev_time = time; }
   float rate() const                             { return _rate; }
   void set_rate(float rate)                      { _rate = rate; }
+  int compiled_bytes() const                     { return _compiled_bytes; }
+  void set_compiled_bytes(int bytes)             { _compiled_bytes = bytes; }
 
   int highest_comp_level() const                 { return _highest_comp_level;  }
   void set_highest_comp_level(int level)         { _highest_comp_level = (u1)level; }
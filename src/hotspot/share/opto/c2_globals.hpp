@@ -259,6 +259,10 @@
   develop(bool, TraceOptimizeFill, false,                                   \
           "print detailed information about fill conversion")               \
                                                                             \
+  product(bool, OptimizeSearchLoops, false, DIAGNOSTIC,                      \
+          "Find the exiting iteration of loops that search a byte array "   \
+          "for an invariant value with a vectorized intrinsic")             \
+                                                                            \
   develop(bool, OptoCoalesce, true,                                         \
           "Use Conservative Copy Coalescing in the Register Allocator")     \
                                                                             \
@@ -281,6 +285,10 @@
   product(bool, UseFPUForSpilling, false,                                   \
           "Spill integer registers to FPU instead of stack when possible")  \
                                                                             \
+  product(bool, RematerializeVectorConstants, false, DIAGNOSTIC,            \
+          "Rematerialize vector broadcasts and masks loaded from the "      \
+          "constant table at their uses instead of spilling them")          \
+                                                                            \
   develop_pd(intx, RegisterCostAreaRatio,                                   \
           "Spill selection in reg allocator: scale area by (X/64K) before " \
           "adding cost")                                                    \
@@ -433,6 +441,12 @@
   product(bool, UseOnlyInlinedBimorphic, true,                              \
           "Don't use BimorphicInlining if can't inline a second method")    \
                                                                             \
+  product(intx, PolymorphicInliningLimit, 2, DIAGNOSTIC,                    \
+          "Maximum number of profiled receivers inlined behind type "       \
+          "checks at a virtual call site. Values above 2 also need a "      \
+          "larger TypeProfileWidth")                                        \
+          range(2, 8)                                                       \
+                                                                            \
   develop(bool, SubsumeLoads, true,                                         \
           "Attempt to compile while subsuming loads into machine "          \
           "instructions.")                                                  \
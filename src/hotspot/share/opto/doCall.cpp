@@ -251,9 +251,11 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
           speculative_receiver_type = nullptr;
         }
       }
+      // Up to PolymorphicInliningLimit receivers are inlined behind a chain
+      // of type checks, most frequent first.
+      bool polymorphic = UseBimorphicInlining && morphism >= 2 && morphism <= PolymorphicInliningLimit;
       if (receiver_method == nullptr &&
-          (have_major_receiver || morphism == 1 ||
-           (morphism == 2 && UseBimorphicInlining))) {
+          (have_major_receiver || morphism == 1 || polymorphic)) {
         // receiver_method = profile.method();
         // Profiles do not suggest methods now.  Look it up in the major receiver.
         receiver_method = callee->resolve_invoke(jvms->method()->holder(),
@@ -264,32 +266,39 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
         CallGenerator* hit_cg = this->call_generator(receiver_method,
               vtable_index, !call_does_dispatch, jvms, allow_inline, prof_factor);
         if (hit_cg != nullptr) {
-          // Look up second receiver.
-          CallGenerator* next_hit_cg = nullptr;
-          ciMethod* next_receiver_method = nullptr;
-          if (morphism == 2 && UseBimorphicInlining) {
-            next_receiver_method = callee->resolve_invoke(jvms->method()->holder(),
-                                                               profile.receiver(1));
-            if (next_receiver_method != nullptr) {
-              next_hit_cg = this->call_generator(next_receiver_method,
-                                  vtable_index, !call_does_dispatch, jvms,
-                                  allow_inline, prof_factor);
-              if (next_hit_cg != nullptr && !next_hit_cg->is_inline() &&
-                  have_major_receiver && UseOnlyInlinedBimorphic) {
-                  // Skip if we can't inline second receiver's method
-                  next_hit_cg = nullptr;
+          // Look up the remaining receivers.
+          CallGenerator* next_hit_cg[ciCallProfile::MorphismLimit] = {};
+          ciMethod* next_receiver_method[ciCallProfile::MorphismLimit] = {};
+          bool all_receivers_hit = polymorphic;
+          if (polymorphic) {
+            for (int i = 1; i < morphism; i++) {
+              next_receiver_method[i] = callee->resolve_invoke(jvms->method()->holder(),
+                                                               profile.receiver(i));
+              if (next_receiver_method[i] != nullptr) {
+                next_hit_cg[i] = this->call_generator(next_receiver_method[i],
+                                    vtable_index, !call_does_dispatch, jvms,
+                                    allow_inline, prof_factor);
+                if (next_hit_cg[i] != nullptr && !next_hit_cg[i]->is_inline() &&
+                    ((have_major_receiver && UseOnlyInlinedBimorphic) || morphism > 2)) {
+                  // Skip if we can't inline this receiver's method
+                  next_hit_cg[i] = nullptr;
+                }
+              }
+              if (next_hit_cg[i] == nullptr) {
+                all_receivers_hit = false;
               }
             }
           }
           CallGenerator* miss_cg;
-          Deoptimization::DeoptReason reason = (morphism == 2
+          Deoptimization::DeoptReason reason = (polymorphic
                                                ? Deoptimization::Reason_bimorphic
                                                : Deoptimization::reason_class_check(speculative_receiver_type != nullptr));
-          if ((morphism == 1 || (morphism == 2 && next_hit_cg != nullptr)) &&
+          if ((morphism == 1 || (polymorphic && all_receivers_hit)) &&
               !too_many_traps_or_recompiles(caller, bci, reason)
              ) {
             // Generate uncommon trap for class check failure path
-            // in case of monomorphic or bimorphic virtual call site.
+            // in case of monomorphic or polymorphic virtual call site
+            // where all profiled receivers are covered.
             miss_cg = CallGenerator::for_uncommon_trap(callee, reason,
                         Deoptimization::Action_maybe_recompile);
           } else {
@@ -299,12 +308,22 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
                                                 : CallGenerator::for_virtual_call(callee, vtable_index));
           }
           if (miss_cg != nullptr) {
-            if (next_hit_cg != nullptr) {
+            // Build the guards from the least to the most frequent receiver, so that
+            // the most frequent one is checked first. Each guard's hit probability is
+            // conditional on the receivers checked before it having missed.
+            int remaining_count = 0;
+            for (int i = morphism - 1; i >= 1 && miss_cg != nullptr; i--) {
+              remaining_count += profile.receiver_count(i);
+              if (next_hit_cg[i] == nullptr) {
+                continue;
+              }
               assert(speculative_receiver_type == nullptr, "shouldn't end up here if we used speculation");
-              trace_type_profile(C, jvms->method(), jvms, next_receiver_method, profile.receiver(1), site_count, profile.receiver_count(1));
+              float next_hit_prob = (i == morphism - 1) ? PROB_MAX
+                                                        : (float)profile.receiver_count(i) / (float)remaining_count;
+              trace_type_profile(C, jvms->method(), jvms, next_receiver_method[i], profile.receiver(i), site_count, profile.receiver_count(i));
               // We don't need to record dependency on a receiver here and below.
               // Whenever we inline, the dependency is added by Parse::Parse().
-              miss_cg = CallGenerator::for_predicted_call(profile.receiver(1), miss_cg, next_hit_cg, PROB_MAX);
+              miss_cg = CallGenerator::for_predicted_call(profile.receiver(i), miss_cg, next_hit_cg[i], next_hit_prob);
             }
             if (miss_cg != nullptr) {
               ciKlass* k = speculative_receiver_type != nullptr ? speculative_receiver_type : profile.receiver(0);
@@ -526,6 +526,7 @@ bool ConnectionGraph::has_been_reduced(PhiNode* n, SafePointNode* sfpt) const {
 //  - Phi -> AddP -> Load
 //  - Phi -> CastPP -> SafePoints
 //  - Phi -> CastPP -> AddP -> Load
+//  - Phi -> CastPP -> CmpP/N
 bool ConnectionGraph::can_reduce_check_users(Node* n, uint nesting) const {
   for (DUIterator_Fast imax, i = n->fast_outs(imax); i < imax; i++) {
     Node* use = n->fast_out(i);
@@ -552,6 +553,13 @@ bool ConnectionGraph::can_reduce_check_users(Node* n, uint nesting) const {
           return false;
         }
       }
+    } else if (nesting > 0 && (use->Opcode() == Op_CmpP || use->Opcode() == Op_CmpN)) {
+      // The cast does not change the pointer, so the Cmp is reduced as if it
+      // used the Phi. See reduce_phi.
+      if (!can_reduce_cmp(n, use)) {
+        NOT_PRODUCT(if (TraceReduceAllocationMerges) tty->print_cr("Can NOT reduce Phi %d on invocation %d. CmpP/N %d of CastPP %d isn't reducible.", n->in(1)->_idx, _invocation, use->_idx, n->_idx);)
+        return false;
+      }
     } else if (nesting > 0) {
       NOT_PRODUCT(if (TraceReduceAllocationMerges) tty->print_cr("Can NOT reduce Phi %d on invocation %d. Unsupported user %s at nesting level %d.", n->_idx, _invocation, use->Name(), nesting);)
       return false;
@@ -1303,6 +1311,21 @@ void ConnectionGraph::reduce_phi(PhiNode* ophi, GrowableArray<Node *>  &alloc_wo
     }
   }
 
+  // A CmpP/N of a CastPP compares the same pointer as the Phi itself. Move it
+  // to the Phi so that it is split together with the Cmps of the Phi.
+  for (uint i = 0; i < castpps.size(); i++) {
+    Node* castpp = castpps.at(i);
+    for (int j = castpp->outcnt()-1; j >= 0;) {
+      Node* use = castpp->raw_out(j);
+      if (use->Opcode() == Op_CmpP || use->Opcode() == Op_CmpN) {
+        _igvn->replace_input_of(use, use->in(1) == castpp ? 1 : 2, ophi);
+        others.push(use);
+      }
+      --j;
+      j = MIN2(j, (int)castpp->outcnt()-1);
+    }
+  }
+
   // CastPPs need to be processed before Cmps because during the process of
   // splitting CastPPs we make reference to the inputs of the Cmp that is used
   // by the If controlling the CastPP.
@@ -1320,6 +1343,20 @@ void ConnectionGraph::reduce_phi(PhiNode* ophi, GrowableArray<Node *>  &alloc_wo
     }
   }
 
+#ifndef PRODUCT
+  if (PrintEliminateAllocations) {
+    uint sr_inputs = 0;
+    for (uint i = 1; i < ophi->req(); i++) {
+      JavaObjectNode* ptn = unique_java_object(ophi->in(i));
+      if (ptn != nullptr && ptn->scalar_replaceable()) {
+        sr_inputs++;
+      }
+    }
+    tty->print_cr("++++ Reduced merge: %d Phi of %d scalar replaceable allocations (%d inputs)",
+                  ophi->_idx, sr_inputs, ophi->req() - 1);
+  }
+#endif
+
   _igvn->set_delay_transform(delay);
 }
 
@@ -32,6 +32,7 @@
 #include "opto/connode.hpp"
 #include "opto/convertnode.hpp"
 #include "opto/divnode.hpp"
+#include "opto/intrinsicnode.hpp"
 #include "opto/loopnode.hpp"
 #include "opto/mulnode.hpp"
 #include "opto/movenode.hpp"
@@ -4007,3 +4008,319 @@ bool PhaseIdealLoop::intrinsify_fill(IdealLoopTree* lpt) {
 
   return true;
 }
+
+//=============================================================================
+// Process all the loops in the loop tree and let search loops skip the
+// iterations before their early exit with an intrinsic.
+bool PhaseIdealLoop::do_intrinsify_search() {
+  bool changed = false;
+  for (LoopTreeIterator iter(_ltree_root); !iter.done(); iter.next()) {
+    IdealLoopTree* lpt = iter.current();
+    changed |= intrinsify_search(lpt);
+  }
+  return changed;
+}
+
+// Examine an inner loop looking for a unit stride search of a byte array
+// for an invariant value:
+//
+//   for (int i = init; i < limit; i++) {
+//     if (a[i] == c) break;
+//   }
+//
+// The early exit must be the only control flow besides the loop exit test
+// and the body must not contain anything but the load, the compare and the
+// address computation.
+bool PhaseIdealLoop::match_search_loop(IdealLoopTree* lpt, LoadNode*& load, Node*& value, Node*& offset) {
+  const char* msg = nullptr;
+  Node* msg_node = nullptr;
+
+  load = nullptr;
+  value = nullptr;
+  offset = nullptr;
+
+  CountedLoopNode* head = lpt->_head->as_CountedLoop();
+  CountedLoopEndNode* loop_exit = head->loopexit();
+
+  // Find the early exit. It has to be the first thing in the loop and
+  // directly followed by the loop exit test.
+  IfNode* iff = nullptr;
+  Node* iff_exit = nullptr;
+  for (uint i = 0; msg == nullptr && i < lpt->_body.size(); i++) {
+    Node* n = lpt->_body.at(i);
+    if (n->outcnt() == 0) continue; // Ignore dead
+    if (n->is_Store() || n->is_LoadStore() || n->is_Call() || n->is_SafePoint() || n->is_MemBar()) {
+      msg = "side effect in loop";
+      msg_node = n;
+    } else if (n->is_If() && n != loop_exit) {
+      if (iff != nullptr) {
+        msg = "extra control flow";
+        msg_node = n;
+      }
+      iff = n->as_If();
+    }
+  }
+
+  if (iff == nullptr) {
+    // No early exit
+    return false;
+  }
+
+  if (msg == nullptr && head->stride_con() != 1) {
+    msg = "non-unit stride";
+  }
+
+  if (msg == nullptr) {
+    iff_exit = lpt->is_loop_exit(iff);
+    if (iff_exit == nullptr || iff->in(0) != head || loop_exit->in(0) != iff->proj_out(1 - iff_exit->as_Proj()->_con)) {
+      msg = "early exit not at loop head";
+      msg_node = iff;
+    }
+  }
+
+  // The loop must be left when the loaded value equals the invariant.
+  CmpNode* cmp = nullptr;
+  if (msg == nullptr) {
+    BoolNode* bol = iff->in(1)->isa_Bool();
+    if (bol == nullptr || bol->in(1)->Opcode() != Op_CmpI) {
+      msg = "unhandled exit condition";
+      msg_node = iff->in(1);
+    } else {
+      BoolTest::mask test = iff_exit->is_IfTrue() ? bol->_test._test : bol->_test.negate();
+      cmp = bol->in(1)->as_Cmp();
+      Node* in1 = cmp->in(1);
+      Node* in2 = cmp->in(2);
+      if (lpt->is_invariant(in1)) {
+        swap(in1, in2);
+      }
+      if (test != BoolTest::eq) {
+        msg = "exit is not on equality";
+        msg_node = bol;
+      } else if (!in1->is_Load() || (in1->Opcode() != Op_LoadB && in1->Opcode() != Op_LoadUB)) {
+        msg = "not a byte load";
+        msg_node = in1;
+      } else if (!lpt->is_invariant(in2)) {
+        msg = "variant search value";
+        msg_node = in2;
+      } else {
+        load = in1->as_Load();
+        value = in2;
+      }
+    }
+  }
+
+  if (msg == nullptr) {
+    const TypeAryPtr* ary_t = _igvn.type(load->in(MemNode::Address))->isa_aryptr();
+    if (ary_t == nullptr || ary_t->elem()->array_element_basic_type() != T_BYTE ||
+        C->get_alias_index(load->adr_type()) != C->get_alias_index(TypeAryPtr::BYTES)) {
+      msg = "not a byte array";
+    } else if (load->is_mismatched_access()) {
+      msg = "mismatched load";
+    } else if (!lpt->is_invariant(load->in(MemNode::Memory))) {
+      msg = "variant memory";
+    } else if (!load->in(MemNode::Address)->is_AddP()) {
+      msg = "can't handle load address";
+    }
+    msg_node = load;
+  }
+
+  // The intrinsic matches on the low byte of the value. The value must fit
+  // the load's range for that to agree with the int compare in the loop.
+  if (msg == nullptr) {
+    const TypeInt* value_t = _igvn.type(value)->isa_int();
+    bool is_signed = load->Opcode() == Op_LoadB;
+    if (value_t == nullptr ||
+        value_t->_lo < (is_signed ? min_jbyte : 0) ||
+        value_t->_hi > (is_signed ? max_jbyte : max_jubyte)) {
+      msg = "search value out of byte range";
+      msg_node = value;
+    }
+  }
+
+  // Make sure the address expression can be handled. It should be
+  // head->phi + con. head->phi might have a ConvI2L(CastII()).
+  Node* cast = nullptr;
+  Node* conv = nullptr;
+  if (msg == nullptr) {
+    Node* elements[4];
+    bool found_index = false;
+    int count = load->in(MemNode::Address)->as_AddP()->unpack_offsets(elements, ARRAY_SIZE(elements));
+    if (count == -1) {
+      msg = "malformed address expression";
+    }
+    for (int e = 0; msg == nullptr && e < count; e++) {
+      Node* n = elements[e];
+      if (n->is_Con() && offset == nullptr) {
+        offset = n;
+        continue;
+      }
+#ifdef _LP64
+      if (n->Opcode() == Op_ConvI2L && conv == nullptr) {
+        conv = n;
+        n = n->in(1);
+      }
+#endif
+      if (n->Opcode() == Op_CastII && n->as_CastII()->has_range_check() && cast == nullptr) {
+        // Skip range check dependent CastII nodes
+        cast = n;
+        n = n->in(1);
+      }
+      if (n == head->phi() && !found_index) {
+        found_index = true;
+      } else {
+        msg = "unhandled node in address";
+        msg_node = elements[e];
+      }
+    }
+    if (msg == nullptr && (!found_index || offset == nullptr)) {
+      msg = "missing index or offset";
+    }
+  }
+
+  // Now make sure all the other nodes in the loop can be handled
+  if (msg == nullptr) {
+    VectorSet ok;
+    ok.set(head->_idx);
+    ok.set(loop_exit->_idx);
+    ok.set(head->phi()->_idx);
+    ok.set(head->incr()->_idx);
+    ok.set(loop_exit->cmp_node()->_idx);
+    ok.set(loop_exit->in(1)->_idx);
+    ok.set(iff->_idx);
+    ok.set(iff->in(1)->_idx);
+    ok.set(cmp->_idx);
+    ok.set(load->_idx);
+    if (cast != nullptr) ok.set(cast->_idx);
+    if (conv != nullptr) ok.set(conv->_idx);
+
+    for (uint i = 0; msg == nullptr && i < lpt->_body.size(); i++) {
+      Node* n = lpt->_body.at(i);
+      if (n->outcnt() == 0) continue; // Ignore dead
+      if (ok.test(n->_idx)) continue;
+      // Backedge and early exit projections are ok
+      if (n->is_IfProj() && (n->in(0) == loop_exit || n->in(0) == iff)) continue;
+      if (!n->is_AddP()) {
+        msg = "unhandled node";
+        msg_node = n;
+      }
+    }
+  }
+
+#ifndef PRODUCT
+  if (TraceLoopOpts && msg != nullptr && Verbose) {
+    tty->print_cr("not search intrinsic candidate: %s", msg);
+    if (msg_node != nullptr) msg_node->dump();
+  }
+#endif
+
+  return msg == nullptr;
+}
+
+// Let a search loop start at its exiting iteration. An intrinsic finds the
+// first match in [init, limit) and the loop is then entered at that index,
+// or at its last iteration if there is no match. The remaining scalar
+// iterations take the early exit or the normal exit as before, so the exit
+// paths and the values live out of the loop are unchanged. The skipped
+// iterations only load and compare, and they are covered by the predicates
+// that were hoisted for the whole iteration range.
+bool PhaseIdealLoop::intrinsify_search(IdealLoopTree* lpt) {
+  // Only for counted inner loops
+  if (!lpt->is_counted() || !lpt->is_innermost()) {
+    return false;
+  }
+
+  CountedLoopNode* head = lpt->_head->as_CountedLoop();
+  if (!head->is_valid_counted_loop(T_INT) || !head->is_normal_loop() ||
+      head->is_search_intrinsified() || head->has_exact_trip_count()) {
+    return false;
+  }
+
+  // Very short searches are not worth the setup of the intrinsic.
+  const float min_profile_trip_cnt = 16.0f;
+  if (head->profile_trip_cnt() != COUNT_UNKNOWN && head->profile_trip_cnt() < min_profile_trip_cnt) {
+    return false;
+  }
+
+  if (!Matcher::match_rule_supported(Op_StrIndexOfChar)) {
+    return false;
+  }
+
+  head->verify_strip_mined(1);
+
+  LoadNode* load = nullptr;
+  Node* value = nullptr;
+  Node* offset = nullptr;
+  if (!match_search_loop(lpt, load, value, offset)) {
+    return false;
+  }
+
+#ifndef PRODUCT
+  if (TraceLoopOpts) {
+    tty->print("SearchIntrinsic ");
+    lpt->dump_head();
+  }
+#endif
+
+  Node* init = head->init_trip();
+  Node* limit = head->limit();
+  Node* entry = head->skip_strip_mined()->in(LoopNode::EntryControl);
+  Node* base = load->in(MemNode::Address)->as_AddP()->in(AddPNode::Base);
+
+  // Build the address of the first element searched
+  Node* index = init;
+#ifdef _LP64
+  index = new ConvI2LNode(index);
+  _igvn.register_new_node_with_optimizer(index);
+#endif
+  Node* from = new AddPNode(base, base, index);
+  _igvn.register_new_node_with_optimizer(from);
+  from = new AddPNode(base, from, offset);
+  _igvn.register_new_node_with_optimizer(from);
+
+  // The loop is entered, so the element at init is loaded at least once. The
+  // limit may still not be above init, e.g. for a loop that was a do-while
+  // loop: search that element only, so that the intrinsic never reads more
+  // than the loop does.
+  Node* count = new SubINode(limit, init);
+  _igvn.register_new_node_with_optimizer(count);
+  count = new MaxINode(count, _igvn.intcon(1));
+  _igvn.register_new_node_with_optimizer(count);
+  Node* ch = new AndINode(value, _igvn.intcon(max_jubyte));
+  _igvn.register_new_node_with_optimizer(ch);
+
+  Node* found = new StrIndexOfCharNode(entry, load->in(MemNode::Memory), from, count, ch, StrIntrinsicNode::L);
+  _igvn.register_new_node_with_optimizer(found);
+
+  // found is the offset of the first match from init, or -1. The last
+  // element searched is the one at init + count - 1.
+  Node* last = new AddINode(init, _igvn.intcon(-1));
+  _igvn.register_new_node_with_optimizer(last);
+  last = new AddINode(last, count);
+  _igvn.register_new_node_with_optimizer(last);
+  Node* at_match = new AddINode(init, found);
+  _igvn.register_new_node_with_optimizer(at_match);
+  Node* cmp = new CmpINode(found, _igvn.intcon(0));
+  _igvn.register_new_node_with_optimizer(cmp);
+  Node* bol = new BoolNode(cmp, BoolTest::lt);
+  _igvn.register_new_node_with_optimizer(bol);
+  Node* start = CMoveNode::make(bol, at_match, last, TypeInt::INT);
+  _igvn.register_new_node_with_optimizer(start);
+
+  // Keep the type of the induction variable within the original range
+  start = new MinINode(start, last);
+  _igvn.register_new_node_with_optimizer(start);
+  start = new MaxINode(start, init);
+  _igvn.register_new_node_with_optimizer(start);
+
+  _igvn.replace_input_of(head->phi(), LoopNode::EntryControl, start);
+  head->mark_search_intrinsified();
+
+#ifndef PRODUCT
+  if (TraceLoopOpts) {
+    tty->print("SearchIntrinsic intrinsic ");
+    found->dump();
+  }
+#endif
+
+  return true;
+}
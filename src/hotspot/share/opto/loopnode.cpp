@@ -4883,6 +4883,12 @@ void PhaseIdealLoop::build_and_optimize() {
     }
   }
 
+  if (OptimizeSearchLoops && UseLoopPredicate && C->has_loops() && !C->major_progress()) {
+    if (do_intrinsify_search()) {
+      C->set_major_progress();
+    }
+  }
+
   // Perform iteration-splitting on inner loops.  Split iterations to avoid
   // range checks or one-shot null checks.
 
@@ -85,6 +85,7 @@ class LoopNode : public RegionNode {
          MultiversionSlowLoop         = 2<<17,
          MultiversionDelayedSlowLoop  = 3<<17,
          MultiversionFlagsMask        = 3<<17,
+         SearchIntrinsified           = 1<<19,
        };
   char _unswitch_count;
   enum { _unswitch_max=3 };
@@ -108,6 +109,7 @@ class LoopNode : public RegionNode {
   bool is_subword_loop() const { return _loop_flags & SubwordLoop; }
   bool is_loop_nest_inner_loop() const { return _loop_flags & LoopNestInnerLoop; }
   bool is_loop_nest_outer_loop() const { return _loop_flags & LoopNestLongOuterLoop; }
+  bool is_search_intrinsified() const { return _loop_flags & SearchIntrinsified; }
 
   void mark_partial_peel_failed() { _loop_flags |= PartialPeelFailed; }
   void mark_was_slp() { _loop_flags |= WasSlpAnalyzed; }
@@ -121,6 +123,7 @@ class LoopNode : public RegionNode {
   void mark_subword_loop() { _loop_flags |= SubwordLoop; }
   void mark_loop_nest_inner_loop() { _loop_flags |= LoopNestInnerLoop; }
   void mark_loop_nest_outer_loop() { _loop_flags |= LoopNestLongOuterLoop; }
+  void mark_search_intrinsified() { _loop_flags |= SearchIntrinsified; }
 
   int unswitch_max() { return _unswitch_max; }
   int unswitch_count() { return _unswitch_count; }
@@ -1613,6 +1616,11 @@ class PhaseIdealLoop : public PhaseTransform {
   bool match_fill_loop(IdealLoopTree* lpt, Node*& store, Node*& store_value,
                        Node*& shift, Node*& offset);
 
+  // Conversion of search loops with an early exit into a vectorized prefix
+  bool do_intrinsify_search();
+  bool intrinsify_search(IdealLoopTree* lpt);
+  bool match_search_loop(IdealLoopTree* lpt, LoadNode*& load, Node*& value, Node*& offset);
+
 private:
   // Return a type based on condition control flow
   const TypeInt* filtered_type( Node *n, Node* n_ctrl);
@@ -501,6 +501,17 @@ bool MachNode::rematerialize() const {
     }
   }
 
+  // Vector constants loaded from the constant table are hoisted out of loops
+  // and shared by all their uses. Rematerializing them costs a memory load at
+  // every use, the same as a reload, but makes them the cheapest live ranges
+  // to spill. Let them compete for vector registers like other values instead.
+  if (!RematerializeVectorConstants && is_MachConstant()) {
+    int op = ideal_Opcode();
+    if (op == Op_Replicate || op == Op_MaskAll) {
+      return false;
+    }
+  }
+
   // Defining flags - can't spill these! Must remateralize.
   if (ideal_reg() == Op_RegFlags) {
     return true;
@@ -1612,7 +1612,13 @@ bool SuperWord::implemented(const Node_List* pack, const uint size) const {
         retValue = ReductionNode::implemented(opc, size, arith_type->basic_type());
       }
     } else if (VectorNode::is_convert_opcode(opc)) {
-      retValue = VectorCastNode::implemented(opc, size, velt_basic_type(p0->in(1)), velt_basic_type(p0));
+      BasicType src_bt = velt_basic_type(p0->in(1));
+      if (opc == Op_ConvI2L && (src_bt == T_BOOLEAN || src_bt == T_CHAR)) {
+        // Zero extending subword loads: cast the loaded lanes to long directly.
+        retValue = VectorCastNode::load_extension_implemented(size, src_bt, T_LONG);
+      } else {
+        retValue = VectorCastNode::implemented(opc, size, src_bt, velt_basic_type(p0));
+      }
     } else if (VectorNode::is_minmax_opcode(opc) && is_subword_type(velt_basic_type(p0))) {
       // Java API for Math.min/max operations supports only int, long, float
       // and double types. Thus, avoid generating vector min/max nodes for
@@ -2260,7 +2266,12 @@ bool SuperWord::is_vector_use(Node* use, int u_idx) const {
     return true;
   }
 
-  if (!is_velt_basic_type_compatible_use_def(use, def)) {
+  if (is_subword_load_extended_by_use(use, def)) {
+    // The loaded lanes are extended with a vector cast before the use.
+    if (!VectorCastNode::load_extension_implemented(u_pk->size(), velt_basic_type(def), velt_basic_type(use))) {
+      return false;
+    }
+  } else if (!is_velt_basic_type_compatible_use_def(use, def)) {
     return false;
   }
 
@@ -2623,6 +2634,29 @@ const Type* VLoopTypes::container_type(Node* n) const {
   return t;
 }
 
+// Java extends subword loads to int before any arithmetic, and the element type
+// of operations is only narrowed when all their uses are narrow. A wider use of
+// a pack of subword loads, such as an int reduction of byte[] elements, gets the
+// loaded lanes extended with a vector cast, which keeps the values of the scalar
+// loads.
+bool VLoopTypes::is_subword_load_extended_by_use(const Node* use, const Node* def) const {
+  assert(_vloop.in_bb(def) && _vloop.in_bb(use), "both use and def are in loop");
+
+  if (!def->is_Load() ||
+      use->is_Cmp() ||
+      use->is_CMove() ||
+      VectorNode::is_convert_opcode(use->Opcode()) ||
+      VectorNode::is_muladds2i(use)) {
+    return false;
+  }
+
+  BasicType use_bt = velt_basic_type(use);
+  BasicType def_bt = velt_basic_type(def);
+  return is_subword_type(def_bt) &&
+         (use_bt == T_INT || use_bt == T_SHORT) &&
+         type2aelembytes(use_bt) > type2aelembytes(def_bt);
+}
+
 bool VLoopMemorySlices::same_memory_slice(MemNode* m1, MemNode* m2) const {
   return _vloop.phase()->C->get_alias_index(m1->adr_type()) ==
          _vloop.phase()->C->get_alias_index(m2->adr_type());
@@ -484,6 +484,10 @@ class SuperWord : public ResourceObj {
     return _vloop_analyzer.types().vector_width_in_bytes(n);
   }
 
+  bool is_subword_load_extended_by_use(const Node* use, const Node* def) const {
+    return _vloop_analyzer.types().is_subword_load_extended_by_use(use, def);
+  }
+
   // VLoopDependencyGraph accessors
   const VLoopDependencyGraph& dependency_graph() const {
     return _vloop_analyzer.dependency_graph();
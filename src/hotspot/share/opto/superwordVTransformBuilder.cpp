@@ -191,7 +191,15 @@ VTransformNode* SuperWordVTransformBuilder::get_or_make_vtnode_vector_input_at_i
   if (pack_in != nullptr) {
     // Input is a matching pack -> vtnode already exists.
     assert(index != 2 || !VectorNode::is_shift(p0), "shift's count cannot be vector");
-    return get_vtnode(pack_in->at(0));
+    VTransformNode* pack_in_vtn = get_vtnode(pack_in->at(0));
+    if (_vloop_analyzer.types().is_subword_load_extended_by_use(p0, pack_in->at(0))) {
+      // Subword loads used as wider elements -> extend the loaded lanes.
+      BasicType element_bt = _vloop_analyzer.types().velt_basic_type(p0);
+      VTransformNode* extend = new (_vtransform.arena()) VTransformLoadExtensionNode(_vtransform, pack->size(), element_bt);
+      extend->set_req(1, pack_in_vtn);
+      return extend;
+    }
+    return pack_in_vtn;
   }
 
   if (VectorNode::is_muladds2i(p0)) {
@@ -511,6 +511,10 @@ class VLoopTypes : public StackObj {
     return vector_width(n) * type2aelembytes(bt);
   }
 
+  // Does use take the subword loads of def as wider elements, so that the
+  // loaded lanes have to be sign or zero extended with a vector cast?
+  bool is_subword_load_extended_by_use(const Node* use, const Node* def) const;
+
 private:
   void set_velt_type(Node* n, const Type* t) {
     assert(t != nullptr, "cannot set nullptr");
@@ -1239,41 +1239,38 @@ Node* StoreVectorNode::Ideal(PhaseGVN* phase, bool can_reshape) {
   return StoreNode::Ideal(phase, can_reshape);
 }
 
+// Returns true if the mask is generated by a VectorMaskGen whose length is known
+// to cover all 'size_in_bytes' bytes of the masked memory access, e.g. a
+// VectorSpecies.indexInRange() mask for an index that is not in the tail.
+static bool is_all_true_mask_gen(PhaseGVN* phase, Node* mask, uint size_in_bytes) {
+  if (mask->is_top() || mask->Opcode() != Op_VectorMaskGen) {
+    return false;
+  }
+  const TypeLong* ty = phase->type(mask->in(1))->isa_long();
+  if (ty == nullptr) {
+    return false;
+  }
+  BasicType mask_bt = Matcher::vector_element_basic_type(mask);
+  return ty->_lo >= (jlong)(size_in_bytes / type2aelembytes(mask_bt));
+}
+
 Node* LoadVectorMaskedNode::Ideal(PhaseGVN* phase, bool can_reshape) {
-  if (!in(3)->is_top() && in(3)->Opcode() == Op_VectorMaskGen) {
-    Node* mask_len = in(3)->in(1);
-    const TypeLong* ty = phase->type(mask_len)->isa_long();
-    if (ty && ty->is_con()) {
-      BasicType mask_bt = Matcher::vector_element_basic_type(in(3));
-      int load_sz = type2aelembytes(mask_bt) * ty->get_con();
-      assert(load_sz <= MaxVectorSize, "Unexpected load size");
-      if (load_sz == MaxVectorSize) {
-        Node* ctr = in(MemNode::Control);
-        Node* mem = in(MemNode::Memory);
-        Node* adr = in(MemNode::Address);
-        return phase->transform(new LoadVectorNode(ctr, mem, adr, adr_type(), vect_type()));
-      }
-    }
+  if (is_all_true_mask_gen(phase, in(3), vect_type()->length_in_bytes())) {
+    Node* ctr = in(MemNode::Control);
+    Node* mem = in(MemNode::Memory);
+    Node* adr = in(MemNode::Address);
+    return phase->transform(new LoadVectorNode(ctr, mem, adr, adr_type(), vect_type()));
   }
   return LoadVectorNode::Ideal(phase, can_reshape);
 }
 
 Node* StoreVectorMaskedNode::Ideal(PhaseGVN* phase, bool can_reshape) {
-  if (!in(4)->is_top() && in(4)->Opcode() == Op_VectorMaskGen) {
-    Node* mask_len = in(4)->in(1);
-    const TypeLong* ty = phase->type(mask_len)->isa_long();
-    if (ty && ty->is_con()) {
-      BasicType mask_bt = Matcher::vector_element_basic_type(in(4));
-      int load_sz = type2aelembytes(mask_bt) * ty->get_con();
-      assert(load_sz <= MaxVectorSize, "Unexpected store size");
-      if (load_sz == MaxVectorSize) {
-        Node* ctr = in(MemNode::Control);
-        Node* mem = in(MemNode::Memory);
-        Node* adr = in(MemNode::Address);
-        Node* val = in(MemNode::ValueIn);
-        return phase->transform(new StoreVectorNode(ctr, mem, adr, adr_type(), val));
-      }
-    }
+  if (is_all_true_mask_gen(phase, in(4), vect_type()->length_in_bytes())) {
+    Node* ctr = in(MemNode::Control);
+    Node* mem = in(MemNode::Memory);
+    Node* adr = in(MemNode::Address);
+    Node* val = in(MemNode::ValueIn);
+    return phase->transform(new StoreVectorNode(ctr, mem, adr, adr_type(), val));
   }
   return StoreVectorNode::Ideal(phase, can_reshape);
 }
@@ -1580,6 +1577,29 @@ bool VectorCastNode::implemented(int opc, uint vlen, BasicType src_type, BasicTy
   return false;
 }
 
+int VectorCastNode::load_extension_opcode(BasicType load_type) {
+  switch (load_type) {
+    case T_BYTE:    return Op_VectorCastB2X;
+    case T_BOOLEAN: return Op_VectorUCastB2X;
+    case T_SHORT:   return Op_VectorCastS2X;
+    case T_CHAR:    return Op_VectorUCastS2X;
+    default:        return 0;
+  }
+}
+
+bool VectorCastNode::load_extension_implemented(uint vlen, BasicType load_type, BasicType dst_type) {
+  int vopc = load_extension_opcode(load_type);
+  if (vopc == 0 ||
+      type2aelembytes(dst_type) <= type2aelembytes(load_type) ||
+      !is_integral_type(dst_type) || dst_type == T_CHAR) {
+    return false;
+  }
+  return (vlen > 1) && is_power_of_2(vlen) &&
+         VectorNode::vector_size_supported_auto_vectorization(load_type, vlen) &&
+         VectorNode::vector_size_supported_auto_vectorization(dst_type, vlen) &&
+         Matcher::match_rule_supported_auto_vectorization(vopc, vlen, dst_type);
+}
+
 Node* VectorCastNode::Identity(PhaseGVN* phase) {
   if (!in(1)->is_top()) {
     BasicType  in_bt = in(1)->bottom_type()->is_vect()->element_basic_type();
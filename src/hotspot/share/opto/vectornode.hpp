@@ -1844,6 +1844,12 @@ class VectorCastNode : public VectorNode {
   static int  opcode(int opc, BasicType bt, bool is_signed = true);
   static bool implemented(int opc, uint vlen, BasicType src_type, BasicType dst_type);
 
+  // Cast doing the implicit sign or zero extension of subword loads, for
+  // loaded lanes of load_type. Auto-vectorization types the lanes of zero
+  // extending loads as T_BOOLEAN (LoadUB) and T_CHAR (LoadUS).
+  static int  load_extension_opcode(BasicType load_type);
+  static bool load_extension_implemented(uint vlen, BasicType load_type, BasicType dst_type);
+
   virtual Node* Identity(PhaseGVN* phase);
 };
 
@@ -550,6 +550,14 @@ VTransformApplyResult VTransformPopulateIndexNode::apply(const VLoopAnalyzer& vl
   return VTransformApplyResult::make_vector(vn, _vlen, vn->length_in_bytes());
 }
 
+VTransformApplyResult VTransformLoadExtensionNode::apply(const VLoopAnalyzer& vloop_analyzer,
+                                                         const GrowableArray<Node*>& vnode_idx_to_transformed_node) const {
+  Node* val = find_transformed_input(1, vnode_idx_to_transformed_node);
+  VectorNode* vn = make_load_extension(vloop_analyzer, val, _element_bt, _vlen);
+  register_new_node_from_vectorization(vloop_analyzer, vn, val);
+  return VTransformApplyResult::make_vector(vn, _vlen, vn->length_in_bytes());
+}
+
 VTransformApplyResult VTransformElementWiseVectorNode::apply(const VLoopAnalyzer& vloop_analyzer,
                                                              const GrowableArray<Node*>& vnode_idx_to_transformed_node) const {
   Node* first = nodes().at(0);
@@ -574,8 +582,14 @@ VTransformApplyResult VTransformElementWiseVectorNode::apply(const VLoopAnalyzer
     vn = new VectorBlendNode(/* blend1 */ in2, /* blend2 */ in3, /* mask */ in1);
   } else if (VectorNode::is_convert_opcode(opc)) {
     assert(first->req() == 2 && req() == 2, "only one input expected");
-    int vopc = VectorCastNode::opcode(opc, in1->bottom_type()->is_vect()->element_basic_type());
-    vn = VectorCastNode::make(vopc, in1, bt, vlen);
+    BasicType in_bt = in1->bottom_type()->is_vect()->element_basic_type();
+    if (opc == Op_ConvI2L && (in_bt == T_BOOLEAN || in_bt == T_CHAR)) {
+      // Zero extending subword loads, see SuperWord::implemented.
+      vn = make_load_extension(vloop_analyzer, in1, bt, vlen);
+    } else {
+      int vopc = VectorCastNode::opcode(opc, in_bt);
+      vn = VectorCastNode::make(vopc, in1, bt, vlen);
+    }
   } else if (VectorNode::is_reinterpret_opcode(opc)) {
     assert(first->req() == 2 && req() == 2, "only one input expected");
     const TypeVect* vt = TypeVect::make(bt, vlen);
@@ -714,6 +728,23 @@ void VTransformNode::register_new_node_from_vectorization(const VLoopAnalyzer& v
   VectorNode::trace_new_vector(vn, "AutoVectorization");
 }
 
+// Sign or zero extend the lanes of the subword load vector in to bt lanes. The
+// lanes of zero extending loads are typed T_BOOLEAN or T_CHAR, but the vector
+// casts expect T_BYTE or T_SHORT input, so those are reinterpreted first.
+VectorNode* VTransformNode::make_load_extension(const VLoopAnalyzer& vloop_analyzer, Node* in, BasicType bt, uint vlen) const {
+  const TypeVect* in_vt = in->bottom_type()->is_vect();
+  BasicType in_bt = in_vt->element_basic_type();
+  int vopc = VectorCastNode::load_extension_opcode(in_bt);
+  assert(vopc != 0, "must be a subword load vector: %s", type2name(in_bt));
+  if (in_bt == T_BOOLEAN || in_bt == T_CHAR) {
+    const TypeVect* signed_vt = TypeVect::make(in_bt == T_BOOLEAN ? T_BYTE : T_SHORT, vlen);
+    Node* reinterpret = new VectorReinterpretNode(in, in_vt, signed_vt);
+    register_new_node_from_vectorization(vloop_analyzer, reinterpret, in);
+    in = reinterpret;
+  }
+  return VectorCastNode::make(vopc, in, bt, vlen);
+}
+
 #ifndef PRODUCT
 void VTransformGraph::print_vtnodes() const {
   tty->print_cr("\nVTransformGraph::print_vtnodes:");
@@ -790,6 +821,10 @@ void VTransformPopulateIndexNode::print_spec() const {
   tty->print("vlen=%d element_bt=%s", _vlen, type2name(_element_bt));
 }
 
+void VTransformLoadExtensionNode::print_spec() const {
+  tty->print("vlen=%d element_bt=%s", _vlen, type2name(_element_bt));
+}
+
 void VTransformVectorNode::print_spec() const {
   tty->print("%d-pack[", _nodes.length());
   for (int i = 0; i < _nodes.length(); i++) {
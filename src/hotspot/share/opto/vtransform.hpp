@@ -337,6 +337,7 @@ class VTransformNode : public ArenaObj {
   Node* find_transformed_input(int i, const GrowableArray<Node*>& vnode_idx_to_transformed_node) const;
 
   void register_new_node_from_vectorization(const VLoopAnalyzer& vloop_analyzer, Node* vn, Node* old_node) const;
+  VectorNode* make_load_extension(const VLoopAnalyzer& vloop_analyzer, Node* in, BasicType bt, uint vlen) const;
 
   NOT_PRODUCT(virtual const char* name() const = 0;)
   NOT_PRODUCT(void print() const;)
@@ -428,6 +429,21 @@ class VTransformPopulateIndexNode : public VTransformNode {
   NOT_PRODUCT(virtual void print_spec() const override;)
 };
 
+// Transform introduces a vector cast that sign or zero extends the lanes of a
+// subword load vector, as the scalar loads would, for a use with wider elements.
+class VTransformLoadExtensionNode : public VTransformNode {
+private:
+  int _vlen;
+  const BasicType _element_bt;
+public:
+  VTransformLoadExtensionNode(VTransform& vtransform, int vlen, const BasicType element_bt) :
+    VTransformNode(vtransform, 2), _vlen(vlen), _element_bt(element_bt) {}
+  virtual VTransformApplyResult apply(const VLoopAnalyzer& vloop_analyzer,
+                                      const GrowableArray<Node*>& vnode_idx_to_transformed_node) const override;
+  NOT_PRODUCT(virtual const char* name() const override { return "LoadExtension"; };)
+  NOT_PRODUCT(virtual void print_spec() const override;)
+};
+
 // Base class for all vector vtnodes.
 class VTransformVectorNode : public VTransformNode {
 private:
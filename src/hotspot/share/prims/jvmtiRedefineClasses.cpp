@@ -276,7 +276,7 @@ void VM_RedefineClasses::doit() {
   // that reference methods of the evolved classes.
   // Have to do this after all classes are redefined and all methods that
   // are redefined are marked as old.
-  AdjustAndCleanMetadata adjust_and_clean_metadata(current);
+  AdjustAndCleanMetadata adjust_and_clean_metadata(current, _class_defs, _class_count);
   ClassLoaderDataGraph::classes_do(&adjust_and_clean_metadata);
 
   // JSR-292 support
@@ -3694,6 +3694,22 @@ void VM_RedefineClasses::set_new_constant_pool(
 // to fix up these pointers.  MethodData also points to old methods and
 // must be cleaned.
 
+// The vtable, itable and default methods of a class only hold methods of
+// the class itself, its superclasses and its superinterfaces. Redefinition
+// doesn't change the class hierarchy, so unless the class is a subtype of
+// one of the redefined classes they can't refer to any of the old methods.
+bool VM_RedefineClasses::AdjustAndCleanMetadata::may_inherit_redefined_methods(InstanceKlass* ik) const {
+  if (_has_redefined_Object) {
+    return true;
+  }
+  for (int i = 0; i < _class_count; i++) {
+    if (ik->is_subtype_of(get_ik(_class_defs[i].klass))) {
+      return true;
+    }
+  }
+  return false;
+}
+
 // Adjust cpools and vtables closure
 void VM_RedefineClasses::AdjustAndCleanMetadata::do_klass(Klass* k) {
 
@@ -3725,13 +3741,15 @@ void VM_RedefineClasses::AdjustAndCleanMetadata::do_klass(Klass* k) {
 
     // Adjust all vtables, default methods and itables, to clean out old methods.
     ResourceMark rm(_thread);
-    if (ik->vtable_length() > 0) {
-      ik->vtable().adjust_method_entries(&trace_name_printed);
-      ik->adjust_default_methods(&trace_name_printed);
-    }
+    if (may_inherit_redefined_methods(ik)) {
+      if (ik->vtable_length() > 0) {
+        ik->vtable().adjust_method_entries(&trace_name_printed);
+        ik->adjust_default_methods(&trace_name_printed);
+      }
 
-    if (ik->itable_length() > 0) {
-      ik->itable().adjust_method_entries(&trace_name_printed);
+      if (ik->itable_length() > 0) {
+        ik->itable().adjust_method_entries(&trace_name_printed);
+      }
     }
 
     // The constant pools in other classes (other_cp) can refer to
@@ -515,8 +515,13 @@ class VM_RedefineClasses: public VM_Operation {
   // to fix up these pointers and clean MethodData out.
   class AdjustAndCleanMetadata : public KlassClosure {
     Thread* _thread;
+    const jvmtiClassDefinition* _class_defs;
+    jint _class_count;
+
+    bool may_inherit_redefined_methods(InstanceKlass* ik) const;
    public:
-    AdjustAndCleanMetadata(Thread* t) : _thread(t) {}
+    AdjustAndCleanMetadata(Thread* t, const jvmtiClassDefinition* class_defs, jint class_count) :
+      _thread(t), _class_defs(class_defs), _class_count(class_count) {}
     void do_klass(Klass* k);
   };
 
@@ -56,6 +56,7 @@
 #include "runtime/globals_extension.hpp"
 #include "runtime/java.hpp"
 #include "runtime/os.hpp"
+#include "runtime/perfData.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/safepointMechanism.hpp"
 #include "runtime/synchronizer.hpp"
@@ -3822,6 +3823,13 @@ jint Arguments::apply_ergo() {
     }
   }
 
+  if (UsePerfData && PerfEventRingRecords > 0 && FLAG_IS_DEFAULT(PerfDataMemorySize)) {
+    // Make room for the sun.rt.events ring next to the other counters, so
+    // that it is not allocated on the C heap where tools can't see it.
+    size_t ring_size = align_up(PerfEventRing::value_length(PerfEventRingRecords) + K, K);
+    FLAG_SET_ERGO(PerfDataMemorySize, PerfDataMemorySize + checked_cast<int>(ring_size));
+  }
+
   if (FLAG_IS_CMDLINE(DiagnoseSyncOnValueBasedClasses)) {
     if (DiagnoseSyncOnValueBasedClasses == ObjectSynchronizer::LOG_WARNING && !log_is_enabled(Info, valuebasedclasses)) {
       LogConfiguration::configure_stdout(LogLevel::Info, true, LOG_TAGS(valuebasedclasses));
@@ -2149,7 +2149,7 @@ NOINLINE intptr_t* Thaw<ConfigT>::thaw_fast(stackChunkOop chunk) {
   }
 
   // Below this heuristic, we thaw the whole chunk, above it we thaw just one frame.
-  static const int threshold = 500; // words
+  const int threshold = ContinuationFullThawThreshold; // words
 
   const int full_chunk_size = chunk->stack_size() - chunk->sp(); // this initial size could be reduced if it's a partial thaw
   int argsize, thaw_size;
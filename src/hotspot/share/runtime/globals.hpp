@@ -171,6 +171,11 @@ const int ObjectAlignmentInBytes = 8;
   product(uint, HandshakeTimeout, 0, DIAGNOSTIC,                            \
           "If nonzero set a timeout in milliseconds for handshakes")        \
                                                                             \
+  product(uint, ParallelHandshakeThreshold, 1024, DIAGNOSTIC,               \
+          "Minimum number of threads for a handshake of all threads to "    \
+          "be issued and processed by the safepoint worker threads, "       \
+          "if the GC provides them. 0 disables parallel handshakes")        \
+                                                                            \
   product(bool, AlwaysSafeConstructors, false, EXPERIMENTAL,                \
           "Force safe construction, as if all fields are final.")           \
                                                                             \
@@ -445,6 +450,16 @@ const int ObjectAlignmentInBytes = 8;
           "Delay in milliseconds for option AbortVMOnVMOperationTimeout")   \
           range(0, max_intx)                                                \
                                                                             \
+  product(bool, SafepointLatencyTracking, false, DIAGNOSTIC,                \
+          "Keep histograms of safepoint phase latencies and record the "    \
+          "threads that were last to reach each safepoint, see "            \
+          "VM.safepoint_latency and the SafepointLateThread event")         \
+                                                                            \
+  product(uint, SafepointLatencyTrackedThreads, 3, DIAGNOSTIC,              \
+          "Number of late threads recorded per safepoint when "             \
+          "SafepointLatencyTracking is enabled")                            \
+          range(1, 16)                                                      \
+                                                                            \
   product(bool, MaxFDLimit, true,                                           \
           "Bump the number of file descriptors to maximum (Unix only)")     \
                                                                             \
@@ -584,6 +599,12 @@ const int ObjectAlignmentInBytes = 8;
   product(ccstr, NativeMemoryTracking, DEBUG_ONLY("summary") NOT_DEBUG("off"), \
           "Native memory tracking options")                                 \
                                                                             \
+  product(size_t, NMTDetailSampleInterval, 0, EXPERIMENTAL,                 \
+          "With NativeMemoryTracking=detail, record the call stacks of "    \
+          "only 1 in this many mallocs on average, and scale the call "     \
+          "site totals accordingly. 0 or 1 records every malloc")           \
+          range(0, max_juint)                                               \
+                                                                            \
   product(bool, PrintNMTStatistics, false, DIAGNOSTIC,                      \
           "Print native memory tracking summary data if it is on")          \
                                                                             \
@@ -714,6 +735,12 @@ const int ObjectAlignmentInBytes = 8;
           "Allow parallel defineClass requests for class loaders "          \
           "registering as parallel capable")                                \
                                                                             \
+  product(uint, BootClassPreloadThreads, 0, EXPERIMENTAL,                   \
+          "Number of threads that speculatively load the boot classes "     \
+          "named in the CDS class list after VM initialization, so that "   \
+          "class loading overlaps the start of main() (0 is off)")          \
+          range(0, 16)                                                      \
+                                                                            \
   product(bool, DisablePrimordialThreadGuardPages, false, EXPERIMENTAL,     \
                "Disable the use of stack guard pages if the JVM is loaded " \
                "on the primordial process thread")                          \
@@ -939,6 +966,12 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, TraceCompilerThreads, false, DIAGNOSTIC,                    \
              "Trace creation and removal of compiler threads")              \
                                                                             \
+  product(uint, CompilerThreadCPULimit, 100,                                \
+          "Percentage of a processor the threads of the optimizing "        \
+          "compiler may use together. After a compilation a thread stays "  \
+          "idle for long enough to keep all of them within the limit")      \
+          range(1, 100)                                                     \
+                                                                            \
   product(ccstr, LogClassLoadingCauseFor, nullptr,                          \
           "Apply -Xlog:class+load+cause* to classes whose fully "           \
           "qualified name contains this string (\"*\" matches "             \
@@ -1413,6 +1446,12 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, PrintMetaspaceStatisticsAtExit, false, DIAGNOSTIC,          \
           "Print metaspace statistics upon VM exit.")                       \
                                                                             \
+  product(bool, MetaspaceSeparateTransientLoaders, false, EXPERIMENTAL,     \
+          "Allocate the metaspace of hidden classes and of class loaders "  \
+          "other than the builtin loaders from separate root chunks, so "   \
+          "that it can be uncommitted as a whole once these loaders are "   \
+          "unloaded.")                                                      \
+                                                                            \
   product(bool, PrintCompilerMemoryStatisticsAtExit, false, DIAGNOSTIC,     \
           "Print compiler memory statistics upon VM exit.")                 \
                                                                             \
@@ -1527,6 +1566,21 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, SegmentedCodeCache, false,                                  \
           "Use a segmented code cache")                                     \
                                                                             \
+  product(uintx, CodeCacheHotInvocationThreshold, 0, DIAGNOSTIC,            \
+          "Allocate fully optimized nmethods of methods invoked at least "  \
+          "this many times at the lowest free address of their code heap "  \
+          "that fits, instead of in the best fitting free block, to group " \
+          "hot code together. Without a fitting free block they are "       \
+          "allocated at the top like other code (0 is off)")                \
+          range(0, max_uintx)                                               \
+                                                                            \
+  product(size_t, CodeCacheHotSegmentSize, 0, DIAGNOSTIC,                   \
+          "Reserve the code cache with small pages and ask the OS to back " \
+          "only the first this many bytes of each nmethod code heap with "  \
+          "large pages; effective with transparent huge pages in madvise "  \
+          "mode (0 is off)")                                                \
+          range(0, max_uintx)                                               \
+                                                                            \
   product_pd(uintx, ReservedCodeCacheSize,                                  \
           "Reserved code cache size (in bytes) - maximum code cache size")  \
           constraint(VMPageSizeConstraintFunc, AtParse)                     \
@@ -1745,6 +1799,11 @@ const int ObjectAlignmentInBytes = 8;
           "Maximum PerfStringConstant string length before truncation")     \
           range(32, 32*K)                                                   \
                                                                             \
+  product(int, PerfEventRingRecords, 0, EXPERIMENTAL,                       \
+          "Number of safepoint and compilation event records kept in the "  \
+          "sun.rt.events ring in PerfData memory. 0 disables the ring.")    \
+          range(0, 4*K)                                                     \
+                                                                            \
   product(bool, PerfAllowAtExitRegistration, false,                         \
           "Allow registration of atexit() methods")                         \
                                                                             \
@@ -1862,6 +1921,11 @@ const int ObjectAlignmentInBytes = 8;
           "Minimum percentage of dead table entries for cleaning the table") \
           range(1, 100)                                                     \
                                                                             \
+  product(bool, StringDeduplicationUseStringTable, false, EXPERIMENTAL,     \
+          "Deduplicate against interned strings in the StringTable "        \
+          "before using the deduplication table, so interned values "       \
+          "are not also entered there")                                     \
+                                                                            \
   product(bool, StringDeduplicationResizeALot, false, DIAGNOSTIC,           \
           "Force more frequent table resizing")                             \
                                                                             \
@@ -1925,6 +1989,13 @@ const int ObjectAlignmentInBytes = 8;
   develop(bool, UseContinuationFastPath, true,                              \
           "Use fast-path frame walking in continuations")                   \
                                                                             \
+  product(int, ContinuationFullThawThreshold, 500, EXPERIMENTAL,            \
+          "Stack chunks with fewer words than this are thawed in whole on " \
+          "the fast path. Larger chunks are thawed one frame at a time, "   \
+          "the remaining frames are thawed lazily through the return "      \
+          "barrier and are not copied again by the next freeze.")           \
+          range(0, max_jint)                                                \
+                                                                            \
   develop(int, VerifyMetaspaceInterval, DEBUG_ONLY(500) NOT_DEBUG(0),       \
                "Run periodic metaspace verifications (0 - none, "           \
                "1 - always, >1 every nth interval)")                        \
@@ -2010,6 +2081,14 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, UseThreadsLockThrottleLock, true, DIAGNOSTIC,               \
           "Use an extra lock during Thread start and exit to alleviate"     \
           "contention on Threads_lock.")                                    \
+                                                                            \
+  product(bool, ProfileVMLocks, false, DIAGNOSTIC,                          \
+          "Count acquisitions and contention of VM internal locks. "        \
+          "Printed with jcmd VM.lock_stats")                                \
+                                                                            \
+  product(bool, ShareStringConcatCallSites, true, DIAGNOSTIC,               \
+          "Link invokedynamic string concatenation sites that refer to "    \
+          "the same constant pool entry to a single CallSite")              \
 
 // end of RUNTIME_FLAGS
 
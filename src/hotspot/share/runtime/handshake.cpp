@@ -24,10 +24,13 @@
 
 #include "classfile/javaClasses.hpp"
 #include "classfile/vmSymbols.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "jvm_io.h"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
+#include "memory/universe.hpp"
 #include "prims/jvmtiThreadState.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/globals.hpp"
@@ -40,6 +43,7 @@
 #include "runtime/task.hpp"
 #include "runtime/threadSMR.hpp"
 #include "runtime/vmThread.hpp"
+#include "utilities/bitMap.inline.hpp"
 #include "utilities/formatBuffer.hpp"
 #include "utilities/filterQueue.inline.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -83,6 +87,7 @@ class HandshakeOperation : public CHeapObj<mtThread> {
   bool is_async()                  { return _handshake_cl->is_async(); }
   bool is_suspend()                { return _handshake_cl->is_suspend(); }
   bool is_async_exception()        { return _handshake_cl->is_async_exception(); }
+  bool can_process_in_parallel()   { return _handshake_cl->can_process_in_parallel(); }
 };
 
 class AsyncHandshakeOperation : public HandshakeOperation {
@@ -155,8 +160,8 @@ class HandshakeSpinYield : public StackObj {
     _spin_time_ns = _spin_time_ns > max_spin_time_ns ? max_spin_time_ns : _spin_time_ns;
   }
 
-  void add_result(HandshakeState::ProcessResult pr) {
-    _result_count[current_result_pos()][pr]++;
+  void add_result(HandshakeState::ProcessResult pr, int count = 1) {
+    _result_count[current_result_pos()][pr] += count;
   }
 
   void process() {
@@ -233,8 +238,133 @@ static void log_handshake_info(jlong start_time_ns, const char* name, int target
   }
 }
 
+// Issues and processes a handshake of all threads with the safepoint worker
+// threads. The workers claim chunks of the ThreadsList. A bitmap over the
+// list records the targets known to be done with the operation, so later
+// rounds only visit the stragglers. Targets still process the operation
+// themselves when they notice it, concurrently with the workers.
+class ParallelHandshakeTask : public WorkerTask {
+  static const uint ChunkSize = 32;
+
+  HandshakeOperation* const _op;
+  ThreadsList* const        _list;
+  CHeapBitMap               _done;
+  bool                      _issue;
+  volatile uint             _claimed;
+  volatile int              _executed;
+  volatile int              _results[HandshakeState::_number_states];
+
+  uint remaining() const    { return _list->length() - (uint)_done.count_one_bits(); }
+
+ public:
+  ParallelHandshakeTask(HandshakeOperation* op, ThreadsList* list) :
+    WorkerTask("Parallel Handshake"),
+    _op(op),
+    _list(list),
+    _done(list->length(), mtThread),
+    _issue(true),
+    _claimed(0),
+    _executed(0),
+    _results() {}
+
+  void work(uint worker_id) {
+    const uint length = _list->length();
+    int results[HandshakeState::_number_states] = {};
+    int executed = 0;
+    for (uint start = Atomic::fetch_then_add(&_claimed, ChunkSize);
+         start < length;
+         start = Atomic::fetch_then_add(&_claimed, ChunkSize)) {
+      const uint end = MIN2(start + ChunkSize, length);
+      for (uint i = start; i < end; i++) {
+        JavaThread* thr = _list->thread_at(i);
+        if (_issue) {
+          thr->handshake_state()->add_operation(_op);
+          continue;
+        }
+        if (_done.at(i)) {
+          continue;
+        }
+        HandshakeState::ProcessResult pr = thr->handshake_state()->try_process(_op, true /* match_only */);
+        results[pr]++;
+        if (pr == HandshakeState::_succeeded) {
+          executed++;
+        }
+        if (pr == HandshakeState::_succeeded || pr == HandshakeState::_no_operation) {
+          _done.par_set_bit(i);
+        }
+      }
+    }
+    for (int i = 0; i < HandshakeState::_number_states; i++) {
+      if (results[i] != 0) {
+        Atomic::add(&_results[i], results[i]);
+      }
+    }
+    Atomic::add(&_executed, executed);
+  }
+
+  // Runs one pass over the targets, on the VM thread alone once few are left.
+  void run(WorkerThreads* workers) {
+    _claimed = 0;
+    for (int i = 0; i < HandshakeState::_number_states; i++) {
+      _results[i] = 0;
+    }
+    uint chunks = (remaining() + ChunkSize - 1) / ChunkSize;
+    uint num_workers = MIN2(chunks, workers->max_workers());
+    if (num_workers <= 1) {
+      work(0);
+    } else {
+      workers->run_task(this, num_workers);
+    }
+  }
+
+  void issue(WorkerThreads* workers) {
+    _issue = true;
+    run(workers);
+    _issue = false;
+  }
+
+  void add_results(HandshakeSpinYield* hsy) const {
+    for (int i = 0; i < HandshakeState::_number_states; i++) {
+      hsy->add_result((HandshakeState::ProcessResult)i, _results[i]);
+    }
+  }
+
+  int executed() const { return _executed; }
+};
+
 class VM_HandshakeAllThreads: public VM_Operation {
   HandshakeOperation* const _op;
+
+  void doit_parallel(jlong start_time_ns, ThreadsList* list, WorkerThreads* workers) {
+    ParallelHandshakeTask task(_op, list);
+    task.issue(workers);
+
+    // Separate the arming of the poll in add_operation() from the read of
+    // JavaThread state in try_process(), see doit().
+    if (UseSystemMemoryBarrier) {
+      SystemMemoryBarrier::emit();
+    } else {
+      OrderAccess::fence();
+    }
+
+    // _op was created with a count == 1 so don't double count.
+    _op->add_target_count((int)list->length() - 1);
+
+    log_trace(handshake)("Threads signaled, begin processing blocked threads by %u workers", workers->max_workers());
+    HandshakeSpinYield hsy(start_time_ns);
+    do {
+      check_handshake_timeout(start_time_ns, _op);
+      task.run(workers);
+      task.add_results(&hsy);
+      hsy.process();
+    } while (!_op->is_completed());
+
+    // Pairs with the release store in do_handshake(), see doit().
+    OrderAccess::acquire();
+
+    log_handshake_info(start_time_ns, _op->name(), (int)list->length(), task.executed(), "parallel");
+  }
+
  public:
   VM_HandshakeAllThreads(HandshakeOperation* op) : _op(op) {}
 
@@ -245,6 +375,15 @@ class VM_HandshakeAllThreads: public VM_Operation {
   void doit() {
     jlong start_time_ns = os::javaTimeNanos();
 
+    if (ParallelHandshakeThreshold > 0 && _op->can_process_in_parallel()) {
+      WorkerThreads* workers = Universe::heap()->safepoint_workers();
+      ThreadsListHandle tlh;
+      if (workers != nullptr && workers->max_workers() > 1 && tlh.length() >= ParallelHandshakeThreshold) {
+        doit_parallel(start_time_ns, tlh.list(), workers);
+        return;
+      }
+    }
+
     JavaThreadIteratorWithHandle jtiwh;
     int number_of_threads_issued = 0;
     for (JavaThread* thr = jtiwh.next(); thr != nullptr; thr = jtiwh.next()) {
@@ -646,7 +785,7 @@ bool HandshakeState::claim_handshake() {
   return false;
 }
 
-HandshakeState::ProcessResult HandshakeState::try_process(HandshakeOperation* match_op) {
+HandshakeState::ProcessResult HandshakeState::try_process(HandshakeOperation* match_op, bool match_only) {
   if (!has_operation()) {
     // JT has already cleared its handshake
     return HandshakeState::_no_operation;
@@ -675,12 +814,17 @@ HandshakeState::ProcessResult HandshakeState::try_process(HandshakeOperation* ma
   HandshakeOperation* op = get_op();
 
   assert(op != nullptr, "Must have an op");
+  if (match_only && op != match_op) {
+    _lock.unlock();
+    return HandshakeState::_claim_failed;
+  }
   assert(SafepointMechanism::local_poll_armed(_handshakee), "Must be");
   assert(op->_target == nullptr || _handshakee == op->_target, "Wrong thread");
 
   log_trace(handshake)("Processing handshake " INTPTR_FORMAT " by %s(%s)", p2i(op),
                        op == match_op ? "handshaker" : "cooperative",
-                       current_thread->is_VM_thread() ? "VM Thread" : "JavaThread");
+                       current_thread->is_VM_thread() ? "VM Thread" :
+                       current_thread->is_Java_thread() ? "JavaThread" : "Worker");
 
   op->prepare(_handshakee, current_thread);
 
@@ -45,6 +45,8 @@ class ThreadsListHandle;
 // nature of the closure, the callback may be executed by the initiating
 // thread, the target thread, or the VMThread. If the callback is not executed
 // by the target thread it will remain in a blocked state until the callback completes.
+// A closure for all threads that returns true from can_process_in_parallel() may
+// also be executed by the safepoint worker threads on behalf of the VMThread.
 class HandshakeClosure : public ThreadClosure, public CHeapObj<mtThread> {
   const char* const _name;
  public:
@@ -54,6 +56,7 @@ class HandshakeClosure : public ThreadClosure, public CHeapObj<mtThread> {
   virtual bool is_async()                          { return false; }
   virtual bool is_suspend()                        { return false; }
   virtual bool is_async_exception()                { return false; }
+  virtual bool can_process_in_parallel()            { return false; }
   virtual void do_thread(Thread* thread) = 0;
 };
 
@@ -149,7 +152,9 @@ class HandshakeState {
     _succeeded,
     _number_states
   };
-  ProcessResult try_process(HandshakeOperation* match_op);
+  // With match_only, operations other than match_op are left to their own
+  // handshaker and _claim_failed is returned if one of them is next.
+  ProcessResult try_process(HandshakeOperation* match_op, bool match_only = false);
 
   Thread* active_handshaker() const { return Atomic::load(&_active_handshaker); }
 
@@ -29,6 +29,7 @@
 #include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/gcHeapSummary.hpp"
 #include "interpreter/bytecodes.hpp"
+#include "logging/log.hpp"
 #include "logging/logAsyncWriter.hpp"
 #include "memory/universe.hpp"
 #include "nmt/memTracker.hpp"
@@ -44,6 +45,7 @@
 #include "runtime/init.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/sharedRuntime.hpp"
+#include "runtime/timerTrace.hpp"
 #include "sanitizers/leak.hpp"
 #include "utilities/macros.hpp"
 #if INCLUDE_JVMCI
@@ -132,8 +134,11 @@ jint init_globals() {
   initial_stubs_init();
   // stack overflow exception blob is referenced by the interpreter
   SharedRuntime::generate_initial_stubs();
-  jint status = universe_init();  // dependent on codeCache_init and
-                                  // initial_stubs_init and metaspace_init.
+  jint status;
+  { TraceTime timer("Initialize universe", TRACETIME_LOG(Info, startuptime));
+    status = universe_init();  // dependent on codeCache_init and
+                               // initial_stubs_init and metaspace_init.
+  }
   if (status != JNI_OK)
     return status;
 
@@ -144,7 +149,9 @@ jint init_globals() {
     LSAN_REGISTER_ROOT_REGION(summary.start(), summary.reserved_size());
   }
 #endif // LEAK_SANITIZER
-  AOTCodeCache::init2();     // depends on universe_init
+  { TraceTime timer("Load AOT code cache", TRACETIME_LOG(Info, startuptime));
+    AOTCodeCache::init2();   // depends on universe_init
+  }
   AsyncLogWriter::initialize();
   gc_barrier_stubs_init();   // depends on universe_init, must be before interpreter_init
   continuations_init();      // must precede continuation stub generation
@@ -163,8 +170,12 @@ jint init_globals() {
 }
 
 jint init_globals2() {
-  universe2_init();          // dependent on codeCache_init and initial_stubs_init
-  javaClasses_init();        // must happen after vtable initialization, before referenceProcessor_init
+  { TraceTime timer("Initialize universe (phase 2)", TRACETIME_LOG(Info, startuptime));
+    universe2_init();        // dependent on codeCache_init and initial_stubs_init
+  }
+  { TraceTime timer("Initialize java classes offsets", TRACETIME_LOG(Info, startuptime));
+    javaClasses_init();      // must happen after vtable initialization, before referenceProcessor_init
+  }
   interpreter_init_code();   // after javaClasses_init and before any method gets linked
   referenceProcessor_init();
   jni_handles_init();
@@ -179,8 +190,10 @@ jint init_globals2() {
   dependencyContext_init();
   dependencies_init();
 
-  if (!compileBroker_init()) {
-    return JNI_EINVAL;
+  { TraceTime timer("Initialize compile broker", TRACETIME_LOG(Info, startuptime));
+    if (!compileBroker_init()) {
+      return JNI_EINVAL;
+    }
   }
 #if INCLUDE_JVMCI
   if (EnableJVMCI) {
@@ -188,8 +201,10 @@ jint init_globals2() {
   }
 #endif
 
-  if (!universe_post_init()) {
-    return JNI_ERR;
+  { TraceTime timer("Initialize universe (post)", TRACETIME_LOG(Info, startuptime));
+    if (!universe_post_init()) {
+      return JNI_ERR;
+    }
   }
   compiler_stubs_init(false /* in_compiler_thread */); // compiler's intrinsics stubs
   final_stubs_init();    // final StubRoutines stubs
@@ -477,6 +477,8 @@ JavaThread::JavaThread(MemTag mem_tag) :
   _exception_pc(nullptr),
   _exception_handler_pc(nullptr),
   _is_method_handle_return(0),
+  _profile_sample_countdown(0),
+  _profile_sample_seed(os::random() | 1),
 
   _jni_active_critical(0),
   _pending_jni_exception_check_fn(nullptr),
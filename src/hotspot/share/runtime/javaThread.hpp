@@ -454,6 +454,8 @@ class JavaThread: public Thread {
   volatile address _exception_pc;                // PC where exception happened
   volatile address _exception_handler_pc;        // PC for handler of exception
   volatile int     _is_method_handle_return;     // true (== 1) if the current exception PC is a MethodHandle call site.
+  int              _profile_sample_countdown;    // Executions of sampled C1 type profiles left until the next update
+  int              _profile_sample_seed;         // Xorshift state randomizing the countdown reset
 
  private:
   // support for JNI critical regions
@@ -869,6 +871,8 @@ class JavaThread: public Thread {
   static ByteSize exception_pc_offset()          { return byte_offset_of(JavaThread, _exception_pc); }
   static ByteSize exception_handler_pc_offset()  { return byte_offset_of(JavaThread, _exception_handler_pc); }
   static ByteSize is_method_handle_return_offset() { return byte_offset_of(JavaThread, _is_method_handle_return); }
+  static ByteSize profile_sample_countdown_offset() { return byte_offset_of(JavaThread, _profile_sample_countdown); }
+  static ByteSize profile_sample_seed_offset()   { return byte_offset_of(JavaThread, _profile_sample_seed); }
 
   static ByteSize active_handles_offset()        { return byte_offset_of(JavaThread, _active_handles); }
 
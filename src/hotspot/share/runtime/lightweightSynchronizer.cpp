@@ -71,6 +71,18 @@ class ObjectMonitorTable : AllStatic {
   static size_t _table_size;
   static volatile bool _resize;
 
+  // A small direct-mapped cache in front of the table, indexed by the hash
+  // of the object. It lets hot monitors be found without probing the table.
+  //
+  // Entries are only valid for monitors that are in the table. A monitor is
+  // removed from its cache slot when it is removed from the table, which is
+  // before the deflation handshake, so a monitor read from the cache is kept
+  // alive the same way as one read from the table. A thread that publishes a
+  // monitor it found in the table re-checks for deflation afterwards, so a
+  // racing deflation cannot leave a stale entry behind.
+  static const size_t CACHE_SIZE = 4096;
+  static ObjectMonitor* volatile* _cache;
+
   class Lookup : public StackObj {
     oop _obj;
 
@@ -163,9 +175,46 @@ class ObjectMonitorTable : AllStatic {
     return ConcurrentTable::DEFAULT_GROW_HINT;
   }
 
+  static ObjectMonitor* volatile* cache_slot(uintx hash) {
+    return &_cache[hash & (CACHE_SIZE - 1)];
+  }
+
+  static ObjectMonitor* cache_get(oop obj, uintx hash) {
+    ObjectMonitor* monitor = Atomic::load_acquire(cache_slot(hash));
+    if (monitor != nullptr &&
+        (uintx)monitor->hash() == hash &&
+        !monitor->is_being_async_deflated() &&
+        monitor->object_refers_to(obj)) {
+      return monitor;
+    }
+    return nullptr;
+  }
+
+  static void cache_put(ObjectMonitor* monitor) {
+    ObjectMonitor* volatile* slot = cache_slot((uintx)monitor->hash());
+    if (Atomic::load(slot) == monitor) {
+      return;
+    }
+    // The fence orders the store before the deflation check below; the
+    // deflater makes contentions negative before removing the entry, so at
+    // least one of the two sees the other and clears the slot.
+    Atomic::release_store_fence(slot, monitor);
+    if (monitor->is_being_async_deflated()) {
+      Atomic::cmpxchg(slot, monitor, (ObjectMonitor*)nullptr);
+    }
+  }
+
+  static void cache_remove(ObjectMonitor* monitor) {
+    Atomic::cmpxchg(cache_slot((uintx)monitor->hash()), monitor, (ObjectMonitor*)nullptr);
+  }
+
  public:
   static void create() {
     _table = new ConcurrentTable(initial_log_size(), max_log_size(), grow_hint());
+    _cache = NEW_C_HEAP_ARRAY(ObjectMonitor* volatile, CACHE_SIZE, mtObjectMonitor);
+    for (size_t i = 0; i < CACHE_SIZE; i++) {
+      _cache[i] = nullptr;
+    }
     _items_count = 0;
     _table_size = table_size();
     _resize = false;
@@ -183,14 +232,21 @@ class ObjectMonitorTable : AllStatic {
   }
 
   static ObjectMonitor* monitor_get(Thread* current, oop obj) {
-    ObjectMonitor* result = nullptr;
     Lookup lookup_f(obj);
+    ObjectMonitor* result = cache_get(obj, lookup_f.get_hash());
+    if (result != nullptr) {
+      verify_monitor_get_result(obj, result);
+      return result;
+    }
     auto found_f = [&](ObjectMonitor** found) {
       assert((*found)->object_peek() == obj, "must be");
       result = *found;
     };
     _table->get(current, lookup_f, found_f);
     verify_monitor_get_result(obj, result);
+    if (result != nullptr) {
+      cache_put(result);
+    }
     return result;
   }
 
@@ -288,6 +344,7 @@ class ObjectMonitorTable : AllStatic {
     bool grow;
     _table->insert_get(current, lookup_f, monitor, found_f, &grow);
     verify_monitor_get_result(obj, result);
+    cache_put(result);
     if (grow) {
       try_notify_grow();
     }
@@ -296,7 +353,9 @@ class ObjectMonitorTable : AllStatic {
 
   static bool remove_monitor_entry(Thread* current, ObjectMonitor* monitor) {
     LookupMonitor lookup_f(monitor);
-    return _table->remove(current, lookup_f);
+    bool removed = _table->remove(current, lookup_f);
+    cache_remove(monitor);
+    return removed;
   }
 
   static bool contains_monitor(Thread* current, ObjectMonitor* monitor) {
@@ -331,6 +390,7 @@ ObjectMonitorTable::ConcurrentTable* ObjectMonitorTable::_table = nullptr;
 volatile size_t ObjectMonitorTable::_items_count = 0;
 size_t ObjectMonitorTable::_table_size = 0;
 volatile bool ObjectMonitorTable::_resize = false;
+ObjectMonitor* volatile* ObjectMonitorTable::_cache = nullptr;
 
 ObjectMonitor* LightweightSynchronizer::get_or_insert_monitor_from_table(oop object, JavaThread* current, bool* inserted) {
   assert(LockingMode == LM_LIGHTWEIGHT, "must be");
@@ -33,6 +33,7 @@
 #include "runtime/semaphore.inline.hpp"
 #include "runtime/threadCrashProtection.hpp"
 #include "utilities/events.hpp"
+#include "utilities/growableArray.hpp"
 #include "utilities/macros.hpp"
 
 class InFlightMutexRelease {
@@ -122,11 +123,18 @@ void Mutex::lock(Thread* self) {
   OrderAccess::fence();
   if (!_lock.try_lock()) {
     // The lock is contended, use contended slow-path function to lock
+    jlong start = ProfileVMLocks ? os::javaTimeNanos() : 0;
     lock_contended(self);
+    if (ProfileVMLocks) {
+      record_contended(start);
+    }
   }
 
   assert_owner(nullptr);
   set_owner(self);
+  if (ProfileVMLocks) {
+    _acquire_count++;
+  }
 }
 
 void Mutex::lock() {
@@ -146,7 +154,16 @@ void Mutex::lock_without_safepoint_check(Thread * self) {
   check_rank(self);
 
   OrderAccess::fence();
-  _lock.lock();
+  if (!ProfileVMLocks) {
+    _lock.lock();
+  } else {
+    if (!_lock.try_lock()) {
+      jlong start = os::javaTimeNanos();
+      _lock.lock();
+      record_contended(start);
+    }
+    _acquire_count++;
+  }
   assert_owner(nullptr);
   set_owner(self);
 }
@@ -176,6 +193,9 @@ bool Mutex::try_lock_inner(bool do_rank_checks) {
   if (_lock.try_lock()) {
     assert_owner(nullptr);
     set_owner(self);
+    if (ProfileVMLocks) {
+      _acquire_count++;
+    }
     return true;
   }
   return false;
@@ -284,7 +304,8 @@ Mutex::~Mutex() {
   os::free(const_cast<char*>(_name));
 }
 
-Mutex::Mutex(Rank rank, const char * name, bool allow_vm_block) : _owner(nullptr) {
+Mutex::Mutex(Rank rank, const char * name, bool allow_vm_block) : _owner(nullptr),
+  _acquire_count(0), _contended_count(0), _contended_nanos(0) {
   assert(os::mutex_init_done(), "Too early!");
   assert(name != nullptr, "Mutex requires a name");
   _name = os::strdup(name, mtInternal);
@@ -302,6 +323,11 @@ Mutex::Mutex(Rank rank, const char * name, bool allow_vm_block) : _owner(nullptr
 #endif
 }
 
+void Mutex::record_contended(jlong start_nanos) {
+  _contended_count++;
+  _contended_nanos += os::javaTimeNanos() - start_nanos;
+}
+
 bool Mutex::owned_by_self() const {
   return owner() == Thread::current();
 }
@@ -592,6 +618,35 @@ void Mutex::print_lock_ranks(outputStream* st) {
 #endif // ASSERT
 }
 
+static int compare_contended_nanos(Mutex** m1, Mutex** m2) {
+  jlong n1 = (*m1)->contended_nanos();
+  jlong n2 = (*m2)->contended_nanos();
+  return n1 > n2 ? -1 : (n1 < n2 ? 1 : 0);
+}
+
+void Mutex::print_lock_statistics(outputStream* st) {
+  if (!ProfileVMLocks) {
+    st->print_cr("VM lock profiling is disabled, use -XX:+UnlockDiagnosticVMOptions -XX:+ProfileVMLocks");
+    return;
+  }
+  ResourceMark rm;
+  GrowableArray<Mutex*> locks(_num_mutex);
+  for (int i = 0; i < _num_mutex; i++) {
+    if (_mutex_array[i]->acquire_count() > 0) {
+      locks.append(_mutex_array[i]);
+    }
+  }
+  locks.sort(compare_contended_nanos);
+
+  st->print_cr("%-32s %14s %14s %14s", "Lock", "Acquired", "Contended", "Blocked (ms)");
+  for (int i = 0; i < locks.length(); i++) {
+    Mutex* m = locks.at(i);
+    st->print_cr("%-32s %14" PRIu64 " %14" PRIu64 " %14.3f", m->name(),
+                 m->acquire_count(), m->contended_count(),
+                 (double)m->contended_nanos() / NANOSECS_PER_MILLISEC);
+  }
+}
+
 RecursiveMutex::RecursiveMutex() : _sem(1), _owner(nullptr), _recursions(0) {}
 
 void RecursiveMutex::lock(Thread* current) {
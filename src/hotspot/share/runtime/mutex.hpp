@@ -117,6 +117,14 @@ class Mutex : public CHeapObj<mtSynchronizer> {
   static Mutex** _mutex_array;
   static int _num_mutex;
 
+  // Contention statistics, maintained while ProfileVMLocks is enabled.
+  // They are only updated by the thread holding the native lock.
+  uint64_t _acquire_count;
+  uint64_t _contended_count;
+  jlong    _contended_nanos;       // time spent blocked acquiring the lock
+
+  void record_contended(jlong start_nanos);
+
 #ifdef ASSERT
   Rank    _rank;                 // rank (to avoid/detect potential deadlocks)
   Mutex*  _next;                 // Used by a Thread to link up owned locks
@@ -210,6 +218,10 @@ class Mutex : public CHeapObj<mtSynchronizer> {
 
   static void  add_mutex(Mutex* var);
 
+  uint64_t acquire_count() const           { return _acquire_count; }
+  uint64_t contended_count() const         { return _contended_count; }
+  jlong contended_nanos() const            { return _contended_nanos; }
+
   void print_on_error(outputStream* st) const;
   #ifndef PRODUCT
     void print_on(outputStream* st) const;
@@ -220,6 +232,17 @@ class Mutex : public CHeapObj<mtSynchronizer> {
   // by fatal error handler.
   static void print_owned_locks_on_error(outputStream* st);
   static void print_lock_ranks(outputStream* st);
+
+  // Print the contention statistics of all mutexes/monitors that have been
+  // acquired while ProfileVMLocks was enabled, most contended first.
+  static void print_lock_statistics(outputStream* st);
+
+  template <typename Function>
+  static void locks_do(Function f) {
+    for (int i = 0; i < _num_mutex; i++) {
+      f(_mutex_array[i]);
+    }
+  }
 };
 
 class Monitor : public Mutex {
@@ -61,6 +61,7 @@ Mutex*   VtableStubs_lock             = nullptr;
 Mutex*   SymbolArena_lock             = nullptr;
 Monitor* StringDedup_lock             = nullptr;
 Mutex*   StringDedupIntern_lock       = nullptr;
+Mutex*   SafepointLatency_lock        = nullptr;
 Monitor* CodeCache_lock               = nullptr;
 Mutex*   TouchedMethodLog_lock        = nullptr;
 Mutex*   RetData_lock                 = nullptr;
@@ -222,6 +223,7 @@ void mutex_init() {
 
   MUTEX_DEFN(StringDedup_lock                , PaddedMonitor, nosafepoint);
   MUTEX_DEFN(StringDedupIntern_lock          , PaddedMutex  , nosafepoint);
+  MUTEX_DEFN(SafepointLatency_lock           , PaddedMutex  , nosafepoint);
   MUTEX_DEFN(RawMonitor_lock                 , PaddedMutex  , nosafepoint-1);
 
   MUTEX_DEFN(Metaspace_lock                  , PaddedMutex  , nosafepoint-3);
@@ -28,7 +28,10 @@
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 
-#if defined(LINUX) || defined(AIX) || defined(BSD)
+#if defined(LINUX)
+# include "park_posix.hpp"
+# include "park_linux.hpp"
+#elif defined(AIX) || defined(BSD)
 # include "park_posix.hpp"
 #else
 # include OS_HEADER(park)
@@ -31,8 +31,10 @@
 #include "runtime/java.hpp"
 #include "runtime/mutex.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/orderAccess.hpp"
 #include "runtime/os.hpp"
 #include "runtime/perfData.inline.hpp"
+#include "utilities/align.hpp"
 #include "utilities/exceptions.hpp"
 #include "utilities/globalCounter.inline.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -229,6 +231,49 @@ void PerfString::set_string(const char* s2) {
   ((char*)_valuep)[_length-1] = '\0';
 }
 
+PerfEventRing::PerfEventRing(CounterNS ns, const char* namep, jint capacity)
+  : PerfByteArray(ns, namep, U_None, V_Variable,
+                  (jint)value_length(capacity)),
+    _position(nullptr), _records(nullptr), _capacity(capacity) {
+
+  if (is_valid()) {
+    memset(_valuep, 0, _length);
+    char* base = align_up((char*)_valuep, sizeof(jlong));
+    _position = (volatile jlong*)base;
+    _records = (Record*)(base + sizeof(jlong));
+  }
+}
+
+void PerfEventRing::record(jint kind, jint id, jlong start_ns, jlong duration_ns) {
+  jlong n = Atomic::fetch_then_add(_position, (jlong)1);
+  Record* r = &_records[n % _capacity];
+
+  const jlong busy = -1;
+  jlong seq = Atomic::load_acquire(&r->_sequence);
+  while (true) {
+    if (seq > n) {
+      // record n + capacity (or later) already got the slot
+      return;
+    }
+    if (seq == busy) {
+      SpinPause();
+      seq = Atomic::load_acquire(&r->_sequence);
+      continue;
+    }
+    jlong prev = Atomic::cmpxchg(&r->_sequence, seq, busy);
+    if (prev == seq) {
+      break;
+    }
+    seq = prev;
+  }
+  OrderAccess::storestore();
+  r->_start_ns = start_ns;
+  r->_duration_ns = duration_ns;
+  r->_kind = kind;
+  r->_id = id;
+  Atomic::release_store(&r->_sequence, n + 1);
+}
+
 PerfStringConstant::PerfStringConstant(CounterNS ns, const char* namep,
                                        const char* initial_value)
                      : PerfString(ns, namep, V_Constant,
@@ -408,6 +453,26 @@ PerfStringVariable* PerfDataManager::create_string_variable(CounterNS ns,
   return p;
 }
 
+PerfEventRing* PerfDataManager::create_event_ring(CounterNS ns,
+                                                  const char* name,
+                                                  jint capacity,
+                                                  TRAPS) {
+
+  assert(capacity > 0, "PerfEventRing with no records");
+
+  PerfEventRing* p = new PerfEventRing(ns, name, capacity);
+
+  if (!p->is_valid()) {
+    // allocation of native resources failed.
+    delete p;
+    THROW_NULL(vmSymbols::java_lang_OutOfMemoryError());
+  }
+
+  add_item(p, false);
+
+  return p;
+}
+
 PerfLongVariable* PerfDataManager::create_long_variable(CounterNS ns,
                                                         const char* name,
                                                         PerfData::Units u,
@@ -562,6 +562,59 @@ class PerfStringVariable : public PerfString {
     inline void set_value(const char* val) { set_string(val); }
 };
 
+/*
+ * The PerfEventRing class provides a PerfData sub class that stores a
+ * fixed number of fixed-size event records in the PerfData memory region,
+ * so that external tools can follow VM events without attaching to the VM.
+ * It is exported as a byte array. The value starts with padding up to the
+ * first 8 byte aligned address, followed by a jlong holding the total number
+ * of records written so far and the array of records. Record n is stored in
+ * slot n % capacity.
+ *
+ * Writers take a record number n with an atomic increment of the position.
+ * Since writers holding n and n + capacity map to the same slot, the slot
+ * itself is claimed by a compare-and-swap of its sequence number from the
+ * previously published value to busy (-1). A writer that finds the slot busy
+ * waits for the other writer to publish, and a writer that finds a newer
+ * record already published in the slot drops its own. The record is then
+ * filled in and published by storing n + 1 into the sequence number. A
+ * reader must check that the sequence number is the expected one both
+ * before and after copying the record, and discard the record otherwise.
+ */
+class PerfEventRing : public PerfByteArray {
+
+  friend class PerfDataManager; // for access to protected constructor
+
+  public:
+    struct Record {
+      volatile jlong _sequence;  // record number + 1, 0 if empty, -1 if busy
+      jlong _start_ns;           // os::javaTimeNanos() at start of the event
+      jlong _duration_ns;
+      jint  _kind;
+      jint  _id;
+    };
+
+  private:
+    volatile jlong* _position;
+    Record*         _records;
+    jint            _capacity;
+
+  protected:
+
+    // the ring is only updated by event writers
+    void sample() { }
+
+    PerfEventRing(CounterNS ns, const char* namep, jint capacity);
+
+  public:
+    // length of the byte array holding capacity records
+    static size_t value_length(jint capacity) {
+      return sizeof(jlong) - 1 + sizeof(jlong) + capacity * sizeof(Record);
+    }
+
+    void record(jint kind, jint id, jlong start_ns, jlong duration_ns);
+};
+
 
 /*
  * The PerfDataList class is a container class for managing lists
@@ -741,6 +794,9 @@ class PerfDataManager : AllStatic {
                                                   PerfData::Units u,
                                                   jlong ival, TRAPS);
 
+    static PerfEventRing* create_event_ring(CounterNS ns, const char* name,
+                                            jint capacity, TRAPS);
+
     static PerfLongVariable* create_long_variable(CounterNS ns,
                                                   const char* name,
                                                   PerfData::Units u, TRAPS) {
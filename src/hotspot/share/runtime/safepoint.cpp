@@ -52,6 +52,7 @@
 #include "runtime/orderAccess.hpp"
 #include "runtime/osThread.hpp"
 #include "runtime/safepoint.hpp"
+#include "runtime/safepointLatency.hpp"
 #include "runtime/safepointMechanism.inline.hpp"
 #include "runtime/signature.hpp"
 #include "runtime/stackWatermarkSet.inline.hpp"
@@ -244,6 +245,10 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
       assert(cur_tss->is_running(), "Illegal initial state");
       if (thread_not_running(cur_tss)) {
         --still_running;
+        if (SafepointLatencyTracking) {
+          SafepointLatency::thread_arrived(cur_tss->thread(),
+                                           os::javaTimeNanos() - SafepointTracing::start_of_safepoint());
+        }
         *p_prev = nullptr;
         ThreadSafepointState *tmp = cur_tss;
         cur_tss = cur_tss->get_next();
@@ -953,6 +958,10 @@ void SafepointTracing::begin(VM_Operation::VMOp_Type type) {
   _last_app_time_ns = _last_safepoint_begin_time_ns - _last_safepoint_end_time_ns;
   _last_safepoint_end_time_ns = 0;
 
+  if (SafepointLatencyTracking) {
+    SafepointLatency::begin();
+  }
+
   RuntimeService::record_safepoint_begin(_last_app_time_ns);
 }
 
@@ -962,6 +971,11 @@ void SafepointTracing::synchronized(int nof_threads, int nof_running, int traps)
   _nof_running = nof_running;
   _page_trap   = traps;
   RuntimeService::record_safepoint_synchronized(_last_safepoint_sync_time_ns - _last_safepoint_begin_time_ns);
+
+  if (SafepointLatencyTracking) {
+    SafepointLatency::synchronized(SafepointSynchronize::safepoint_id(), _current_type,
+                                   _last_safepoint_sync_time_ns - _last_safepoint_begin_time_ns);
+  }
 }
 
 void SafepointTracing::leave() {
@@ -980,6 +994,10 @@ void SafepointTracing::end() {
   if (log_is_enabled(Info, safepoint, stats)) {
     statistics_log();
   }
+  if (SafepointLatencyTracking) {
+    SafepointLatency::end(_last_safepoint_end_time_ns - _last_safepoint_sync_time_ns,
+                          _last_safepoint_end_time_ns - _last_safepoint_begin_time_ns);
+  }
 
   log_info(safepoint)(
      "Safepoint \"%s\", "
@@ -1000,4 +1018,7 @@ void SafepointTracing::end() {
      );
 
   RuntimeService::record_safepoint_end(_last_safepoint_end_time_ns - _last_safepoint_sync_time_ns);
+  RuntimeService::record_event(RuntimeService::safepoint_event, (jint)_current_type,
+                               _last_safepoint_begin_time_ns,
+                               _last_safepoint_end_time_ns - _last_safepoint_begin_time_ns);
 }
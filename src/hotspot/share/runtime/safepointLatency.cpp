@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "code/codeBlob.hpp"
+#include "code/nmethod.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
+#include "logging/log.hpp"
+#include "memory/allocation.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/method.hpp"
+#include "runtime/frame.inline.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/javaThread.inline.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/safepoint.hpp"
+#include "runtime/safepointLatency.hpp"
+#include "services/diagnosticCommand.hpp"
+#include "utilities/ostream.hpp"
+
+static double to_micros(jlong nanos) {
+  return (double)nanos / (NANOUNITS / MICROUNITS);
+}
+
+SafepointLatency::Data SafepointLatency::_data;
+JavaThread* SafepointLatency::_arrival_thread[SafepointLatency::MaxTrackedThreads];
+jlong SafepointLatency::_arrival_time_ns[SafepointLatency::MaxTrackedThreads];
+uint SafepointLatency::_arrival_count = 0;
+
+void SafepointLatency::Data::reset() {
+  _sync.reset();
+  _operation.reset();
+  _total.reset();
+  _worst_safepoint_id = 0;
+  _worst_type = VM_Operation::VMOp_Terminating;
+  _worst_sync_ns = 0;
+  _worst_late_count = 0;
+}
+
+void SafepointLatency::Data::print_on(outputStream* st) const {
+  _sync.print_on(st, "Time to safepoint");
+  _operation.print_on(st, "At safepoint");
+  _total.print_on(st, "Total");
+  if (_worst_sync_ns == 0) {
+    return;
+  }
+  st->print_cr("Slowest time to safepoint: %.3f us, safepoint " UINT64_FORMAT " (%s)",
+               to_micros(_worst_sync_ns), _worst_safepoint_id, VM_Operation::name(_worst_type));
+  for (uint i = 0; i < _worst_late_count; i++) {
+    const LateThread& late = _worst_late[i];
+    st->print_cr("  %.3f us \"%s\" %s",
+                 to_micros(late._time_to_safepoint_ns), late._name, late._location);
+  }
+}
+
+void SafepointLatency::begin() {
+  _arrival_count = 0;
+}
+
+void SafepointLatency::thread_arrived(JavaThread* thread, jlong time_to_safepoint_ns) {
+  uint slot = _arrival_count++ % SafepointLatencyTrackedThreads;
+  _arrival_thread[slot] = thread;
+  _arrival_time_ns[slot] = time_to_safepoint_ns;
+}
+
+// Describes where a stopped thread is parked. For compiled code stopped at
+// a poll, the poll kind is taken from the relocation at the poll pc.
+static const char* describe_stop_location(JavaThread* thread, outputStream* st,
+                                          Method** method_out, int* bci_out) {
+  *method_out = nullptr;
+  *bci_out = -1;
+  if (!thread->has_last_Java_frame()) {
+    st->print("no Java frames");
+    return "vm";
+  }
+  frame fr = thread->last_frame();
+  if (fr.is_interpreted_frame()) {
+    Method* m = fr.interpreter_frame_method();
+    int bci = fr.interpreter_frame_bci();
+    *method_out = m;
+    *bci_out = bci;
+    m->print_short_name(st);
+    st->print(" @ bci %d (interpreted)", bci);
+    return "interpreted";
+  }
+  if (fr.is_compiled_frame()) {
+    nmethod* nm = fr.cb()->as_nmethod();
+    const char* kind = "call";
+    address pc = fr.pc();
+    if (thread->safepoint_state()->is_at_poll_safepoint()) {
+      pc = thread->saved_exception_pc();
+      kind = nm->is_at_poll_return(pc) ? "return poll" : "loop poll";
+    }
+    *method_out = nm->method();
+    nm->method()->print_short_name(st);
+    st->print(" @ pc offset " INTPTR_FORMAT " (nmethod %d, %s)",
+              (intptr_t)(pc - nm->code_begin()), nm->compile_id(), kind);
+    return kind;
+  }
+  CodeBlob* cb = fr.cb();
+  st->print("in %s", cb != nullptr ? cb->name() : "unknown frame");
+  return "stub";
+}
+
+static void post_late_thread_event(uint64_t safepoint_id, JavaThread* thread, jlong time_to_safepoint_ns,
+                                   Method* method, int bci, const char* kind) {
+  EventSafepointLateThread event;
+  if (event.should_commit()) {
+    event.set_safepointId(safepoint_id);
+    event.set_thread(JFR_JVM_THREAD_ID(thread));
+    event.set_timeToSafepoint(time_to_safepoint_ns);
+    event.set_method(method);
+    event.set_bci(bci);
+    event.set_stopKind(kind);
+    event.commit();
+  }
+}
+
+void SafepointLatency::synchronized(uint64_t safepoint_id, VM_Operation::VMOp_Type type, jlong sync_time_ns) {
+  assert(SafepointSynchronize::is_at_safepoint(), "threads must be stopped");
+
+  ResourceMark rm;
+  LateThread late[MaxTrackedThreads];
+  uint tracked = MIN2(_arrival_count, (uint)SafepointLatencyTrackedThreads);
+  LogTarget(Debug, safepoint, latency) lt;
+  for (uint i = 0; i < tracked; i++) {
+    // Newest arrival first.
+    uint slot = (_arrival_count - 1 - i) % SafepointLatencyTrackedThreads;
+    JavaThread* thread = _arrival_thread[slot];
+    jlong time_ns = _arrival_time_ns[slot];
+
+    late[i]._time_to_safepoint_ns = time_ns;
+    stringStream loc(late[i]._location, sizeof(late[i]._location));
+    Method* method;
+    int bci;
+    const char* kind = describe_stop_location(thread, &loc, &method, &bci);
+    stringStream name(late[i]._name, sizeof(late[i]._name));
+    name.print("%s", thread->name());
+
+    post_late_thread_event(safepoint_id, thread, time_ns, method, bci, kind);
+    if (lt.is_enabled()) {
+      lt.print("Safepoint " UINT64_FORMAT ", late thread \"%s\": " JLONG_FORMAT " ns, %s",
+               safepoint_id, late[i]._name, time_ns, late[i]._location);
+    }
+  }
+
+  MutexLocker ml(SafepointLatency_lock, Mutex::_no_safepoint_check_flag);
+  _data._sync.record(sync_time_ns);
+  if (sync_time_ns > _data._worst_sync_ns) {
+    _data._worst_safepoint_id = safepoint_id;
+    _data._worst_type = type;
+    _data._worst_sync_ns = sync_time_ns;
+    _data._worst_late_count = tracked;
+    for (uint i = 0; i < tracked; i++) {
+      _data._worst_late[i] = late[i];
+    }
+  }
+}
+
+void SafepointLatency::end(jlong operation_time_ns, jlong total_time_ns) {
+  MutexLocker ml(SafepointLatency_lock, Mutex::_no_safepoint_check_flag);
+  _data._operation.record(operation_time_ns);
+  _data._total.record(total_time_ns);
+}
+
+void SafepointLatency::print_on(outputStream* st, bool reset) {
+  // Copy out under the lock so the VM thread is not held up by printing.
+  ResourceMark rm;
+  Data* snapshot = NEW_RESOURCE_OBJ(Data);
+  {
+    MutexLocker ml(SafepointLatency_lock, Mutex::_no_safepoint_check_flag);
+    *snapshot = _data;
+    if (reset) {
+      _data.reset();
+    }
+  }
+  snapshot->print_on(st);
+}
+
+SafepointLatencyDCmd::SafepointLatencyDCmd(outputStream* output, bool heap) :
+                                           DCmdWithParser(output, heap),
+  _reset("-reset", "Reset the histograms after printing them", "BOOLEAN", false, "false") {
+  _dcmdparser.add_dcmd_option(&_reset);
+}
+
+void SafepointLatencyDCmd::execute(DCmdSource source, TRAPS) {
+  if (!SafepointLatencyTracking) {
+    output()->print_cr("Safepoint latency tracking is not enabled, use -XX:+UnlockDiagnosticVMOptions -XX:+SafepointLatencyTracking.");
+    return;
+  }
+  SafepointLatency::print_on(output(), _reset.value());
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_RUNTIME_SAFEPOINTLATENCY_HPP
+#define SHARE_RUNTIME_SAFEPOINTLATENCY_HPP
+
+#include "memory/allStatic.hpp"
+#include "runtime/vmOperation.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/latencyHistogram.hpp"
+
+class JavaThread;
+class outputStream;
+
+// Per-safepoint latency tracking, enabled with -XX:+SafepointLatencyTracking.
+//
+// The duration of the synchronization, operation and total phase of every
+// safepoint is recorded in a histogram. While synchronizing, the VM thread
+// remembers the last SafepointLatencyTrackedThreads threads it found to have
+// stopped. Once all threads are stopped it resolves where each of them is
+// parked: the poll site in an nmethod, the interpreted bytecode, or the
+// thread state transition it blocked in. The late threads are posted as
+// SafepointLateThread events, logged with -Xlog:safepoint+latency=debug, and
+// the ones of the slowest safepoint so far are printed by the
+// VM.safepoint_latency diagnostic command.
+//
+// Arrival times are as observed by the VM thread, which polls thread states
+// with back off, so they are upper bounds of the real time to safepoint.
+class SafepointLatency : AllStatic {
+public:
+  static const uint MaxTrackedThreads = 16;
+
+private:
+  struct LateThread {
+    jlong _time_to_safepoint_ns;
+    char  _name[64];
+    char  _location[256];
+  };
+
+  struct Data {
+    LatencyHistogram _sync;
+    LatencyHistogram _operation;
+    LatencyHistogram _total;
+
+    // The late threads of the safepoint with the longest synchronization.
+    uint64_t                 _worst_safepoint_id;
+    VM_Operation::VMOp_Type  _worst_type;
+    jlong                    _worst_sync_ns;
+    uint                     _worst_late_count;
+    LateThread               _worst_late[MaxTrackedThreads];
+
+    void reset();
+    void print_on(outputStream* st) const;
+  };
+
+  static Data _data;
+
+  // Ring of the most recent arrivals of the current safepoint. Arrivals
+  // are observed in time order, so these are the slowest threads.
+  static JavaThread* _arrival_thread[MaxTrackedThreads];
+  static jlong       _arrival_time_ns[MaxTrackedThreads];
+  static uint        _arrival_count;
+
+public:
+  static void begin();
+  static void thread_arrived(JavaThread* thread, jlong time_to_safepoint_ns);
+  static void synchronized(uint64_t safepoint_id, VM_Operation::VMOp_Type type, jlong sync_time_ns);
+  static void end(jlong operation_time_ns, jlong total_time_ns);
+
+  static void print_on(outputStream* st, bool reset);
+};
+
+#endif // SHARE_RUNTIME_SAFEPOINTLATENCY_HPP
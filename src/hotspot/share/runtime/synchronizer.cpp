@@ -1640,11 +1640,13 @@ ObjectMonitor* ObjectSynchronizer::inflate_impl(JavaThread* locking_thread, oop
   }
 }
 
-// Walk the in-use list and deflate (at most MonitorDeflationMax) idle
-// ObjectMonitors. Returns the number of deflated ObjectMonitors.
+// Continue walking the in-use list with iter and deflate (at most
+// MonitorDeflationMax) idle ObjectMonitors. Returns the number of deflated
+// ObjectMonitors. The walk stops before an unvisited ObjectMonitor, so it
+// can be resumed after the deflated ObjectMonitors have been deleted.
 //
-size_t ObjectSynchronizer::deflate_monitor_list(ObjectMonitorDeflationSafepointer* safepointer) {
-  MonitorList::Iterator iter = _in_use_list.iterator();
+size_t ObjectSynchronizer::deflate_monitor_list(MonitorList::Iterator& iter,
+                                                ObjectMonitorDeflationSafepointer* safepointer) {
   size_t deflated_count = 0;
   Thread* current = Thread::current();
 
@@ -1668,6 +1670,8 @@ class HandshakeForDeflation : public HandshakeClosure {
  public:
   HandshakeForDeflation() : HandshakeClosure("HandshakeForDeflation") {}
 
+  bool can_process_in_parallel() { return true; }
+
   void do_thread(Thread* thread) {
     log_trace(monitorinflation)("HandshakeForDeflation::do_thread: thread="
                                 INTPTR_FORMAT, p2i(thread));
@@ -1809,18 +1813,32 @@ size_t ObjectSynchronizer::deflate_idle_monitors() {
   ObjectMonitorDeflationLogging log;
   ObjectMonitorDeflationSafepointer safepointer(current, &log);
 
-  log.begin();
+  EventJavaMonitorDeflationStatistics event;
 
-  // Deflate some idle ObjectMonitors.
-  size_t deflated_count = deflate_monitor_list(&safepointer);
+  log.begin();
 
-  // Unlink the deflated ObjectMonitors from the in-use list.
+  // Deflate idle ObjectMonitors in batches of at most MonitorDeflationMax.
+  // Each batch is unlinked, handshaked and deleted before the walk of the
+  // in-use list continues, so memory is released while a large population
+  // is still being processed and a cycle covers the whole list.
+  MonitorList::Iterator iter = _in_use_list.iterator();
+  size_t deflated_count = 0;
   size_t unlinked_count = 0;
-  size_t deleted_count = 0;
-  if (deflated_count > 0) {
+  uint batches = 0;
+  size_t batch_deflated_count;
+  do {
+    batch_deflated_count = deflate_monitor_list(iter, &safepointer);
+    if (batch_deflated_count == 0) {
+      break;
+    }
+    batches++;
+    deflated_count += batch_deflated_count;
+
+    // Unlink the deflated ObjectMonitors from the in-use list.
     ResourceMark rm(current);
-    GrowableArray<ObjectMonitor*> delete_list((int)deflated_count);
-    unlinked_count = _in_use_list.unlink_deflated(deflated_count, &delete_list, &safepointer);
+    GrowableArray<ObjectMonitor*> delete_list((int)batch_deflated_count);
+    size_t batch_unlinked_count = _in_use_list.unlink_deflated(batch_deflated_count, &delete_list, &safepointer);
+    unlinked_count += batch_unlinked_count;
 
 #ifdef ASSERT
     if (UseObjectMonitorTable) {
@@ -1830,10 +1848,10 @@ size_t ObjectSynchronizer::deflate_idle_monitors() {
     }
 #endif
 
-    log.before_handshake(unlinked_count);
+    log.before_handshake(batch_unlinked_count);
 
     // A JavaThread needs to handshake in order to safely free the
-    // ObjectMonitors that were deflated in this cycle.
+    // ObjectMonitors that were deflated in this batch.
     HandshakeForDeflation hfd_hc;
     Handshake::execute(&hfd_hc);
     // Also, we sync and desync GC threads around the handshake, so that they can
@@ -1845,15 +1863,22 @@ size_t ObjectSynchronizer::deflate_idle_monitors() {
     log.after_handshake();
 
     // After the handshake, safely free the ObjectMonitors that were
-    // deflated and unlinked in this cycle.
+    // deflated and unlinked in this batch.
 
     // Delete the unlinked ObjectMonitors.
-    deleted_count = delete_monitors(&delete_list, &safepointer);
-    assert(unlinked_count == deleted_count, "must be");
-  }
+    size_t batch_deleted_count = delete_monitors(&delete_list, &safepointer);
+    assert(batch_unlinked_count == batch_deleted_count, "must be");
+  } while (batch_deflated_count >= (size_t)MonitorDeflationMax && iter.has_next());
 
   log.end(deflated_count, unlinked_count);
 
+  if (event.should_commit()) {
+    event.set_deflatedCount(deflated_count);
+    event.set_batches(batches);
+    event.set_inUseCount(_in_use_list.count());
+    event.commit();
+  }
+
   GVars.stw_random = os::random();
 
   if (deflated_count != 0) {
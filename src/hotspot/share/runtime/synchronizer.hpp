@@ -187,7 +187,8 @@ class ObjectSynchronizer : AllStatic {
   static size_t deflate_idle_monitors();
 
   // Deflate idle monitors:
-  static size_t deflate_monitor_list(ObjectMonitorDeflationSafepointer* safepointer);
+  static size_t deflate_monitor_list(MonitorList::Iterator& iter,
+                                     ObjectMonitorDeflationSafepointer* safepointer);
   static size_t in_use_list_count();
   static size_t in_use_list_max();
   static size_t in_use_list_ceiling();
@@ -30,6 +30,7 @@
 #include "cds/heapShared.hpp"
 #include "cds/metaspaceShared.hpp"
 #include "classfile/classLoader.hpp"
+#include "classfile/classPreloader.hpp"
 #include "classfile/javaClasses.hpp"
 #include "classfile/javaThreadStatus.hpp"
 #include "classfile/symbolTable.hpp"
@@ -70,6 +71,7 @@
 #include "runtime/globals.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/handshake.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/java.hpp"
 #include "runtime/javaCalls.hpp"
@@ -862,6 +864,9 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
     CLEAR_PENDING_EXCEPTION;
   }
 
+  // Overlap loading of the boot classes in the class list with main().
+  ClassPreloader::start();
+
   // Let WatcherThread run all registered periodic tasks now.
   // NOTE:  All PeriodicTasks should be registered by now. If they
   //   aren't, late joiners might appear to start slowly (we might
@@ -1346,9 +1351,7 @@ class PrintOnClosure : public ThreadClosure {
 };
 
 // Threads::print_on() is called at safepoint by VM_PrintThreads operation.
-void Threads::print_on(outputStream* st, bool print_stacks,
-                       bool internal_format, bool print_concurrent_locks,
-                       bool print_extended_info) {
+static void print_thread_dump_header(outputStream* st) {
   char buf[32];
   st->print_raw_cr(os::local_time_string(buf, sizeof(buf)));
 
@@ -1357,6 +1360,20 @@ void Threads::print_on(outputStream* st, bool print_stacks,
                VM_Version::vm_release(),
                VM_Version::vm_info_string());
   st->cr();
+}
+
+static void print_java_thread_stack_on(JavaThread* p, outputStream* st) {
+  p->print_stack_on(st);
+  if (p->is_vthread_mounted()) {
+    st->print_cr("   Mounted virtual thread #" INT64_FORMAT, java_lang_Thread::thread_id(p->vthread()));
+    p->print_vthread_stack_on(st);
+  }
+}
+
+void Threads::print_on(outputStream* st, bool print_stacks,
+                       bool internal_format, bool print_concurrent_locks,
+                       bool print_extended_info) {
+  print_thread_dump_header(st);
 
 #if INCLUDE_SERVICES
   // Dump concurrent locks
@@ -1376,11 +1393,7 @@ void Threads::print_on(outputStream* st, bool print_stacks,
       if (internal_format) {
         p->trace_stack();
       } else {
-        p->print_stack_on(st);
-        if (p->is_vthread_mounted()) {
-          st->print_cr("   Mounted virtual thread #" INT64_FORMAT, java_lang_Thread::thread_id(p->vthread()));
-          p->print_vthread_stack_on(st);
-        }
+        print_java_thread_stack_on(p, st);
       }
     }
     st->cr();
@@ -1397,6 +1410,43 @@ void Threads::print_on(outputStream* st, bool print_stacks,
   st->flush();
 }
 
+class PrintThreadHandshakeClosure : public HandshakeClosure {
+private:
+  outputStream* _st;
+  bool _print_extended_info;
+
+public:
+  PrintThreadHandshakeClosure(outputStream* st, bool print_extended_info) :
+      HandshakeClosure("PrintThread"), _st(st), _print_extended_info(print_extended_info) {}
+
+  virtual void do_thread(Thread* thread) {
+    JavaThread* p = JavaThread::cast(thread);
+    ResourceMark rm;
+    p->print_on(_st, _print_extended_info);
+    print_java_thread_stack_on(p, _st);
+    _st->cr();
+  }
+};
+
+// Like print_on, but each Java thread is printed in a handshake with that
+// thread, so only one thread at a time is stopped. The threads are not
+// printed at the same point in time, and the output can't include the
+// concurrent locks, which need a heap walk at a safepoint.
+void Threads::print_on_with_handshakes(outputStream* st, bool print_extended_info) {
+  print_thread_dump_header(st);
+
+  PrintThreadHandshakeClosure cl(st, print_extended_info);
+  ThreadsListHandle tlh;
+  for (JavaThread* p : tlh) {
+    Handshake::execute(&cl, &tlh, p);
+  }
+
+  PrintOnClosure non_java_cl(st);
+  non_java_threads_do(&non_java_cl);
+
+  st->flush();
+}
+
 void Threads::print_on_error(Thread* this_thread, outputStream* st, Thread* current, char* buf,
                              int buflen, bool* found_current) {
   if (this_thread != nullptr) {
@@ -54,6 +54,7 @@
   template(SerialGCCollect)                       \
   template(ParallelCollectForAllocation)          \
   template(ParallelGCCollect)                     \
+  template(EpsilonCollect)                        \
   template(G1CollectForAllocation)                \
   template(G1CollectFull)                         \
   template(G1PauseRemark)                         \
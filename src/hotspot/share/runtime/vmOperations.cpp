@@ -640,6 +640,7 @@ void VM_PrintCompileQueue::doit() {
 
 #if INCLUDE_SERVICES
 void VM_PrintClassHierarchy::doit() {
-  KlassHierarchy::print_class_hierarchy(_out, _print_interfaces, _print_subclasses, _classname);
+  KlassHierarchy::print_class_hierarchy(_out, _print_interfaces, _print_subclasses,
+                                        _print_secondary_supers, _classname);
 }
 #endif
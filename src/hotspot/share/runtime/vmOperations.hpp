@@ -280,12 +280,14 @@ class VM_PrintClassHierarchy: public VM_Operation {
   outputStream* _out;
   bool _print_interfaces;
   bool _print_subclasses;
+  bool _print_secondary_supers;
   char* _classname;
 
  public:
-  VM_PrintClassHierarchy(outputStream* st, bool print_interfaces, bool print_subclasses, char* classname) :
+  VM_PrintClassHierarchy(outputStream* st, bool print_interfaces, bool print_subclasses,
+                         bool print_secondary_supers, char* classname) :
     _out(st), _print_interfaces(print_interfaces), _print_subclasses(print_subclasses),
-    _classname(classname) {}
+    _print_secondary_supers(print_secondary_supers), _classname(classname) {}
   VMOp_Type type() const { return VMOp_PrintClassHierarchy; }
   void doit();
 };
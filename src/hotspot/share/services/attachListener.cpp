@@ -61,6 +61,7 @@
 class attachStream : public bufferedStream {
   AttachOperation::ReplyWriter* _reply_writer;
   const bool _allow_streaming;
+  const bool _framed;
   enum class ResultState { Unset, Set, Written };
   ResultState _result_state;
   jint _result;
@@ -81,7 +82,8 @@ class attachStream : public bufferedStream {
     }
 
     if (_result_state != ResultState::Written) {
-      if (_reply_writer->write_reply(_result, this)) {
+      if (_framed ? _reply_writer->write_framed_reply(_result, this)
+                  : _reply_writer->write_reply(_result, this)) {
         _result_state = ResultState::Written;
         reset();
       } else {
@@ -95,10 +97,12 @@ class attachStream : public bufferedStream {
   }
 
 public:
-  attachStream(AttachOperation::ReplyWriter* reply_writer, bool allow_streaming)
+  attachStream(AttachOperation::ReplyWriter* reply_writer, bool allow_streaming, bool framed = false)
     : bufferedStream(INITIAL_BUFFER_SIZE, MAXIMUM_BUFFER_SIZE),
       _reply_writer(reply_writer),
-      _allow_streaming(reply_writer == nullptr ? false : allow_streaming),
+      // framed replies carry the output size, so they cannot be streamed
+      _allow_streaming(reply_writer == nullptr || framed ? false : allow_streaming),
+      _framed(framed),
       _result_state(ResultState::Unset), _result(JNI_OK),
       _error(false)
     {}
@@ -175,6 +179,8 @@ AttachAPIVersion AttachListener::_supported_version = ATTACH_API_V1;
 // Default is false (if jdk.attach.vm.streaming property is not set).
 bool AttachListener::_default_streaming_output = false;
 
+bool AttachListener::_keepalive_supported = false;
+
 static bool get_bool_sys_prop(const char* name, bool default_value, TRAPS) {
   ResourceMark rm(THREAD);
   HandleMark hm(THREAD);
@@ -555,6 +561,9 @@ static jint get_version(AttachOperation* op, attachStream* out) {
   if (strcmp(arg0, "options") == 0) {
       // print supported options: "option1,option2..."
       out->print(" streaming");
+      if (AttachListener::is_keepalive_supported()) {
+        out->print(" keepalive");
+      }
   }
   return JNI_OK;
 }
@@ -611,7 +620,7 @@ void AttachListenerThread::thread_entry(JavaThread* thread, TRAPS) {
     }
 
     ResourceMark rm;
-    attachStream st(op->get_reply_writer(), op->streaming_output());
+    attachStream st(op->get_reply_writer(), op->streaming_output(), op->keepalive());
 
     // handle special detachall operation
     if (strcmp(op->name(), AttachOperation::detachall_operation_name()) == 0) {
@@ -815,6 +824,10 @@ void AttachOperation::RequestReader::parse_options(AttachOperation* op, char* st
       } else if (strcmp(value, "0") == 0) {
         op->set_streaming_output(false);
       }
+    } else if (strcmp(name, "keepalive") == 0) {
+      if (strcmp(value, "1") == 0 && AttachListener::is_keepalive_supported()) {
+        op->set_keepalive(true);
+      }
     }
   }
 }
@@ -937,3 +950,10 @@ bool AttachOperation::ReplyWriter::write_reply(jint result, bufferedStream* resu
   return write_reply(result, result_stream->base(), (int)result_stream->size());
 }
 
+bool AttachOperation::ReplyWriter::write_framed_reply(jint result, bufferedStream* result_stream) {
+  char buf[32];
+  os::snprintf_checked(buf, sizeof(buf), "%d\n", (int)result_stream->size());
+  return write_reply(result, buf) &&
+         write_fully(result_stream->base(), (int)result_stream->size());
+}
+
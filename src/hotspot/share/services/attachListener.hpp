@@ -67,6 +67,10 @@ jdk25 update: client may specify additional options in the attach operation requ
   Option "streaming":
     - "streaming=1" turns on streaming output. Output data are sent as they become available.
     - "streaming=0" turns off streaming output. Output is buffered and sent after the operation is complete.
+  Option "keepalive" (only reported by platforms that support it):
+    - "keepalive=1" keeps the connection open after the operation is complete, so the client can
+      send further requests over the same connection. Output is not streamed, and the reply
+      is framed as "<result>\n<size>\n" followed by exactly <size> bytes of output.
 */
 enum AttachAPIVersion: int {
   ATTACH_API_V1 = 1,
@@ -111,6 +115,8 @@ class AttachListener: AllStatic {
 
   static bool _default_streaming_output;
 
+  static bool _keepalive_supported;
+
  public:
   static void set_supported_version(AttachAPIVersion version);
   static AttachAPIVersion get_supported_version();
@@ -122,6 +128,14 @@ class AttachListener: AllStatic {
     return _default_streaming_output;
   }
 
+  // set by platforms which can serve several operations over one connection
+  static void set_keepalive_supported(bool value) {
+    _keepalive_supported = value;
+  }
+  static bool is_keepalive_supported() {
+    return _keepalive_supported;
+  }
+
   static void set_state(AttachListenerState new_state) {
     Atomic::store(&_state, new_state);
   }
@@ -185,6 +199,7 @@ class AttachOperation: public CHeapObj<mtServiceability> {
   char* _name;
   GrowableArrayCHeap<char*, mtServiceability> _args;
   bool _streaming; // streaming output is requested
+  bool _keepalive; // the connection is kept open for further operations
 
   static char* copy_str(const char* value) {
     return value == nullptr ? nullptr : os::strdup(value, mtServiceability);
@@ -229,15 +244,22 @@ class AttachOperation: public CHeapObj<mtServiceability> {
     _streaming = value;
   }
 
+  bool keepalive() const {
+    return _keepalive;
+  }
+  void set_keepalive(bool value) {
+    _keepalive = value;
+  }
+
   // create an v1 operation of a given name (for compatibility, deprecated)
-  AttachOperation(const char* name) : _name(nullptr), _streaming(AttachListener::get_default_streaming()) {
+  AttachOperation(const char* name) : _name(nullptr), _streaming(AttachListener::get_default_streaming()), _keepalive(false) {
     set_name(name);
     for (int i = 0; i < arg_count_max; i++) {
       set_arg(i, nullptr);
     }
   }
 
-  AttachOperation() : _name(nullptr), _streaming(AttachListener::get_default_streaming()) {
+  AttachOperation() : _name(nullptr), _streaming(AttachListener::get_default_streaming()), _keepalive(false) {
   }
 
   virtual ~AttachOperation() {
@@ -294,6 +316,8 @@ class AttachOperation: public CHeapObj<mtServiceability> {
     // Writes standard operation reply.
     bool write_reply(jint result, const char* message, int message_len = -1);
     bool write_reply(jint result, bufferedStream* result_stream);
+    // Writes reply with the size of the output, used for keepalive connections.
+    bool write_framed_reply(jint result, bufferedStream* result_stream);
   };
 
   // Platform implementation needs to implement the method to support streaming output.
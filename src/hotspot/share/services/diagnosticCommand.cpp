@@ -37,6 +37,7 @@
 #include "compiler/directivesParser.hpp"
 #include "gc/shared/gcVMOperations.hpp"
 #include "jvm.h"
+#include "memory/heapInspection.hpp"
 #include "memory/metaspaceUtils.hpp"
 #include "memory/metaspace/metaspaceDCmd.hpp"
 #include "memory/resourceArea.hpp"
@@ -54,7 +55,9 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/jniHandles.hpp"
+#include "runtime/mutex.hpp"
 #include "runtime/os.hpp"
+#include "runtime/threads.hpp"
 #include "runtime/vmOperations.hpp"
 #include "runtime/vm_version.hpp"
 #include "services/diagnosticArgument.hpp"
@@ -103,8 +106,10 @@ void DCmd::register_dcmds(){
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<PrintVMFlagsDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<SetVMFlagDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<VMDynamicLibrariesDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<VMLockStatsDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<VMUptimeDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<VMInfoDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<SafepointLatencyDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<SystemGCDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<RunFinalizationDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<HeapInfoDCmd>(full_export, true, false));
@@ -471,7 +476,8 @@ void FinalizerInfoDCmd::execute(DCmdSource source, TRAPS) {
 #if INCLUDE_SERVICES // Heap dumping/inspection supported
 HeapDumpDCmd::HeapDumpDCmd(outputStream* output, bool heap) :
                            DCmdWithParser(output, heap),
-  _filename("filename","Name of the dump file", "FILE",true),
+  _filename("filename","Name of the dump file, or tcp://<host>:<port> or fd://<n> "
+                       "to stream the dump", "FILE",true),
   _all("-all", "Dump all objects, including unreachable objects",
        "BOOLEAN", false, "false"),
   _gzip("-gz", "If specified, the heap dump is written in gzipped format "
@@ -481,12 +487,15 @@ HeapDumpDCmd::HeapDumpDCmd(outputStream* output, bool heap) :
            "BOOLEAN", false, "false"),
   _parallel("-parallel", "Number of parallel threads to use for heap dump. The VM "
                           "will try to use the specified number of threads, but might use fewer.",
-            "INT", false, "1") {
+            "INT", false, "1"),
+  _lz4("-lz4", "If specified, the heap dump is written in LZ4 frame format, "
+               "which is much faster to write than gzip", "BOOLEAN", false, "false") {
   _dcmdparser.add_dcmd_option(&_all);
   _dcmdparser.add_dcmd_argument(&_filename);
   _dcmdparser.add_dcmd_option(&_gzip);
   _dcmdparser.add_dcmd_option(&_overwrite);
   _dcmdparser.add_dcmd_option(&_parallel);
+  _dcmdparser.add_dcmd_option(&_lz4);
 }
 
 void HeapDumpDCmd::execute(DCmdSource source, TRAPS) {
@@ -502,6 +511,11 @@ void HeapDumpDCmd::execute(DCmdSource source, TRAPS) {
     }
   }
 
+  if (_lz4.value() && _gzip.is_set()) {
+    output()->print_cr("Only one of -gz and -lz4 can be specified.");
+    return;
+  }
+
   if (_parallel.is_set()) {
     parallel = _parallel.value();
 
@@ -518,7 +532,7 @@ void HeapDumpDCmd::execute(DCmdSource source, TRAPS) {
   // This helps reduces the amount of unreachable objects in the dump
   // and makes it easier to browse.
   HeapDumper dumper(!_all.value() /* request GC if _all is false*/);
-  dumper.dump(_filename.value(), output(), (int) level, _overwrite.value(), (uint)parallel);
+  dumper.dump(_filename.value(), output(), (int) level, _overwrite.value(), (uint)parallel, _lz4.value());
 }
 
 ClassHistogramDCmd::ClassHistogramDCmd(outputStream* output, bool heap) :
@@ -531,12 +545,36 @@ ClassHistogramDCmd::ClassHistogramDCmd(outputStream* output, bool heap) :
        "1 means use one thread (disable parallelism). "
        "For any other value the VM will try to use the specified number of "
        "threads, but might use fewer.",
-       "INT", false, "0") {
+       "INT", false, "0"),
+  _concurrent("-concurrent",
+       "Gather the histogram during the next concurrent marking cycle instead of "
+       "stopping the world to walk the heap (G1 and ZGC only). The histogram of "
+       "the objects marked by the cycle is logged with gc+classhisto when marking "
+       "completes. Objects allocated since marking started, and with G1 objects "
+       "in young regions, are not included.",
+       "BOOLEAN", false, "false") {
   _dcmdparser.add_dcmd_option(&_all);
   _dcmdparser.add_dcmd_option(&_parallel_thread_num);
+  _dcmdparser.add_dcmd_option(&_concurrent);
 }
 
 void ClassHistogramDCmd::execute(DCmdSource source, TRAPS) {
+  if (_concurrent.value()) {
+    if (!UseG1GC && !UseZGC) {
+      output()->print_cr("A concurrent class histogram requires G1 or ZGC.");
+      return;
+    }
+    if (_all.value() || _parallel_thread_num.is_set()) {
+      output()->print_cr("-all and -parallel cannot be used with -concurrent.");
+      return;
+    }
+    ConcurrentHeapHistogram::request();
+    output()->print_cr("Class histogram requested from the next concurrent marking cycle, "
+                       "it is logged with gc+classhisto%s.",
+                       log_is_enabled(Info, gc, classhisto) ? "" : " (currently disabled, see VM.log)");
+    return;
+  }
+
   jlong num = _parallel_thread_num.value();
   if (num < 0) {
     output()->print_cr("Parallel thread number out of range (>=0): " JLONG_FORMAT, num);
@@ -556,12 +594,24 @@ void ClassHistogramDCmd::execute(DCmdSource source, TRAPS) {
 ThreadDumpDCmd::ThreadDumpDCmd(outputStream* output, bool heap) :
                                DCmdWithParser(output, heap),
   _locks("-l", "print java.util.concurrent locks", "BOOLEAN", false, "false"),
-  _extended("-e", "print extended thread information", "BOOLEAN", false, "false") {
+  _extended("-e", "print extended thread information", "BOOLEAN", false, "false"),
+  _handshake("-handshake", "print each thread in a handshake with it instead of "
+             "stopping all threads at a safepoint, not compatible with -l", "BOOLEAN", false, "false") {
   _dcmdparser.add_dcmd_option(&_locks);
   _dcmdparser.add_dcmd_option(&_extended);
+  _dcmdparser.add_dcmd_option(&_handshake);
 }
 
 void ThreadDumpDCmd::execute(DCmdSource source, TRAPS) {
+  if (_handshake.value()) {
+    if (_locks.value()) {
+      output()->print_cr("The -l option can not be used with -handshake");
+      return;
+    }
+    Threads::print_on_with_handshakes(output(), _extended.value());
+    return;
+  }
+
   // thread stacks and JNI global handles
   VM_PrintThreads op1(output(), _locks.value(), _extended.value(), true /* print JNI handle info */);
   VMThread::execute(&op1);
@@ -836,6 +886,10 @@ void VMDynamicLibrariesDCmd::execute(DCmdSource source, TRAPS) {
   output()->cr();
 }
 
+void VMLockStatsDCmd::execute(DCmdSource source, TRAPS) {
+  Mutex::print_lock_statistics(output());
+}
+
 void CompileQueueDCmd::execute(DCmdSource source, TRAPS) {
   VM_PrintCompileQueue printCompileQueueOp(output());
   VMThread::execute(&printCompileQueueOp);
@@ -934,17 +988,22 @@ ClassHierarchyDCmd::ClassHierarchyDCmd(outputStream* output, bool heap) :
   _print_subclasses("-s", "If a classname is specified, print its subclasses "
                     "in addition to its superclasses. Without this option only the "
                     "superclasses will be printed.", "BOOLEAN", false, "false"),
+  _print_secondary_supers("-secondary", "Print the secondary supers table of each class, "
+                          "with the number of probes needed for positive and negative lookups.",
+                          "BOOLEAN", false, "false"),
   _classname("classname", "Name of class whose hierarchy should be printed. "
              "If not specified, all class hierarchies are printed.",
              "STRING", false) {
   _dcmdparser.add_dcmd_option(&_print_interfaces);
   _dcmdparser.add_dcmd_option(&_print_subclasses);
+  _dcmdparser.add_dcmd_option(&_print_secondary_supers);
   _dcmdparser.add_dcmd_argument(&_classname);
 }
 
 void ClassHierarchyDCmd::execute(DCmdSource source, TRAPS) {
   VM_PrintClassHierarchy printClassHierarchyOp(output(), _print_interfaces.value(),
-                                               _print_subclasses.value(), _classname.value());
+                                               _print_subclasses.value(), _print_secondary_supers.value(),
+                                               _classname.value());
   VMThread::execute(&printClassHierarchyOp);
 }
 #endif
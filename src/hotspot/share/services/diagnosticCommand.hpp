@@ -176,6 +176,21 @@ class VMDynamicLibrariesDCmd : public DCmd {
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class VMLockStatsDCmd : public DCmd {
+public:
+  VMLockStatsDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() {
+    return "VM.lock_stats";
+  }
+  static const char* description() {
+    return "Print contention statistics of VM internal locks (requires -XX:+ProfileVMLocks).";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 class VMUptimeDCmd : public DCmdWithParser {
 protected:
   DCmdArgument<bool> _date;
@@ -266,8 +281,9 @@ class HeapDumpDCmd : public DCmdWithParser {
   DCmdArgument<jlong> _gzip;
   DCmdArgument<bool> _overwrite;
   DCmdArgument<jlong> _parallel;
+  DCmdArgument<bool> _lz4;
 public:
-  static int num_arguments() { return 5; }
+  static int num_arguments() { return 6; }
   HeapDumpDCmd(outputStream* output, bool heap);
   static const char* name() {
     return "GC.heap_dump";
@@ -288,8 +304,9 @@ class ClassHistogramDCmd : public DCmdWithParser {
 protected:
   DCmdArgument<bool> _all;
   DCmdArgument<jlong> _parallel_thread_num;
+  DCmdArgument<bool> _concurrent;
 public:
-  static int num_arguments() { return 2; }
+  static int num_arguments() { return 3; }
   ClassHistogramDCmd(outputStream* output, bool heap);
   static const char* name() {
     return "GC.class_histogram";
@@ -307,9 +324,10 @@ class ClassHierarchyDCmd : public DCmdWithParser {
 protected:
   DCmdArgument<bool> _print_interfaces; // true if inherited interfaces should be printed.
   DCmdArgument<bool> _print_subclasses; // true if subclasses of the specified classname should be printed.
+  DCmdArgument<bool> _print_secondary_supers; // true if secondary supers table statistics should be printed.
   DCmdArgument<char*> _classname; // Optional single class name whose hierarchy should be printed.
 public:
-  static int num_arguments() { return 3; }
+  static int num_arguments() { return 4; }
   ClassHierarchyDCmd(outputStream* output, bool heap);
   static const char* name() {
     return "VM.class_hierarchy";
@@ -351,8 +369,9 @@ class ThreadDumpDCmd : public DCmdWithParser {
 protected:
   DCmdArgument<bool> _locks;
   DCmdArgument<bool> _extended;
+  DCmdArgument<bool> _handshake;
 public:
-  static int num_arguments() { return 2; }
+  static int num_arguments() { return 3; }
   ThreadDumpDCmd(outputStream* output, bool heap);
   static const char* name() { return "Thread.print"; }
   static const char* description() {
@@ -699,6 +718,25 @@ class StringtableDCmd : public DCmdWithParser {
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class SafepointLatencyDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<bool> _reset;
+public:
+  static int num_arguments() { return 1; }
+  SafepointLatencyDCmd(outputStream* output, bool heap);
+  static const char* name() {
+    return "VM.safepoint_latency";
+  }
+  static const char* description() {
+    return "Print safepoint latency histograms and the threads that were last to reach "
+           "the slowest safepoint. Requires -XX:+SafepointLatencyTracking.";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 class SystemDictionaryDCmd : public DCmdWithParser {
 protected:
   DCmdArgument<bool> _verbose;
@@ -608,7 +608,8 @@ void AbstractDumpWriter::end_sub_record() {
 
 class DumpWriter : public AbstractDumpWriter {
 private:
-  FileWriter* _writer;
+  AbstractWriter* _writer;
+  FileWriter* _file_writer; // null if writing to a stream
   AbstractCompressor* _compressor;
   size_t _bytes_written;
   char* _error;
@@ -621,17 +622,21 @@ class DumpWriter : public AbstractDumpWriter {
 
 private:
   void do_compress();
+  void initialize();
 
 public:
   DumpWriter(const char* path, bool overwrite, AbstractCompressor* compressor);
+  // Writes to a tcp:// or fd:// stream, takes ownership of the writer.
+  DumpWriter(StreamWriter* writer, AbstractCompressor* compressor);
   ~DumpWriter();
   julong bytes_written() const override        { return (julong) _bytes_written; }
   char const* error() const override           { return _error; }
   void set_error(const char* error)            { _error = (char*)error; }
   bool has_error() const                       { return _error != nullptr; }
-  const char* get_file_path() const            { return _writer->get_file_path(); }
+  bool is_stream() const                       { return _file_writer == nullptr; }
+  const char* get_file_path() const            { assert(!is_stream(), "no file"); return _file_writer->get_file_path(); }
   AbstractCompressor* compressor()             { return _compressor; }
-  bool is_overwrite() const                    { return _writer->is_overwrite(); }
+  bool is_overwrite() const                    { assert(!is_stream(), "no file"); return _file_writer->is_overwrite(); }
 
   void flush() override;
 
@@ -639,13 +644,14 @@ class DumpWriter : public AbstractDumpWriter {
   // internals for DumpMerger
   friend class DumpMerger;
   void set_bytes_written(julong bytes_written) { _bytes_written = bytes_written; }
-  int get_fd() const                           { return _writer->get_fd(); }
+  int get_fd() const                           { assert(!is_stream(), "no file"); return _file_writer->get_fd(); }
   void set_compressor(AbstractCompressor* p)   { _compressor = p; }
 };
 
 DumpWriter::DumpWriter(const char* path, bool overwrite, AbstractCompressor* compressor) :
   AbstractDumpWriter(),
-  _writer(new (std::nothrow) FileWriter(path, overwrite)),
+  _writer(nullptr),
+  _file_writer(new (std::nothrow) FileWriter(path, overwrite)),
   _compressor(compressor),
   _bytes_written(0),
   _error(nullptr),
@@ -654,10 +660,34 @@ DumpWriter::DumpWriter(const char* path, bool overwrite, AbstractCompressor* com
   _out_pos(0),
   _tmp_buffer(nullptr),
   _tmp_size(0) {
+  _writer = _file_writer;
+  initialize();
+}
+
+DumpWriter::DumpWriter(StreamWriter* writer, AbstractCompressor* compressor) :
+  AbstractDumpWriter(),
+  _writer(writer),
+  _file_writer(nullptr),
+  _compressor(compressor),
+  _bytes_written(0),
+  _error(nullptr),
+  _out_buffer(nullptr),
+  _out_size(0),
+  _out_pos(0),
+  _tmp_buffer(nullptr),
+  _tmp_size(0) {
+  initialize();
+}
+
+void DumpWriter::initialize() {
+  if (_writer == nullptr) {
+    _error = (char*)"Could not allocate writer";
+    return;
+  }
   _error = (char*)_writer->open_writer();
   if (_error == nullptr) {
     _buffer = (char*)os::malloc(io_buffer_max_size, mtInternal);
-    if (compressor != nullptr) {
+    if (_compressor != nullptr) {
       _error = (char*)_compressor->init(io_buffer_max_size, &_out_size, &_tmp_size);
       if (_error == nullptr) {
         if (_out_size > 0) {
@@ -2271,6 +2301,9 @@ class VM_HeapDumper : public VM_GC_Operation, public WorkerTask, public Unmounte
   // HPROF_TRACE and HPROF_FRAME records for platform and mounted virtual threads
   void dump_stack_traces(AbstractDumpWriter* writer);
 
+  // HPROF_HEAP_DUMP_SEGMENT records
+  void dump_heap_segments(DumpWriter* segment_writer, int dumper_id, uint worker_id);
+
  public:
   VM_HeapDumper(DumpWriter* writer, bool gc_before_heap_dump, bool oome, uint num_dump_threads) :
     VM_GC_Operation(0 /* total collections,      dummy, ignored */,
@@ -2367,8 +2400,9 @@ bool VM_HeapDumper::doit_prologue() {
 void VM_HeapDumper::prepare_parallel_dump(WorkerThreads* workers) {
   uint num_active_workers = workers != nullptr ? workers->active_workers() : 0;
   uint num_requested_dump_threads = _num_dumper_threads;
-  // check if we can dump in parallel based on requested and active threads
-  if (num_active_workers <= 1 || num_requested_dump_threads <= 1) {
+  // check if we can dump in parallel based on requested and active threads,
+  // parallel dumpers write to separate files that a stream cannot be merged from
+  if (num_active_workers <= 1 || num_requested_dump_threads <= 1 || _writer->is_stream()) {
     _num_dumper_threads = 1;
   } else {
     _num_dumper_threads = clamp(num_requested_dump_threads, 2U, num_active_workers);
@@ -2476,22 +2510,43 @@ void VM_HeapDumper::work(uint worker_id) {
   // HPROF_HEAP_DUMP/HPROF_HEAP_DUMP_SEGMENT starts here
 
   ResourceMark rm;
-  // share global compressor, local DumpWriter is not responsible for its life cycle
-  DumpWriter segment_writer(DumpMerger::get_writer_path(writer()->get_file_path(), dumper_id),
-                            writer()->is_overwrite(), writer()->compressor());
-  if (!segment_writer.has_error()) {
+  if (writer()->is_stream()) {
+    // A stream cannot be merged into later, so the heap dump segments are
+    // written to the global writer directly. Stream dumps are never parallel.
+    assert(!is_parallel_dump(), "invariant");
+    dump_heap_segments(writer(), dumper_id, worker_id);
+  } else {
+    // share global compressor, local DumpWriter is not responsible for its life cycle
+    DumpWriter segment_writer(DumpMerger::get_writer_path(writer()->get_file_path(), dumper_id),
+                              writer()->is_overwrite(), writer()->compressor());
+    dump_heap_segments(&segment_writer, dumper_id, worker_id);
+  }
+
+  if (is_vm_dumper(dumper_id)) {
+    _dumper_controller->wait_all_dumpers_complete();
+
+    // flush global writer
+    writer()->flush();
+
+    // At this point, all fragments of the heapdump have been written to separate files.
+    // We need to merge them into a complete heapdump and write HPROF_HEAP_DUMP_END at that time.
+  }
+}
+
+void VM_HeapDumper::dump_heap_segments(DumpWriter* segment_writer, int dumper_id, uint worker_id) {
+  if (!segment_writer->has_error()) {
     if (is_vm_dumper(dumper_id)) {
       // dump some non-heap subrecords to heap dump segment
       TraceTime timer("Dump non-objects (part 2)", TRACETIME_LOG(Info, heapdump));
       // Writes HPROF_GC_CLASS_DUMP records
-      ClassDumper class_dumper(&segment_writer);
+      ClassDumper class_dumper(segment_writer);
       ClassLoaderDataGraph::classes_do(&class_dumper);
 
       // HPROF_GC_ROOT_THREAD_OBJ + frames + jni locals
-      dump_threads(&segment_writer);
+      dump_threads(segment_writer);
 
       // HPROF_GC_ROOT_JNI_GLOBAL
-      JNIGlobalsDumper jni_dumper(&segment_writer);
+      JNIGlobalsDumper jni_dumper(segment_writer);
       JNIHandles::oops_do(&jni_dumper);
       // technically not jni roots, but global roots
       // for things like preallocated throwable backtraces
@@ -2499,7 +2554,7 @@ void VM_HeapDumper::work(uint worker_id) {
       // HPROF_GC_ROOT_STICKY_CLASS
       // These should be classes in the null class loader data, and not all classes
       // if !ClassUnloading
-      StickyClassDumper stiky_class_dumper(&segment_writer);
+      StickyClassDumper stiky_class_dumper(segment_writer);
       ClassLoaderData::the_null_class_loader_data()->classes_do(&stiky_class_dumper);
     }
 
@@ -2512,7 +2567,7 @@ void VM_HeapDumper::work(uint worker_id) {
     // of the heap dump.
 
     TraceTime timer(is_parallel_dump() ? "Dump heap objects in parallel" : "Dump heap objects", TRACETIME_LOG(Info, heapdump));
-    HeapObjectDumper obj_dumper(&segment_writer, this);
+    HeapObjectDumper obj_dumper(segment_writer, this);
     if (!is_parallel_dump()) {
       Universe::heap()->object_iterate(&obj_dumper);
     } else {
@@ -2520,21 +2575,11 @@ void VM_HeapDumper::work(uint worker_id) {
       _poi->object_iterate(&obj_dumper, worker_id);
     }
 
-    segment_writer.finish_dump_segment();
-    segment_writer.flush();
+    segment_writer->finish_dump_segment();
+    segment_writer->flush();
   }
 
-  _dumper_controller->dumper_complete(&segment_writer, writer());
-
-  if (is_vm_dumper(dumper_id)) {
-    _dumper_controller->wait_all_dumpers_complete();
-
-    // flush global writer
-    writer()->flush();
-
-    // At this point, all fragments of the heapdump have been written to separate files.
-    // We need to merge them into a complete heapdump and write HPROF_HEAP_DUMP_END at that time.
-  }
+  _dumper_controller->dumper_complete(segment_writer, writer());
 }
 
 void VM_HeapDumper::dump_stack_traces(AbstractDumpWriter* writer) {
@@ -2587,6 +2632,10 @@ void VM_HeapDumper::dump_vthread(oop vt, AbstractDumpWriter* segment_writer) {
   thread_dumper.init_serial_nums(&_thread_serial_num, &_frame_serial_num);
 
   // write HPROF_TRACE/HPROF_FRAME records to global writer
+  if (segment_writer == writer()) {
+    // Streaming: top-level records must not be written into an open dump segment.
+    segment_writer->finish_dump_segment();
+  }
   _dumper_controller->lock_global_writer();
   thread_dumper.dump_stack_traces(writer(), _klass_map);
   _dumper_controller->unlock_global_writer();
@@ -2598,7 +2647,7 @@ void VM_HeapDumper::dump_vthread(oop vt, AbstractDumpWriter* segment_writer) {
 }
 
 // dump the heap to given path.
-int HeapDumper::dump(const char* path, outputStream* out, int compression, bool overwrite, uint num_dump_threads) {
+int HeapDumper::dump(const char* path, outputStream* out, int compression, bool overwrite, uint num_dump_threads, bool lz4) {
   assert(path != nullptr && strlen(path) > 0, "path missing");
 
   // print message in interactive case
@@ -2623,7 +2672,14 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression, bool
 
   AbstractCompressor* compressor = nullptr;
 
-  if (compression > 0) {
+  if (lz4) {
+    compressor = new (std::nothrow) LZ4Compressor();
+
+    if (compressor == nullptr) {
+      set_error("Could not allocate lz4 compressor");
+      return -1;
+    }
+  } else if (compression > 0) {
     compressor = new (std::nothrow) GZipCompressor(compression);
 
     if (compressor == nullptr) {
@@ -2632,7 +2688,11 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression, bool
     }
   }
 
-  DumpWriter writer(path, overwrite, compressor);
+  // Only tcp:// and fd:// destinations use the stream writer, file dumps keep
+  // the file writer so that they can still be dumped in parallel and merged.
+  DumpWriter writer = StreamWriter::is_stream_destination(path) ?
+                      DumpWriter(new (std::nothrow) StreamWriter(path), compressor) :
+                      DumpWriter(path, overwrite, compressor);
 
   if (writer.error() != nullptr) {
     set_error(writer.error());
@@ -2658,7 +2718,8 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression, bool
   // Phase 2: Merge multiple heap files into one complete heap dump file.
   //          This is done by DumpMerger, which is performed outside safepoint
 
-  DumpMerger merger(path, &writer, dumper.dump_seq());
+  // A stream has no segment files to merge, only HPROF_HEAP_DUMP_END is written.
+  DumpMerger merger(path, &writer, writer.is_stream() ? 0 : dumper.dump_seq());
   // Perform heapdump file merge operation in the current thread prevents us
   // from occupying the VM Thread, which in turn affects the occurrence of
   // GC and other VM operations.
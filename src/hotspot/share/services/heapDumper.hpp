@@ -61,7 +61,11 @@ class HeapDumper : public StackObj {
   // additional info is written to out if not null.
   // compression >= 0 creates a gzipped file with the given compression level.
   // parallel_thread_num >= 0 indicates thread numbers of parallel object dump.
-  int dump(const char* path, outputStream* out = nullptr, int compression = -1, bool overwrite = false, uint parallel_thread_num = default_num_of_dump_threads());
+  // lz4 writes LZ4 frames instead of gzip, the compression level is then ignored.
+  // A path of the form tcp://<host>:<port> or fd://<n> streams the dump instead
+  // of writing a file; streamed dumps are written by a single thread.
+  int dump(const char* path, outputStream* out = nullptr, int compression = -1, bool overwrite = false,
+           uint parallel_thread_num = default_num_of_dump_threads(), bool lz4 = false);
 
   // returns error message (resource allocated), or null if no error
   char* error_as_C_string() const;
@@ -28,6 +28,15 @@
 #include "services/heapDumperCompression.hpp"
 #include "utilities/zipLibrary.hpp"
 
+#ifndef _WINDOWS
+#include <netdb.h>
+#include <sys/socket.h>
+#endif
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
 
 char const* FileWriter::open_writer() {
   assert(_fd < 0, "Must not already be open");
@@ -85,3 +94,274 @@ char const* GZipCompressor::compress(char* in, size_t in_size, char* out, size_t
 
   return msg;
 }
+
+static const char tcp_prefix[] = "tcp://";
+static const char fd_prefix[] = "fd://";
+
+bool StreamWriter::is_stream_destination(char const* destination) {
+  return strncmp(destination, tcp_prefix, sizeof(tcp_prefix) - 1) == 0 ||
+         strncmp(destination, fd_prefix, sizeof(fd_prefix) - 1) == 0;
+}
+
+char const* StreamWriter::open_writer() {
+  assert(_fd < 0, "Must not already be open");
+
+  if (strncmp(_destination, fd_prefix, sizeof(fd_prefix) - 1) == 0) {
+    char* end = nullptr;
+    const long fd = strtol(_destination + sizeof(fd_prefix) - 1, &end, 10);
+    if (end == nullptr || *end != '\0' || fd < 0 || fd > INT_MAX) {
+      return "Invalid file descriptor";
+    }
+    _fd = (int)fd;
+    _owns_fd = false;
+    return nullptr;
+  }
+
+  return open_socket(_destination + sizeof(tcp_prefix) - 1);
+}
+
+char const* StreamWriter::open_socket(char const* address) {
+#ifdef _WINDOWS
+  return "Streaming to a socket is not supported on this platform";
+#else
+  char host[256];
+  const char* colon = strrchr(address, ':');
+  if (colon == nullptr || colon == address || (size_t)(colon - address) >= sizeof(host) || colon[1] == '\0') {
+    return "Invalid address, expected tcp://<host>:<port>";
+  }
+  memcpy(host, address, colon - address);
+  host[colon - address] = '\0';
+
+  struct addrinfo hints;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  struct addrinfo* result = nullptr;
+  if (getaddrinfo(host, colon + 1, &hints, &result) != 0) {
+    return "Could not resolve host";
+  }
+
+  char const* msg = "Could not connect";
+  for (struct addrinfo* ai = result; ai != nullptr; ai = ai->ai_next) {
+    const int fd = ::socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+    if (fd < 0) {
+      continue;
+    }
+    if (os::connect(fd, ai->ai_addr, ai->ai_addrlen) == 0) {
+      _fd = fd;
+      _owns_fd = true;
+      msg = nullptr;
+      break;
+    }
+    msg = os::strerror(errno);
+    os::socket_close(fd);
+  }
+  freeaddrinfo(result);
+  return msg;
+#endif
+}
+
+StreamWriter::~StreamWriter() {
+  if (_fd >= 0 && _owns_fd) {
+    os::socket_close(_fd);
+  }
+  _fd = -1;
+}
+
+char const* StreamWriter::write_buf(char* buf, size_t size) {
+  assert(_fd >= 0, "Must be open");
+  assert(size > 0, "Must write at least one byte");
+
+  if (!_owns_fd) {
+    return os::write(_fd, buf, size) ? nullptr : os::strerror(errno);
+  }
+  while (size > 0) {
+    const ssize_t sent = os::send(_fd, buf, size, MSG_NOSIGNAL);
+    if (sent <= 0) {
+      return sent == 0 ? "Connection closed" : os::strerror(errno);
+    }
+    buf += sent;
+    size -= (size_t)sent;
+  }
+  return nullptr;
+}
+
+// LZ4 frame and block format, see https://github.com/lz4/lz4/tree/dev/doc.
+
+static const u4 lz4_frame_magic = 0x184D2204;
+static const size_t lz4_frame_header_size = 7;   // magic, FLG, BD, HC
+static const size_t lz4_block_header_size = 4;
+static const size_t lz4_end_mark_size = 4;
+static const u4 lz4_uncompressed_block = 0x80000000;
+
+static const size_t lz4_min_match = 4;
+static const size_t lz4_last_literals = 5;   // the last 5 bytes are always literals
+static const size_t lz4_match_limit = 12;    // the last match starts 12 bytes before the end
+static const size_t lz4_max_offset = 65535;
+static const int lz4_hash_log = 16;
+
+static inline void lz4_put_u4(u1* p, u4 v) {
+  p[0] = (u1)v;
+  p[1] = (u1)(v >> 8);
+  p[2] = (u1)(v >> 16);
+  p[3] = (u1)(v >> 24);
+}
+
+static inline u4 lz4_read_u4(const u1* p) {
+  u4 v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+static inline u4 lz4_hash(u4 sequence) {
+  return (sequence * 2654435761U) >> (32 - lz4_hash_log);
+}
+
+static inline u4 rotl32(u4 v, int r) {
+  return (v << r) | (v >> (32 - r));
+}
+
+// xxHash32 of a short (< 16 bytes) input, for the frame descriptor checksum.
+static u4 xxh32_short(const u1* p, size_t len) {
+  const u4 prime1 = 2654435761U;
+  const u4 prime2 = 2246822519U;
+  const u4 prime3 = 3266489917U;
+  const u4 prime4 = 668265263U;
+  const u4 prime5 = 374761393U;
+  assert(len < 16, "only short inputs");
+  u4 h = prime5 + (u4)len;
+  for (; len >= 4; p += 4, len -= 4) {
+    h = rotl32(h + (lz4_read_u4(p) * prime3), 17) * prime4;
+  }
+  for (; len > 0; p++, len--) {
+    h = rotl32(h + (*p * prime5), 11) * prime1;
+  }
+  h ^= h >> 15;
+  h *= prime2;
+  h ^= h >> 13;
+  h *= prime3;
+  h ^= h >> 16;
+  return h;
+}
+
+static u1* lz4_write_length(u1* op, size_t len) {
+  for (; len >= 255; len -= 255) {
+    *op++ = 255;
+  }
+  *op++ = (u1)len;
+  return op;
+}
+
+static u1* lz4_write_sequence(u1* op, const u1* literals, size_t literal_len, size_t offset, size_t match_len) {
+  u1* const token = op++;
+  const size_t match_code = match_len - lz4_min_match;
+  *token = (u1)((MIN2<size_t>(literal_len, 15) << 4) | MIN2<size_t>(match_code, 15));
+  if (literal_len >= 15) {
+    op = lz4_write_length(op, literal_len - 15);
+  }
+  memcpy(op, literals, literal_len);
+  op += literal_len;
+  *op++ = (u1)offset;
+  *op++ = (u1)(offset >> 8);
+  if (match_code >= 15) {
+    op = lz4_write_length(op, match_code - 15);
+  }
+  return op;
+}
+
+// Greedy single-pass LZ4 block compressor. Returns the compressed size.
+static size_t lz4_compress_block(const u1* src, size_t src_size, u1* dst, u4* table) {
+  const u1* const end = src + src_size;
+  const u1* anchor = src;
+  u1* op = dst;
+
+  if (src_size > lz4_match_limit) {
+    const u1* const mf_limit = end - lz4_match_limit;
+    const u1* const match_end = end - lz4_last_literals;
+    memset(table, 0, sizeof(u4) << lz4_hash_log);
+    const u1* ip = src + 1;
+    while (ip < mf_limit) {
+      const u4 sequence = lz4_read_u4(ip);
+      const u4 h = lz4_hash(sequence);
+      const u1* ref = src + table[h];
+      table[h] = (u4)(ip - src);
+      if (ref >= ip || (size_t)(ip - ref) > lz4_max_offset || lz4_read_u4(ref) != sequence) {
+        // Skip faster through incompressible data.
+        ip += 1 + ((ip - anchor) >> 6);
+        continue;
+      }
+      while (ip > anchor && ref > src && ip[-1] == ref[-1]) {
+        ip--;
+        ref--;
+      }
+      const u1* mp = ip + lz4_min_match;
+      const u1* rp = ref + lz4_min_match;
+      while (mp < match_end && *mp == *rp) {
+        mp++;
+        rp++;
+      }
+      op = lz4_write_sequence(op, anchor, ip - anchor, ip - ref, mp - ip);
+      ip = anchor = mp;
+    }
+  }
+
+  // Last literals.
+  const size_t literal_len = end - anchor;
+  *op++ = (u1)(MIN2<size_t>(literal_len, 15) << 4);
+  if (literal_len >= 15) {
+    op = lz4_write_length(op, literal_len - 15);
+  }
+  memcpy(op, anchor, literal_len);
+  op += literal_len;
+  return op - dst;
+}
+
+static size_t lz4_max_compressed_size(size_t size) {
+  return size + size / 255 + 16;
+}
+
+char const* LZ4Compressor::init(size_t block_size, size_t* needed_out_size,
+                                size_t* needed_tmp_size) {
+  // Block maximum size id: 4 = 64 KB, 5 = 256 KB, 6 = 1 MB, 7 = 4 MB.
+  _block_max_size_id = 4;
+  while (block_size > ((size_t)64 * K << (2 * (_block_max_size_id - 4)))) {
+    if (++_block_max_size_id > 7) {
+      return "Block size too large for LZ4";
+    }
+  }
+  *needed_out_size = lz4_frame_header_size + lz4_block_header_size +
+                     lz4_max_compressed_size(block_size) + lz4_end_mark_size;
+  *needed_tmp_size = sizeof(u4) << lz4_hash_log;
+  return nullptr;
+}
+
+char const* LZ4Compressor::compress(char* in, size_t in_size, char* out, size_t out_size,
+                                    char* tmp, size_t tmp_size, size_t* compressed_size) {
+  assert(_block_max_size_id != 0, "not initialized");
+  assert(out_size >= lz4_frame_header_size + lz4_block_header_size +
+                     lz4_max_compressed_size(in_size) + lz4_end_mark_size, "out buffer too small");
+  assert(tmp_size >= (sizeof(u4) << lz4_hash_log), "tmp buffer too small");
+
+  u1* op = (u1*)out;
+  lz4_put_u4(op, lz4_frame_magic);
+  op[4] = 0x60;                                // version 01, independent blocks
+  op[5] = (u1)(_block_max_size_id << 4);
+  op[6] = (u1)(xxh32_short(op + 4, 2) >> 8);
+  op += lz4_frame_header_size;
+
+  u1* const block = op + lz4_block_header_size;
+  size_t block_size = lz4_compress_block((const u1*)in, in_size, block, (u4*)tmp);
+  if (block_size >= in_size) {
+    memcpy(block, in, in_size);
+    block_size = in_size;
+    lz4_put_u4(op, (u4)block_size | lz4_uncompressed_block);
+  } else {
+    lz4_put_u4(op, (u4)block_size);
+  }
+  op = block + block_size;
+  lz4_put_u4(op, 0);
+  op += lz4_end_mark_size;
+
+  *compressed_size = (char*)op - out;
+  return nullptr;
+}
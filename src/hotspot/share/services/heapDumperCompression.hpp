@@ -84,6 +84,33 @@ class FileWriter : public AbstractWriter {
 };
 
 
+// A writer for a stream that cannot be seeked or reopened, given as either
+// "tcp://<host>:<port>" to connect to, or "fd://<n>" for an inherited file
+// descriptor. The dump is written in one pass without intermediate files.
+class StreamWriter : public AbstractWriter {
+private:
+  char const* _destination;
+  int _fd;
+  bool _owns_fd;
+
+  char const* open_socket(char const* address);
+
+public:
+  StreamWriter(char const* destination) : _destination(destination), _fd(-1), _owns_fd(false) { }
+
+  ~StreamWriter();
+
+  // Returns true if the dump destination names a stream rather than a file.
+  static bool is_stream_destination(char const* destination);
+
+  // Opens the writer. Returns null on success and a static error message otherwise.
+  virtual char const* open_writer();
+
+  // Does the write. Returns null on success and a static error message otherwise.
+  virtual char const* write_buf(char* buf, size_t size);
+};
+
+
 // A compressor using the gzip format.
 class GZipCompressor : public AbstractCompressor {
 private:
@@ -102,4 +129,22 @@ class GZipCompressor : public AbstractCompressor {
                                char* tmp, size_t tmp_size, size_t* compressed_size);
 };
 
+
+// A compressor using the LZ4 frame format. Each block is written as a
+// complete frame, so blocks compressed by parallel dumpers can be concatenated
+// in any order. Much faster than gzip, at a lower compression ratio.
+class LZ4Compressor : public AbstractCompressor {
+private:
+  u1 _block_max_size_id;
+
+public:
+  LZ4Compressor() : _block_max_size_id(0) { }
+
+  virtual char const* init(size_t block_size, size_t* needed_out_size,
+                           size_t* needed_tmp_size);
+
+  virtual char const* compress(char* in, size_t in_size, char* out, size_t out_size,
+                               char* tmp, size_t tmp_size, size_t* compressed_size);
+};
+
 #endif // SHARE_SERVICES_HEAPDUMPERCOMPRESSION_HPP
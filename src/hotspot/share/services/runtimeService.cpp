@@ -35,6 +35,7 @@ PerfCounter*  RuntimeService::_sync_time_ticks = nullptr;
 PerfCounter*  RuntimeService::_total_safepoints = nullptr;
 PerfCounter*  RuntimeService::_safepoint_time_ticks = nullptr;
 PerfCounter*  RuntimeService::_application_time_ticks = nullptr;
+PerfEventRing* RuntimeService::_events = nullptr;
 
 void RuntimeService::init() {
   if (UsePerfData) {
@@ -56,6 +57,16 @@ void RuntimeService::init() {
               PerfDataManager::create_counter(SUN_RT, "applicationTime",
                                               PerfData::U_Ticks, CHECK);
 
+    if (PerfEventRingRecords > 0) {
+      _events = PerfDataManager::create_event_ring(SUN_RT, "events",
+                                                   PerfEventRingRecords, CHECK);
+      if (_events->is_on_c_heap()) {
+        // Still recorded, but invisible to external tools.
+        warning("PerfEventRingRecords=%d does not fit into the PerfData memory, "
+                "sun.rt.events is not exported. Increase PerfDataMemorySize.",
+                PerfEventRingRecords);
+      }
+    }
 
     // create performance counters for jvm_version and its capabilities
     PerfDataManager::create_constant(SUN_RT, "jvmVersion", PerfData::U_None,
@@ -98,6 +109,12 @@ void RuntimeService::record_safepoint_end(jlong safepoint_ticks) {
   }
 }
 
+void RuntimeService::record_event(EventKind kind, jint id, jlong start_ns, jlong duration_ns) {
+  if (_events != nullptr) {
+    _events->record(kind, id, start_ns, duration_ns);
+  }
+}
+
 jlong RuntimeService::safepoint_sync_time_ms() {
   return UsePerfData ?
     Management::ticks_to_ms(_sync_time_ticks->get_value()) : -1;
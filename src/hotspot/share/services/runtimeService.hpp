@@ -34,8 +34,14 @@ class RuntimeService : public AllStatic {
   static PerfCounter* _total_safepoints;
   static PerfCounter* _safepoint_time_ticks;   // Accumulated time at safepoints
   static PerfCounter* _application_time_ticks; // Accumulated time not at safepoints
+  static PerfEventRing* _events;               // Recent safepoints and compilations
 
 public:
+  enum EventKind {
+    safepoint_event   = 1,  // id is the VM operation type
+    compilation_event = 2   // id is the compile id
+  };
+
   static void init();
 
   static jlong safepoint_sync_time_ms();
@@ -47,6 +53,7 @@ class RuntimeService : public AllStatic {
   static void record_safepoint_begin(jlong app_ticks) NOT_MANAGEMENT_RETURN;
   static void record_safepoint_synchronized(jlong sync_ticks) NOT_MANAGEMENT_RETURN;
   static void record_safepoint_end(jlong safepoint_ticks) NOT_MANAGEMENT_RETURN;
+  static void record_event(EventKind kind, jint id, jlong start_ns, jlong duration_ns) NOT_MANAGEMENT_RETURN;
 };
 
 #endif // SHARE_SERVICES_RUNTIMESERVICE_HPP
@@ -29,9 +29,11 @@
 #include "utilities/checkedCast.hpp"
 #include "utilities/elfFuncDescTable.hpp"
 #include "utilities/elfSymbolTable.hpp"
+#include "utilities/quickSort.hpp"
 
 ElfSymbolTable::ElfSymbolTable(FILE* const file, Elf_Shdr& shdr) :
-  _next(nullptr), _fd(file), _section(file, shdr) {
+  _next(nullptr), _fd(file), _section(file, shdr),
+  _index(nullptr), _index_length(0), _index_built(false) {
   assert(file != nullptr, "null file handle");
   _status = _section.status();
 
@@ -41,22 +43,68 @@ ElfSymbolTable::ElfSymbolTable(FILE* const file, Elf_Shdr& shdr) :
 }
 
 ElfSymbolTable::~ElfSymbolTable() {
+  if (_index != nullptr) {
+    os::free(_index);
+  }
   if (_next != nullptr) {
     delete _next;
   }
 }
 
+address ElfSymbolTable::symbol_address(const Elf_Sym* sym, ElfFuncDescTable* funcDescTable) const {
+  if (funcDescTable != nullptr && funcDescTable->get_index() == sym->st_shndx) {
+    // We need to go another step through the function descriptor table (currently PPC64 only)
+    return funcDescTable->lookup(sym->st_value);
+  }
+  return (address)sym->st_value;
+}
+
+int ElfSymbolTable::compare_index_entries(const IndexEntry& e1, const IndexEntry& e2) {
+  if (e1._addr != e2._addr) {
+    return e1._addr < e2._addr ? -1 : 1;
+  }
+  // keep symbols at the same address in section order
+  return e1._sym - e2._sym;
+}
+
+void ElfSymbolTable::build_index(const Elf_Sym* symbols, int count, ElfFuncDescTable* funcDescTable) {
+  _index_built = true;
+
+  int length = 0;
+  for (int index = 0; index < count; index++) {
+    if (STT_FUNC == ELF_ST_TYPE(symbols[index].st_info) && symbols[index].st_size > 0) {
+      length++;
+    }
+  }
+  if (length == 0) {
+    return;
+  }
+  // Not enough memory for the index is okay, lookup walks the section instead.
+  _index = (IndexEntry*)os::malloc(length * sizeof(IndexEntry), mtInternal);
+  if (_index == nullptr) {
+    return;
+  }
+  for (int index = 0; index < count; index++) {
+    if (STT_FUNC == ELF_ST_TYPE(symbols[index].st_info) && symbols[index].st_size > 0) {
+      _index[_index_length]._addr = symbol_address(&symbols[index], funcDescTable);
+      _index[_index_length]._sym = index;
+      _index_length++;
+    }
+  }
+  QuickSort::sort(_index, (size_t)_index_length, compare_index_entries);
+  address max_end = nullptr;
+  for (int i = 0; i < _index_length; i++) {
+    address end = _index[i]._addr + symbols[_index[i]._sym].st_size;
+    max_end = MAX2(max_end, end);
+    _index[i]._max_end = max_end;
+  }
+}
+
 bool ElfSymbolTable::compare(const Elf_Sym* sym, address addr, int* stringtableIndex, int* posIndex, int* offset, ElfFuncDescTable* funcDescTable) {
   if (STT_FUNC == ELF_ST_TYPE(sym->st_info)) {
     Elf64_Xword st_size = sym->st_size;
     const Elf_Shdr* shdr = _section.section_header();
-    address sym_addr;
-    if (funcDescTable != nullptr && funcDescTable->get_index() == sym->st_shndx) {
-      // We need to go another step through the function descriptor table (currently PPC64 only)
-      sym_addr = funcDescTable->lookup(sym->st_value);
-    } else {
-      sym_addr = (address)sym->st_value;
-    }
+    address sym_addr = symbol_address(sym, funcDescTable);
     if (sym_addr <= addr && (Elf_Word)(addr - sym_addr) < st_size) {
       *offset = (int)(addr - sym_addr);
       *posIndex = sym->st_name;
@@ -81,6 +129,34 @@ bool ElfSymbolTable::lookup(address addr, int* stringtableIndex, int* posIndex,
   Elf_Sym* symbols = (Elf_Sym*)_section.section_data();
 
   if (symbols != nullptr) {
+    if (!_index_built) {
+      build_index(symbols, count, funcDescTable);
+    }
+    if (_index != nullptr) {
+      // find the last symbol starting at or below addr
+      int lo = 0;
+      int hi = _index_length;
+      while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (_index[mid]._addr <= addr) {
+          lo = mid + 1;
+        } else {
+          hi = mid;
+        }
+      }
+      // Walk back over the symbols that may still enclose addr. As with the
+      // walk over the section, the first enclosing symbol in section order
+      // is the result.
+      int found = -1;
+      for (int i = lo - 1; i >= 0 && _index[i]._max_end > addr; i--) {
+        const IndexEntry& e = _index[i];
+        if ((size_t)(addr - e._addr) < symbols[e._sym].st_size && (found == -1 || e._sym < found)) {
+          found = e._sym;
+        }
+      }
+      return found != -1 &&
+             compare(&symbols[found], addr, stringtableIndex, posIndex, offset, funcDescTable);
+    }
     for (int index = 0; index < count; index ++) {
       if (compare(&symbols[index], addr, stringtableIndex, posIndex, offset, funcDescTable)) {
         return true;
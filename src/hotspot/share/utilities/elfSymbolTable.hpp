@@ -37,6 +37,12 @@
  * Whenever possible, it will load all symbols from the corresponding section
  * of the elf file into memory. Otherwise, it will walk the section in file
  * to look up the symbol that nearest the given address.
+ *
+ * When the symbols are in memory, an index of the function symbols sorted by
+ * address is built on the first lookup, so that later lookups are a binary
+ * search instead of a walk over the whole section. Symbols may overlap or
+ * nest, so every entry also records the highest end address of the entries
+ * up to it, which bounds the entries that may still contain an address.
  */
 class ElfSymbolTable: public CHeapObj<mtInternal> {
   friend class ElfFile;
@@ -50,6 +56,17 @@ class ElfSymbolTable: public CHeapObj<mtInternal> {
   ElfSection      _section;
 
   NullDecoder::decoder_status _status;
+
+  // function symbols of the in-memory section sorted by address
+  struct IndexEntry {
+    address _addr;
+    address _max_end; // highest end address of this and all preceding entries
+    int     _sym;     // index into the section data
+  };
+  IndexEntry* _index;
+  int         _index_length;
+  bool        _index_built;
+
 public:
   ElfSymbolTable(FILE* const file, Elf_Shdr& shdr);
   ~ElfSymbolTable();
@@ -63,6 +80,10 @@ class ElfSymbolTable: public CHeapObj<mtInternal> {
   void set_next(ElfSymbolTable* next) { _next = next; }
 
   bool compare(const Elf_Sym* sym, address addr, int* stringtableIndex, int* posIndex, int* offset, ElfFuncDescTable* funcDescTable);
+
+  address symbol_address(const Elf_Sym* sym, ElfFuncDescTable* funcDescTable) const;
+  void build_index(const Elf_Sym* symbols, int count, ElfFuncDescTable* funcDescTable);
+  static int compare_index_entries(const IndexEntry& e1, const IndexEntry& e2);
 };
 
 #endif // !_WINDOWS and !__APPLE__
@@ -34,6 +34,11 @@ void* GrowableArrayResourceAllocator::allocate(int max, int elementSize) {
   return (void*)resource_allocate_bytes(byte_size);
 }
 
+bool GrowableArrayResourceAllocator::extend_in_place(void* mem, int old_max, int new_max, int element_size) {
+  assert(old_max >= 0 && new_max >= old_max, "integer overflow");
+  return Thread::current()->resource_area()->Aextend(mem, element_size * (size_t) old_max, element_size * (size_t) new_max);
+}
+
 void* GrowableArrayArenaAllocator::allocate(int max, int element_size, Arena* arena) {
   assert(max >= 0, "integer overflow");
   size_t byte_size = element_size * (size_t) max;
@@ -41,6 +46,11 @@ void* GrowableArrayArenaAllocator::allocate(int max, int element_size, Arena* ar
   return arena->Amalloc(byte_size);
 }
 
+bool GrowableArrayArenaAllocator::extend_in_place(void* mem, int old_max, int new_max, int element_size, Arena* arena) {
+  assert(old_max >= 0 && new_max >= old_max, "integer overflow");
+  return arena->Aextend(mem, element_size * (size_t) old_max, element_size * (size_t) new_max);
+}
+
 void* GrowableArrayCHeapAllocator::allocate(int max, int element_size, MemTag mem_tag) {
   assert(max >= 0, "integer overflow");
 
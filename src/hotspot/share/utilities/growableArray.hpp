@@ -523,6 +523,12 @@ void GrowableArrayWithAllocator<E, Derived>::expand_to(int new_capacity) {
   assert(new_capacity > old_capacity,
          "expected growth but %d <= %d", new_capacity, old_capacity);
   this->_capacity = new_capacity;
+  // Arena backed arrays whose data is the latest allocation can grow in place,
+  // rather than leaving the old data array behind as garbage in the arena.
+  if (this->_data != nullptr && static_cast<Derived*>(this)->extend_in_place(old_capacity)) {
+    for (int i = old_capacity; i < this->_capacity; i++) ::new ((void*)&this->_data[i]) E();
+    return;
+  }
   E* newData = static_cast<Derived*>(this)->allocate();
   int i = 0;
   for (     ; i < this->_len; i++) ::new ((void*)&newData[i]) E(this->_data[i]);
@@ -584,12 +590,14 @@ void GrowableArrayWithAllocator<E, Derived>::clear_and_deallocate() {
 class GrowableArrayResourceAllocator {
 public:
   static void* allocate(int max, int element_size);
+  static bool extend_in_place(void* mem, int old_max, int new_max, int element_size);
 };
 
 // Arena allocator
 class GrowableArrayArenaAllocator {
 public:
   static void* allocate(int max, int element_size, Arena* arena);
+  static bool extend_in_place(void* mem, int old_max, int new_max, int element_size, Arena* arena);
 };
 
 // CHeap allocator
@@ -747,6 +755,22 @@ class GrowableArray : public GrowableArrayWithAllocator<E, GrowableArray<E>> {
     return allocate(this->_capacity, _metadata.arena());
   }
 
+  // Try to grow the data array from old_capacity to _capacity without moving it.
+  bool extend_in_place(int old_capacity) {
+    if (on_resource_area()) {
+      DEBUG_ONLY(_metadata.on_resource_area_alloc_check());
+      return GrowableArrayResourceAllocator::extend_in_place(this->_data, old_capacity, this->_capacity, sizeof(E));
+    }
+
+    if (on_C_heap()) {
+      return false;
+    }
+
+    assert(on_arena(), "Sanity");
+    DEBUG_ONLY(_metadata.on_arena_alloc_check());
+    return GrowableArrayArenaAllocator::extend_in_place(this->_data, old_capacity, this->_capacity, sizeof(E), _metadata.arena());
+  }
+
   void deallocate(E* mem) {
     if (on_C_heap()) {
       GrowableArrayCHeapAllocator::deallocate(mem);
@@ -820,6 +844,10 @@ class GrowableArrayCHeap : public GrowableArrayWithAllocator<E, GrowableArrayCHe
     return allocate(this->_capacity, MT);
   }
 
+  bool extend_in_place(int old_capacity) {
+    return false;
+  }
+
   void deallocate(E* mem) {
     GrowableArrayCHeapAllocator::deallocate(mem);
   }
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "utilities/latencyHistogram.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/powerOfTwo.hpp"
+
+static double to_micros(jlong nanos) {
+  return (double)nanos / (NANOUNITS / MICROUNITS);
+}
+
+int LatencyHistogram::bucket_index(jlong value) {
+  assert(value >= 0 && value <= MaxValue, "out of range: " JLONG_FORMAT, value);
+  if (value < 2 * SubBucketCount) {
+    return (int)value;
+  }
+  // The top SubBucketBits + 1 bits select the bucket within the magnitude.
+  int shift = log2i((uint64_t)value) - SubBucketBits;
+  return shift * SubBucketCount + (int)(value >> shift);
+}
+
+jlong LatencyHistogram::bucket_lower_bound(int index) {
+  assert(index >= 0 && index < BucketCount, "out of range: %d", index);
+  if (index < 2 * SubBucketCount) {
+    return index;
+  }
+  int shift = index / SubBucketCount - 1;
+  return (jlong)(index % SubBucketCount + SubBucketCount) << shift;
+}
+
+jlong LatencyHistogram::bucket_upper_bound(int index) {
+  return index == BucketCount - 1 ? MaxValue : bucket_lower_bound(index + 1) - 1;
+}
+
+void LatencyHistogram::reset() {
+  memset(_counts, 0, sizeof(_counts));
+  _count = 0;
+  _sum = 0;
+  _max = 0;
+}
+
+void LatencyHistogram::record(jlong value) {
+  value = clamp(value, (jlong)0, MaxValue);
+  _counts[bucket_index(value)]++;
+  _count++;
+  _sum += value;
+  _max = MAX2(_max, value);
+}
+
+jlong LatencyHistogram::value_at_percentile(double percentile) const {
+  if (_count == 0) {
+    return 0;
+  }
+  uint64_t target = (uint64_t)ceil(percentile / 100.0 * (double)_count);
+  target = clamp(target, (uint64_t)1, _count);
+  uint64_t seen = 0;
+  for (int i = 0; i < BucketCount; i++) {
+    seen += _counts[i];
+    if (seen >= target) {
+      return MIN2(bucket_upper_bound(i), _max);
+    }
+  }
+  return _max;
+}
+
+void LatencyHistogram::print_on(outputStream* st, const char* name) const {
+  static const double percentiles[] = { 50.0, 75.0, 90.0, 95.0, 99.0, 99.9, 99.99, 100.0 };
+
+  st->print_cr("%s: " UINT64_FORMAT " samples, mean %.3f us, max %.3f us",
+               name, _count, mean() / (NANOUNITS / MICROUNITS), to_micros(_max));
+  if (_count == 0) {
+    return;
+  }
+  st->print_cr("  %14s  %10s", "Value (us)", "Percentile");
+  for (double p : percentiles) {
+    st->print_cr("  %14.3f  %10.4f", to_micros(value_at_percentile(p)), p / 100.0);
+  }
+}
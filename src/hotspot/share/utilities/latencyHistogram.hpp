@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_UTILITIES_LATENCYHISTOGRAM_HPP
+#define SHARE_UTILITIES_LATENCYHISTOGRAM_HPP
+
+#include "utilities/globalDefinitions.hpp"
+
+class outputStream;
+
+// A log-linear histogram of nanosecond latencies. Each power of two is
+// split into SubBucketCount linear buckets, so a recorded value is known
+// to within 1/SubBucketCount of its magnitude. Values above MaxValue are
+// counted in the last bucket.
+//
+// The histogram is not thread safe. Readers that may race with updates
+// must hold the lock that guards the updates, or copy the histogram
+// under it.
+class LatencyHistogram {
+  static const int   SubBucketBits  = 4;
+  static const int   SubBucketCount = 1 << SubBucketBits;
+  static const int   MaxValueBits   = 40;
+  static const int   BucketCount    = (MaxValueBits - SubBucketBits + 1) * SubBucketCount;
+  static const jlong MaxValue       = (CONST64(1) << MaxValueBits) - 1;
+
+  uint64_t _counts[BucketCount];
+  uint64_t _count;
+  jlong    _sum;
+  jlong    _max;
+
+  static int   bucket_index(jlong value);
+  static jlong bucket_lower_bound(int index);
+  static jlong bucket_upper_bound(int index);
+
+public:
+  LatencyHistogram() { reset(); }
+
+  void reset();
+  void record(jlong value);
+
+  uint64_t count() const { return _count; }
+  jlong max() const      { return _max; }
+  double mean() const    { return _count == 0 ? 0.0 : (double)_sum / (double)_count; }
+
+  // Upper bound of the bucket holding the given percentile (0-100),
+  // never more than the largest recorded value.
+  jlong value_at_percentile(double percentile) const;
+
+  void print_on(outputStream* st, const char* name) const;
+};
+
+#endif // SHARE_UTILITIES_LATENCYHISTOGRAM_HPP
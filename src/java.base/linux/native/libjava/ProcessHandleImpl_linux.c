@@ -145,7 +145,10 @@ jint os_getChildren(JNIEnv *env, jlong jpid, jlongArray jarray,
             jlong totalTime = 0L;
             jlong startTime = 0L;
 
-            /* skip files that aren't numbers */
+            /* skip files that aren't numbers, without touching them */
+            if (!isdigit((unsigned char) ptr->d_name[0])) {
+                continue;
+            }
             pid_t childpid = (pid_t) atoi(ptr->d_name);
             if ((int) childpid <= 0) {
                 continue;
@@ -195,9 +198,9 @@ jint os_getChildren(JNIEnv *env, jlong jpid, jlongArray jarray,
  */
 pid_t os_getParentPidAndTimings(JNIEnv *env, pid_t pid,
                                 jlong *totalTime, jlong* startTime) {
-    FILE* fp;
+    int fd;
     char buffer[2048];
-    int statlen;
+    ssize_t statlen;
     char fn[32];
     char* s;
     int parentPid;
@@ -210,8 +213,13 @@ pid_t os_getParentPidAndTimings(JNIEnv *env, pid_t pid,
      */
     snprintf(fn, sizeof fn, "/proc/%d/stat", pid);
 
-    fp = fopen(fn, "r");
-    if (fp == NULL) {
+    /*
+     * This is called for every process when enumerating children, so use
+     * plain open/read/close rather than stdio, which would allocate and
+     * free a FILE buffer per pid. The kernel generates the whole stat
+     * line on the first read.
+     */
+    if ((fd = open(fn, O_RDONLY)) < 0) {
         return -1;              // fail, no such /proc/pid/stat
     }
 
@@ -220,8 +228,8 @@ pid_t os_getParentPidAndTimings(JNIEnv *env, pid_t pid,
      * As the command could be anything we must find the right most
      * ")" and then skip the white spaces that follow it.
      */
-    statlen = fread(buffer, 1, (sizeof buffer - 1), fp);
-    fclose(fp);
+    statlen = read(fd, buffer, sizeof buffer - 1);
+    close(fd);
     if (statlen < 0) {
         return -1;               // parent pid is not available
     }
@@ -568,6 +568,20 @@ void ImageFileReader::get_resource(ImageLocation& location, u1* uncompressed_dat
     }
 }
 
+// Return the mapped address of the resource for the supplied location offset.
+const u1* ImageFileReader::get_resource_address(u4 offset) const {
+        if (!memory_map_image) {
+                return NULL;
+        }
+        // Expand location attributes.
+        ImageLocation location(get_location_offset_data(offset));
+        // Compressed resources have to be inflated into a buffer.
+        if (location.get_attribute(ImageLocation::ATTRIBUTE_COMPRESSED) != 0) {
+                return NULL;
+        }
+        return get_data_address() + location.get_attribute(ImageLocation::ATTRIBUTE_OFFSET);
+}
+
 // Return the ImageModuleData for this image
 ImageModuleData * ImageFileReader::get_image_module_data() {
     return _module_data;
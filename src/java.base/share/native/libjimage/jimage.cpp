@@ -171,6 +171,23 @@ JIMAGE_GetResource(JImageFile* image, JImageLocationRef location,
     return size;
 }
 
+/*
+ * JImageGetResourceAddress - Given an open image file (see JImageOpen) and a
+ * resource's location information (see JImageFindResource), return the address
+ * of the resource's bytes in the memory mapped image, or NULL if the resource
+ * is compressed or the image is not memory mapped.
+ *
+ * Ex.
+ *  jlong size;
+ *  JImageLocationRef location = (*JImageFindResource)(image,
+ *                               "java.base", "9.0", "java/lang/String.class", &size);
+ *  const char* bytes = (*JImageGetResourceAddress)(image, location);
+ */
+extern "C" JNIEXPORT const char*
+JIMAGE_GetResourceAddress(JImageFile* image, JImageLocationRef location) {
+    return (const char*) ((ImageFileReader*) image)->get_resource_address((u4) location);
+}
+
 /*
  * JImageResourceIterator - Given an open image file (see JImageOpen), a visitor
  * function and a visitor argument, iterator through each of the image's resources.
@@ -32,6 +32,10 @@
 #include <unistd.h>
 #include <limits.h>
 
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
 #include "childproc.h"
 #include "jni_util.h"
 
@@ -73,6 +77,16 @@ closeDescriptors(void)
     struct dirent *dirp;
     int from_fd = FAIL_FILENO + 1;
 
+#if defined(__linux__) && defined(SYS_close_range)
+    /* On kernels with close_range(2) (Linux 5.9+) a single system call
+     * closes the whole range, without having to list /proc/self/fd.
+     * Call it through syscall(2) so that we do not depend on the glibc
+     * version providing a wrapper.  Older kernels fail with ENOSYS and
+     * we fall back to the directory scan below. */
+    if (syscall(SYS_close_range, from_fd, ~0U, 0) == 0)
+        return 1;
+#endif
+
     /* We're trying to close all file descriptors, but opendir() might
      * itself be implemented using a file descriptor, and we certainly
      * don't want to close that while it's in use.  We assume that if
@@ -159,8 +159,140 @@ DEFINE_XOR_BLIT(IntArgb, IntArgbPre, AnyInt)
 
 DEFINE_SRC_MASKFILL(IntArgbPre, 4ByteArgb)
 
+#if defined(__SSE2__) || defined(_M_X64)
+
+#include <string.h>
+#include <emmintrin.h>
+
+/*
+ * SrcOver MaskFill into IntArgbPre is the loop that antialiased rendering
+ * into a premultiplied BufferedImage spends its time in. Because the
+ * destination is premultiplied, the work that DEFINE_SRCOVER_MASKFILL does
+ * for each pixel collapses to
+ *
+ *     resA = MUL8(pathA, srcA)
+ *     res  = MUL8(pathA, src) + MUL8(0xff - resA, dst)
+ *
+ * for all four components. Because MUL8(0xff, x) == x and MUL8(0, x) == 0,
+ * the same formula also covers pathA == 0xff and pathA == 0. This lets four
+ * pixels be composited at a time in 16-bit lanes.
+ */
+
+/* Exactly mul8table[a][b] for a, b in [0, 255]. */
+static inline __m128i IntArgbPreVecMul8(__m128i a, __m128i b)
+{
+    __m128i p = _mm_mullo_epi16(a, b);
+    __m128i t = _mm_srli_epi16(_mm_add_epi16(p, _mm_srli_epi16(p, 8)), 8);
+    return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(p, _mm_set1_epi16(128)),
+                                        t), 8);
+}
+
+/* Composites two pixels unpacked to 16 bits, m holding pathA per pixel. */
+static inline __m128i IntArgbPreVecSrcOver(__m128i m, __m128i src, __m128i dst)
+{
+    __m128i res = IntArgbPreVecMul8(m, src);
+    __m128i resA = _mm_shufflehi_epi16(_mm_shufflelo_epi16(res, 0xff), 0xff);
+    __m128i dstF = _mm_sub_epi16(_mm_set1_epi16(0xff), resA);
+    return _mm_add_epi16(res, IntArgbPreVecMul8(dstF, dst));
+}
+
+/* Composites four pixels, pathA for pixel i being in 16-bit lane i of m. */
+static inline void IntArgbPreSrcOverFill4(jint *pRas, __m128i m, __m128i src)
+{
+    __m128i zero = _mm_setzero_si128();
+    __m128i dst = _mm_loadu_si128((__m128i *) pRas);
+    __m128i m2 = _mm_unpacklo_epi16(m, m);
+    __m128i resLo = IntArgbPreVecSrcOver(_mm_unpacklo_epi32(m2, m2), src,
+                                         _mm_unpacklo_epi8(dst, zero));
+    __m128i resHi = IntArgbPreVecSrcOver(_mm_unpackhi_epi32(m2, m2), src,
+                                         _mm_unpackhi_epi8(dst, zero));
+    _mm_storeu_si128((__m128i *) pRas, _mm_packus_epi16(resLo, resHi));
+}
+
+static inline void IntArgbPreSrcOverFill1(jint *pRas, jint pathA,
+                                          jint srcA, jint srcR,
+                                          jint srcG, jint srcB)
+{
+    juint pixel = (juint) *pRas;
+    jint resA = MUL8(pathA, srcA);
+    jint dstF = 0xff - resA;
+    jint resR = MUL8(pathA, srcR) + MUL8(dstF, (pixel >> 16) & 0xff);
+    jint resG = MUL8(pathA, srcG) + MUL8(dstF, (pixel >>  8) & 0xff);
+    jint resB = MUL8(pathA, srcB) + MUL8(dstF, (pixel      ) & 0xff);
+    resA += MUL8(dstF, pixel >> 24);
+    *pRas = (resA << 24) | (resR << 16) | (resG << 8) | resB;
+}
+
+void NAME_SRCOVER_MASKFILL(IntArgbPre)
+    (void *rasBase,
+     jubyte *pMask, jint maskOff, jint maskScan,
+     jint width, jint height,
+     jint fgColor,
+     SurfaceDataRasInfo *pRasInfo,
+     NativePrimitive *pPrim,
+     CompositeInfo *pCompInfo)
+{
+    jint srcA, srcR, srcG, srcB;
+    jint rasScan = pRasInfo->scanStride;
+    jint *pRas = (jint *) rasBase;
+    __m128i srcVec;
+
+    Extract4ByteArgbCompsAndAlphaFromArgb(fgColor, src);
+    if (srcA != 0xff) {
+        if (srcA == 0) {
+            return;
+        }
+        srcR = MUL8(srcA, srcR);
+        srcG = MUL8(srcA, srcG);
+        srcB = MUL8(srcA, srcB);
+    }
+    srcVec = _mm_setr_epi16((short) srcB, (short) srcG, (short) srcR, (short) srcA,
+                            (short) srcB, (short) srcG, (short) srcR, (short) srcA);
+
+    if (pMask) {
+        pMask += maskOff;
+        do {
+            jint x = 0;
+            for (; x + 4 <= width; x += 4) {
+                jint path4;
+                memcpy(&path4, pMask + x, sizeof(path4));
+                if (path4 != 0) {
+                    __m128i m = _mm_unpacklo_epi8(_mm_cvtsi32_si128(path4),
+                                                  _mm_setzero_si128());
+                    IntArgbPreSrcOverFill4(pRas + x, m, srcVec);
+                }
+            }
+            for (; x < width; x++) {
+                jint pathA = pMask[x];
+                if (pathA > 0) {
+                    IntArgbPreSrcOverFill1(pRas + x, pathA,
+                                           srcA, srcR, srcG, srcB);
+                }
+            }
+            pRas = PtrAddBytes(pRas, rasScan);
+            pMask = PtrAddBytes(pMask, maskScan);
+        } while (--height > 0);
+    } else /* pMask == 0 */ {
+        __m128i m = _mm_set1_epi16(0xff);
+        do {
+            jint x = 0;
+            for (; x + 4 <= width; x += 4) {
+                IntArgbPreSrcOverFill4(pRas + x, m, srcVec);
+            }
+            for (; x < width; x++) {
+                IntArgbPreSrcOverFill1(pRas + x, 0xff, srcA, srcR, srcG, srcB);
+            }
+            pRas = PtrAddBytes(pRas, rasScan);
+        } while (--height > 0);
+    }
+}
+
+#else /* !(__SSE2__ || _M_X64) */
+
 DEFINE_SRCOVER_MASKFILL(IntArgbPre, 4ByteArgb)
 
+#endif /* __SSE2__ || _M_X64 */
+
 DEFINE_ALPHA_MASKFILL(IntArgbPre, 4ByteArgb)
 
 DEFINE_SRCOVER_MASKBLIT(IntArgb, IntArgbPre, 4ByteArgb)
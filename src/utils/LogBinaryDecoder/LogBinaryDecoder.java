@@ -0,0 +1,397 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+import java.io.BufferedWriter;
+import java.io.IOException;
+import java.io.OutputStreamWriter;
+import java.io.PrintWriter;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.Arrays;
+import java.util.HashMap;
+import java.util.Locale;
+import java.util.Map;
+
+/**
+ * Converts the files written by the HotSpot binary unified logging output
+ * (-Xlog:...:binfile=name) to text, decorated with uptime, level and tags:
+ *
+ *   java LogBinaryDecoder.java name [name.0 ...]
+ *
+ * The file format is described in src/hotspot/share/logging/logBinaryFileOutput.cpp.
+ * Messages are formatted the way the C library would have, with two exceptions:
+ * %a uses the Java representation, and %p always prints as 0x followed by the
+ * hexadecimal address.
+ */
+public class LogBinaryDecoder {
+    private static final byte[] MAGIC = "HSULBIN\0".getBytes(StandardCharsets.US_ASCII);
+    private static final int FORMAT_VERSION = 1;
+    private static final int BYTE_ORDER_MARKER = 0x01020304;
+    private static final int HEADER_SIZE = 28;
+
+    private static final int DEFINE_STRING = 1;
+    private static final int MESSAGE = 2;
+    private static final int TEXT = 3;
+
+    private static final int NULL_STRING_SIZE = 0xffffffff;
+
+    private static final String[] LEVELS = { "off", "trace", "debug", "info", "warning", "error" };
+
+    private final PrintWriter out;
+    private final Map<Integer, String> strings = new HashMap<>();
+    private int longSize;
+    private double frequency;
+
+    LogBinaryDecoder(PrintWriter out) {
+        this.out = out;
+    }
+
+    public static void main(String[] args) throws IOException {
+        if (args.length == 0) {
+            System.err.println("Usage: java LogBinaryDecoder.java <file> [<file> ...]");
+            System.exit(1);
+        }
+        PrintWriter out = new PrintWriter(new BufferedWriter(new OutputStreamWriter(System.out, StandardCharsets.UTF_8)));
+        for (String file : args) {
+            new LogBinaryDecoder(out).decode(Path.of(file));
+        }
+        out.flush();
+    }
+
+    void decode(Path file) throws IOException {
+        ByteBuffer buf = ByteBuffer.wrap(Files.readAllBytes(file));
+        readHeader(file, buf);
+        while (buf.remaining() >= 5) {
+            int kind = Byte.toUnsignedInt(buf.get());
+            int size = buf.getInt();
+            if (size < 0 || size > buf.remaining()) {
+                // The VM was probably still writing the file.
+                System.err.println(file + ": truncated record at offset " + (buf.position() - 5));
+                return;
+            }
+            ByteBuffer payload = buf.slice(buf.position(), size).order(buf.order());
+            buf.position(buf.position() + size);
+            switch (kind) {
+                case DEFINE_STRING -> {
+                    int id = payload.getInt();
+                    strings.put(id, utf8(payload, payload.remaining()));
+                }
+                case MESSAGE -> {
+                    int level = Byte.toUnsignedInt(payload.get());
+                    int tags = payload.getInt();
+                    long ticks = payload.getLong();
+                    String format = string(payload.getInt());
+                    String prefix = utf8(payload, payload.getInt());
+                    String message;
+                    try {
+                        message = prefix + new CFormat(payload, longSize).format(format);
+                    } catch (RuntimeException e) {
+                        message = prefix + format + " <undecodable arguments: " + e + ">";
+                    }
+                    print(level, tags, ticks, message);
+                }
+                case TEXT -> {
+                    int level = Byte.toUnsignedInt(payload.get());
+                    int tags = payload.getInt();
+                    long ticks = payload.getLong();
+                    print(level, tags, ticks, utf8(payload, payload.remaining()));
+                }
+                default -> {
+                    // Unknown record kinds from later versions are skipped.
+                }
+            }
+        }
+    }
+
+    private void readHeader(Path file, ByteBuffer buf) throws IOException {
+        if (buf.remaining() < HEADER_SIZE) {
+            throw new IOException(file + ": not a binary log file");
+        }
+        byte[] magic = new byte[MAGIC.length];
+        buf.get(magic);
+        if (!Arrays.equals(magic, MAGIC)) {
+            throw new IOException(file + ": not a binary log file");
+        }
+        buf.order(ByteOrder.LITTLE_ENDIAN);
+        if (buf.getInt(12) != BYTE_ORDER_MARKER) {
+            buf.order(ByteOrder.BIG_ENDIAN);
+        }
+        int version = buf.getInt();
+        if (version != FORMAT_VERSION) {
+            throw new IOException(file + ": unsupported version " + version);
+        }
+        buf.getInt(); // byte order marker
+        longSize = buf.get();
+        buf.get();    // pointer size
+        buf.getShort();
+        frequency = buf.getLong();
+    }
+
+    private void print(int level, int tags, long ticks, String message) {
+        String levelName = level < LEVELS.length ? LEVELS[level] : Integer.toString(level);
+        out.printf(Locale.ROOT, "[%.3fs][%s][%s] %s%n", ticks / frequency, levelName, string(tags), message);
+    }
+
+    private String string(int id) {
+        String s = strings.get(id);
+        return s != null ? s : "<undefined string " + id + ">";
+    }
+
+    private static String utf8(ByteBuffer buf, int size) {
+        byte[] bytes = new byte[size];
+        buf.get(bytes);
+        return new String(bytes, StandardCharsets.UTF_8);
+    }
+
+    /**
+     * Formats a printf format string with the arguments as stored by the VM.
+     */
+    static class CFormat {
+        private final ByteBuffer args;
+        private final int longSize;
+
+        // The parts of the conversion specification being formatted.
+        private boolean leftAlign;
+        private boolean plus;
+        private boolean space;
+        private boolean alternate;
+        private boolean zeroPad;
+        private int width;
+        private int precision;
+        private String length;
+
+        CFormat(ByteBuffer args, int longSize) {
+            this.args = args;
+            this.longSize = longSize;
+        }
+
+        String format(String fmt) {
+            StringBuilder sb = new StringBuilder();
+            int i = 0;
+            while (i < fmt.length()) {
+                char c = fmt.charAt(i++);
+                if (c != '%') {
+                    sb.append(c);
+                    continue;
+                }
+                if (i < fmt.length() && fmt.charAt(i) == '%') {
+                    sb.append('%');
+                    i++;
+                    continue;
+                }
+
+                leftAlign = plus = space = alternate = zeroPad = false;
+                width = 0;
+                precision = -1;
+                for (; i < fmt.length(); i++) {
+                    c = fmt.charAt(i);
+                    if (c == '-') leftAlign = true;
+                    else if (c == '+') plus = true;
+                    else if (c == ' ') space = true;
+                    else if (c == '#') alternate = true;
+                    else if (c == '0') zeroPad = true;
+                    else if (c != '\'') break;
+                }
+                if (i < fmt.length() && fmt.charAt(i) == '*') {
+                    width = (int) args.getLong();
+                    if (width < 0) {
+                        leftAlign = true;
+                        width = -width;
+                    }
+                    i++;
+                } else {
+                    int start = i;
+                    while (i < fmt.length() && Character.isDigit(fmt.charAt(i))) i++;
+                    width = start == i ? 0 : Integer.parseInt(fmt.substring(start, i));
+                }
+                if (i < fmt.length() && fmt.charAt(i) == '.') {
+                    i++;
+                    if (i < fmt.length() && fmt.charAt(i) == '*') {
+                        precision = (int) args.getLong();
+                        i++;
+                    } else {
+                        int start = i;
+                        while (i < fmt.length() && Character.isDigit(fmt.charAt(i))) i++;
+                        precision = start == i ? 0 : Integer.parseInt(fmt.substring(start, i));
+                    }
+                }
+                int start = i;
+                while (i < fmt.length() && "hlzjtL".indexOf(fmt.charAt(i)) >= 0) i++;
+                length = fmt.substring(start, i);
+                if (i == fmt.length()) {
+                    throw new IllegalArgumentException("incomplete conversion in " + fmt);
+                }
+                sb.append(convert(fmt.charAt(i++)));
+            }
+            return sb.toString();
+        }
+
+        private String convert(char conversion) {
+            switch (conversion) {
+                case 'd', 'i' -> {
+                    long value = args.getLong();
+                    return integer(signedValue(value) < 0, Long.toUnsignedString(Math.abs(signedValue(value))), "");
+                }
+                case 'u' -> {
+                    return integer(false, Long.toUnsignedString(unsignedValue(args.getLong())), "");
+                }
+                case 'o' -> {
+                    String digits = Long.toOctalString(unsignedValue(args.getLong()));
+                    return integer(false, digits, alternate && !digits.startsWith("0") ? "0" : "");
+                }
+                case 'x', 'X' -> {
+                    long value = unsignedValue(args.getLong());
+                    String digits = Long.toHexString(value);
+                    String result = integer(false, digits, alternate && value != 0 ? "0x" : "");
+                    return conversion == 'X' ? result.toUpperCase(Locale.ROOT) : result;
+                }
+                case 'c' -> {
+                    return pad(String.valueOf((char) (args.getLong() & 0xff)));
+                }
+                case 's' -> {
+                    int size = args.getInt();
+                    String s = size == NULL_STRING_SIZE ? "(null)" : utf8(args, size);
+                    if (precision >= 0 && precision < s.length()) {
+                        s = s.substring(0, precision);
+                    }
+                    return pad(s);
+                }
+                case 'p' -> {
+                    return pad("0x" + Long.toHexString(args.getLong()));
+                }
+                case 'e', 'E', 'f', 'F', 'g', 'G', 'a', 'A' -> {
+                    double value = Double.longBitsToDouble(args.getLong());
+                    String result = floating(Character.toLowerCase(conversion), value);
+                    return Character.isUpperCase(conversion) ? result.toUpperCase(Locale.ROOT) : result;
+                }
+                default -> throw new IllegalArgumentException("unsupported conversion %" + conversion);
+            }
+        }
+
+        // Integers are stored widened to 64 bits; narrow them to the size given by the length modifier.
+        private long signedValue(long value) {
+            return switch (length) {
+                case "hh" -> (byte) value;
+                case "h" -> (short) value;
+                case "" -> (int) value;
+                case "l" -> longSize == 4 ? (int) value : value;
+                default -> value;
+            };
+        }
+
+        private long unsignedValue(long value) {
+            return switch (length) {
+                case "hh" -> value & 0xffL;
+                case "h" -> value & 0xffffL;
+                case "" -> value & 0xffffffffL;
+                case "l" -> longSize == 4 ? value & 0xffffffffL : value;
+                default -> value;
+            };
+        }
+
+        private String integer(boolean negative, String digits, String prefix) {
+            if (precision >= 0) {
+                if (precision == 0 && digits.equals("0")) {
+                    digits = "";
+                }
+                digits = "0".repeat(Math.max(0, precision - digits.length())) + digits;
+            }
+            String sign = negative ? "-" : plus ? "+" : space ? " " : "";
+            return padNumber(sign + prefix, digits, precision < 0);
+        }
+
+        private String floating(char conversion, double value) {
+            if (Double.isNaN(value) || Double.isInfinite(value)) {
+                String s = Double.isNaN(value) ? "nan" : "inf";
+                String sign = (value < 0) ? "-" : plus ? "+" : space ? " " : "";
+                return padNumber(sign, s, false);
+            }
+            boolean negative = value < 0 || (value == 0 && 1 / value < 0);
+            double abs = Math.abs(value);
+            int p = precision < 0 ? 6 : precision;
+            String digits;
+            switch (conversion) {
+                case 'f' -> digits = fixed(abs, p);
+                case 'e' -> digits = exponential(abs, p);
+                case 'g' -> {
+                    if (p == 0) p = 1;
+                    // The exponent the value has when converted with %e and precision p - 1.
+                    String e = String.format(Locale.ROOT, "%." + (p - 1) + "e", abs);
+                    int exponent = Integer.parseInt(e.substring(e.indexOf('e') + 1));
+                    digits = (exponent < -4 || exponent >= p) ? exponential(abs, p - 1) : fixed(abs, p - 1 - exponent);
+                    if (!alternate && digits.indexOf('.') >= 0) {
+                        int exp = digits.indexOf('e');
+                        String mantissa = exp >= 0 ? digits.substring(0, exp) : digits;
+                        String rest = exp >= 0 ? digits.substring(exp) : "";
+                        mantissa = mantissa.replaceAll("0+$", "").replaceAll("\\.$", "");
+                        digits = mantissa + rest;
+                    }
+                }
+                default -> digits = String.format(Locale.ROOT, precision < 0 ? "%a" : "%." + p + "a", abs);
+            }
+            String sign = negative ? "-" : plus ? "+" : space ? " " : "";
+            return padNumber(sign, digits, true);
+        }
+
+        private String fixed(double abs, int p) {
+            String s = String.format(Locale.ROOT, "%." + p + "f", abs);
+            return (alternate && p == 0) ? s + "." : s;
+        }
+
+        private String exponential(double abs, int p) {
+            String s = String.format(Locale.ROOT, "%." + p + "e", abs);
+            if (alternate && p == 0) {
+                int e = s.indexOf('e');
+                s = s.substring(0, e) + "." + s.substring(e);
+            }
+            return s;
+        }
+
+        // Pads to the width, with zeros between the sign/prefix and the digits if requested.
+        private String padNumber(String prefix, String digits, boolean zeroPadAllowed) {
+            int padding = width - prefix.length() - digits.length();
+            if (padding <= 0) {
+                return prefix + digits;
+            }
+            if (leftAlign) {
+                return prefix + digits + " ".repeat(padding);
+            }
+            if (zeroPad && zeroPadAllowed) {
+                return prefix + "0".repeat(padding) + digits;
+            }
+            return " ".repeat(padding) + prefix + digits;
+        }
+
+        private String pad(String s) {
+            int padding = width - s.length();
+            if (padding <= 0) {
+                return s;
+            }
+            return leftAlign ? s + " ".repeat(padding) : " ".repeat(padding) + s;
+        }
+    }
+}
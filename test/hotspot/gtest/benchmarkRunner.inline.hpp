@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef GTEST_BENCHMARK_RUNNER_INLINE_HPP
+#define GTEST_BENCHMARK_RUNNER_INLINE_HPP
+
+#include "memory/allocation.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/os.hpp"
+#include "runtime/semaphore.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/quickSort.hpp"
+#include "threadHelper.inline.hpp"
+
+// This file contains helper classes to microbenchmark VM internals from gtest.
+//
+// Benchmarks are ordinary tests in the Benchmark category. They are disabled
+// by default so they do not slow down regular test runs. Run them with:
+//
+//   --gtest_also_run_disabled_tests --gtest_filter='Benchmark.*'
+//
+// Results are printed to tty. They are meant for comparing builds on the
+// same machine, nothing is asserted about them.
+
+// Upper bound for the number of threads in a scaling run, so that benchmarks
+// can keep per-worker state in fixed size arrays.
+const uint BenchmarkMaxWorkers = 16;
+
+// Base class for a benchmark. Override run_batch() to perform a fixed number
+// of operations. worker_id identifies the calling thread in a scaling run,
+// it is 0 for single-threaded runs.
+class BenchmarkRunnable {
+public:
+  virtual void run_batch(uint worker_id) = 0;
+};
+
+// Times a benchmark on the current thread. After warm_up batches, each
+// of the measured batches is timed separately, and the time per operation
+// is reported as min, percentiles and max.
+class BenchmarkRunner {
+  const char* const _name;
+  BenchmarkRunnable* const _runnable;
+  const size_t _ops_per_batch;
+  const int _warm_up_batches;
+  const int _measured_batches;
+
+  static int compare(jlong a, jlong b) {
+    return a < b ? -1 : (a > b ? 1 : 0);
+  }
+
+  double ns_per_op(const jlong* times, double percentile) const {
+    int index = (int)(percentile * (_measured_batches - 1) / 100.0);
+    return (double)times[index] / (double)_ops_per_batch;
+  }
+
+public:
+  BenchmarkRunner(const char* name, BenchmarkRunnable* runnable, size_t ops_per_batch,
+                  int warm_up_batches = 100, int measured_batches = 1000) :
+    _name(name),
+    _runnable(runnable),
+    _ops_per_batch(ops_per_batch),
+    _warm_up_batches(warm_up_batches),
+    _measured_batches(measured_batches) {}
+
+  void run() {
+    for (int i = 0; i < _warm_up_batches; i++) {
+      _runnable->run_batch(0);
+    }
+
+    jlong* times = NEW_C_HEAP_ARRAY(jlong, _measured_batches, mtTest);
+    for (int i = 0; i < _measured_batches; i++) {
+      jlong start = os::javaTimeNanos();
+      _runnable->run_batch(0);
+      times[i] = os::javaTimeNanos() - start;
+    }
+    QuickSort::sort(times, _measured_batches, compare);
+
+    tty->print_cr("%s: ns/op min %.2f p50 %.2f p90 %.2f p99 %.2f max %.2f (%d batches of %zu ops)",
+                  _name,
+                  ns_per_op(times, 0), ns_per_op(times, 50), ns_per_op(times, 90),
+                  ns_per_op(times, 99), ns_per_op(times, 100),
+                  _measured_batches, _ops_per_batch);
+    FREE_C_HEAP_ARRAY(jlong, times);
+  }
+};
+
+// Runs a benchmark concurrently in 1, 2, 4, ... up to max_threads threads,
+// each for a fixed duration, and reports the aggregate throughput. Shows
+// how an operation scales under contention.
+class BenchmarkScalingRunner {
+  class BenchmarkThread : public JavaTestThread {
+    BenchmarkRunnable* const _runnable;
+    const uint _worker_id;
+    const jlong _duration_millis;
+    volatile size_t* const _total_batches;
+
+  public:
+    BenchmarkThread(BenchmarkRunnable* runnable, uint worker_id, jlong duration_millis,
+                    volatile size_t* total_batches, Semaphore* done) :
+      JavaTestThread(done),
+      _runnable(runnable),
+      _worker_id(worker_id),
+      _duration_millis(duration_millis),
+      _total_batches(total_batches) {}
+
+    void main_run() {
+      size_t batches = 0;
+      jlong stop_time = os::javaTimeMillis() + _duration_millis;
+      while (os::javaTimeMillis() < stop_time) {
+        _runnable->run_batch(_worker_id);
+        batches++;
+      }
+      Atomic::add(_total_batches, batches);
+    }
+  };
+
+  const char* const _name;
+  BenchmarkRunnable* const _runnable;
+  const size_t _ops_per_batch;
+  const uint _max_threads;
+  const jlong _duration_millis;
+
+  void run(uint nthreads) {
+    Semaphore done(0);
+    volatile size_t total_batches = 0;
+
+    BenchmarkThread** t = NEW_C_HEAP_ARRAY(BenchmarkThread*, nthreads, mtTest);
+    for (uint i = 0; i < nthreads; i++) {
+      t[i] = new BenchmarkThread(_runnable, i, _duration_millis, &total_batches, &done);
+    }
+    jlong start = os::javaTimeNanos();
+    for (uint i = 0; i < nthreads; i++) {
+      t[i]->doit();
+    }
+    for (uint i = 0; i < nthreads; i++) {
+      done.wait();
+    }
+    jlong elapsed = os::javaTimeNanos() - start;
+    FREE_C_HEAP_ARRAY(BenchmarkThread*, t);
+
+    double ops = (double)Atomic::load(&total_batches) * (double)_ops_per_batch;
+    tty->print_cr("%s: %u threads: %.3f Mops/s", _name, nthreads, ops * 1000.0 / (double)elapsed);
+  }
+
+public:
+  // max_threads - upper bound, also capped by the number of processors
+  // duration_millis - how long each thread runs at each thread count
+  BenchmarkScalingRunner(const char* name, BenchmarkRunnable* runnable, size_t ops_per_batch,
+                         uint max_threads, jlong duration_millis = 1000) :
+    _name(name),
+    _runnable(runnable),
+    _ops_per_batch(ops_per_batch),
+    _max_threads(MIN3(max_threads, BenchmarkMaxWorkers, (uint)os::processor_count())),
+    _duration_millis(duration_millis) {}
+
+  void run() {
+    for (uint n = 1; n <= _max_threads; n *= 2) {
+      run(n);
+    }
+  }
+};
+
+#endif // GTEST_BENCHMARK_RUNNER_INLINE_HPP
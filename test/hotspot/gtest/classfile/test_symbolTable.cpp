@@ -193,3 +193,28 @@ TEST_VM(SymbolTable, test_cleanup_delay_drain) {
     ASSERT_EQ(symbols[i]->refcount(), 1) << "TempNewSymbol refcount after drain is 1";
   }
 }
+
+TEST_VM(SymbolTable, test_repeated_lookup) {
+  JavaThread* THREAD = JavaThread::current();
+  ThreadInVMfromNative invm(THREAD);
+
+  // Repeated lookups of a permanent symbol find the same symbol
+  Symbol* perm = SymbolTable::new_permanent_symbol("test-repeated-lookup-perm");
+  ASSERT_TRUE(perm->is_permanent());
+  for (int i = 0; i < 3; i++) {
+    ASSERT_EQ(SymbolTable::probe("test-repeated-lookup-perm", 25), perm);
+  }
+  ASSERT_TRUE(perm->is_permanent());
+
+  // A symbol which is not permanent is still refcounted on every lookup
+  TempNewSymbol temp = stable_temp_symbol(SymbolTable::new_symbol("test-repeated-lookup-temp"));
+  int count = temp->refcount();
+  for (int i = 1; i <= 3; i++) {
+    Symbol* found = SymbolTable::probe("test-repeated-lookup-temp", 25);
+    ASSERT_EQ(found, (Symbol*)temp);
+    ASSERT_EQ(found->refcount(), count + i) << "lookup must increment the refcount";
+  }
+  for (int i = 0; i < 3; i++) {
+    temp->decrement_refcount();
+  }
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "classfile/symbolTable.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/os.hpp"
+#include "benchmarkRunner.inline.hpp"
+#include "unittest.hpp"
+
+// Microbenchmark for SymbolTable lookups of existing symbols, see
+// benchmarkRunner.inline.hpp.
+
+static const int symbol_count = 4096;
+static const size_t symbol_lookups_per_batch = 1024;
+
+class SymbolTableLookupBenchmark : public BenchmarkRunnable {
+  Symbol** const _symbols;
+
+public:
+  SymbolTableLookupBenchmark(Symbol** symbols) : _symbols(symbols) {}
+
+  void run_batch(uint worker_id) {
+    uint seed = (uint)os::random();
+    for (size_t i = 0; i < symbol_lookups_per_batch; i++) {
+      seed = seed * 1103515245 + 12345;
+      const Symbol* sym = _symbols[seed % symbol_count];
+      Symbol* found = SymbolTable::probe((const char*)sym->bytes(), sym->utf8_length());
+      guarantee(found == sym, "symbol must be present");
+    }
+  }
+};
+
+TEST_VM(Benchmark, DISABLED_symbolTable_lookup) {
+  Symbol** symbols = NEW_C_HEAP_ARRAY(Symbol*, symbol_count, mtTest);
+  {
+    JavaThread* THREAD = JavaThread::current();
+    // the thread should be in vm to use locks
+    ThreadInVMfromNative invm(THREAD);
+    for (int i = 0; i < symbol_count; i++) {
+      char name[64];
+      os::snprintf_checked(name, sizeof(name), "BenchmarkSymbol_%d", i);
+      symbols[i] = SymbolTable::new_symbol(name);
+    }
+  }
+
+  SymbolTableLookupBenchmark benchmark(symbols);
+  BenchmarkRunner("SymbolTable probe", &benchmark, symbol_lookups_per_batch).run();
+  BenchmarkScalingRunner("SymbolTable probe", &benchmark, symbol_lookups_per_batch, BenchmarkMaxWorkers).run();
+
+  for (int i = 0; i < symbol_count; i++) {
+    symbols[i]->decrement_refcount();
+  }
+  FREE_C_HEAP_ARRAY(Symbol*, symbols);
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "gc/shared/oopStorage.inline.hpp"
+#include "benchmarkRunner.inline.hpp"
+#include "unittest.hpp"
+
+// Microbenchmark for OopStorage allocate and release, see
+// benchmarkRunner.inline.hpp.
+
+static const size_t oopstorage_entries_per_batch = 256;
+
+class OopStorageAllocateReleaseBenchmark : public BenchmarkRunnable {
+  OopStorage* const _storage;
+
+public:
+  OopStorageAllocateReleaseBenchmark(OopStorage* storage) : _storage(storage) {}
+
+  void run_batch(uint worker_id) {
+    oop* entries[oopstorage_entries_per_batch];
+    for (size_t i = 0; i < oopstorage_entries_per_batch; i++) {
+      entries[i] = _storage->allocate();
+      guarantee(entries[i] != nullptr, "allocation failed");
+    }
+    _storage->release(entries, oopstorage_entries_per_batch);
+  }
+};
+
+TEST_VM(Benchmark, DISABLED_oopStorage_allocate_release) {
+  OopStorage* storage = OopStorage::create("Benchmark Storage", mtGC);
+  OopStorageAllocateReleaseBenchmark benchmark(storage);
+  BenchmarkRunner("OopStorage allocate+release", &benchmark, oopstorage_entries_per_batch).run();
+  BenchmarkScalingRunner("OopStorage allocate+release", &benchmark, oopstorage_entries_per_batch, BenchmarkMaxWorkers).run();
+  delete storage;
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "gc/shared/taskqueue.inline.hpp"
+#include "benchmarkRunner.inline.hpp"
+#include "unittest.hpp"
+
+// Microbenchmarks for GenericTaskQueue, see benchmarkRunner.inline.hpp.
+// Every worker owns the queue with its worker id. The queue set always has
+// BenchmarkMaxWorkers queues, so with fewer threads some steal attempts hit
+// empty queues, as they do for idle GC workers.
+
+typedef GenericTaskQueue<size_t, mtTest> BenchmarkTaskQueue;
+typedef GenericTaskQueueSet<BenchmarkTaskQueue, mtTest> BenchmarkTaskQueueSet;
+
+static const size_t taskqueue_tasks_per_batch = 256;
+
+class TaskQueueBenchmark : public BenchmarkRunnable {
+protected:
+  BenchmarkTaskQueueSet _queues;
+
+  void fill(BenchmarkTaskQueue* q) {
+    for (size_t i = 0; i < taskqueue_tasks_per_batch; i++) {
+      q->push(i);
+    }
+  }
+
+  void drain(BenchmarkTaskQueue* q) {
+    size_t task;
+    while (q->pop_local(task)) {}
+  }
+
+public:
+  TaskQueueBenchmark() : _queues(BenchmarkMaxWorkers) {
+    for (uint i = 0; i < BenchmarkMaxWorkers; i++) {
+      _queues.register_queue(i, new BenchmarkTaskQueue());
+    }
+  }
+
+  ~TaskQueueBenchmark() {
+    for (uint i = 0; i < BenchmarkMaxWorkers; i++) {
+      delete _queues.queue(i);
+    }
+  }
+};
+
+// The owner pushes a batch of tasks and pops them again.
+class TaskQueuePushPopBenchmark : public TaskQueueBenchmark {
+public:
+  void run_batch(uint worker_id) {
+    BenchmarkTaskQueue* q = _queues.queue(worker_id);
+    fill(q);
+    drain(q);
+  }
+};
+
+// The owner pushes a batch of tasks, then tries to steal half as many
+// from the other queues before popping what is left in its own queue.
+class TaskQueueStealBenchmark : public TaskQueueBenchmark {
+public:
+  void run_batch(uint worker_id) {
+    BenchmarkTaskQueue* q = _queues.queue(worker_id);
+    fill(q);
+    size_t task;
+    for (size_t i = 0; i < taskqueue_tasks_per_batch / 2; i++) {
+      _queues.steal(worker_id, task);
+    }
+    drain(q);
+  }
+};
+
+TEST_VM(Benchmark, DISABLED_taskQueue_push_pop) {
+  TaskQueuePushPopBenchmark benchmark;
+  BenchmarkRunner("GenericTaskQueue push+pop_local", &benchmark, taskqueue_tasks_per_batch).run();
+  BenchmarkScalingRunner("GenericTaskQueue push+pop_local", &benchmark, taskqueue_tasks_per_batch, BenchmarkMaxWorkers).run();
+}
+
+TEST_VM(Benchmark, DISABLED_taskQueue_steal) {
+  TaskQueueStealBenchmark benchmark;
+  BenchmarkScalingRunner("GenericTaskQueue steal", &benchmark, taskqueue_tasks_per_batch, BenchmarkMaxWorkers).run();
+}
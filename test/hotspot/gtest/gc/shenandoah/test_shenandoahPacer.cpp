@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "gc/shenandoah/shenandoahPacer.hpp"
+#include "unittest.hpp"
+
+class ShenandoahPacerTest {
+  ShenandoahPacer _pacer;
+
+ public:
+  ShenandoahPacerTest() : _pacer(nullptr) {}
+
+  // Every phase takes the given seconds, allocating at the given rate.
+  void record_history(double phase_time, double words_per_second) {
+    for (int p = ShenandoahPacer::_mark; p <= ShenandoahPacer::_update_refs; p++) {
+      _pacer._phase_times[p]->add(phase_time);
+    }
+    _pacer._alloc_rate->add(words_per_second);
+  }
+
+  double evac_factor(size_t taxable_bytes) const {
+    return _pacer.adaptive_tax_factor(ShenandoahPacer::_evac, taxable_bytes);
+  }
+
+  double mark_factor(size_t taxable_bytes) const {
+    return _pacer.adaptive_tax_factor(ShenandoahPacer::_mark, taxable_bytes);
+  }
+};
+
+TEST_VM(ShenandoahPacer, adaptive_tax_factor_without_history) {
+  ShenandoahPacerTest test;
+  EXPECT_DOUBLE_EQ(1.0, test.evac_factor(M));
+}
+
+TEST_VM(ShenandoahPacer, adaptive_tax_factor) {
+  ShenandoahPacerTest test;
+  // One second per phase at 1000 words per second: evacuation and update
+  // refs are expected to allocate 2 * 1000 words until the end of the cycle.
+  test.record_history(1.0, 1000.0);
+  const double expected_bytes = 2 * 1000.0 * HeapWordSize;
+
+  EXPECT_DOUBLE_EQ(0.5, test.evac_factor((size_t)(2 * expected_bytes)));
+  EXPECT_DOUBLE_EQ(0.25, test.evac_factor((size_t)(4 * expected_bytes)));
+  // Never scaled below a tenth, nor up
+  EXPECT_DOUBLE_EQ(0.1, test.evac_factor((size_t)(100 * expected_bytes)));
+  EXPECT_DOUBLE_EQ(1.0, test.evac_factor((size_t)(expected_bytes / 2)));
+  // Mark still has three phases to go
+  EXPECT_DOUBLE_EQ(0.75, test.mark_factor((size_t)(2 * expected_bytes)));
+}
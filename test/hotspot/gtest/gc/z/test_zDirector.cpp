@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "gc/z/zDirector.hpp"
+#include "gc/z/zGlobals.hpp"
+#include "unittest.hpp"
+
+static const double threshold = 10.0;
+static const size_t min_capacity = 64 * M;
+static const size_t max_capacity = 1000 * M;
+
+static size_t adjust(double pressure, size_t limit, size_t used) {
+  return ZDirector::adjusted_soft_max_capacity_limit(pressure, threshold, limit, max_capacity,
+                                                     min_capacity, used, max_capacity);
+}
+
+TEST(ZDirector, soft_max_capacity_limit_lowered_under_pressure) {
+  // Lowered by 10%
+  ASSERT_EQ(adjust(threshold, max_capacity, 100 * M), 900 * M);
+  // But not below the memory in use, rounded up to granules
+  ASSERT_EQ(adjust(threshold, max_capacity, 949 * M), 950 * M);
+  // Nor below the min capacity
+  ASSERT_EQ(adjust(50.0, 70 * M, 0), min_capacity);
+}
+
+TEST(ZDirector, soft_max_capacity_limit_not_raised_under_pressure) {
+  // More memory in use than the limit allows
+  ASSERT_EQ(adjust(threshold, 500 * M, 800 * M), 500 * M);
+  // A limit below the min capacity is kept
+  ASSERT_EQ(adjust(threshold, min_capacity - ZGranuleSize, 0), min_capacity - ZGranuleSize);
+}
+
+TEST(ZDirector, soft_max_capacity_limit_restored_without_pressure) {
+  // Unchanged between half the threshold and the threshold
+  ASSERT_EQ(adjust(threshold / 2, 500 * M, 100 * M), 500 * M);
+  // Raised by 10% of the max capacity below half the threshold
+  ASSERT_EQ(adjust(0.0, 500 * M, 100 * M), 600 * M);
+  ASSERT_EQ(adjust(0.0, 950 * M, 100 * M), max_capacity);
+  ASSERT_EQ(adjust(0.0, max_capacity, 100 * M), max_capacity);
+}
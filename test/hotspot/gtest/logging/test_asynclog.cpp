@@ -244,6 +244,40 @@ TEST_VM_F(AsyncLogTest, logBuffer) {
   EXPECT_TRUE(file_contains_substrings_in_order(TestLogFileName, strs));
 }
 
+TEST_VM_F(AsyncLogTest, closedBuffer) {
+  const auto Default = LogDecorations(LogLevel::Warning, LogTagSetMapping<LogTag::__NO_TAG>::tagset(),
+                                      LogDecorators());
+  LogFileStreamOutput* output = LogConfiguration::StdoutLog;
+  auto buffer = new AsyncLogWriter::Buffer(1024);
+
+  EXPECT_EQ(AsyncLogWriter::Buffer::PushResult::Success,
+            buffer->try_push_back(output, Default, "before close", strlen("before close")));
+  buffer->close();
+  EXPECT_EQ(AsyncLogWriter::Buffer::PushResult::Closed,
+            buffer->try_push_back(output, Default, "after close", strlen("after close")));
+
+  // Messages reserved before closing are still visible.
+  auto it = buffer->iterator();
+  EXPECT_TRUE(it.hasNext());
+  EXPECT_STREQ("before close", it.next()->message());
+  EXPECT_FALSE(it.hasNext());
+
+  // Reset keeps the buffer closed until it is opened again.
+  buffer->reset();
+  EXPECT_FALSE(buffer->iterator().hasNext());
+  EXPECT_EQ(AsyncLogWriter::Buffer::PushResult::Closed,
+            buffer->try_push_back(output, Default, "after reset", strlen("after reset")));
+  buffer->open();
+  EXPECT_EQ(AsyncLogWriter::Buffer::PushResult::Success,
+            buffer->try_push_back(output, Default, "after open", strlen("after open")));
+  auto it2 = buffer->iterator();
+  EXPECT_TRUE(it2.hasNext());
+  EXPECT_STREQ("after open", it2.next()->message());
+  EXPECT_FALSE(it2.hasNext());
+
+  delete buffer;
+}
+
 TEST_VM_F(AsyncLogTest, droppingMessage) {
   if (AsyncLogWriter::instance() == nullptr) return;
   if (LogConfiguration::async_mode() != LogConfiguration::AsyncMode::Drop) {
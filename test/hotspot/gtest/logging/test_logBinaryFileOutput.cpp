@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "jvm.h"
+#include "logTestUtils.inline.hpp"
+#include "logging/logBinaryFileOutput.hpp"
+#include "logging/logDecorations.hpp"
+#include "logging/logTagSet.hpp"
+#include "memory/resourceArea.hpp"
+#include "runtime/os.hpp"
+#include "unittest.hpp"
+#include "utilities/ostream.hpp"
+
+static const char* name = prepend_prefix_temp_dir("binfile=", "testlog.bin");
+
+ATTRIBUTE_PRINTF(2, 3)
+static void write_unformatted(LogBinaryFileOutput& output, const char* fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  output.write(LogLevel::Info, LogTagSetMapping<LogTag::_logging>::tagset(), "", fmt, args);
+  va_end(args);
+}
+
+// Returns the number of occurrences of str in the file.
+static int count_in_file(const char* file_name, const char* str) {
+  FILE* fp = os::fopen(file_name, "rb");
+  EXPECT_NE(nullptr, fp);
+  if (fp == nullptr) {
+    return -1;
+  }
+  char buf[4096];
+  size_t size = fread(buf, 1, sizeof(buf), fp);
+  fclose(fp);
+
+  int count = 0;
+  const size_t len = strlen(str);
+  for (size_t i = 0; i + len <= size; i++) {
+    if (memcmp(buf + i, str, len) == 0) {
+      count++;
+    }
+  }
+  return count;
+}
+
+TEST_VM(LogBinaryFileOutput, records) {
+  ResourceMark rm;
+  stringStream ss;
+  LogFileOutput::set_file_name_parameters(0);
+  char* file_name;
+  {
+    LogBinaryFileOutput output(name);
+    ASSERT_TRUE(output.initialize("", &ss)) << ss.as_string();
+    file_name = os::strdup(output.cur_log_file_name());
+
+    // Encoded messages store the format string once and the arguments separately.
+    write_unformatted(output, "binary record %d %s", 4711, "first");
+    write_unformatted(output, "binary record %d %s", 4712, "second");
+    // long double can't be encoded, so the message is formatted.
+    write_unformatted(output, "formatted record %.1Lf %d", (long double)1.5, 4713);
+
+    // Already formatted text is written as is.
+    LogDecorations decorations(LogLevel::Info, LogTagSetMapping<LogTag::_logging>::tagset(), LogDecorators());
+    output.write(decorations, "text record");
+  }
+
+  EXPECT_EQ(1, count_in_file(file_name, "HSULBIN"));
+  EXPECT_EQ(1, count_in_file(file_name, "binary record %d %s"));
+  EXPECT_EQ(0, count_in_file(file_name, "4711"));
+  EXPECT_EQ(1, count_in_file(file_name, "first"));
+  EXPECT_EQ(1, count_in_file(file_name, "second"));
+  EXPECT_EQ(1, count_in_file(file_name, "formatted record 1.5 4713"));
+  EXPECT_EQ(1, count_in_file(file_name, "text record"));
+  // The tagset label is only defined once.
+  EXPECT_EQ(1, count_in_file(file_name, "logging"));
+
+  remove(file_name);
+  os::free(file_name);
+}
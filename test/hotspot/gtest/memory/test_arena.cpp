@@ -213,6 +213,35 @@ TEST_VM(Arena, realloc_nontop_grow) {
   ASSERT_RANGE_IS_MARKED(p2, 10); // realloc should preserve old content
 }
 
+// in-place extension of the top allocation.
+TEST_VM(Arena, extend_top) {
+  Arena ar(mtTest);
+
+  void* p1 = ar.Amalloc(0x10);
+  ASSERT_AMALLOC(ar, p1);
+  GtestUtils::mark_range(p1, 0x10);
+
+  ASSERT_TRUE(ar.Aextend(p1, 0x10, 0x20));
+  ASSERT_RANGE_IS_MARKED(p1, 0x10); // extending should preserve old content
+
+  void* p2 = ar.Amalloc(0x10);
+  ASSERT_EQ((char*)p1 + 0x20, (char*)p2); // extended range is in use
+}
+
+// extension is refused if the allocation is not the top one.
+TEST_VM(Arena, extend_nontop) {
+  Arena ar(mtTest);
+
+  void* p1 = ar.Amalloc(0x10);
+  ASSERT_AMALLOC(ar, p1);
+  void* p_other = ar.Amalloc(0x10); // new top, p1 not top anymore
+  ASSERT_AMALLOC(ar, p_other);
+
+  ASSERT_FALSE(ar.Aextend(p1, 0x10, 0x20));
+  void* p2 = ar.Amalloc(0x10);
+  ASSERT_EQ((char*)p_other + 0x10, (char*)p2); // arena untouched
+}
+
 // -------- random alloc test -------------
 
 static uint8_t canary(int i) {
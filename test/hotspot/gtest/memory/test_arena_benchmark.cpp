@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "memory/arena.hpp"
+#include "benchmarkRunner.inline.hpp"
+#include "unittest.hpp"
+
+// Microbenchmark for Arena allocation, see benchmarkRunner.inline.hpp.
+// Each batch creates an arena and fills it with small allocations, so it
+// includes growing into new chunks and returning them to the ChunkPool.
+
+static const size_t arena_allocations_per_batch = 1024;
+static const size_t arena_allocation_size = 32;
+
+class ArenaAllocateBenchmark : public BenchmarkRunnable {
+public:
+  void run_batch(uint worker_id) {
+    Arena arena(mtTest);
+    for (size_t i = 0; i < arena_allocations_per_batch; i++) {
+      void* p = arena.Amalloc(arena_allocation_size);
+      guarantee(p != nullptr, "allocation failed");
+    }
+  }
+};
+
+TEST_VM(Benchmark, DISABLED_arena_allocate) {
+  ArenaAllocateBenchmark benchmark;
+  BenchmarkRunner("Arena Amalloc", &benchmark, arena_allocations_per_batch).run();
+  BenchmarkScalingRunner("Arena Amalloc", &benchmark, arena_allocations_per_batch, BenchmarkMaxWorkers).run();
+}
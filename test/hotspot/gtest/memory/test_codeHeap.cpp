@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "memory/heap.hpp"
+#include "memory/memoryReserver.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "unittest.hpp"
+
+class CodeHeapTest : public ::testing::Test {
+ protected:
+  static const size_t heap_size = 1 * M;
+  static const size_t segment_size = 128;
+
+  ReservedSpace _rs;
+  CodeHeap* _heap;
+
+  void SetUp() override {
+    _rs = MemoryReserver::reserve(heap_size, mtCode);
+    ASSERT_TRUE(_rs.is_reserved());
+    _heap = new CodeHeap("Test code heap", CodeBlobType::All);
+    MutexLocker ml(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+    ASSERT_TRUE(_heap->reserve(_rs, heap_size, segment_size));
+  }
+
+  void TearDown() override {
+    // The segment map of the heap is not released.
+    delete _heap;
+    MemoryReserver::release(_rs);
+  }
+};
+
+// Blocks [0], [2] and [4] are freed, so that the freelist holds three holes
+// of the same size in address order. First fit must hand out the low end of
+// the lowest hole, best fit the high end of a hole.
+TEST_VM_F(CodeHeapTest, first_fit_takes_lowest_address) {
+  MutexLocker ml(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+  const size_t block_size = 4 * K;
+  void* blocks[6];
+  for (int i = 0; i < 6; i++) {
+    blocks[i] = _heap->allocate(block_size);
+    ASSERT_NE(blocks[i], (void*)nullptr);
+    if (i > 0) {
+      ASSERT_LT(blocks[i - 1], blocks[i]);
+    }
+  }
+  _heap->deallocate(blocks[0]);
+  _heap->deallocate(blocks[2]);
+  _heap->deallocate(blocks[4]);
+
+  const size_t small_size = 512;
+  void* first = _heap->allocate(small_size, true /* first_fit */);
+  EXPECT_EQ(blocks[0], first) << "first fit must start at the lowest free address";
+
+  void* second = _heap->allocate(small_size, true /* first_fit */);
+  EXPECT_LT(first, second);
+  EXPECT_LT(second, blocks[1]) << "the remainder of the lowest hole must be used next";
+
+  void* best = _heap->allocate(small_size);
+  EXPECT_GT(best, blocks[2]) << "best fit hands out the high end of a hole";
+  EXPECT_LT(best, blocks[3]);
+
+  // A first fit allocation that fits no hole comes from the top.
+  void* large = _heap->allocate(2 * block_size, true /* first_fit */);
+  EXPECT_GT(large, blocks[5]);
+}
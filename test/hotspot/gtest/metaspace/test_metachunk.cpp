@@ -427,3 +427,39 @@ TEST_VM(metaspace, chunk_enlarge_in_place) {
 
 }
 
+
+static const MetaWord* root_chunk_area_base(const Metachunk* c) {
+  return align_down(c->base(), MAX_CHUNK_BYTE_SIZE);
+}
+
+TEST_VM(metaspace, get_chunk_transient) {
+
+  ChunkGtestContext context;
+  ChunkManager& cm = context.cm();
+
+  // Transient chunks are never carved from the same root chunk as standard ones...
+  Metachunk* c1 = cm.get_chunk(CHUNK_LEVEL_4K, CHUNK_LEVEL_4K, 0);
+  Metachunk* c2 = cm.get_chunk(CHUNK_LEVEL_4K, CHUNK_LEVEL_4K, 0, true);
+  ASSERT_NOT_NULL(c1);
+  ASSERT_NOT_NULL(c2);
+  EXPECT_NE(root_chunk_area_base(c1), root_chunk_area_base(c2));
+
+  // ... but share root chunks among themselves.
+  Metachunk* c3 = cm.get_chunk(CHUNK_LEVEL_4K, CHUNK_LEVEL_4K, 0, true);
+  ASSERT_NOT_NULL(c3);
+  EXPECT_EQ(root_chunk_area_base(c2), root_chunk_area_base(c3));
+
+  // Once all transient chunks are returned, their root chunk is whole again
+  // and can be taken over by a standard request.
+  const MetaWord* transient_area = root_chunk_area_base(c2);
+  cm.return_chunk(c2);
+  cm.return_chunk(c3);
+  Metachunk* c4 = cm.get_chunk(ROOT_CHUNK_LEVEL, ROOT_CHUNK_LEVEL, 0);
+  ASSERT_NOT_NULL(c4);
+  EXPECT_EQ(transient_area, c4->base());
+
+  cm.return_chunk(c1);
+  cm.return_chunk(c4);
+  DEBUG_ONLY(cm.verify();)
+
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "nmt/mallocSiteTable.hpp"
+#include "nmt/mallocTracker.hpp"
+#include "nmt/memTracker.hpp"
+#include "runtime/os.hpp"
+#include "testutils.hpp"
+#include "unittest.hpp"
+
+// Finds the malloc site of a call stack
+class FindMallocSite : public MallocSiteWalker {
+  const NativeCallStack& _stack;
+  const MallocSite* _site;
+ public:
+  FindMallocSite(const NativeCallStack& stack) : _stack(stack), _site(nullptr) {}
+  bool do_malloc_site(const MallocSite* site) override {
+    if (site->call_stack()->equals(_stack)) {
+      _site = site;
+      return false;
+    }
+    return true;
+  }
+  const MallocSite* site() const { return _site; }
+};
+
+TEST_VM(NMT, malloc_site_weighted_counters) {
+  NativeCallStack stack;
+  MallocSite site(stack, mtTest);
+
+  site.allocate(16);
+  site.allocate(32 * 10, 10);
+  EXPECT_EQ(site.count(), (size_t)11);
+  EXPECT_EQ(site.size(), (size_t)(16 + 320));
+
+  site.deallocate(32 * 10, 10);
+  EXPECT_EQ(site.count(), (size_t)1);
+  EXPECT_EQ(site.size(), (size_t)16);
+  EXPECT_EQ(site.peak_size(), (size_t)(16 + 320));
+}
+
+TEST_VM(NMT, malloc_stack_sampling) {
+  if (!MallocStackSampler::is_enabled()) {
+    // Every malloc is recorded with its own weight
+    EXPECT_EQ(MallocStackSampler::weight(), (size_t)1);
+    for (int i = 0; i < 100; i++) {
+      EXPECT_TRUE(MallocStackSampler::should_sample());
+    }
+    return;
+  }
+  const size_t interval = MallocStackSampler::weight();
+  const size_t n = 1000 * interval;
+  size_t samples = 0;
+  for (size_t i = 0; i < n; i++) {
+    if (MallocStackSampler::should_sample()) {
+      samples++;
+    }
+  }
+  // The expected number of samples is 1000, allow a wide margin
+  EXPECT_GT(samples, (size_t)500);
+  EXPECT_LT(samples, (size_t)2000);
+}
+
+// Mallocs that pass their own call stack take part in the sampling like
+// mallocs that use MALLOC_CALLER_PC, so their site totals are estimates of
+// the real totals, not the real totals times the interval.
+TEST_VM(NMT, malloc_stack_sampling_explicit_stack) {
+  if (MemTracker::tracking_level() != NMT_detail || !MallocStackSampler::is_enabled()) {
+    return;
+  }
+  address pcs[] = { (address)0x1234560, (address)0x1234570, (address)0x1234580 };
+  NativeCallStack stack(pcs, ARRAY_SIZE(pcs));
+
+  const size_t size = 64;
+  const int n = 1000 * (int)MallocStackSampler::weight();
+  void** blocks = NEW_C_HEAP_ARRAY(void*, n, mtTest);
+  for (int i = 0; i < n; i++) {
+    blocks[i] = os::malloc(size, mtTest, stack);
+    ASSERT_NOT_NULL(blocks[i]);
+  }
+
+  FindMallocSite finder(stack);
+  MallocSiteTable::walk_malloc_site(&finder);
+  ASSERT_NOT_NULL(finder.site());
+  const size_t count = finder.site()->count();
+  // The expected count is n, allow a wide margin
+  EXPECT_GT(count, (size_t)n / 2);
+  EXPECT_LT(count, (size_t)n * 2);
+  EXPECT_EQ(count % MallocStackSampler::weight(), (size_t)0);
+  EXPECT_EQ(finder.site()->size(), count * size);
+
+  for (int i = 0; i < n; i++) {
+    os::free(blocks[i]);
+  }
+  FREE_C_HEAP_ARRAY(void*, blocks);
+  EXPECT_EQ(finder.site()->count(), (size_t)0);
+  EXPECT_EQ(finder.site()->size(), (size_t)0);
+}
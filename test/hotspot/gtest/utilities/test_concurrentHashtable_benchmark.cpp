@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "runtime/os.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/concurrentHashTable.inline.hpp"
+#include "utilities/powerOfTwo.hpp"
+#include "benchmarkRunner.inline.hpp"
+#include "unittest.hpp"
+
+// Microbenchmarks for ConcurrentHashTable, see benchmarkRunner.inline.hpp.
+
+struct BenchmarkCHTConfig : public AllStatic {
+  typedef uintptr_t Value;
+  static uintx get_hash(const Value& value, bool* dead_hash) {
+    return (uintx)value;
+  }
+  static void* allocate_node(void* context, size_t size, const Value& value) {
+    return os::malloc(size, mtTest);
+  }
+  static void free_node(void* context, void* memory, const Value& value) {
+    os::free(memory);
+  }
+};
+
+typedef ConcurrentHashTable<BenchmarkCHTConfig, mtInternal> BenchmarkCHT;
+
+struct BenchmarkCHTLookup {
+  uintptr_t _val;
+  BenchmarkCHTLookup(uintptr_t val) : _val(val) {}
+  uintx get_hash() {
+    return BenchmarkCHTConfig::get_hash(_val, nullptr);
+  }
+  bool equals(const uintptr_t* value) {
+    return _val == *value;
+  }
+  bool is_dead(const uintptr_t* value) {
+    return false;
+  }
+};
+
+struct BenchmarkCHTGet {
+  uintptr_t _found;
+  BenchmarkCHTGet() : _found(0) {}
+  void operator()(uintptr_t* value) {
+    _found = *value;
+  }
+};
+
+static const size_t cht_entries = 64 * K;
+static const size_t cht_ops_per_batch = 1024;
+
+// Looks up existing keys in a populated table, in pseudo-random order.
+class CHTGetBenchmark : public BenchmarkRunnable {
+  BenchmarkCHT* const _table;
+
+public:
+  CHTGetBenchmark(BenchmarkCHT* table) : _table(table) {}
+
+  void run_batch(uint worker_id) {
+    Thread* thread = Thread::current();
+    uint seed = (uint)os::random();
+    for (size_t i = 0; i < cht_ops_per_batch; i++) {
+      seed = seed * 1103515245 + 12345;
+      BenchmarkCHTLookup lookup((seed % cht_entries) + 1);
+      BenchmarkCHTGet get;
+      _table->get(thread, lookup, get);
+      guarantee(get._found != 0, "key must be present");
+    }
+  }
+};
+
+// Inserts a batch of keys private to the worker, then removes them again.
+class CHTInsertRemoveBenchmark : public BenchmarkRunnable {
+  BenchmarkCHT* const _table;
+
+public:
+  CHTInsertRemoveBenchmark(BenchmarkCHT* table) : _table(table) {}
+
+  void run_batch(uint worker_id) {
+    Thread* thread = Thread::current();
+    // Keys above cht_entries do not collide with the preloaded ones.
+    uintptr_t base = cht_entries + 1 + (uintptr_t)worker_id * cht_ops_per_batch;
+    for (size_t i = 0; i < cht_ops_per_batch; i++) {
+      BenchmarkCHTLookup lookup(base + i);
+      _table->insert(thread, lookup, base + i);
+    }
+    for (size_t i = 0; i < cht_ops_per_batch; i++) {
+      BenchmarkCHTLookup lookup(base + i);
+      _table->remove(thread, lookup);
+    }
+  }
+};
+
+static BenchmarkCHT* create_populated_table() {
+  Thread* thread = Thread::current();
+  BenchmarkCHT* table = new BenchmarkCHT(log2i_exact(cht_entries));
+  for (uintptr_t v = 1; v <= cht_entries; v++) {
+    BenchmarkCHTLookup lookup(v);
+    table->insert(thread, lookup, v);
+  }
+  return table;
+}
+
+TEST_VM(Benchmark, DISABLED_concurrentHashTable_get) {
+  BenchmarkCHT* table = create_populated_table();
+  CHTGetBenchmark benchmark(table);
+  BenchmarkRunner("ConcurrentHashTable get", &benchmark, cht_ops_per_batch).run();
+  BenchmarkScalingRunner("ConcurrentHashTable get", &benchmark, cht_ops_per_batch, BenchmarkMaxWorkers).run();
+  delete table;
+}
+
+TEST_VM(Benchmark, DISABLED_concurrentHashTable_insert_remove) {
+  BenchmarkCHT* table = create_populated_table();
+  CHTInsertRemoveBenchmark benchmark(table);
+  // Each batch performs an insert and a remove per key.
+  BenchmarkRunner("ConcurrentHashTable insert+remove", &benchmark, 2 * cht_ops_per_batch).run();
+  BenchmarkScalingRunner("ConcurrentHashTable insert+remove", &benchmark, 2 * cht_ops_per_batch, BenchmarkMaxWorkers).run();
+  delete table;
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#if !defined(_WINDOWS) && !defined(__APPLE__)
+
+#include "utilities/elfSymbolTable.hpp"
+#include "unittest.hpp"
+
+#include <stdio.h>
+
+enum {
+  INNER_NAME = 10,
+  OUTER_NAME = 20,
+  OTHER_NAME = 30,
+  UNSIZED_NAME = 40,
+  STRTAB_INDEX = 7
+};
+
+static Elf_Sym make_func(Elf_Word name, uintptr_t value, uintptr_t size) {
+  Elf_Sym sym;
+  memset(&sym, 0, sizeof(sym));
+  sym.st_name = name;
+  sym.st_info = (STB_GLOBAL << 4) | STT_FUNC;
+  sym.st_value = value;
+  sym.st_size = size;
+  return sym;
+}
+
+// Looks up addr and returns the name index of the symbol found, or -1
+static int lookup_name(ElfSymbolTable* table, uintptr_t addr, int* offset) {
+  int strtab = -1;
+  int name = -1;
+  *offset = -1;
+  if (!table->lookup((address)addr, &strtab, &name, offset, nullptr)) {
+    return -1;
+  }
+  EXPECT_EQ(strtab, (int)STRTAB_INDEX);
+  return name;
+}
+
+// Nested and overlapping function symbols must be found like a walk over
+// the section finds them: the first enclosing symbol in section order.
+TEST_VM(ElfSymbolTable, nested_symbols) {
+  Elf_Sym symbols[5];
+  memset(&symbols[0], 0, sizeof(Elf_Sym));
+  symbols[1] = make_func(INNER_NAME, 0x150, 0x10);    // [0x150, 0x160) nested in OUTER
+  symbols[2] = make_func(OUTER_NAME, 0x100, 0x100);   // [0x100, 0x200)
+  symbols[3] = make_func(OTHER_NAME, 0x300, 0x20);    // [0x300, 0x320)
+  symbols[4] = make_func(UNSIZED_NAME, 0x170, 0);     // never found
+
+  FILE* file = tmpfile();
+  ASSERT_NE(file, (FILE*)nullptr);
+  ASSERT_EQ(fwrite(symbols, sizeof(symbols), 1, file), (size_t)1);
+  ASSERT_EQ(fflush(file), 0);
+
+  Elf_Shdr shdr;
+  memset(&shdr, 0, sizeof(shdr));
+  shdr.sh_type = SHT_SYMTAB;
+  shdr.sh_offset = 0;
+  shdr.sh_size = sizeof(symbols);
+  shdr.sh_link = STRTAB_INDEX;
+  shdr.sh_entsize = sizeof(Elf_Sym);
+
+  ElfSymbolTable* table = new ElfSymbolTable(file, shdr);
+  ASSERT_FALSE(NullDecoder::is_error(table->get_status()));
+
+  int offset;
+  EXPECT_EQ(lookup_name(table, 0x100, &offset), (int)OUTER_NAME);
+  EXPECT_EQ(offset, 0);
+  EXPECT_EQ(lookup_name(table, 0x14f, &offset), (int)OUTER_NAME);
+  EXPECT_EQ(offset, 0x4f);
+  EXPECT_EQ(lookup_name(table, 0x150, &offset), (int)INNER_NAME);
+  EXPECT_EQ(offset, 0);
+  EXPECT_EQ(lookup_name(table, 0x15f, &offset), (int)INNER_NAME);
+  EXPECT_EQ(offset, 0xf);
+  // After the nested symbol, but still in the enclosing one
+  EXPECT_EQ(lookup_name(table, 0x160, &offset), (int)OUTER_NAME);
+  EXPECT_EQ(offset, 0x60);
+  EXPECT_EQ(lookup_name(table, 0x170, &offset), (int)OUTER_NAME);
+  EXPECT_EQ(offset, 0x70);
+  EXPECT_EQ(lookup_name(table, 0x1ff, &offset), (int)OUTER_NAME);
+  EXPECT_EQ(offset, 0xff);
+  EXPECT_EQ(lookup_name(table, 0x310, &offset), (int)OTHER_NAME);
+  EXPECT_EQ(offset, 0x10);
+
+  EXPECT_EQ(lookup_name(table, 0x50, &offset), -1);
+  EXPECT_EQ(lookup_name(table, 0x200, &offset), -1);
+  EXPECT_EQ(lookup_name(table, 0x2ff, &offset), -1);
+  EXPECT_EQ(lookup_name(table, 0x320, &offset), -1);
+
+  delete table;
+  fclose(file);
+}
+
+#endif // !_WINDOWS && !__APPLE__
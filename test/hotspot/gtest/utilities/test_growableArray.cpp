@@ -558,6 +558,30 @@ TEST_VM_ASSERT_MSG(GrowableArrayAssertingTest, assignment_with_embedded_cheap,
 
 #endif
 
+TEST_VM(GrowableArrayArena, grows_in_place) {
+  Arena arena(mtTest);
+  GrowableArray<int> a(&arena, 4, 0, 0);
+  for (int i = 0; i < 4; i++) {
+    a.append(i);
+  }
+  int* data = a.adr_at(0);
+  // The data array is the latest arena allocation, so it is extended.
+  a.append(4);
+  ASSERT_EQ(data, a.adr_at(0));
+  ASSERT_GE(a.capacity(), 5);
+
+  // Another allocation on top forces the next growth to move the data.
+  arena.Amalloc(8);
+  const int cap = a.capacity();
+  for (int i = a.length(); i <= cap; i++) {
+    a.append(i);
+  }
+  ASSERT_NE(data, a.adr_at(0));
+  for (int i = 0; i < a.length(); i++) {
+    ASSERT_EQ(i, a.at(i));
+  }
+}
+
 TEST(GrowableArrayCHeap, sanity) {
   // Stack/CHeap
   {
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "utilities/latencyHistogram.hpp"
+#include "utilities/ostream.hpp"
+#include "unittest.hpp"
+
+TEST(LatencyHistogram, empty) {
+  LatencyHistogram h;
+  EXPECT_EQ((uint64_t)0, h.count());
+  EXPECT_EQ(0, h.max());
+  EXPECT_EQ(0, h.value_at_percentile(50.0));
+}
+
+TEST(LatencyHistogram, small_values_are_exact) {
+  LatencyHistogram h;
+  for (jlong v = 0; v < 32; v++) {
+    h.record(v);
+  }
+  EXPECT_EQ((uint64_t)32, h.count());
+  EXPECT_EQ(31, h.max());
+  EXPECT_EQ(0, h.value_at_percentile(0.0));
+  EXPECT_EQ(15, h.value_at_percentile(50.0));
+  EXPECT_EQ(31, h.value_at_percentile(100.0));
+}
+
+TEST(LatencyHistogram, relative_error) {
+  LatencyHistogram h;
+  const jlong n = 100000;
+  for (jlong v = 1; v <= n; v++) {
+    h.record(v * 1000);
+  }
+  EXPECT_EQ(n * 1000, h.max());
+  const double percentiles[] = { 10.0, 50.0, 90.0, 99.0, 99.9 };
+  for (double p : percentiles) {
+    double exact = p / 100.0 * n * 1000;
+    double value = (double)h.value_at_percentile(p);
+    EXPECT_GE(value, exact * 0.999) << "p" << p;
+    EXPECT_LE(value, exact * (1.0 + 1.0 / 16)) << "p" << p;
+  }
+  EXPECT_EQ(h.max(), h.value_at_percentile(100.0));
+}
+
+TEST(LatencyHistogram, out_of_range) {
+  LatencyHistogram h;
+  h.record(-1);
+  h.record(max_jlong);
+  EXPECT_EQ((uint64_t)2, h.count());
+  EXPECT_EQ(0, h.value_at_percentile(50.0));
+  EXPECT_EQ(h.max(), h.value_at_percentile(100.0));
+  EXPECT_LT(h.max(), max_jlong);
+
+  h.reset();
+  EXPECT_EQ((uint64_t)0, h.count());
+}
+
+TEST(LatencyHistogram, print) {
+  LatencyHistogram h;
+  h.record(1500);
+  h.record(2500);
+  stringStream ss;
+  h.print_on(&ss, "Test");
+  EXPECT_NE(strstr(ss.base(), "Test: 2 samples, mean 2.000 us, max 2.500 us"), (char*)nullptr) << ss.base();
+  EXPECT_NE(strstr(ss.base(), "Percentile"), (char*)nullptr) << ss.base();
+}
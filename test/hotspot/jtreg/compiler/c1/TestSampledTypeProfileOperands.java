@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Values and constants loaded for sampled type profiles must stay
+ *          valid when the profile update is skipped. With Tier3DelayOff=0
+ *          every tier 3 compilation samples, and with a single thread the
+ *          countdown makes sites alternate deterministically between
+ *          updating and skipping their profiles.
+ * @requires vm.compiler1.enabled
+ * @run main/othervm -Xcomp -XX:TieredStopAtLevel=3 -XX:Tier3DelayOff=0
+ *                   -XX:C1TypeProfileSampleStride=2
+ *                   -XX:CompileCommand=compileonly,compiler.c1.TestSampledTypeProfileOperands::*
+ *                   compiler.c1.TestSampledTypeProfileOperands
+ * @run main/othervm -Xcomp -XX:TieredStopAtLevel=3 -XX:Tier3DelayOff=0
+ *                   -XX:C1TypeProfileSampleStride=3
+ *                   -XX:CompileCommand=compileonly,compiler.c1.TestSampledTypeProfileOperands::*
+ *                   compiler.c1.TestSampledTypeProfileOperands
+ * @run main/othervm -Xcomp -XX:TieredStopAtLevel=3 -XX:Tier3DelayOff=0
+ *                   -XX:C1TypeProfileSampleStride=1024
+ *                   -XX:CompileCommand=compileonly,compiler.c1.TestSampledTypeProfileOperands::*
+ *                   compiler.c1.TestSampledTypeProfileOperands
+ */
+
+package compiler.c1;
+
+public class TestSampledTypeProfileOperands {
+    static final Object CONSTANT = new Object();
+
+    static Object identity(Object o) {
+        return o;
+    }
+
+    static String concat(Object a, Object b, Object c, Object d) {
+        return String.valueOf(a) + b + c + d;
+    }
+
+    static String describe(Object o) {
+        return o == null ? "null" : o.getClass().getSimpleName();
+    }
+
+    // The constants passed to the calls are loaded for the argument profiles
+    // and are reused, in the same block, by the calls and by the code after
+    // the calls.
+    static String constants() {
+        Object r = identity("abc");
+        String s = concat("abc", CONSTANT == null ? null : "abc", r, "abc");
+        return s + "abc" + identity(null) + describe("abc");
+    }
+
+    // Many live values, so that the values loaded for the profiles compete
+    // for registers with the values used after the profiled sites.
+    static String pressure(Object a, Object b, Object c, Object d, Object e, Object f, int i) {
+        Object x = identity((i & 1) == 0 ? a : b);
+        Object y = identity((i & 2) == 0 ? c : d);
+        String s = concat(a, b, c, d) + concat(e, f, x, y);
+        return s + describe(a) + describe(b) + describe(c) + describe(d) + describe(e) + describe(f) + describe(x) + describe(y);
+    }
+
+    static String expectedPressure(Object a, Object b, Object c, Object d, Object e, Object f, int i) {
+        Object x = (i & 1) == 0 ? a : b;
+        Object y = (i & 2) == 0 ? c : d;
+        StringBuilder sb = new StringBuilder();
+        sb.append(a).append(b).append(c).append(d).append(e).append(f).append(x).append(y);
+        for (Object o : new Object[] { a, b, c, d, e, f, x, y }) {
+            sb.append(o == null ? "null" : o.getClass().getSimpleName());
+        }
+        return sb.toString();
+    }
+
+    public static void main(String[] args) {
+        String expectedConstants = "abcabcabcabcabcnullString";
+        Object[] values = { "s", 1, 2L, null, 'c', 3.0, new StringBuilder("sb") };
+        for (int i = 0; i < 10_000; i++) {
+            String c = constants();
+            if (!expectedConstants.equals(c)) {
+                throw new RuntimeException("iteration " + i + ": expected " + expectedConstants + " but got " + c);
+            }
+            Object a = values[i % values.length];
+            Object b = values[(i + 1) % values.length];
+            Object d = values[(i + 3) % values.length];
+            Object e = values[(i + 5) % values.length];
+            String expected = expectedPressure(a, b, CONSTANT, d, e, "f", i);
+            String actual = pressure(a, b, CONSTANT, d, e, "f", i);
+            if (!expected.equals(actual)) {
+                throw new RuntimeException("iteration " + i + ": expected " + expected + " but got " + actual);
+            }
+        }
+    }
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Tier 3 code that samples its argument, return and parameter type
+ *          profiles must keep the results of the profiled methods.
+ * @requires vm.compiler1.enabled
+ * @run main/othervm -Xbatch -XX:TieredStopAtLevel=3
+ *                   -XX:C1TypeProfileSampleStride=7 -XX:Tier3DelayOff=0
+ *                   compiler.c1.TestSampledTypeProfiles
+ * @run main/othervm -Xbatch
+ *                   -XX:C1TypeProfileSampleStride=64 -XX:Tier3DelayOff=0
+ *                   compiler.c1.TestSampledTypeProfiles
+ */
+
+package compiler.c1;
+
+public class TestSampledTypeProfiles {
+    interface Shape {
+        int area();
+    }
+
+    static class Square implements Shape {
+        final int side;
+        Square(int side) {
+            this.side = side;
+        }
+        public int area() {
+            return side * side;
+        }
+    }
+
+    static class Rect implements Shape {
+        final int w;
+        final int h;
+        Rect(int w, int h) {
+            this.w = w;
+            this.h = h;
+        }
+        public int area() {
+            return w * h;
+        }
+    }
+
+    static Shape make(int i) {
+        if (i % 11 == 0) {
+            return null;
+        }
+        return (i % 3 == 0) ? new Rect(i, 2) : new Square(i);
+    }
+
+    static int area(Shape s) {
+        return s == null ? -1 : s.area();
+    }
+
+    static int sumAreas(Object o1, Object o2, int i) {
+        return area((Shape)o1) + area((Shape)o2) + area(make(i));
+    }
+
+    static int expectedArea(int i) {
+        if (i % 11 == 0) {
+            return -1;
+        }
+        return (i % 3 == 0) ? 2 * i : i * i;
+    }
+
+    public static void main(String[] args) {
+        for (int i = 0; i < 100_000; i++) {
+            int j = i + 1;
+            int expected = expectedArea(i) + expectedArea(j) + expectedArea(i & 1023);
+            int actual = sumAreas(make(i), make(j), i & 1023);
+            if (expected != actual) {
+                throw new RuntimeException("iteration " + i + ": expected " + expected + " but got " + actual);
+            }
+        }
+    }
+}
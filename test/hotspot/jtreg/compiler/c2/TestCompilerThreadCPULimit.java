@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary C2 compiler threads limited to a share of a processor must stay
+ *          idle after their compilations and still compile the hot methods.
+ * @requires vm.compiler2.enabled
+ * @library /test/lib
+ * @run driver compiler.c2.TestCompilerThreadCPULimit
+ */
+
+package compiler.c2;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestCompilerThreadCPULimit {
+
+    public static void main(String[] args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createTestJavaProcessBuilder(
+                "-XX:+UnlockDiagnosticVMOptions",
+                "-XX:+TraceCompilerThreads",
+                "-XX:CompilerThreadCPULimit=20",
+                "-XX:+PrintCompilation",
+                Workload.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Done");
+        output.shouldMatch("Compiler thread C2 CompilerThread\\d+ idle for \\d+ ms after using \\d+ ms of CPU");
+        output.shouldMatch("\\s4\\s+compiler.c2.TestCompilerThreadCPULimit\\$Workload::hash");
+    }
+
+    static class Workload {
+        static int hash(int[] a, int seed) {
+            int h = seed;
+            for (int i = 0; i < a.length; i++) {
+                h = 31 * h + (a[i] ^ (h >>> 7));
+            }
+            return h;
+        }
+
+        public static void main(String[] args) throws Exception {
+            int[] a = new int[1000];
+            for (int i = 0; i < a.length; i++) {
+                a[i] = i * 0x9e3779b9;
+            }
+            int h = 0;
+            long end = System.nanoTime() + 5_000_000_000L;
+            while (System.nanoTime() < end) {
+                for (int i = 0; i < 1000; i++) {
+                    h += hash(a, i);
+                }
+            }
+            System.out.println("Done " + h);
+        }
+    }
+}
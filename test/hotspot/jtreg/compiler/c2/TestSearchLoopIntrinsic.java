@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Search loops with an early exit that start at the exiting iteration
+ *          found by the StrIndexOfChar intrinsic must keep their results.
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+OptimizeSearchLoops
+ *                   -XX:CompileCommand=compileonly,compiler.c2.TestSearchLoopIntrinsic::find*
+ *                   compiler.c2.TestSearchLoopIntrinsic
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:-OptimizeSearchLoops
+ *                   compiler.c2.TestSearchLoopIntrinsic
+ */
+
+package compiler.c2;
+
+import java.util.Random;
+
+public class TestSearchLoopIntrinsic {
+
+    static int findByte(byte[] a, int from, int to, byte c) {
+        int i = from;
+        for (; i < to; i++) {
+            if (a[i] == c) {
+                break;
+            }
+        }
+        return i;
+    }
+
+    static int findSpace(byte[] a, int from) {
+        for (int i = from; i < a.length; i++) {
+            if (a[i] == ' ') {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    static int findUnsigned(byte[] a, int c) {
+        for (int i = 0; i < a.length; i++) {
+            if ((a[i] & 0xff) == c) {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    // The value may be outside the byte range: never found.
+    static int findInt(byte[] a, int c) {
+        for (int i = 0; i < a.length; i++) {
+            if (a[i] == c) {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    // The loop runs at least once, also when from is not below to.
+    static int findDoWhile(byte[] a, int from, int to, byte c) {
+        int i = from;
+        do {
+            if (a[i] == c) {
+                break;
+            }
+            i++;
+        } while (i < to);
+        return i;
+    }
+
+    static int referenceDoWhile(byte[] a, int from, int to, byte c) {
+        if (a[from] == c) {
+            return from;
+        }
+        int found = referenceFind(a, from + 1, to, c, false);
+        return found != -1 ? found : Math.max(from + 1, to);
+    }
+
+    static int referenceFind(byte[] a, int from, int to, int c, boolean unsigned) {
+        for (int i = from; i < to; i++) {
+            int v = unsigned ? (a[i] & 0xff) : a[i];
+            if (v == c) {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    static void check(int expected, int actual, String what) {
+        if (expected != actual) {
+            throw new RuntimeException(what + ": expected " + expected + " but got " + actual);
+        }
+    }
+
+    public static void main(String[] args) {
+        Random r = new Random(42);
+        for (int iter = 0; iter < 20_000; iter++) {
+            int len = r.nextInt(300);
+            byte[] a = new byte[len];
+            for (int i = 0; i < len; i++) {
+                a[i] = (byte)('a' + r.nextInt(26));
+            }
+            if (len > 0 && r.nextBoolean()) {
+                a[r.nextInt(len)] = ' ';
+            }
+            if (len > 0 && r.nextBoolean()) {
+                a[r.nextInt(len)] = (byte)0xf0;
+            }
+            int from = len == 0 ? 0 : r.nextInt(len);
+            int to = from + (len == from ? 0 : r.nextInt(len - from + 1));
+
+            int expected = referenceFind(a, from, to, ' ', false);
+            check(expected == -1 ? to : expected, findByte(a, from, to, (byte)' '), "findByte");
+            check(referenceFind(a, from, len, ' ', false), findSpace(a, from), "findSpace");
+            check(referenceFind(a, 0, len, 0xf0, true), findUnsigned(a, 0xf0), "findUnsigned");
+            check(referenceFind(a, 0, len, (byte)0xf0, false), findInt(a, (byte)0xf0), "findInt signed");
+            check(-1, findInt(a, 0xf0), "findInt out of range");
+            if (len > 0) {
+                // from at or above to: only the element at from is searched.
+                int above = r.nextInt(len);
+                int below = r.nextInt(above + 1);
+                check(referenceDoWhile(a, above, below, (byte)' '), findDoWhile(a, above, below, (byte)' '), "findDoWhile init >= limit");
+                check(referenceDoWhile(a, from, Math.max(to, from + 1), (byte)' '),
+                      findDoWhile(a, from, Math.max(to, from + 1), (byte)' '), "findDoWhile");
+                int expectedAbove = referenceFind(a, above, below, ' ', false);
+                check(expectedAbove == -1 ? above : expectedAbove, findByte(a, above, below, (byte)' '), "findByte init > limit");
+            }
+        }
+    }
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Vector constants shared by several vectorized loops must keep their
+ *          values whether they are rematerialized or spilled.
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:CompileCommand=compileonly,compiler.c2.TestSharedVectorConstants::test*
+ *                   compiler.c2.TestSharedVectorConstants
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+RematerializeVectorConstants
+ *                   -XX:CompileCommand=compileonly,compiler.c2.TestSharedVectorConstants::test*
+ *                   compiler.c2.TestSharedVectorConstants
+ */
+
+package compiler.c2;
+
+import java.util.Random;
+
+public class TestSharedVectorConstants {
+    static final int SIZE = 1027;
+
+    // The same broadcasts are used by all loops of the method.
+    static void testSeveralLoops(int[] a, int[] b, int[] c, float[] f) {
+        for (int i = 0; i < a.length; i++) {
+            a[i] = (a[i] & 0x5a5a5a5a) + 12345;
+        }
+        for (int i = 0; i < b.length; i++) {
+            b[i] = (b[i] ^ 0x5a5a5a5a) * 12345;
+        }
+        for (int i = 0; i < c.length; i++) {
+            c[i] = (a[i] + b[i]) | 0x5a5a5a5a;
+        }
+        for (int i = 0; i < f.length; i++) {
+            f[i] = f[i] * 1.5f + 0.25f;
+        }
+    }
+
+    // Live vector constants around a call keep register pressure high.
+    static long testAcrossCall(long[] a, int n) {
+        long sum = 0;
+        for (int k = 0; k < n; k++) {
+            for (int i = 0; i < a.length; i++) {
+                a[i] = (a[i] & 0xff00ff00ff00ffL) + 0x0101010101010101L;
+            }
+            sum += opaque(a[k]);
+            for (int i = 0; i < a.length; i++) {
+                a[i] = (a[i] ^ 0x0101010101010101L) & 0xff00ff00ff00ffL;
+            }
+        }
+        return sum;
+    }
+
+    static long opaque(long v) {
+        return v;
+    }
+
+    static void check(long expected, long actual, String what) {
+        if (expected != actual) {
+            throw new RuntimeException(what + ": expected " + expected + " but got " + actual);
+        }
+    }
+
+    public static void main(String[] args) {
+        Random r = new Random(42);
+        int[] a0 = new int[SIZE];
+        int[] b0 = new int[SIZE];
+        float[] f0 = new float[SIZE];
+        long[] l0 = new long[SIZE];
+        for (int i = 0; i < SIZE; i++) {
+            a0[i] = r.nextInt();
+            b0[i] = r.nextInt();
+            f0[i] = r.nextFloat();
+            l0[i] = r.nextLong();
+        }
+
+        int[] a = new int[SIZE];
+        int[] b = new int[SIZE];
+        int[] c = new int[SIZE];
+        float[] f = new float[SIZE];
+        long[] l = new long[SIZE];
+        for (int iter = 0; iter < 10_000; iter++) {
+            System.arraycopy(a0, 0, a, 0, SIZE);
+            System.arraycopy(b0, 0, b, 0, SIZE);
+            System.arraycopy(f0, 0, f, 0, SIZE);
+            System.arraycopy(l0, 0, l, 0, SIZE);
+            testSeveralLoops(a, b, c, f);
+            long sum = testAcrossCall(l, 3);
+
+            long expectedSum = 0;
+            long[] e = l0.clone();
+            for (int k = 0; k < 3; k++) {
+                for (int i = 0; i < SIZE; i++) {
+                    e[i] = (e[i] & 0xff00ff00ff00ffL) + 0x0101010101010101L;
+                }
+                expectedSum += e[k];
+                for (int i = 0; i < SIZE; i++) {
+                    e[i] = (e[i] ^ 0x0101010101010101L) & 0xff00ff00ff00ffL;
+                }
+            }
+            check(expectedSum, sum, "testAcrossCall sum");
+
+            for (int i = 0; i < SIZE; i++) {
+                int ea = (a0[i] & 0x5a5a5a5a) + 12345;
+                int eb = (b0[i] ^ 0x5a5a5a5a) * 12345;
+                check(ea, a[i], "testSeveralLoops a");
+                check(eb, b[i], "testSeveralLoops b");
+                check((ea + eb) | 0x5a5a5a5a, c[i], "testSeveralLoops c");
+                check(Float.floatToIntBits(f0[i] * 1.5f + 0.25f), Float.floatToIntBits(f[i]), "testSeveralLoops f");
+                check(e[i], l[i], "testAcrossCall");
+            }
+        }
+    }
+}
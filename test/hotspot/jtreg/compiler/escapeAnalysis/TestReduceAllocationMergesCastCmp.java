@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Allocation merges whose null checked value is compared against a
+ *          constant must keep the results of the comparisons when reduced.
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:CompileCommand=compileonly,compiler.escapeAnalysis.TestReduceAllocationMergesCastCmp::test*
+ *                   -XX:CompileCommand=dontinline,compiler.escapeAnalysis.TestReduceAllocationMergesCastCmp::opaque
+ *                   compiler.escapeAnalysis.TestReduceAllocationMergesCastCmp
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:-ReduceAllocationMerges
+ *                   compiler.escapeAnalysis.TestReduceAllocationMergesCastCmp
+ */
+
+package compiler.escapeAnalysis;
+
+public class TestReduceAllocationMergesCastCmp {
+    static class Point {
+        int x;
+        int y;
+        Point(int x, int y) {
+            this.x = x;
+            this.y = y;
+        }
+    }
+
+    static final Point ORIGIN = new Point(0, 0);
+    static Point shared = new Point(7, 11);
+
+    static Point opaque(Point p) {
+        return p;
+    }
+
+    // The merge is null checked, and the checked value is compared against
+    // a constant after loading from it.
+    static int testCompareAfterNullCheck(boolean c1, boolean c2, int v) {
+        Point p = c1 ? new Point(v, v + 1) : (c2 ? ORIGIN : null);
+        if (p != null) {
+            int sum = p.x + p.y;
+            return p == ORIGIN ? -sum - 1 : sum;
+        }
+        return Integer.MIN_VALUE;
+    }
+
+    // One input escapes, the other one can be scalar replaced.
+    static int testCompareWithEscapingInput(boolean c1, int v) {
+        Point p = c1 ? new Point(v, 2 * v) : opaque(shared);
+        if (p != null) {
+            return p == shared ? p.x : p.y;
+        }
+        return 0;
+    }
+
+    static void check(int expected, int actual, String what) {
+        if (expected != actual) {
+            throw new RuntimeException(what + ": expected " + expected + " but got " + actual);
+        }
+    }
+
+    public static void main(String[] args) {
+        for (int i = 0; i < 50_000; i++) {
+            boolean c1 = (i % 3) == 0;
+            boolean c2 = (i % 5) != 0;
+            int expected = c1 ? 2 * i + 1 : (c2 ? -1 : Integer.MIN_VALUE);
+            check(expected, testCompareAfterNullCheck(c1, c2, i), "testCompareAfterNullCheck");
+            check(c1 ? 2 * i : 7, testCompareWithEscapingInput(c1, i), "testCompareWithEscapingInput");
+        }
+    }
+}
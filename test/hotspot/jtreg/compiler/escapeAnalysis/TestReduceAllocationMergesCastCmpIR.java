@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Allocation merges whose null checked value is compared against a
+ *          constant are reduced and their allocations scalar replaced.
+ * @requires vm.compiler2.enabled
+ * @library /test/lib /
+ * @run driver compiler.escapeAnalysis.TestReduceAllocationMergesCastCmpIR
+ */
+
+package compiler.escapeAnalysis;
+
+import compiler.lib.ir_framework.*;
+import jdk.test.lib.Asserts;
+
+public class TestReduceAllocationMergesCastCmpIR {
+    static class Point {
+        int x;
+        int y;
+        Point(int x, int y) {
+            this.x = x;
+            this.y = y;
+        }
+    }
+
+    static final Point ORIGIN = new Point(0, 0);
+
+    static int iteration;
+
+    public static void main(String[] args) {
+        TestFramework framework = new TestFramework();
+        Scenario reduce = new Scenario(0, "-XX:+UnlockDiagnosticVMOptions", "-XX:+ReduceAllocationMerges");
+        Scenario noReduce = new Scenario(1, "-XX:+UnlockDiagnosticVMOptions", "-XX:-ReduceAllocationMerges");
+        framework.addScenarios(reduce, noReduce).start();
+    }
+
+    @Test
+    @IR(failOn = {IRNode.ALLOC}, applyIf = {"ReduceAllocationMerges", "true"})
+    @IR(counts = {IRNode.ALLOC, "1"}, applyIf = {"ReduceAllocationMerges", "false"})
+    static int testCompareAfterNullCheck(boolean c1, boolean c2, int v) {
+        Point p = c1 ? new Point(v, v + 1) : (c2 ? ORIGIN : null);
+        if (p != null) {
+            int sum = p.x + p.y;
+            return p == ORIGIN ? -sum - 1 : sum;
+        }
+        return Integer.MIN_VALUE;
+    }
+
+    @Run(test = "testCompareAfterNullCheck")
+    static void runCompareAfterNullCheck() {
+        int i = iteration++;
+        boolean c1 = (i % 3) == 0;
+        boolean c2 = (i % 5) != 0;
+        int expected = c1 ? 2 * i + 1 : (c2 ? -1 : Integer.MIN_VALUE);
+        Asserts.assertEQ(expected, testCompareAfterNullCheck(c1, c2, i));
+    }
+}
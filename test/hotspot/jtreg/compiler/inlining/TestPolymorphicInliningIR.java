@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary With PolymorphicInliningLimit=3, C2 must inline all three receivers
+ *          of a call site profiled with three types behind type checks, trap
+ *          on a fourth type, and keep a virtual call where four types were seen.
+ * @requires vm.compiler2.enabled
+ * @library /test/lib /
+ * @run driver compiler.inlining.TestPolymorphicInliningIR
+ */
+
+package compiler.inlining;
+
+import compiler.lib.ir_framework.*;
+import jdk.test.lib.Asserts;
+
+public class TestPolymorphicInliningIR {
+    static final String BIMORPHIC_TRAP = "CallStaticJava.*uncommon_trap.*bimorphic";
+
+    interface Shape {
+        int area();
+    }
+
+    static class Square implements Shape {
+        public int area() {
+            return 4;
+        }
+    }
+
+    static class Rect implements Shape {
+        public int area() {
+            return 6;
+        }
+    }
+
+    static class Triangle implements Shape {
+        public int area() {
+            return 3;
+        }
+    }
+
+    static class Hexagon implements Shape {
+        public int area() {
+            return 12;
+        }
+    }
+
+    static final Shape[] THREE = { new Square(), new Rect(), new Triangle() };
+    static final Shape[] FOUR = { new Square(), new Rect(), new Triangle(), new Hexagon() };
+
+    static int iteration;
+
+    public static void main(String[] args) {
+        TestFramework.runWithFlags("-XX:+UnlockDiagnosticVMOptions",
+                                   "-XX:PolymorphicInliningLimit=3",
+                                   "-XX:TypeProfileWidth=3");
+    }
+
+    @Test
+    @IR(failOn = {IRNode.DYNAMIC_CALL_OF_METHOD, "area",
+                  IRNode.STATIC_CALL_OF_METHOD, "area"},
+        counts = {BIMORPHIC_TRAP, "1"})
+    static int callThree(Shape s) {
+        return s.area();
+    }
+
+    @Run(test = "callThree")
+    static void runCallThree(RunInfo info) {
+        Shape s = THREE[iteration++ % THREE.length];
+        Asserts.assertEQ(s.area(), callThree(s));
+        if (!info.isWarmUp()) {
+            // A type that was not profiled takes the class check trap.
+            Asserts.assertEQ(12, callThree(new Hexagon()));
+        }
+    }
+
+    @Test
+    @IR(counts = {IRNode.DYNAMIC_CALL_OF_METHOD, "area", "1"},
+        failOn = {BIMORPHIC_TRAP})
+    static int callFour(Shape s) {
+        return s.area();
+    }
+
+    @Run(test = "callFour")
+    static void runCallFour() {
+        Shape s = FOUR[iteration++ % FOUR.length];
+        Asserts.assertEQ(s.area(), callFour(s));
+    }
+}
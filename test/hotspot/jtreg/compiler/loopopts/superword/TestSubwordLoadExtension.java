@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Vectorized loops that use subword loads as int or long elements
+ *          must sign or zero extend the loaded lanes like the scalar loads.
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:CompileCommand=compileonly,compiler.loopopts.superword.TestSubwordLoadExtension::test*
+ *                   compiler.loopopts.superword.TestSubwordLoadExtension
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:-UseSuperWord
+ *                   compiler.loopopts.superword.TestSubwordLoadExtension
+ */
+
+package compiler.loopopts.superword;
+
+import java.util.Random;
+
+public class TestSubwordLoadExtension {
+    static final int SIZE = 1027;
+
+    static int testSumBytes(byte[] a) {
+        int sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    static int testSumUnsignedBytes(byte[] a) {
+        int sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            sum += a[i] & 0xff;
+        }
+        return sum;
+    }
+
+    static long testLongSumBytes(byte[] a) {
+        long sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    static long testLongSumUnsignedBytes(byte[] a) {
+        long sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            sum += a[i] & 0xff;
+        }
+        return sum;
+    }
+
+    static int testSumShorts(short[] a) {
+        int sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    static int testSumChars(char[] a) {
+        int sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    static int testDotBytes(byte[] a, byte[] b) {
+        int sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            sum += a[i] * b[i];
+        }
+        return sum;
+    }
+
+    static void testWidenBytesToInts(byte[] a, int[] r) {
+        for (int i = 0; i < a.length; i++) {
+            r[i] = a[i] + 1;
+        }
+    }
+
+    static void testWidenBytesToShorts(byte[] a, short[] r) {
+        for (int i = 0; i < a.length; i++) {
+            r[i] = (short)((a[i] & 0xff) << 4);
+        }
+    }
+
+    static void testRowSums(byte[][] m, int[] r) {
+        for (int i = 0; i < m.length; i++) {
+            byte[] row = m[i];
+            int sum = 0;
+            for (int j = 0; j < row.length; j++) {
+                sum += row[j];
+            }
+            r[i] = sum;
+        }
+    }
+
+    static void check(long expected, long actual, String what) {
+        if (expected != actual) {
+            throw new RuntimeException(what + ": expected " + expected + " but got " + actual);
+        }
+    }
+
+    public static void main(String[] args) {
+        Random r = new Random(42);
+        byte[] a = new byte[SIZE];
+        byte[] b = new byte[SIZE];
+        short[] s = new short[SIZE];
+        char[] c = new char[SIZE];
+        r.nextBytes(a);
+        r.nextBytes(b);
+        for (int i = 0; i < SIZE; i++) {
+            s[i] = (short)r.nextInt();
+            c[i] = (char)r.nextInt();
+        }
+        byte[][] m = new byte[17][];
+        for (int i = 0; i < m.length; i++) {
+            m[i] = new byte[r.nextInt(SIZE)];
+            r.nextBytes(m[i]);
+        }
+
+        int sumBytes = 0, sumUnsignedBytes = 0, sumShorts = 0, sumChars = 0, dot = 0;
+        for (int i = 0; i < SIZE; i++) {
+            sumBytes += a[i];
+            sumUnsignedBytes += a[i] & 0xff;
+            sumShorts += s[i];
+            sumChars += c[i];
+            dot += a[i] * b[i];
+        }
+
+        int[] ints = new int[SIZE];
+        short[] shorts = new short[SIZE];
+        int[] rows = new int[m.length];
+        for (int iter = 0; iter < 20_000; iter++) {
+            check(sumBytes, testSumBytes(a), "testSumBytes");
+            check(sumUnsignedBytes, testSumUnsignedBytes(a), "testSumUnsignedBytes");
+            check(sumBytes, testLongSumBytes(a), "testLongSumBytes");
+            check(sumUnsignedBytes, testLongSumUnsignedBytes(a), "testLongSumUnsignedBytes");
+            check(sumShorts, testSumShorts(s), "testSumShorts");
+            check(sumChars, testSumChars(c), "testSumChars");
+            check(dot, testDotBytes(a, b), "testDotBytes");
+        }
+        for (int iter = 0; iter < 5_000; iter++) {
+            testWidenBytesToInts(a, ints);
+            testWidenBytesToShorts(a, shorts);
+            testRowSums(m, rows);
+        }
+        for (int i = 0; i < SIZE; i++) {
+            check(a[i] + 1, ints[i], "testWidenBytesToInts");
+            check((short)((a[i] & 0xff) << 4), shorts[i], "testWidenBytesToShorts");
+        }
+        for (int i = 0; i < m.length; i++) {
+            int sum = 0;
+            for (byte v : m[i]) {
+                sum += v;
+            }
+            check(sum, rows[i], "testRowSums");
+        }
+    }
+}
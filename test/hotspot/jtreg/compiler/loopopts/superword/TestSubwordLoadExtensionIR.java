@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary SuperWord must vectorize subword loads that are widened to int by
+ *          casting the loaded vector.
+ * @requires vm.compiler2.enabled
+ * @library /test/lib /
+ * @run driver compiler.loopopts.superword.TestSubwordLoadExtensionIR
+ */
+
+package compiler.loopopts.superword;
+
+import compiler.lib.ir_framework.*;
+import jdk.test.lib.Asserts;
+
+public class TestSubwordLoadExtensionIR {
+    static final int SIZE = 1024;
+
+    static final byte[] B = new byte[SIZE];
+    static final short[] S = new short[SIZE];
+    static final char[] C = new char[SIZE];
+    static final int[] R = new int[SIZE];
+
+    static {
+        for (int i = 0; i < SIZE; i++) {
+            B[i] = (byte)(i * 37);
+            S[i] = (short)(i * 4099);
+            C[i] = (char)(i * 4099);
+        }
+    }
+
+    public static void main(String[] args) {
+        TestFramework.run();
+    }
+
+    @Test
+    @IR(counts = {IRNode.LOAD_VECTOR_B, IRNode.VECTOR_SIZE_ANY, "> 0",
+                  IRNode.VECTOR_CAST_B2I, IRNode.VECTOR_SIZE_ANY, "> 0",
+                  IRNode.STORE_VECTOR, "> 0"},
+        applyIf = {"UseSuperWord", "true"},
+        applyIfCPUFeatureOr = {"avx2", "true", "asimd", "true"})
+    static void testBytesToInts(byte[] a, int[] r) {
+        for (int i = 0; i < a.length; i++) {
+            r[i] = a[i] + 1;
+        }
+    }
+
+    @Run(test = "testBytesToInts")
+    static void runBytesToInts() {
+        testBytesToInts(B, R);
+        for (int i = 0; i < SIZE; i++) {
+            Asserts.assertEQ(B[i] + 1, R[i]);
+        }
+    }
+
+    @Test
+    @IR(counts = {IRNode.VECTOR_UCAST_B2I, IRNode.VECTOR_SIZE_ANY, "> 0",
+                  IRNode.STORE_VECTOR, "> 0"},
+        applyIf = {"UseSuperWord", "true"},
+        applyIfCPUFeatureOr = {"avx2", "true", "asimd", "true"})
+    static void testUnsignedBytesToInts(byte[] a, int[] r) {
+        for (int i = 0; i < a.length; i++) {
+            r[i] = (a[i] & 0xff) + 1;
+        }
+    }
+
+    @Run(test = "testUnsignedBytesToInts")
+    static void runUnsignedBytesToInts() {
+        testUnsignedBytesToInts(B, R);
+        for (int i = 0; i < SIZE; i++) {
+            Asserts.assertEQ((B[i] & 0xff) + 1, R[i]);
+        }
+    }
+
+    @Test
+    @IR(counts = {IRNode.LOAD_VECTOR_S, IRNode.VECTOR_SIZE_ANY, "> 0",
+                  IRNode.VECTOR_CAST_S2I, IRNode.VECTOR_SIZE_ANY, "> 0",
+                  IRNode.STORE_VECTOR, "> 0"},
+        applyIf = {"UseSuperWord", "true"},
+        applyIfCPUFeatureOr = {"avx2", "true", "asimd", "true"})
+    static void testShortsToInts(short[] a, int[] r) {
+        for (int i = 0; i < a.length; i++) {
+            r[i] = a[i] + 1;
+        }
+    }
+
+    @Run(test = "testShortsToInts")
+    static void runShortsToInts() {
+        testShortsToInts(S, R);
+        for (int i = 0; i < SIZE; i++) {
+            Asserts.assertEQ(S[i] + 1, R[i]);
+        }
+    }
+
+    @Test
+    @IR(counts = {IRNode.LOAD_VECTOR_C, IRNode.VECTOR_SIZE_ANY, "> 0",
+                  IRNode.VECTOR_UCAST_S2I, IRNode.VECTOR_SIZE_ANY, "> 0",
+                  IRNode.STORE_VECTOR, "> 0"},
+        applyIf = {"UseSuperWord", "true"},
+        applyIfCPUFeatureOr = {"avx2", "true", "asimd", "true"})
+    static void testCharsToInts(char[] a, int[] r) {
+        for (int i = 0; i < a.length; i++) {
+            r[i] = a[i] + 1;
+        }
+    }
+
+    @Run(test = "testCharsToInts")
+    static void runCharsToInts() {
+        testCharsToInts(C, R);
+        for (int i = 0; i < SIZE; i++) {
+            Asserts.assertEQ(C[i] + 1, R[i]);
+        }
+    }
+}
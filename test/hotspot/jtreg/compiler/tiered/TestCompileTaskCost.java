@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Compile tasks selected with their expected cost and deadline must
+ *          all get compiled, and the queue must report how long they waited.
+ * @requires vm.compiler1.enabled & vm.compiler2.enabled
+ * @library /test/lib
+ * @run driver compiler.tiered.TestCompileTaskCost
+ */
+
+package compiler.tiered;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestCompileTaskCost {
+
+    public static void main(String[] args) throws Exception {
+        for (String flags : new String[] { "-XX:CompileTaskCostScale=1", "-XX:CompileTaskDeadline=1",
+                                           "-XX:CompileTaskCostScale=0" }) {
+            ProcessBuilder pb = ProcessTools.createTestJavaProcessBuilder(
+                    "-XX:+UnlockDiagnosticVMOptions",
+                    "-XX:+CIPrintCompileQueue",
+                    "-XX:CICompilerCount=2",
+                    flags,
+                    Workload.class.getName());
+            OutputAnalyzer output = new OutputAnalyzer(pb.start());
+            output.shouldHaveExitValue(0);
+            output.shouldContain("Done");
+            output.shouldMatch("Queue wait of \\d+ started tasks: 50%: [0-9.]+ ms, 90%: [0-9.]+ ms, 99%: [0-9.]+ ms, max: [0-9.]+ ms");
+        }
+    }
+
+    static class Workload {
+        static int small(int x) {
+            return x * 31 + 7;
+        }
+
+        static int large(int[] a, int x) {
+            int r = 0;
+            for (int i = 0; i < a.length; i++) {
+                switch ((a[i] + x) & 7) {
+                    case 0 -> r += small(a[i]);
+                    case 1 -> r -= a[i] >>> 3;
+                    case 2 -> r ^= Integer.rotateLeft(a[i], x & 31);
+                    case 3 -> r += Integer.bitCount(a[i] ^ x);
+                    case 4 -> r *= 3;
+                    case 5 -> r += Long.hashCode((long)a[i] * x);
+                    case 6 -> r |= a[i] & 0xff00;
+                    default -> r += i;
+                }
+            }
+            return r;
+        }
+
+        public static void main(String[] args) {
+            int[] a = new int[256];
+            for (int i = 0; i < a.length; i++) {
+                a[i] = i * 0x9e3779b9;
+            }
+            int sum = 0;
+            for (int i = 0; i < 50_000; i++) {
+                sum += small(i) + large(a, i);
+            }
+            System.out.println("Done " + sum);
+        }
+    }
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Epsilon with EpsilonSlidingGC reclaims garbage when the heap is
+ *          exhausted and keeps live objects, their contents and hash codes.
+ * @requires vm.gc.Epsilon
+ * @run main/othervm -Xmx64m -XX:+UnlockExperimentalVMOptions
+ *                   -XX:+UseEpsilonGC -XX:+EpsilonSlidingGC -Xlog:gc
+ *                   gc.epsilon.TestSlidingGC
+ * @run main/othervm -Xmx64m -XX:+UnlockExperimentalVMOptions
+ *                   -XX:+UseEpsilonGC -XX:+EpsilonSlidingGC -XX:-UseTLAB
+ *                   gc.epsilon.TestSlidingGC
+ */
+
+package gc.epsilon;
+
+public class TestSlidingGC {
+    static final int LIVE = 10_000;
+    static final long GARBAGE_BYTES = 1024L * 1024 * 1024;
+
+    static volatile Object sink;
+
+    static class Node {
+        final int value;
+        final int[] payload;
+        Node next;
+
+        Node(int value) {
+            this.value = value;
+            this.payload = new int[] { value, ~value };
+        }
+    }
+
+    public static void main(String[] args) {
+        Node[] live = new Node[LIVE];
+        int[] hashes = new int[LIVE];
+        for (int i = 0; i < LIVE; i++) {
+            live[i] = new Node(i);
+            hashes[i] = System.identityHashCode(live[i]);
+            if (i > 0) {
+                live[i - 1].next = live[i];
+            }
+        }
+
+        // Allocate many times the heap size in garbage, replacing some of the
+        // live objects along the way so that the live set is spread out.
+        long allocated = 0;
+        for (int i = 0; allocated < GARBAGE_BYTES; i++) {
+            sink = new byte[1024];
+            allocated += 1024;
+            if (i % 100 == 0) {
+                int idx = (i / 100) % LIVE;
+                Node n = new Node(idx);
+                n.next = live[idx].next;
+                if (idx > 0) {
+                    live[idx - 1].next = n;
+                }
+                live[idx] = n;
+                hashes[idx] = System.identityHashCode(n);
+            }
+        }
+
+        Node n = live[0];
+        for (int i = 0; i < LIVE; i++) {
+            if (n != live[i]) {
+                throw new RuntimeException("Broken link at " + i);
+            }
+            if (n.value != i || n.payload[0] != i || n.payload[1] != ~i) {
+                throw new RuntimeException("Broken contents at " + i);
+            }
+            if (System.identityHashCode(n) != hashes[i]) {
+                throw new RuntimeException("Identity hash code changed at " + i);
+            }
+            n = n.next;
+        }
+        if (n != null) {
+            throw new RuntimeException("List should end after " + LIVE + " nodes");
+        }
+    }
+}
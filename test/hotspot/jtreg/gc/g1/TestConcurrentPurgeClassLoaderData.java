@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestConcurrentPurgeClassLoaderData
+ * @summary Full GCs racing with the concurrent purge of class loader data
+ *          unloaded in Remark must not crash or corrupt metaspace.
+ * @requires vm.gc.G1
+ * @library /test/lib /
+ * @build   jdk.test.whitebox.WhiteBox
+ * @modules java.base/jdk.internal.misc
+ * @run     driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run main/othervm -XX:+UseG1GC -Xmx128m -Xlog:gc,gc+phases=debug
+ *                   -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -XX:+G1ConcurrentPurgeClassLoaderData
+ *                   gc.g1.TestConcurrentPurgeClassLoaderData
+ */
+
+import java.io.InputStream;
+
+import jdk.test.whitebox.WhiteBox;
+
+public class TestConcurrentPurgeClassLoaderData {
+    private static final WhiteBox WB = WhiteBox.getWhiteBox();
+    private static final long DURATION_MS = 10_000;
+
+    public static class Unloadable {
+        public Object self() {
+            return this;
+        }
+    }
+
+    static class OneClassLoader extends ClassLoader {
+        private final byte[] bytes;
+
+        OneClassLoader(byte[] bytes) {
+            super(TestConcurrentPurgeClassLoaderData.class.getClassLoader());
+            this.bytes = bytes;
+        }
+
+        @Override
+        protected Class<?> loadClass(String name, boolean resolve) throws ClassNotFoundException {
+            if (name.equals(Unloadable.class.getName())) {
+                synchronized (getClassLoadingLock(name)) {
+                    Class<?> c = findLoadedClass(name);
+                    if (c == null) {
+                        c = defineClass(name, bytes, 0, bytes.length);
+                    }
+                    return c;
+                }
+            }
+            return super.loadClass(name, resolve);
+        }
+    }
+
+    private static volatile boolean done;
+    private static volatile Object sink;
+
+    public static void main(String[] args) throws Exception {
+        byte[] bytes;
+        String resource = Unloadable.class.getName().replace('.', '/') + ".class";
+        try (InputStream in = ClassLoader.getSystemResourceAsStream(resource)) {
+            bytes = in.readAllBytes();
+        }
+
+        Thread loader = new Thread(() -> {
+            try {
+                while (!done) {
+                    for (int i = 0; i < 100; i++) {
+                        Class<?> c = new OneClassLoader(bytes).loadClass(Unloadable.class.getName());
+                        sink = c.getMethod("self").invoke(c.getDeclaredConstructor().newInstance());
+                    }
+                }
+            } catch (ReflectiveOperationException e) {
+                throw new RuntimeException(e);
+            }
+        });
+        loader.start();
+
+        // Start concurrent cycles, each unloading the classes loaded since the
+        // previous one in its Remark pause, and force Full GCs while the
+        // concurrent mark thread may still be purging them.
+        long end = System.currentTimeMillis() + DURATION_MS;
+        int cycles = 0;
+        while (System.currentTimeMillis() < end) {
+            if (WB.g1StartConcMarkCycle()) {
+                cycles++;
+            }
+            while (WB.g1InConcurrentMark()) {
+                if ((cycles & 1) == 0) {
+                    System.gc();
+                }
+                Thread.onSpinWait();
+            }
+        }
+        done = true;
+        loader.join();
+        System.out.println("Concurrent cycles started: " + cycles);
+    }
+}
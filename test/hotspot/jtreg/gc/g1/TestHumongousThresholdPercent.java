@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+import static gc.testlibrary.Allocation.blackHole;
+
+/*
+ * @test TestHumongousThresholdPercent
+ * @summary Objects below G1HumongousThresholdPercent of the region size must be
+ *          allocated in regular regions instead of as humongous objects.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @library /
+ * @run driver gc.g1.TestHumongousThresholdPercent
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestHumongousThresholdPercent {
+    private static final int heapSize       = 224; // MB
+    private static final int heapRegionSize = 1;   // MB
+
+    private static OutputAnalyzer run(int thresholdPercent) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(
+            "-XX:+UseG1GC",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:G1HumongousThresholdPercent=" + thresholdPercent,
+            "-Xms" + heapSize + "m",
+            "-Xmx" + heapSize + "m",
+            "-XX:G1HeapRegionSize=" + heapRegionSize + "m",
+            "-Xlog:gc",
+            LargeObjectAllocator.class.getName());
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    public static void main(String[] args) throws Exception {
+        run(50).shouldContain("(G1 Humongous Allocation)");
+        run(90).shouldNotContain("(G1 Humongous Allocation)");
+    }
+
+    static class LargeObjectAllocator {
+        public static void main(String [] args) {
+            for (int i = 0; i < 4 * heapSize; i++) {
+                // About 60% of a G1HeapRegion.
+                blackHole(new long[80_000]);
+            }
+        }
+    }
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Full GCs that compact the old generation in islands must keep
+ *          the heap consistent.
+ * @requires vm.gc.Parallel
+ * @requires vm.flagless
+ * @library /test/lib
+ * @run driver gc.parallel.TestCompactionIslands
+ */
+
+package gc.parallel;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestCompactionIslands {
+    static class Node {
+        final int id;
+        Node next;
+        final byte[] payload;
+
+        Node(int id, Node next) {
+            this.id = id;
+            this.next = next;
+            this.payload = new byte[512 + (id % 7) * 64];
+            this.payload[0] = (byte)id;
+            this.payload[payload.length - 1] = (byte)(id >> 8);
+        }
+    }
+
+    static final int COUNT = 100_000;
+
+    static void check(Node[] nodes) {
+        for (int i = 0; i < nodes.length; i++) {
+            Node n = nodes[i];
+            if (n == null) {
+                continue;
+            }
+            if (n.id != i) {
+                throw new RuntimeException("Node " + i + " has id " + n.id);
+            }
+            if (n.next != null && n.next.id >= i) {
+                throw new RuntimeException("Node " + i + " links to " + n.next.id);
+            }
+            if (n.payload.length != 512 + (i % 7) * 64 ||
+                n.payload[0] != (byte)i || n.payload[n.payload.length - 1] != (byte)(i >> 8)) {
+                throw new RuntimeException("Node " + i + " has a corrupted payload");
+            }
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0) {
+            work();
+            return;
+        }
+
+        ProcessBuilder pb = ProcessTools.createLimitedTestJavaProcessBuilder(
+            "-XX:+UseParallelGC", "-Xmx256m", "-Xmn16m",
+            "-XX:+UnlockExperimentalVMOptions", "-XX:ParallelCompactIslands=4",
+            // System.gc() would otherwise always use maximum compaction.
+            "-XX:-UseMaximumCompactionOnSystemGC", "-XX:HeapMaximumCompactionInterval=1000",
+            "-XX:+UnlockDiagnosticVMOptions", "-XX:+VerifyBeforeGC", "-XX:+VerifyAfterGC",
+            "-Xlog:gc+compaction=debug",
+            TestCompactionIslands.class.getName(), "worker");
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldMatch("Compaction island 0: \\[0x\\p{XDigit}+, 0x\\p{XDigit}+\\) new_top 0x\\p{XDigit}+");
+    }
+
+    static void work() {
+        Node[] nodes = new Node[COUNT];
+        Node last = null;
+        for (int i = 0; i < COUNT; i++) {
+            last = new Node(i, last);
+            nodes[i] = last;
+        }
+        // Promote everything, then punch holes into the old generation.
+        System.gc();
+        for (int round = 0; round < 5; round++) {
+            for (int i = round; i < COUNT; i += 2 + round) {
+                nodes[i] = null;
+            }
+            for (int i = 1; i < COUNT; i++) {
+                if (nodes[i] != null) {
+                    Node prev = null;
+                    for (int j = i - 1; j >= 0 && j >= i - 16; j--) {
+                        if (nodes[j] != null) {
+                            prev = nodes[j];
+                            break;
+                        }
+                    }
+                    nodes[i].next = prev;
+                }
+            }
+            System.gc();
+            check(nodes);
+        }
+    }
+}
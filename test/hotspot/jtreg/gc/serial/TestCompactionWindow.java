@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Full GCs that leave part of the old generation in place must keep
+ *          the heap consistent.
+ * @requires vm.gc.Serial
+ * @run main/othervm -XX:+UseSerialGC -Xmx64m -Xmn8m
+ *                   -XX:+UnlockExperimentalVMOptions -XX:SerialFullGCCompactionWindowPercent=1
+ *                   -XX:MarkSweepAlwaysCompactCount=1000
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+VerifyBeforeGC -XX:+VerifyAfterGC
+ *                   gc.serial.TestCompactionWindow
+ */
+
+package gc.serial;
+
+public class TestCompactionWindow {
+    static class Node {
+        final int id;
+        Node next;
+        final byte[] payload;
+
+        Node(int id, Node next) {
+            this.id = id;
+            this.next = next;
+            this.payload = new byte[64 + (id % 7) * 16];
+        }
+    }
+
+    static final int COUNT = 100_000;
+
+    static void check(Node[] nodes) {
+        for (int i = 0; i < nodes.length; i++) {
+            Node n = nodes[i];
+            if (n == null) {
+                continue;
+            }
+            if (n.id != i) {
+                throw new RuntimeException("Node " + i + " has id " + n.id);
+            }
+            if (n.next != null && n.next.id >= i) {
+                throw new RuntimeException("Node " + i + " links to " + n.next.id);
+            }
+            if (n.payload.length != 64 + (i % 7) * 16) {
+                throw new RuntimeException("Node " + i + " has payload of length " + n.payload.length);
+            }
+        }
+    }
+
+    public static void main(String[] args) {
+        Node[] nodes = new Node[COUNT];
+        Node last = null;
+        for (int i = 0; i < COUNT; i++) {
+            last = new Node(i, last);
+            nodes[i] = last;
+        }
+        // Promote everything, then punch holes into the old generation.
+        System.gc();
+        for (int round = 0; round < 5; round++) {
+            for (int i = round; i < COUNT; i += 5 + round) {
+                nodes[i] = null;
+            }
+            for (int i = 1; i < COUNT; i++) {
+                if (nodes[i] != null) {
+                    Node prev = null;
+                    for (int j = i - 1; j >= 0 && j >= i - 16; j--) {
+                        if (nodes[j] != null) {
+                            prev = nodes[j];
+                            break;
+                        }
+                    }
+                    nodes[i].next = prev;
+                }
+            }
+            System.gc();
+            check(nodes);
+        }
+    }
+}
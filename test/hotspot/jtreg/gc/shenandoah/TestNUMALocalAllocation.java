@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/* @test id=default
+ * @summary Allocation and evacuation must work when Shenandoah binds heap regions to NUMA nodes.
+ * @requires vm.gc.Shenandoah
+ *
+ * @run main/othervm -XX:+UnlockDiagnosticVMOptions -XX:+UnlockExperimentalVMOptions -Xmx128m
+ *      -XX:+UseShenandoahGC -XX:+UseNUMA -XX:+ShenandoahNUMALocalAllocation
+ *      -XX:+ShenandoahVerify
+ *      TestNUMALocalAllocation
+ */
+
+/* @test id=generational
+ * @summary Allocation and evacuation must work when Shenandoah binds heap regions to NUMA nodes.
+ * @requires vm.gc.Shenandoah
+ *
+ * @run main/othervm -XX:+UnlockDiagnosticVMOptions -XX:+UnlockExperimentalVMOptions -Xmx128m
+ *      -XX:+UseShenandoahGC -XX:ShenandoahGCMode=generational
+ *      -XX:+UseNUMA -XX:+ShenandoahNUMALocalAllocation
+ *      -XX:+ShenandoahVerify
+ *      TestNUMALocalAllocation
+ */
+
+public class TestNUMALocalAllocation {
+    static final int COUNT = 1_000_000;
+    static Object[] retained = new Object[10_000];
+
+    public static void main(String[] args) throws Exception {
+        Thread[] threads = new Thread[4];
+        for (int t = 0; t < threads.length; t++) {
+            final int seed = t;
+            threads[t] = new Thread(() -> {
+                for (int i = 0; i < COUNT; i++) {
+                    byte[] b = new byte[(i + seed) % 512];
+                    if (i % 100 == 0) {
+                        retained[(i / 100 + seed) % retained.length] = b;
+                    }
+                }
+            });
+            threads[t].start();
+        }
+        for (Thread t : threads) {
+            t.join();
+        }
+    }
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary With StringDeduplicationUseStringTable, a Latin1 String is
+ *          deduplicated against the interned String with the same contents.
+ * @requires vm.gc.G1
+ * @requires vm.flagless
+ * @library /test/lib
+ * @run driver gc.stringdedup.TestStringDeduplicationInterned
+ */
+
+package gc.stringdedup;
+
+import java.lang.reflect.Field;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestStringDeduplicationInterned {
+    static final int MAX_ATTEMPTS = 100;
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0) {
+            work();
+            return;
+        }
+
+        ProcessBuilder pb = ProcessTools.createLimitedTestJavaProcessBuilder(
+            "-XX:+UseG1GC", "-Xmx64m",
+            "-XX:+UseStringDeduplication", "-XX:StringDeduplicationAgeThreshold=1",
+            "-XX:+UnlockExperimentalVMOptions", "-XX:+StringDeduplicationUseStringTable",
+            "-XX:+CompactStrings",
+            "--add-opens", "java.base/java.lang=ALL-UNNAMED",
+            "-Xlog:stringdedup*=debug",
+            TestStringDeduplicationInterned.class.getName(), "worker");
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Deduplicated against interned string");
+        // The hit is counted against the StringTable, not the dedup table.
+        output.shouldMatch("Interned:\\s+[1-9]\\d*\\(");
+    }
+
+    static void work() throws Exception {
+        Field valueField = String.class.getDeclaredField("value");
+        valueField.setAccessible(true);
+        Field coderField = String.class.getDeclaredField("coder");
+        coderField.setAccessible(true);
+
+        // Built at run time so that it is not a literal in the archived or
+        // dynamic StringTable.
+        String interned = new String(("interned-latin1-" + System.nanoTime()).toCharArray()).intern();
+        String duplicate = new String(interned.toCharArray());
+        if ((byte)coderField.get(duplicate) != 0) {
+            throw new RuntimeException("Expected a Latin1 string");
+        }
+        if (valueField.get(duplicate) == valueField.get(interned)) {
+            throw new RuntimeException("Expected distinct value arrays");
+        }
+
+        for (int i = 0; i < MAX_ATTEMPTS; i++) {
+            System.gc();
+            Thread.sleep(100);
+            if (valueField.get(duplicate) == valueField.get(interned)) {
+                System.out.println("Deduplicated against interned string");
+                return;
+            }
+        }
+        throw new RuntimeException("Latin1 string was not deduplicated");
+    }
+}
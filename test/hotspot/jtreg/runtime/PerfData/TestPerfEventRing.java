@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary The sun.rt.events ring must be exported in the hsperfdata file,
+ *          and the VM must warn when it does not fit into PerfData memory.
+ * @requires vm.flagless
+ * @library /test/lib
+ * @run driver runtime.PerfData.TestPerfEventRing
+ */
+
+package runtime.PerfData;
+
+import jdk.test.lib.JDKToolFinder;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestPerfEventRing {
+    static final String WARNING = "does not fit into the PerfData memory";
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0) {
+            work();
+            return;
+        }
+
+        // The largest ring does not fit into the default PerfDataMemorySize,
+        // which is grown to make room for it.
+        OutputAnalyzer output = run("-XX:PerfEventRingRecords=4096");
+        output.shouldHaveExitValue(0);
+        output.shouldNotContain(WARNING);
+        output.shouldMatch("sun\\.rt\\.events=");
+
+        // An explicit PerfDataMemorySize is kept.
+        output = run("-XX:PerfEventRingRecords=4096", "-XX:PerfDataMemorySize=32k");
+        output.shouldHaveExitValue(0);
+        output.shouldContain("PerfEventRingRecords=4096 " + WARNING);
+        output.shouldNotMatch("sun\\.rt\\.events=");
+    }
+
+    static OutputAnalyzer run(String... flags) throws Exception {
+        String[] args = new String[flags.length + 5];
+        args[0] = "-XX:+UsePerfData";
+        args[1] = "-XX:-PerfDisableSharedMem";
+        args[2] = "-XX:+UnlockExperimentalVMOptions";
+        System.arraycopy(flags, 0, args, 3, flags.length);
+        args[flags.length + 3] = TestPerfEventRing.class.getName();
+        args[flags.length + 4] = "worker";
+        ProcessBuilder pb = ProcessTools.createLimitedTestJavaProcessBuilder(args);
+        return new OutputAnalyzer(pb.start());
+    }
+
+    static void work() throws Exception {
+        // Record a few safepoints.
+        for (int i = 0; i < 3; i++) {
+            System.gc();
+        }
+        // jcmd reads PerfCounter.print from the hsperfdata file.
+        OutputAnalyzer jcmd = ProcessTools.executeProcess(JDKToolFinder.getJDKTool("jcmd"),
+                                                          Long.toString(ProcessHandle.current().pid()),
+                                                          "PerfCounter.print");
+        jcmd.shouldHaveExitValue(0);
+        jcmd.shouldContain("sun.rt.safepoints=");
+        System.out.println(jcmd.getStdout());
+    }
+}
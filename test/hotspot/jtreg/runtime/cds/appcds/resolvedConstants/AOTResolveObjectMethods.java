@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Record ObjectMethods and StringConcatFactory.makeConcat call sites
+ *          are resolved when the AOT cache is created
+ * @requires vm.cds.supports.aot.class.linking
+ * @requires vm.flagless
+ * @library /test/lib
+ * @compile -XDstringConcat=indy AOTResolveObjectMethods.java
+ * @run driver AOTResolveObjectMethods
+ */
+
+import java.nio.file.Path;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import jdk.test.lib.util.JarUtils;
+
+public class AOTResolveObjectMethods {
+    static final String APP = AOTResolveObjectMethodsApp.class.getName();
+
+    public static void main(String[] args) throws Exception {
+        Path jar = Path.of("app.jar");
+        JarUtils.createJarFile(jar, Path.of(System.getProperty("test.classes")),
+                               APP + ".class", APP + "$Point.class");
+        String cp = jar.toString();
+
+        run("-XX:AOTMode=record", "-XX:AOTConfiguration=app.aotconfig", "-cp", cp, APP)
+            .shouldHaveExitValue(0);
+
+        OutputAnalyzer output = run("-XX:AOTMode=create", "-XX:AOTConfiguration=app.aotconfig",
+                                    "-XX:AOTCache=app.aot", "-Xlog:aot+resolve=trace", "-cp", cp);
+        output.shouldHaveExitValue(0);
+        output.shouldMatch("archived indy +CP entry \\[ *\\d+\\]: AOTResolveObjectMethodsApp\\$Point \\(\\d+\\)");
+        output.shouldContain("=> java/lang/runtime/ObjectMethods.bootstrap:");
+        output.shouldMatch("archived indy +CP entry \\[ *\\d+\\]: AOTResolveObjectMethodsApp \\(\\d+\\)");
+        output.shouldContain("=> java/lang/invoke/StringConcatFactory.makeConcat:");
+
+        run("-XX:AOTCache=app.aot", "-Xshare:on", "-cp", cp, APP)
+            .shouldHaveExitValue(0)
+            .shouldContain("Point[x=1, name=one]");
+    }
+
+    static OutputAnalyzer run(String... args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createLimitedTestJavaProcessBuilder(args);
+        return new OutputAnalyzer(pb.start());
+    }
+}
+
+class AOTResolveObjectMethodsApp {
+    record Point(int x, String name) {}
+
+    public static void main(String[] args) {
+        Point p = new Point(1, "one");
+        Point q = new Point(1, "one");
+        if (!p.equals(q) || p.hashCode() != q.hashCode()) {
+            throw new RuntimeException("Equal points compare as different");
+        }
+        // Compiled with -XDstringConcat=indy, so this uses makeConcat.
+        String s = p.name() + q.name();
+        if (!s.equals("oneone")) {
+            throw new RuntimeException("Wrong concatenation: " + s);
+        }
+        System.out.println(p.toString());
+    }
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+/*
+ * @test ParallelHandshakeTest
+ * @summary Deoptimization handshakes of all threads processed by the safepoint workers
+ * @requires vm.gc.G1
+ * @library /testlibrary /test/lib
+ * @build ParallelHandshakeTest
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run driver ParallelHandshakeTest
+ */
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.locks.LockSupport;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import jdk.test.whitebox.WhiteBox;
+
+public class ParallelHandshakeTest {
+
+    public static void main(String... args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createTestJavaProcessBuilder(
+                "-Xbootclasspath/a:.",
+                "-XX:+UnlockDiagnosticVMOptions",
+                "-XX:+WhiteBoxAPI",
+                "-XX:+UseG1GC",
+                "-XX:ParallelGCThreads=4",
+                "-XX:ParallelHandshakeThreshold=1",
+                "-Xlog:handshake=info",
+                Target.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldMatch("Handshake \"Deoptimize\", Targeted threads: \\d+, .*, parallel");
+    }
+
+    static class Target {
+        static volatile boolean stop = false;
+        static volatile long sink;
+
+        public static void main(String... args) throws Exception {
+            List<Thread> threads = new ArrayList<>();
+            for (int i = 0; i < 64; i++) {
+                Thread t;
+                switch (i % 3) {
+                    case 0 -> t = new Thread(Target::spin);
+                    case 1 -> t = new Thread(Target::park);
+                    default -> t = new Thread(Target::allocate);
+                }
+                t.start();
+                threads.add(t);
+            }
+
+            WhiteBox wb = WhiteBox.getWhiteBox();
+            for (int i = 0; i < 20; i++) {
+                Thread.sleep(20);
+                wb.deoptimizeAll();
+            }
+
+            stop = true;
+            for (Thread t : threads) {
+                LockSupport.unpark(t);
+                t.join();
+            }
+        }
+
+        static void spin() {
+            long x = 0;
+            while (!stop) {
+                x += System.nanoTime() & 1;
+            }
+            sink = x;
+        }
+
+        static void park() {
+            while (!stop) {
+                LockSupport.parkNanos(1_000_000);
+            }
+        }
+
+        static void allocate() {
+            while (!stop) {
+                sink = new Object[16].hashCode();
+            }
+        }
+    }
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary invokedynamic string concatenation sites that refer to the same
+ *          constant pool entry are linked to the CallSite of the first one
+ * @requires vm.flagless
+ * @library /test/lib
+ * @run driver TestShareStringConcatCallSites
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestShareStringConcatCallSites {
+
+    static class Concat {
+        // The first two sites have the same recipe and argument types, so
+        // javac emits a single CONSTANT_InvokeDynamic for them. The third
+        // one has a different recipe.
+        static String run(int i) {
+            String a = "v" + i;
+            String b = "v" + i;
+            return a + "," + b;
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0) {
+            for (int i = 0; i < 100; i++) {
+                String expected = "v" + i + ",v" + i;
+                String actual = Concat.run(i);
+                if (!expected.equals(actual)) {
+                    throw new RuntimeException("Expected " + expected + " but got " + actual);
+                }
+            }
+            return;
+        }
+
+        String shared = "TestShareStringConcatCallSites\\$Concat indy#1 shares CallSite of indy#0 @CP\\[\\d+\\]";
+
+        OutputAnalyzer output = run("-XX:+ShareStringConcatCallSites");
+        output.shouldHaveExitValue(0);
+        output.shouldMatch(shared);
+        output.shouldNotContain("TestShareStringConcatCallSites$Concat indy#2 shares");
+
+        output = run("-XX:-ShareStringConcatCallSites");
+        output.shouldHaveExitValue(0);
+        output.shouldNotMatch(shared);
+    }
+
+    static OutputAnalyzer run(String flag) throws Exception {
+        ProcessBuilder pb = ProcessTools.createLimitedTestJavaProcessBuilder(
+            "-XX:+UnlockDiagnosticVMOptions", flag,
+            "-Xlog:methodhandles+indy=debug",
+            TestShareStringConcatCallSites.class.getName(), "worker");
+        return new OutputAnalyzer(pb.start());
+    }
+}
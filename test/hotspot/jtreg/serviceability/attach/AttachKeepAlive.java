@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Several attach operations can be sent over one keepalive connection
+ * @requires os.family == "linux"
+ * @library /test/lib
+ * @run driver AttachKeepAlive
+ */
+
+import java.io.ByteArrayOutputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.OutputStream;
+import java.net.StandardProtocolFamily;
+import java.net.UnixDomainSocketAddress;
+import java.nio.channels.Channels;
+import java.nio.channels.SocketChannel;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.Path;
+
+import jdk.test.lib.apps.LingeredApp;
+
+public class AttachKeepAlive {
+
+    public static void main(String[] args) throws Exception {
+        LingeredApp app = null;
+        try {
+            app = LingeredApp.startApp("-XX:+StartAttachListener");
+            Path socket = Path.of("/tmp", ".java_pid" + app.getPid());
+            for (int i = 0; i < 600 && !Files.exists(socket); i++) {
+                Thread.sleep(100);
+            }
+            if (!Files.exists(socket)) {
+                throw new RuntimeException(socket + " was not created");
+            }
+
+            try (SocketChannel channel = SocketChannel.open(StandardProtocolFamily.UNIX)) {
+                channel.connect(UnixDomainSocketAddress.of(socket));
+                InputStream in = Channels.newInputStream(channel);
+                OutputStream out = Channels.newOutputStream(channel);
+
+                // All requests but the last keep the connection open.
+                send(out, "getversion keepalive=1", "options");
+                String version = readFramedReply(in);
+                if (!version.contains("keepalive")) {
+                    throw new RuntimeException("keepalive is not listed in supported options: " + version);
+                }
+
+                for (int i = 0; i < 3; i++) {
+                    send(out, "jcmd keepalive=1", "VM.version");
+                    String reply = readFramedReply(in);
+                    if (!reply.contains("JDK")) {
+                        throw new RuntimeException("Unexpected VM.version output: " + reply);
+                    }
+                    send(out, "jcmd keepalive=1", "VM.uptime");
+                    reply = readFramedReply(in);
+                    if (!reply.trim().endsWith(" s")) {
+                        throw new RuntimeException("Unexpected VM.uptime output: " + reply);
+                    }
+                }
+
+                // A request without keepalive ends the connection after its reply.
+                send(out, "jcmd", "VM.version");
+                String last = new String(in.readAllBytes(), StandardCharsets.UTF_8);
+                if (!last.startsWith("0\n") || !last.contains("JDK")) {
+                    throw new RuntimeException("Unexpected reply: " + last);
+                }
+            }
+        } finally {
+            LingeredApp.stopApp(app);
+        }
+    }
+
+    // Attach API v2 request: <ver>0<size>0<cmd and options>0(<arg>0)*
+    static void send(OutputStream out, String command, String... args) throws IOException {
+        ByteArrayOutputStream data = new ByteArrayOutputStream();
+        data.write(command.getBytes(StandardCharsets.UTF_8));
+        data.write(0);
+        for (String arg : args) {
+            data.write(arg.getBytes(StandardCharsets.UTF_8));
+            data.write(0);
+        }
+        out.write(("2\0" + data.size() + "\0").getBytes(StandardCharsets.UTF_8));
+        data.writeTo(out);
+        out.flush();
+    }
+
+    // Keepalive reply: <result>\n<size>\n followed by <size> bytes of output
+    static String readFramedReply(InputStream in) throws IOException {
+        int result = Integer.parseInt(readLine(in));
+        int size = Integer.parseInt(readLine(in));
+        String output = new String(in.readNBytes(size), StandardCharsets.UTF_8);
+        if (result != 0) {
+            throw new RuntimeException("Operation failed with " + result + ": " + output);
+        }
+        return output;
+    }
+
+    static String readLine(InputStream in) throws IOException {
+        StringBuilder sb = new StringBuilder();
+        int c;
+        while ((c = in.read()) != '\n') {
+            if (c == -1) {
+                throw new RuntimeException("Connection closed, read \"" + sb + "\"");
+            }
+            sb.append((char)c);
+        }
+        return sb.toString();
+    }
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test of diagnostic command GC.class_histogram -concurrent with G1
+ * @requires vm.gc.G1
+ * @library /test/lib /
+ * @build   jdk.test.whitebox.WhiteBox
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ *          jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @run     driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run main/othervm -XX:+UseG1GC -Xlog:gc+classhisto=info:file=classhisto.log
+ *                   -Xlog:gc+phases=debug
+ *                   -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   ClassHistogramConcurrentTest
+ */
+
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.List;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.whitebox.WhiteBox;
+
+public class ClassHistogramConcurrentTest {
+    private static final int COUNT = 1000;
+
+    static class Marked {
+    }
+
+    private static Object[] keep;
+
+    public static void main(String[] args) throws Exception {
+        PidJcmdExecutor executor = new PidJcmdExecutor();
+
+        OutputAnalyzer output = executor.execute("GC.class_histogram -concurrent -all");
+        output.shouldContain("-all and -parallel cannot be used with -concurrent.");
+
+        keep = new Object[COUNT];
+        for (int i = 0; i < COUNT; i++) {
+            keep[i] = new Marked();
+        }
+        // Concurrent marking does not count objects in young regions.
+        System.gc();
+
+        output = executor.execute("GC.class_histogram -concurrent");
+        output.shouldContain("Class histogram requested from the next concurrent marking cycle");
+        output.shouldNotContain("currently disabled");
+
+        WhiteBox.getWhiteBox().g1RunConcurrentGC();
+
+        List<String> lines = Files.readAllLines(Path.of("classhisto.log"));
+        Asserts.assertTrue(lines.stream().anyMatch(l -> l.contains("Class histogram of the objects marked by concurrent marking.")
+                                                        && l.contains("Objects in young regions")),
+                           "No labelled class histogram logged");
+
+        // "  num:  #instances  #bytes  class name"
+        Pattern p = Pattern.compile("\\d+:\\s+(\\d+)\\s+\\d+\\s+" + Pattern.quote(Marked.class.getName()) + "(\\s|$)");
+        long instances = -1;
+        for (String line : lines) {
+            Matcher m = p.matcher(line);
+            if (m.find()) {
+                instances = Long.parseLong(m.group(1));
+            }
+        }
+        Asserts.assertGTE(instances, (long) COUNT, "Marked instances in the histogram");
+        Asserts.assertNotNull(keep);
+    }
+}
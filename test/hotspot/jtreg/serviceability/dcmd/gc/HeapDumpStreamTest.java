@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test of diagnostic command GC.heap_dump streaming to tcp:// and
+ *          fd:// destinations, and of the -lz4 compressor
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ *          jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @run main/othervm HeapDumpStreamTest
+ */
+
+import java.io.ByteArrayOutputStream;
+import java.io.File;
+import java.io.FileOutputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.net.InetAddress;
+import java.net.ServerSocket;
+import java.net.Socket;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.Paths;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.Platform;
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.hprof.HprofParser;
+import jdk.test.lib.process.OutputAnalyzer;
+
+public class HeapDumpStreamTest {
+
+    private static final PidJcmdExecutor executor = new PidJcmdExecutor();
+
+    public static void main(String[] args) throws Exception {
+        testTcp();
+        if (Platform.isLinux()) {
+            testFd();
+        }
+        testLZ4(1);
+        testLZ4(4);
+    }
+
+    private static void testTcp() throws Exception {
+        File dump = new File("stream-tcp.hprof");
+        try (ServerSocket server = new ServerSocket(0, 1, InetAddress.getLoopbackAddress())) {
+            Thread reader = new Thread(() -> {
+                try (Socket s = server.accept();
+                     InputStream in = s.getInputStream()) {
+                    Files.copy(in, dump.toPath());
+                } catch (IOException e) {
+                    throw new RuntimeException(e);
+                }
+            });
+            reader.start();
+            OutputAnalyzer output = executor.execute("GC.heap_dump tcp://127.0.0.1:" + server.getLocalPort());
+            output.shouldContain("Heap dump file created");
+            reader.join();
+        }
+        verifyDump(dump);
+    }
+
+    private static void testFd() throws Exception {
+        File dump = new File("stream-fd.hprof");
+        try (FileOutputStream out = new FileOutputStream(dump)) {
+            int fd = findFd(dump.toPath());
+            OutputAnalyzer output = executor.execute("GC.heap_dump fd://" + fd);
+            output.shouldContain("Heap dump file created");
+        }
+        verifyDump(dump);
+    }
+
+    // Finds the number of the file descriptor this VM has open for the given file.
+    private static int findFd(Path file) throws IOException {
+        Path target = file.toRealPath();
+        try (var fds = Files.newDirectoryStream(Paths.get("/proc/self/fd"))) {
+            for (Path fd : fds) {
+                try {
+                    if (Files.readSymbolicLink(fd).equals(target)) {
+                        return Integer.parseInt(fd.getFileName().toString());
+                    }
+                } catch (IOException e) {
+                    // The descriptor of the directory stream itself, or already closed.
+                }
+            }
+        }
+        throw new RuntimeException("No file descriptor found for " + target);
+    }
+
+    private static void testLZ4(int parallel) throws Exception {
+        File dump = new File("lz4-" + parallel + ".hprof.lz4");
+        OutputAnalyzer output = executor.execute("GC.heap_dump -lz4 -parallel=" + parallel + " " + dump.getAbsolutePath());
+        output.shouldContain("Heap dump file created");
+
+        byte[] compressed = Files.readAllBytes(dump.toPath());
+        File decompressed = new File("lz4-" + parallel + ".hprof");
+        Files.write(decompressed.toPath(), decompressLZ4Frames(compressed));
+        verifyDump(decompressed);
+    }
+
+    private static void verifyDump(File dump) throws Exception {
+        Asserts.assertTrue(dump.exists() && dump.length() > 0, "No heap dump written to " + dump);
+        HprofParser.parse(dump);
+    }
+
+    private static int readIntLE(byte[] b, int pos) {
+        return (b[pos] & 0xff) | (b[pos + 1] & 0xff) << 8 | (b[pos + 2] & 0xff) << 16 | (b[pos + 3] & 0xff) << 24;
+    }
+
+    // Minimal decoder for the LZ4 frames written by the VM: independent blocks,
+    // no block or content checksums, one or more frames back to back.
+    private static byte[] decompressLZ4Frames(byte[] in) {
+        ByteArrayOutputStream out = new ByteArrayOutputStream();
+        int pos = 0;
+        while (pos < in.length) {
+            Asserts.assertEquals(0x184D2204, readIntLE(in, pos), "Bad LZ4 frame magic at " + pos);
+            Asserts.assertEquals(0, in[pos + 4] & 0x1c, "Unexpected LZ4 frame flags");
+            pos += 7;
+            while (true) {
+                int blockSize = readIntLE(in, pos);
+                pos += 4;
+                if (blockSize == 0) {
+                    break;
+                }
+                if (blockSize < 0) {
+                    int size = blockSize & 0x7fffffff;
+                    out.write(in, pos, size);
+                    pos += size;
+                } else {
+                    decompressLZ4Block(in, pos, blockSize, out);
+                    pos += blockSize;
+                }
+            }
+        }
+        return out.toByteArray();
+    }
+
+    private static void decompressLZ4Block(byte[] in, int pos, int size, ByteArrayOutputStream out) {
+        byte[] block = new byte[4 * 1024 * 1024];
+        int op = 0;
+        int end = pos + size;
+        while (pos < end) {
+            int token = in[pos++] & 0xff;
+            int literals = token >>> 4;
+            if (literals == 15) {
+                int b;
+                do {
+                    b = in[pos++] & 0xff;
+                    literals += b;
+                } while (b == 255);
+            }
+            System.arraycopy(in, pos, block, op, literals);
+            pos += literals;
+            op += literals;
+            if (pos >= end) {
+                break;
+            }
+            int offset = (in[pos] & 0xff) | (in[pos + 1] & 0xff) << 8;
+            pos += 2;
+            int match = (token & 0xf) + 4;
+            if ((token & 0xf) == 15) {
+                int b;
+                do {
+                    b = in[pos++] & 0xff;
+                    match += b;
+                } while (b == 255);
+            }
+            for (int i = 0; i < match; i++, op++) {
+                block[op] = block[op - offset];
+            }
+        }
+        out.write(block, 0, op);
+    }
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test of diagnostic command Thread.print -handshake
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run main/othervm PrintHandshakeTest
+ */
+
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.locks.LockSupport;
+
+import jdk.test.lib.dcmd.CommandExecutor;
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+public class PrintHandshakeTest {
+    static final String THREAD_NAME = "PrintHandshakeTest-parked";
+
+    static volatile boolean done;
+
+    static void parkHere(CountDownLatch started) {
+        started.countDown();
+        while (!done) {
+            LockSupport.park();
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        CountDownLatch started = new CountDownLatch(1);
+        Thread parked = new Thread(() -> parkHere(started), THREAD_NAME);
+        parked.start();
+        started.await();
+
+        try {
+            CommandExecutor executor = new PidJcmdExecutor();
+
+            // The option is known to the parser and documented
+            OutputAnalyzer output = executor.execute("help Thread.print");
+            output.shouldContain("-handshake");
+
+            // Each thread is printed, with its stack
+            output = executor.execute("Thread.print -handshake");
+            output.shouldContain("Full thread dump");
+            output.shouldMatch("\"main\" #\\d+");
+            output.shouldMatch("\"" + THREAD_NAME + "\" #\\d+");
+            output.shouldContain("PrintHandshakeTest.parkHere");
+            output.shouldContain("java.lang.Thread.State: WAITING (parking)");
+            // The safepoint operations are skipped
+            output.shouldNotContain("JNI global refs");
+
+            // The option parses together with -e
+            output = executor.execute("Thread.print -handshake -e");
+            output.shouldMatch("\"" + THREAD_NAME + "\" #\\d+");
+
+            // Concurrent locks need a safepoint
+            output = executor.execute("Thread.print -handshake -l");
+            output.shouldContain("The -l option can not be used with -handshake");
+            output.shouldNotContain("Full thread dump");
+        } finally {
+            done = true;
+            LockSupport.unpark(parked);
+            parked.join();
+        }
+    }
+}
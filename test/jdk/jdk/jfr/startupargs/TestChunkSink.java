@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package jdk.jfr.startupargs;
+
+import java.io.DataInputStream;
+import java.io.EOFException;
+import java.io.IOException;
+import java.net.StandardProtocolFamily;
+import java.net.UnixDomainSocketAddress;
+import java.nio.channels.Channels;
+import java.nio.channels.ServerSocketChannel;
+import java.nio.channels.SocketChannel;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.Arrays;
+import java.util.concurrent.atomic.AtomicReference;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+/**
+ * @test
+ * @summary Test -XX:FlightRecorderOptions:chunksink, the mirroring of chunk
+ *          segments to a UNIX-domain socket, with a reading and a stalled peer
+ * @requires vm.hasJFR & os.family != "windows"
+ * @library /test/lib
+ * @modules jdk.jfr
+ * @run main/othervm jdk.jfr.startupargs.TestChunkSink
+ */
+public class TestChunkSink {
+    private static final int CHUNK_BEGIN = 1;
+    private static final int SEGMENT = 2;
+    private static final int CHUNK_END = 3;
+
+    public static class Workload {
+        public static void main(String... args) throws Exception {
+            // Enough events for the recorder to flush several segments
+            for (int i = 0; i < 200; i++) {
+                byte[][] garbage = new byte[1000][];
+                for (int j = 0; j < garbage.length; j++) {
+                    garbage[j] = new byte[1024];
+                }
+                Thread.sleep(5);
+            }
+        }
+    }
+
+    public static void main(String... args) throws Exception {
+        testReadingPeer();
+        testStalledPeer();
+    }
+
+    // A peer that reads all records can rebuild a complete chunk.
+    private static void testReadingPeer() throws Exception {
+        Path socket = Path.of("chunksink-read.sock");
+        Files.deleteIfExists(socket);
+        AtomicReference<byte[]> chunk = new AtomicReference<>();
+        AtomicReference<Throwable> error = new AtomicReference<>();
+        try (ServerSocketChannel server = ServerSocketChannel.open(StandardProtocolFamily.UNIX)) {
+            server.bind(UnixDomainSocketAddress.of(socket));
+            Thread reader = new Thread(() -> {
+                try (SocketChannel peer = server.accept()) {
+                    chunk.set(readChunk(new DataInputStream(Channels.newInputStream(peer))));
+                } catch (Throwable t) {
+                    error.set(t);
+                }
+            });
+            reader.start();
+            OutputAnalyzer output = runWorkload(socket);
+            output.shouldHaveExitValue(0);
+            output.shouldContain("Connected to chunk sink");
+            reader.join();
+        } finally {
+            Files.deleteIfExists(socket);
+        }
+        if (error.get() != null) {
+            throw new RuntimeException("Reading the chunk sink failed", error.get());
+        }
+        byte[] bytes = chunk.get();
+        Asserts.assertNotNull(bytes, "No complete chunk received");
+        Asserts.assertTrue(Arrays.equals(Arrays.copyOf(bytes, 4), new byte[] { 'F', 'L', 'R', 0 }),
+                           "Chunk does not start with the chunk magic");
+    }
+
+    // A peer that never reads must not hold up the recorder, including its
+    // safepoint operations, and is disconnected instead.
+    private static void testStalledPeer() throws Exception {
+        Path socket = Path.of("chunksink-stall.sock");
+        Files.deleteIfExists(socket);
+        try (ServerSocketChannel server = ServerSocketChannel.open(StandardProtocolFamily.UNIX)) {
+            server.bind(UnixDomainSocketAddress.of(socket));
+            AtomicReference<SocketChannel> peer = new AtomicReference<>();
+            Thread acceptor = new Thread(() -> {
+                try {
+                    peer.set(server.accept());
+                } catch (IOException e) {
+                    // The workload did not connect, reported below
+                }
+            });
+            acceptor.start();
+            OutputAnalyzer output = runWorkload(socket);
+            output.shouldHaveExitValue(0);
+            output.shouldContain("Connected to chunk sink");
+            output.shouldContain("does not keep up, disconnected");
+            acceptor.join();
+            if (peer.get() != null) {
+                peer.get().close();
+            }
+        } finally {
+            Files.deleteIfExists(socket);
+        }
+    }
+
+    private static OutputAnalyzer runWorkload(Path socket) throws Exception {
+        return ProcessTools.executeTestJava(
+                "-XX:StartFlightRecording:settings=profile",
+                "-XX:FlightRecorderOptions:chunksink=" + socket.toAbsolutePath(),
+                "-Xlog:jfr+system=debug",
+                Workload.class.getName());
+    }
+
+    // Reads records until the first chunk ends and returns its bytes, or
+    // returns null if the connection closed before that.
+    private static byte[] readChunk(DataInputStream in) throws IOException {
+        byte[] chunk = new byte[0];
+        try {
+            Asserts.assertEquals(CHUNK_BEGIN, in.readUnsignedByte(), "Expected CHUNK_BEGIN");
+            in.readLong();
+            in.readLong();
+            while (true) {
+                int type = in.readUnsignedByte();
+                long offset = in.readLong();
+                long length = in.readLong();
+                if (type == CHUNK_END) {
+                    Asserts.assertEquals((long) chunk.length, length, "Chunk size in CHUNK_END");
+                    return chunk;
+                }
+                Asserts.assertEquals(SEGMENT, type, "Expected SEGMENT");
+                byte[] segment = new byte[(int) length];
+                in.readFully(segment);
+                if (offset + length > chunk.length) {
+                    chunk = Arrays.copyOf(chunk, (int) (offset + length));
+                }
+                System.arraycopy(segment, 0, chunk, (int) offset, (int) length);
+            }
+        } catch (EOFException e) {
+            return null;
+        }
+    }
+}